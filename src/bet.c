@@ -24,8 +24,10 @@
 */
 
 #include "bet.h"
+#include "file.h"
 #include "finance.h"
 #include "fixture.h"
+#include "free.h"
 #include "game_gui.h"
 #include "league.h"
 #include "main.h"
@@ -135,56 +137,172 @@ bet_update_user_bets(void)
     }
 }
 
-/** Calculate the odds for the bet. */
+/** The names of the outcomes in the betting odds file. */
+static const gchar *bet_odds_outcome_names[3] = {"win", "draw", "loss"};
+
+/** Load the betting odds table from the odds file
+    in the support directories. */
 void
-bet_get_odds(BetMatch *bet)
+bet_load_odds_table(void)
 {
 #ifdef DEBUG
-    printf("bet_get_odds\n");
+    printf("bet_load_odds_table\n");
 #endif
 
-    const Fixture *fix = fixture_from_id(bet->fix_id, TRUE);
-    gfloat home_advantage = (fix->home_advantage) ?
-	(const_float("float_game_home_advantage_lower") +
-	 const_float("float_game_home_advantage_upper")) / 2 : 0;
-    gfloat av_skill[2] = {0, 0}, skilldiff;
-    gint i, j, better_idx;
+    gint i, j, steps;
+    gchar name[SMALL];
+    BetOddsStep new;
+    OptionList table = {NULL, NULL, NULL};
+
+    file_load_opt_file(BET_ODDS_FILE, &table, FALSE);
 
-    for(i=0;i<2;i++)
+    steps = option_int("int_bet_odds_steps", &table);
+    if(steps < 1)
+	main_exit_program(EXIT_BET_ERROR,
+			  "bet_load_odds_table: the odds table is empty.");
+
+    g_array_set_size(bet_odds_table, 0);
+    for(i=0;i<steps;i++)
     {
-	for(j=0;j<11;j++)
-	    av_skill[i] += 
-		player_get_game_skill(player_of_idx_team(fix->teams[i], j),
-				      FALSE, TRUE);
+	sprintf(name, "float_bet_odds_skilldiff_%d", i);
+	new.skilldiff = option_float(name, &table);
+
+	for(j=0;j<3;j++)
+	{
+	    sprintf(name, "float_bet_odds_%s_%d", bet_odds_outcome_names[j], i);
+	    new.probs[j] = option_float(name, &table);
+	}
 
-	av_skill[i] /= 11;
+	g_array_append_val(bet_odds_table, new);
     }
 
-    av_skill[0] *= (1 + home_advantage);
+    free_option_list(&table, FALSE);
+}
+
+/** Save the betting odds table.
+    @param filename The full path of the file. */
+void
+bet_save_odds_table(const gchar *filename)
+{
+#ifdef DEBUG
+    printf("bet_save_odds_table\n");
+#endif
+
+    gint i, j;
+    gchar name[SMALL];
+    OptionList table = {NULL, NULL, NULL};
+
+    option_add(&table, "int_bet_odds_steps", bet_odds_table->len, NULL);
+
+    for(i=0;i<bet_odds_table->len;i++)
+    {
+	sprintf(name, "float_bet_odds_skilldiff_%d", i);
+	option_add(&table, name,
+		   (gint)rint(g_array_index(bet_odds_table, BetOddsStep, i).skilldiff *
+			      OPTION_FLOAT_DIVISOR), NULL);
+
+	for(j=0;j<3;j++)
+	{
+	    sprintf(name, "float_bet_odds_%s_%d", bet_odds_outcome_names[j], i);
+	    option_add(&table, name,
+		       (gint)rint(g_array_index(bet_odds_table, BetOddsStep, i).probs[j] *
+				  OPTION_FLOAT_DIVISOR), NULL);
+	}
+    }
+
+    file_save_opt_file(filename, &table);
+    free_option_list(&table, FALSE);
+}
 
-    skilldiff = ABS(av_skill[0] - av_skill[1]);
+/** Return the average game skill of the first eleven players
+    of a team, the measure the betting odds table uses. */
+gfloat
+bet_get_average_skill(const Team *tm)
+{
+#ifdef DEBUG
+    printf("bet_get_average_skill\n");
+#endif
+
+    gint i;
+    gfloat skill = 0;
+
+    for(i=0;i<11;i++)
+	skill += player_get_game_skill(player_of_idx_team(tm, i), FALSE, TRUE);
+
+    return skill / 11;
+}
+
+/** Fill in the probabilities of a win, draw or loss of the better
+    team by interpolating the betting odds table linearly. */
+static void
+bet_get_probs(gfloat skilldiff, gfloat *probs)
+{
+#ifdef DEBUG
+    printf("bet_get_probs\n");
+#endif
+
+    gint i, j;
+    const BetOddsStep *lower = NULL, *upper = NULL;
+    gfloat weight;
+
+    for(i=0;i<bet_odds_table->len;i++)
+	if(g_array_index(bet_odds_table, BetOddsStep, i).skilldiff >= skilldiff)
+	    break;
+
+    /* Beyond the table we take the first or last step. */
+    if(i == 0 || i == bet_odds_table->len)
+    {
+	upper = &g_array_index(bet_odds_table, BetOddsStep, MIN(i, bet_odds_table->len - 1));
+	for(j=0;j<3;j++)
+	    probs[j] = upper->probs[j];
+	return;
+    }
+
+    lower = &g_array_index(bet_odds_table, BetOddsStep, i - 1);
+    upper = &g_array_index(bet_odds_table, BetOddsStep, i);
+    weight = (upper->skilldiff > lower->skilldiff) ?
+	(skilldiff - lower->skilldiff) / (upper->skilldiff - lower->skilldiff) : 1;
+
+    for(j=0;j<3;j++)
+	probs[j] = lower->probs[j] + weight * (upper->probs[j] - lower->probs[j]);
+}
+
+/** Calculate the odds for the bet. The probabilities of the
+    outcomes come from the betting odds table, which goes with
+    the difference of the average skills of the teams.
+    @see bet_get_probs() */
+void
+bet_get_odds(BetMatch *bet)
+{
+#ifdef DEBUG
+    printf("bet_get_odds\n");
+#endif
+
+    const Fixture *fix = fixture_from_id(bet->fix_id, TRUE);
+    gfloat home_advantage = (fix->home_advantage) ?
+	(const_float(float_game_home_advantage_lower) +
+	 const_float(float_game_home_advantage_upper)) / 2 : 0;
+    gfloat av_skill[2] = {bet_get_average_skill(fix->teams[0]),
+			  bet_get_average_skill(fix->teams[1])};
+    gfloat probs[3];
+    gint i, better_idx;
+
+    av_skill[0] *= (1 + home_advantage);
 
     better_idx = 2 * (av_skill[0] < av_skill[1]);
 
-    bet->odds[better_idx] = 
-	0.33 + skilldiff * const_float("float_bet_better_factor");
-    bet->odds[2 - better_idx] = 
-	0.33 + skilldiff * const_float("float_bet_worse_factor");
-
-    for(i=0;i<2;i++)
-	bet->odds[i * 2] = CLAMP(bet->odds[i * 2],
-				 const_float("float_bet_lower_limit"),
-				 1 - const_float("float_bet_lower_limit"));
-    
-    bet->odds[1] = (1 - bet->odds[0] - bet->odds[2]);
-    bet->odds[1] = CLAMP(bet->odds[1],
-			 const_float("float_bet_lower_limit"),
-			 1 - const_float("float_bet_lower_limit"));
+    bet_get_probs(ABS(av_skill[0] - av_skill[1]), probs);
+
+    bet->odds[better_idx] = probs[0];
+    bet->odds[1] = probs[1];
+    bet->odds[2 - better_idx] = probs[2];
 
     for(i=0;i<3;i++)
 	bet->odds[i] = 
-	    bet_round_odd((1 / bet->odds[i]) * 
-			  (1 - const_float("float_bet_commission_decrease")));
+	    bet_round_odd((1 / CLAMP(bet->odds[i],
+				     const_float(float_bet_lower_limit),
+				     1 - const_float(float_bet_lower_limit))) * 
+			  (1 - const_float(float_bet_commission_decrease)));
 }
 
 /** Write the bets for the current week round. */
@@ -250,7 +368,7 @@ bet_place(gint fix_id, gint outcome, gint wager)
 #endif
 
     gint max_wager = (gint)rint(finance_wage_unit(current_user.tm) * 
-				const_float("float_bet_wager_limit_factor"));
+				const_float(float_bet_wager_limit_factor));
     BetUser new_bet;
     gchar buf[SMALL];
 
@@ -29,6 +29,11 @@
 #include "bet_struct.h"
 #include "bygfoot.h"
 #include "fixture_struct.h"
+#include "team_struct.h"
+
+/** The file with the betting odds table.
+    @see debug_calibrate_betting_odds() */
+#define BET_ODDS_FILE "bygfoot_bet_odds"
 
 BetMatch*
 bet_from_fixture(gint fix_id);
@@ -36,6 +41,15 @@ bet_from_fixture(gint fix_id);
 void
 bet_update_user_bets(void);
 
+void
+bet_load_odds_table(void);
+
+void
+bet_save_odds_table(const gchar *filename);
+
+gfloat
+bet_get_average_skill(const Team *tm);
+
 void
 bet_get_odds(BetMatch *bet);
 
@@ -39,6 +39,17 @@ typedef struct
     
 } BetMatch;
 
+/** A step of the betting odds table: the probabilities of a
+    win, draw or loss of the better team at a skill difference.
+    @see bet_get_odds() */
+typedef struct
+{
+    /** The difference of the average skills of the teams. */
+    gfloat skilldiff;
+    /** The probabilities of a win, draw or loss. */
+    gfloat probs[3];
+} BetOddsStep;
+
 /** A struct representing a bet by a user. */
 typedef struct
 {
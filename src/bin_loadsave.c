@@ -0,0 +1,1464 @@
+/*
+   bin_loadsave.c
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <string.h>
+
+#include "bet_struct.h"
+#include "bin_loadsave.h"
+#include "cup_struct.h"
+#include "debug.h"
+#include "job_struct.h"
+#include "league_struct.h"
+#include "misc.h"
+#include "name.h"
+#include "option.h"
+#include "snapshot.h"
+#include "transfer_struct.h"
+#include "user.h"
+#include "variables.h"
+
+/* The binary savegame is the game state as it is in memory:
+
+   - a header with the magic string, the format version, a byte
+     order mark and the sizes of the structs below, so that files
+     from builds with a different struct layout get rejected;
+   - a string table; every string is stored once and referenced
+     by its index (0 stands for NULL);
+   - the structs, written with memcpy. String pointers in them
+     are replaced by their indices, the arrays a struct owns follow
+     after it (length-prefixed) and pointers to other objects keep
+     the address they had when the game was saved.
+
+   When loading, the addresses of the objects that can be pointed
+   to are recorded in a hash table mapping the old addresses to the
+   new ones, which snapshot_relink() then uses to fix the pointers. */
+
+#define BIN_LOADSAVE_MAGIC "BYGFOOTB"
+#define BIN_LOADSAVE_BYTE_ORDER 0x01020304
+
+/** The sizes of the structs written to the file. */
+static const guint32 bin_loadsave_layout[] =
+{
+    sizeof(gpointer), sizeof(gint), sizeof(gfloat),
+    sizeof(Snapshot), sizeof(Country), sizeof(League), sizeof(Cup),
+    sizeof(CupRound), sizeof(CupChooseTeam), sizeof(Team), sizeof(Player),
+    sizeof(PlayerCompetitionStats), sizeof(Fixture), sizeof(Table),
+    sizeof(TableElement), sizeof(User), sizeof(Event), sizeof(LiveGameUnit),
+    sizeof(MemMatch), sizeof(Transfer), sizeof(TransferOffer),
+    sizeof(NewsPaperArticle), sizeof(SeasonStat), sizeof(LeagueStat),
+    sizeof(Stat), sizeof(Job), sizeof(Option)
+};
+
+typedef struct
+{
+    GByteArray *body;
+    /** Mapping strings to their indices in the string table. */
+    GHashTable *string_ids;
+    GPtrArray *strings;
+} BinWriter;
+
+typedef struct
+{
+    const gchar *data;
+    gsize len, pos;
+    /** Pointers into the data. */
+    GPtrArray *strings;
+    /** Mapping old object addresses to new ones. */
+    GHashTable *map;
+    Bygfoot *bygfoot;
+    Snapshot *snapshot;
+    /** Set when the file turns out to be truncated or
+	corrupt; all reads return zeros from then on. */
+    gboolean error;
+} BinReader;
+
+/** Replace the strings in a copy of a struct by their ids. */
+typedef void (*BinSwizzleFunc)(BinWriter *writer, gpointer copy);
+/** Write the things a struct owns. */
+typedef void (*BinSaveFunc)(BinWriter *writer, gconstpointer object);
+/** Restore the strings of a struct just read and
+    read the things it owns. */
+typedef void (*BinLoadFunc)(BinReader *reader, gpointer object);
+
+static void
+bin_save_raw(BinWriter *writer, gconstpointer data, gsize size)
+{
+    g_byte_array_append(writer->body, data, size);
+}
+
+static void
+bin_save_int(BinWriter *writer, gint value)
+{
+    gint32 value32 = value;
+
+    bin_save_raw(writer, &value32, sizeof(gint32));
+}
+
+static void
+bin_save_ptr(BinWriter *writer, gconstpointer ptr)
+{
+    bin_save_raw(writer, &ptr, sizeof(gpointer));
+}
+
+/** Return the id of the string in the string table,
+    adding the string if necessary. */
+static gint
+bin_save_string_id(BinWriter *writer, const gchar *string)
+{
+    gint id;
+
+    if(string == NULL)
+	return 0;
+
+    id = GPOINTER_TO_INT(g_hash_table_lookup(writer->string_ids, string));
+    if(id == 0)
+    {
+	g_ptr_array_add(writer->strings, (gpointer)string);
+	id = writer->strings->len;
+	g_hash_table_insert(writer->string_ids, (gpointer)string, GINT_TO_POINTER(id));
+    }
+
+    return id;
+}
+
+#define bin_save_swizzle(writer, string) \
+    ((string) = GINT_TO_POINTER(bin_save_string_id(writer, string)))
+
+/** Write an array of structs: the length (-1 for NULL), the element
+    size, the address of the data, the elements and then the things
+    the elements own. */
+static void
+bin_save_array(BinWriter *writer, const GArray *array,
+	       BinSwizzleFunc swizzle, BinSaveFunc save)
+{
+    gint i;
+    gsize size;
+    gchar *copy;
+
+    if(array == NULL)
+    {
+	bin_save_int(writer, -1);
+	return;
+    }
+
+    size = g_array_get_element_size((GArray*)array);
+    bin_save_int(writer, array->len);
+    bin_save_int(writer, size);
+    bin_save_ptr(writer, array->data);
+
+    if(swizzle == NULL)
+	bin_save_raw(writer, array->data, size * array->len);
+    else
+    {
+	copy = g_malloc(size * array->len + 1);
+	memcpy(copy, array->data, size * array->len);
+	for(i=0;i<array->len;i++)
+	    swizzle(writer, copy + i * size);
+	bin_save_raw(writer, copy, size * array->len);
+	g_free(copy);
+    }
+
+    if(save != NULL)
+	for(i=0;i<array->len;i++)
+	    save(writer, array->data + i * size);
+}
+
+/** Write a struct allocated on its own, preceded by its address. */
+static void
+bin_save_object(BinWriter *writer, gconstpointer object, gsize size,
+		BinSwizzleFunc swizzle, BinSaveFunc save)
+{
+    gpointer copy = g_malloc(size);
+
+    memcpy(copy, object, size);
+    swizzle(writer, copy);
+
+    bin_save_ptr(writer, object);
+    bin_save_raw(writer, copy, size);
+    g_free(copy);
+
+    save(writer, object);
+}
+
+static void
+bin_save_objects(BinWriter *writer, const GPtrArray *objects, gsize size,
+		 BinSwizzleFunc swizzle, BinSaveFunc save)
+{
+    gint i;
+
+    bin_save_int(writer, (objects == NULL) ? -1 : objects->len);
+    if(objects != NULL)
+	for(i=0;i<objects->len;i++)
+	    bin_save_object(writer, g_ptr_array_index(objects, i), size, swizzle, save);
+}
+
+/** Write a pointer array referencing objects stored elsewhere. */
+static void
+bin_save_refs(BinWriter *writer, const GPtrArray *refs)
+{
+    bin_save_int(writer, (refs == NULL) ? -1 : refs->len);
+    if(refs != NULL)
+	bin_save_raw(writer, refs->pdata, refs->len * sizeof(gpointer));
+}
+
+/** Write a pointer array containing strings. */
+static void
+bin_save_strings(BinWriter *writer, const GPtrArray *strings)
+{
+    gint i;
+
+    bin_save_int(writer, (strings == NULL) ? -1 : strings->len);
+    if(strings != NULL)
+	for(i=0;i<strings->len;i++)
+	    bin_save_int(writer,
+			 bin_save_string_id(writer, g_ptr_array_index(strings, i)));
+}
+
+static void
+bin_save_swizzle_option(BinWriter *writer, gpointer copy)
+{
+    Option *option = copy;
+
+    bin_save_swizzle(writer, option->name);
+    bin_save_swizzle(writer, option->string_value);
+}
+
+static void
+bin_save_option_list(BinWriter *writer, const OptionList *optionlist)
+{
+    bin_save_array(writer, optionlist->list, bin_save_swizzle_option, NULL);
+}
+
+static void
+bin_save_swizzle_stat(BinWriter *writer, gpointer copy)
+{
+    Stat *stat = copy;
+
+    bin_save_swizzle(writer, stat->team_name);
+    bin_save_swizzle(writer, stat->value_string);
+}
+
+static void
+bin_save_swizzle_champ(BinWriter *writer, gpointer copy)
+{
+    ChampStat *champ = copy;
+
+    bin_save_swizzle(writer, champ->team_name);
+    bin_save_swizzle(writer, champ->cl_name);
+}
+
+static void
+bin_save_swizzle_league_stat(BinWriter *writer, gpointer copy)
+{
+    LeagueStat *stats = copy;
+
+    bin_save_swizzle(writer, stats->league_symbol);
+    bin_save_swizzle(writer, stats->league_name);
+}
+
+static void
+bin_save_league_stat(BinWriter *writer, gconstpointer object)
+{
+    const LeagueStat *stats = object;
+
+    bin_save_array(writer, stats->teams_off, bin_save_swizzle_stat, NULL);
+    bin_save_array(writer, stats->teams_def, bin_save_swizzle_stat, NULL);
+    bin_save_array(writer, stats->player_scorers, bin_save_swizzle_stat, NULL);
+    bin_save_array(writer, stats->player_goalies, bin_save_swizzle_stat, NULL);
+}
+
+static void
+bin_save_season_stat(BinWriter *writer, gconstpointer object)
+{
+    const SeasonStat *stat = object;
+
+    bin_save_array(writer, stat->league_champs, bin_save_swizzle_champ, NULL);
+    bin_save_array(writer, stat->cup_champs, bin_save_swizzle_champ, NULL);
+    bin_save_array(writer, stat->league_stats,
+		   bin_save_swizzle_league_stat, bin_save_league_stat);
+}
+
+static void
+bin_save_swizzle_player(BinWriter *writer, gpointer copy)
+{
+    bin_save_swizzle(writer, ((Player*)copy)->name);
+}
+
+static void
+bin_save_player(BinWriter *writer, gconstpointer object)
+{
+    bin_save_array(writer, ((const Player*)object)->stats, NULL, NULL);
+    bin_save_array(writer, ((const Player*)object)->stats_slots, NULL, NULL);
+}
+
+static void
+bin_save_swizzle_team(BinWriter *writer, gpointer copy)
+{
+    Team *tm = copy;
+
+    bin_save_swizzle(writer, tm->name);
+    bin_save_swizzle(writer, tm->symbol);
+    bin_save_swizzle(writer, tm->names_file);
+    bin_save_swizzle(writer, tm->def_file);
+    bin_save_swizzle(writer, tm->strategy_sid);
+    bin_save_swizzle(writer, tm->stadium.name);
+}
+
+static void
+bin_save_team(BinWriter *writer, gconstpointer object)
+{
+    bin_save_array(writer, ((const Team*)object)->players,
+		   bin_save_swizzle_player, bin_save_player);
+}
+
+static void
+bin_save_swizzle_table(BinWriter *writer, gpointer copy)
+{
+    bin_save_swizzle(writer, ((Table*)copy)->name);
+}
+
+static void
+bin_save_table(BinWriter *writer, gconstpointer object)
+{
+    bin_save_array(writer, ((const Table*)object)->elements, NULL, NULL);
+}
+
+static void
+bin_save_swizzle_prom_rel_element(BinWriter *writer, gpointer copy)
+{
+    bin_save_swizzle(writer, ((PromRelElement*)copy)->dest_sid);
+}
+
+static void
+bin_save_swizzle_prom_games(BinWriter *writer, gpointer copy)
+{
+    PromGames *games = copy;
+
+    bin_save_swizzle(writer, games->dest_sid);
+    bin_save_swizzle(writer, games->loser_sid);
+    bin_save_swizzle(writer, games->cup_sid);
+}
+
+static void
+bin_save_swizzle_joined_league(BinWriter *writer, gpointer copy)
+{
+    bin_save_swizzle(writer, ((JoinedLeague*)copy)->sid);
+}
+
+static void
+bin_save_swizzle_new_table(BinWriter *writer, gpointer copy)
+{
+    bin_save_swizzle(writer, ((NewTable*)copy)->name);
+}
+
+static void
+bin_save_swizzle_league(BinWriter *writer, gpointer copy)
+{
+    League *league = copy;
+
+    bin_save_swizzle(writer, league->c.name);
+    bin_save_swizzle(writer, league->short_name);
+    bin_save_swizzle(writer, league->sid);
+    bin_save_swizzle(writer, league->symbol);
+    bin_save_swizzle(writer, league->names_file);
+    bin_save_swizzle_league_stat(writer, &league->stats);
+}
+
+static void
+bin_save_league(BinWriter *writer, gconstpointer object)
+{
+    const League *league = object;
+
+    bin_save_objects(writer, league->c.teams, sizeof(Team),
+		     bin_save_swizzle_team, bin_save_team);
+    bin_save_array(writer, league->prom_rel.elements,
+		   bin_save_swizzle_prom_rel_element, NULL);
+    bin_save_array(writer, league->prom_rel.prom_games,
+		   bin_save_swizzle_prom_games, NULL);
+    bin_save_array(writer, league->two_match_weeks[0], NULL, NULL);
+    bin_save_array(writer, league->two_match_weeks[1], NULL, NULL);
+    bin_save_array(writer, league->rr_breaks, NULL, NULL);
+    bin_save_array(writer, league->joined_leagues,
+		   bin_save_swizzle_joined_league, NULL);
+    bin_save_array(writer, league->tables, bin_save_swizzle_table, bin_save_table);
+    bin_save_array(writer, league->new_tables, bin_save_swizzle_new_table, NULL);
+    bin_save_array(writer, league->fixtures, NULL, NULL);
+    bin_save_strings(writer, league->properties);
+    bin_save_array(writer, league->week_breaks, NULL, NULL);
+    bin_save_league_stat(writer, &league->stats);
+    bin_save_strings(writer, league->skip_weeks_with);
+}
+
+static void
+bin_save_swizzle_choose_team(BinWriter *writer, gpointer copy)
+{
+    bin_save_swizzle(writer, ((CupChooseTeam*)copy)->sid);
+}
+
+/** Write the rest of a choose team chain. */
+static void
+bin_save_choose_team(BinWriter *writer, gconstpointer object)
+{
+    gint len = 0;
+    const CupChooseTeam *ct;
+    CupChooseTeam copy;
+
+    for(ct = ((const CupChooseTeam*)object)->next; ct != NULL; ct = ct->next)
+	len++;
+
+    bin_save_int(writer, len);
+    for(ct = ((const CupChooseTeam*)object)->next; ct != NULL; ct = ct->next)
+    {
+	copy = *ct;
+	bin_save_swizzle_choose_team(writer, &copy);
+	bin_save_raw(writer, &copy, sizeof(CupChooseTeam));
+    }
+}
+
+static void
+bin_save_swizzle_round_wait(BinWriter *writer, gpointer copy)
+{
+    bin_save_swizzle(writer, ((CupRoundWait*)copy)->cup_sid);
+}
+
+static void
+bin_save_swizzle_cup_round(BinWriter *writer, gpointer copy)
+{
+    bin_save_swizzle(writer, ((CupRound*)copy)->name);
+}
+
+static void
+bin_save_cup_round(BinWriter *writer, gconstpointer object)
+{
+    const CupRound *round = object;
+
+    bin_save_array(writer, round->rr_breaks, NULL, NULL);
+    bin_save_array(writer, round->two_match_weeks[0], NULL, NULL);
+    bin_save_array(writer, round->two_match_weeks[1], NULL, NULL);
+    bin_save_refs(writer, round->team_ptrs);
+    bin_save_array(writer, round->choose_teams,
+		   bin_save_swizzle_choose_team, bin_save_choose_team);
+    bin_save_array(writer, round->tables, bin_save_swizzle_table, bin_save_table);
+    bin_save_array(writer, round->waits, bin_save_swizzle_round_wait, NULL);
+}
+
+static void
+bin_save_swizzle_cup(BinWriter *writer, gpointer copy)
+{
+    Cup *cup = copy;
+
+    bin_save_swizzle(writer, cup->c.name);
+    bin_save_swizzle(writer, cup->short_name);
+    bin_save_swizzle(writer, cup->symbol);
+    bin_save_swizzle(writer, cup->sid);
+}
+
+static void
+bin_save_cup(BinWriter *writer, gconstpointer object)
+{
+    gint i;
+    const Cup *cup = object;
+
+    bin_save_refs(writer, cup->c.teams);
+    bin_save_strings(writer, cup->properties);
+    bin_save_array(writer, cup->rounds, bin_save_swizzle_cup_round, bin_save_cup_round);
+    bin_save_refs(writer, cup->bye);
+    bin_save_array(writer, cup->fixtures, NULL, NULL);
+    bin_save_array(writer, cup->week_breaks, NULL, NULL);
+    bin_save_strings(writer, cup->skip_weeks_with);
+
+    bin_save_int(writer, cup->history->len);
+    for(i=0;i<cup->history->len;i++)
+	bin_save_refs(writer, g_ptr_array_index(cup->history, i));
+}
+
+static void
+bin_save_swizzle_country(BinWriter *writer, gpointer copy)
+{
+    Country *cntry = copy;
+
+    bin_save_swizzle(writer, cntry->name);
+    bin_save_swizzle(writer, cntry->symbol);
+    bin_save_swizzle(writer, cntry->sid);
+}
+
+static void
+bin_save_country(BinWriter *writer, gconstpointer object)
+{
+    const Country *cntry = object;
+
+    bin_save_objects(writer, cntry->leagues, sizeof(League),
+		     bin_save_swizzle_league, bin_save_league);
+    bin_save_objects(writer, cntry->cups, sizeof(Cup),
+		     bin_save_swizzle_cup, bin_save_cup);
+    bin_save_refs(writer, cntry->allcups);
+}
+
+static void
+bin_save_swizzle_unit(BinWriter *writer, gpointer copy)
+{
+    bin_save_swizzle(writer, ((LiveGameUnit*)copy)->event.commentary);
+}
+
+/** Replace the strings of a live game embedded in a copied struct. */
+static void
+bin_save_swizzle_live_game(BinWriter *writer, LiveGame *match)
+{
+    if(match->units == NULL)
+    {
+	match->team_names[0] = match->team_names[1] = NULL;
+	return;
+    }
+
+    bin_save_swizzle(writer, match->team_names[0]);
+    bin_save_swizzle(writer, match->team_names[1]);
+}
+
+static void
+bin_save_live_game(BinWriter *writer, const LiveGame *match)
+{
+    gint i, j;
+
+    if(match->units == NULL)
+	return;
+
+    bin_save_array(writer, match->units, bin_save_swizzle_unit, NULL);
+    for(i=0;i<2;i++)
+    {
+	bin_save_array(writer, match->action_ids[i], NULL, NULL);
+	for(j=0;j<LIVE_GAME_STAT_ARRAY_END;j++)
+	    bin_save_strings(writer, match->stats.players[i][j]);
+    }
+}
+
+static void
+bin_save_swizzle_event(BinWriter *writer, gpointer copy)
+{
+    bin_save_swizzle(writer, ((Event*)copy)->value_string);
+}
+
+static void
+bin_save_swizzle_history(BinWriter *writer, gpointer copy)
+{
+    gint i;
+    UserHistory *history = copy;
+
+    bin_save_swizzle(writer, history->team_name);
+    for(i=0;i<3;i++)
+	bin_save_swizzle(writer, history->string[i]);
+}
+
+static void
+bin_save_swizzle_mmatch(BinWriter *writer, gpointer copy)
+{
+    MemMatch *mmatch = copy;
+
+    bin_save_swizzle(writer, mmatch->country_name);
+    mmatch->competition_name = (mmatch->competition_name == NULL) ? NULL :
+	GINT_TO_POINTER(bin_save_string_id(writer, mmatch->competition_name->str));
+    bin_save_swizzle_live_game(writer, &mmatch->lg);
+}
+
+static void
+bin_save_mmatch(BinWriter *writer, gconstpointer object)
+{
+    bin_save_live_game(writer, &((const MemMatch*)object)->lg);
+}
+
+static void
+bin_save_swizzle_user(BinWriter *writer, gpointer copy)
+{
+    User *user = copy;
+
+    bin_save_swizzle(writer, user->name);
+    bin_save_swizzle(writer, user->mmatches_file);
+    bin_save_swizzle_live_game(writer, &user->live_game);
+    user->sponsor.name = (user->sponsor.name == NULL) ? NULL :
+	GINT_TO_POINTER(bin_save_string_id(writer, user->sponsor.name->str));
+}
+
+static void
+bin_save_user(BinWriter *writer, gconstpointer object)
+{
+    const User *user = object;
+
+    bin_save_option_list(writer, &user->options);
+    bin_save_array(writer, user->events, bin_save_swizzle_event, NULL);
+    bin_save_array(writer, user->history, bin_save_swizzle_history, NULL);
+    bin_save_live_game(writer, &user->live_game);
+    bin_save_array(writer, user->youth_academy.players,
+		   bin_save_swizzle_player, bin_save_player);
+    bin_save_array(writer, user->mmatches, bin_save_swizzle_mmatch, bin_save_mmatch);
+    bin_save_array(writer, user->bets[0], NULL, NULL);
+    bin_save_array(writer, user->bets[1], NULL, NULL);
+    bin_save_array(writer, user->default_team, NULL, NULL);
+}
+
+static void
+bin_save_swizzle_article(BinWriter *writer, gpointer copy)
+{
+    NewsPaperArticle *article = copy;
+
+    bin_save_swizzle(writer, article->title_small);
+    bin_save_swizzle(writer, article->title);
+    bin_save_swizzle(writer, article->subtitle);
+}
+
+static void
+bin_save_transfer(BinWriter *writer, gconstpointer object)
+{
+    bin_save_array(writer, ((const Transfer*)object)->offers, NULL, NULL);
+}
+
+/** National job offers point to the names of the user's
+    country and league; only the league name gets stored. */
+static void
+bin_save_swizzle_job(BinWriter *writer, gpointer copy)
+{
+    Job *job = copy;
+
+    if(job->type != JOB_TYPE_INTERNATIONAL)
+	job->country_file = job->country_name = NULL;
+
+    bin_save_swizzle(writer, job->country_file);
+    bin_save_swizzle(writer, job->country_name);
+    bin_save_swizzle(writer, job->league_name);
+}
+
+static void
+bin_save_snapshot(BinWriter *writer, const Snapshot *snapshot)
+{
+    Snapshot copy = *snapshot;
+
+    bin_save_swizzle_country(writer, &copy.country);
+    copy.rand_generator = NULL;
+
+    bin_save_ptr(writer, &country);
+    bin_save_raw(writer, &copy, sizeof(Snapshot));
+
+    bin_save_country(writer, &snapshot->country);
+    bin_save_objects(writer, snapshot->country_list, sizeof(Country),
+		     bin_save_swizzle_country, bin_save_country);
+    bin_save_objects(writer, snapshot->international_cups, sizeof(Cup),
+		     bin_save_swizzle_cup, bin_save_cup);
+    bin_save_array(writer, snapshot->users, bin_save_swizzle_user, bin_save_user);
+    bin_save_option_list(writer, &snapshot->options);
+    bin_save_option_list(writer, &snapshot->settings);
+    bin_save_array(writer, snapshot->newspaper.articles, bin_save_swizzle_article, NULL);
+    bin_save_array(writer, snapshot->transfer_list, NULL, bin_save_transfer);
+    bin_save_array(writer, snapshot->season_stats, NULL, bin_save_season_stat);
+    bin_save_array(writer, snapshot->bets[0], NULL, NULL);
+    bin_save_array(writer, snapshot->bets[1], NULL, NULL);
+    bin_save_array(writer, snapshot->jobs, bin_save_swizzle_job, NULL);
+}
+
+static void
+bin_save_header_int(GByteArray *data, guint32 value)
+{
+    g_byte_array_append(data, (const guint8*)&value, sizeof(guint32));
+}
+
+/** Write the current game state to the file.
+    @return FALSE if the file couldn't be written. */
+gboolean
+bin_loadsave_write(Bygfoot *bygfoot, const gchar *filename)
+{
+#ifdef DEBUG
+    printf("bin_loadsave_write\n");
+#endif
+
+    gint i;
+    gboolean success;
+    const gchar *string;
+    GError *error = NULL;
+    GByteArray *data = g_byte_array_new();
+    Snapshot current;
+    BinWriter writer;
+
+    writer.body = g_byte_array_new();
+    writer.string_ids = g_hash_table_new(g_str_hash, g_str_equal);
+    writer.strings = g_ptr_array_new();
+
+    snapshot_view(bygfoot, &current);
+    bin_save_snapshot(&writer, &current);
+
+    g_byte_array_append(data, (const guint8*)BIN_LOADSAVE_MAGIC,
+			strlen(BIN_LOADSAVE_MAGIC));
+    bin_save_header_int(data, BIN_LOADSAVE_VERSION);
+    bin_save_header_int(data, BIN_LOADSAVE_BYTE_ORDER);
+    bin_save_header_int(data, G_N_ELEMENTS(bin_loadsave_layout));
+    for(i=0;i<G_N_ELEMENTS(bin_loadsave_layout);i++)
+	bin_save_header_int(data, bin_loadsave_layout[i]);
+
+    bin_save_header_int(data, writer.strings->len);
+    for(i=0;i<writer.strings->len;i++)
+    {
+	string = g_ptr_array_index(writer.strings, i);
+	bin_save_header_int(data, strlen(string));
+	g_byte_array_append(data, (const guint8*)string, strlen(string) + 1);
+    }
+
+    g_byte_array_append(data, writer.body->data, writer.body->len);
+
+    /* g_file_set_contents() writes to a temporary file first, so
+       an interrupted save doesn't destroy the old savegame. */
+    success = g_file_set_contents(filename, (const gchar*)data->data,
+				  data->len, &error);
+    if(!success)
+	misc_print_error(&error, FALSE);
+
+    g_byte_array_free(data, TRUE);
+    g_byte_array_free(writer.body, TRUE);
+    g_hash_table_destroy(writer.string_ids);
+    g_ptr_array_free(writer.strings, TRUE);
+
+    return success;
+}
+
+/** Copy the next bytes of the file to dest. If there aren't
+    enough bytes left, dest gets zeroed and the reader is
+    marked as failed. */
+static gboolean
+bin_load_raw(BinReader *reader, gpointer dest, gsize size)
+{
+    if(reader->error || size > reader->len - reader->pos)
+    {
+	reader->error = TRUE;
+	memset(dest, 0, size);
+	return FALSE;
+    }
+
+    memcpy(dest, reader->data + reader->pos, size);
+    reader->pos += size;
+
+    return TRUE;
+}
+
+static gint
+bin_load_int(BinReader *reader)
+{
+    gint32 value;
+
+    bin_load_raw(reader, &value, sizeof(gint32));
+
+    return value;
+}
+
+static gpointer
+bin_load_ptr(BinReader *reader)
+{
+    gpointer ptr;
+
+    bin_load_raw(reader, &ptr, sizeof(gpointer));
+
+    return ptr;
+}
+
+/** Read an array length; -1 stands for a NULL array. */
+static gint
+bin_load_length(BinReader *reader)
+{
+    gint len = bin_load_int(reader);
+
+    if(len < -1)
+    {
+	reader->error = TRUE;
+	return 0;
+    }
+
+    return len;
+}
+
+/** Return the string with the given id from the string table. */
+static const gchar*
+bin_load_string_ref(BinReader *reader, gint id)
+{
+    if(id == 0)
+	return NULL;
+
+    if(id < 0 || id > reader->strings->len)
+    {
+	reader->error = TRUE;
+	return NULL;
+    }
+
+    return g_ptr_array_index(reader->strings, id - 1);
+}
+
+#define bin_load_unswizzle(reader, string) \
+    ((string) = g_strdup(bin_load_string_ref(reader, GPOINTER_TO_INT(string))))
+
+/** Turn a string id back into a name in the name pool. */
+#define bin_load_unswizzle_name(reader, string) \
+    ((string) = name_intern(bin_load_string_ref(reader, GPOINTER_TO_INT(string))))
+
+/** Read an array written by bin_save_array().
+    @param register_elements Whether pointers to the elements
+    can occur in the file. */
+static GArray*
+bin_load_array(BinReader *reader, gsize size, gboolean register_elements,
+	       BinLoadFunc load)
+{
+    gint i, len = bin_load_length(reader);
+    gchar *old;
+    GArray *array;
+
+    if(len == -1)
+	return NULL;
+
+    if((gsize)bin_load_int(reader) != size)
+    {
+	reader->error = TRUE;
+	len = 0;
+    }
+
+    old = bin_load_ptr(reader);
+    if((guint64)len * size > reader->len - reader->pos)
+    {
+	reader->error = TRUE;
+	len = 0;
+    }
+
+    array = g_array_sized_new(FALSE, FALSE, size, len);
+    g_array_append_vals(array, reader->data + reader->pos, len);
+    reader->pos += len * size;
+
+    for(i=0;i<array->len;i++)
+    {
+	if(register_elements)
+	    g_hash_table_insert(reader->map, old + i * size,
+				array->data + i * size);
+	if(load != NULL)
+	    load(reader, array->data + i * size);
+    }
+
+    return array;
+}
+
+static gpointer
+bin_load_object(BinReader *reader, gsize size, BinLoadFunc load)
+{
+    gpointer old = bin_load_ptr(reader),
+	object = g_malloc(size);
+
+    bin_load_raw(reader, object, size);
+    if(old != NULL)
+	g_hash_table_insert(reader->map, old, object);
+
+    load(reader, object);
+
+    return object;
+}
+
+static GPtrArray*
+bin_load_objects(BinReader *reader, gsize size, BinLoadFunc load)
+{
+    gint i, len = bin_load_length(reader);
+    GPtrArray *objects;
+
+    if(len == -1)
+	return NULL;
+
+    objects = g_ptr_array_new();
+    for(i=0;i<len && !reader->error;i++)
+	g_ptr_array_add(objects, bin_load_object(reader, size, load));
+
+    return objects;
+}
+
+/** Read a pointer array written by bin_save_refs(). The pointers
+    still have to be relinked. */
+static GPtrArray*
+bin_load_refs(BinReader *reader)
+{
+    gint i, len = bin_load_length(reader);
+    GPtrArray *refs;
+
+    if(len == -1)
+	return NULL;
+
+    refs = g_ptr_array_new();
+    for(i=0;i<len && !reader->error;i++)
+	g_ptr_array_add(refs, bin_load_ptr(reader));
+
+    return refs;
+}
+
+static GPtrArray*
+bin_load_strings(BinReader *reader)
+{
+    gint i, len = bin_load_length(reader);
+    GPtrArray *strings;
+
+    if(len == -1)
+	return NULL;
+
+    strings = g_ptr_array_new();
+    for(i=0;i<len && !reader->error;i++)
+	g_ptr_array_add(strings,
+			g_strdup(bin_load_string_ref(reader, bin_load_int(reader))));
+
+    return strings;
+}
+
+static void
+bin_load_option(BinReader *reader, gpointer object)
+{
+    Option *option = object;
+
+    bin_load_unswizzle(reader, option->name);
+    bin_load_unswizzle(reader, option->string_value);
+}
+
+static void
+bin_load_option_list(BinReader *reader, OptionList *optionlist)
+{
+    gint i;
+
+    optionlist->list = bin_load_array(reader, sizeof(Option), FALSE, bin_load_option);
+    optionlist->datalist = NULL;
+    optionlist->ids = NULL;
+
+    if(optionlist->list == NULL)
+	return;
+
+    g_datalist_init(&optionlist->datalist);
+    for(i=0;i<optionlist->list->len;i++)
+	g_datalist_set_data(&optionlist->datalist,
+			    g_array_index(optionlist->list, Option, i).name,
+			    &g_array_index(optionlist->list, Option, i));
+
+    option_list_update_ids(optionlist);
+}
+
+static void
+bin_load_stat(BinReader *reader, gpointer object)
+{
+    Stat *stat = object;
+
+    bin_load_unswizzle_name(reader, stat->team_name);
+    bin_load_unswizzle_name(reader, stat->value_string);
+}
+
+static void
+bin_load_champ(BinReader *reader, gpointer object)
+{
+    ChampStat *champ = object;
+
+    bin_load_unswizzle(reader, champ->team_name);
+    bin_load_unswizzle(reader, champ->cl_name);
+}
+
+static void
+bin_load_league_stat(BinReader *reader, gpointer object)
+{
+    LeagueStat *stats = object;
+
+    bin_load_unswizzle(reader, stats->league_symbol);
+    bin_load_unswizzle(reader, stats->league_name);
+    stats->teams_off = bin_load_array(reader, sizeof(Stat), FALSE, bin_load_stat);
+    stats->teams_def = bin_load_array(reader, sizeof(Stat), FALSE, bin_load_stat);
+    stats->player_scorers = bin_load_array(reader, sizeof(Stat), FALSE, bin_load_stat);
+    stats->player_goalies = bin_load_array(reader, sizeof(Stat), FALSE, bin_load_stat);
+}
+
+static void
+bin_load_season_stat(BinReader *reader, gpointer object)
+{
+    SeasonStat *stat = object;
+
+    stat->league_champs = bin_load_array(reader, sizeof(ChampStat), FALSE, bin_load_champ);
+    stat->cup_champs = bin_load_array(reader, sizeof(ChampStat), FALSE, bin_load_champ);
+    stat->league_stats = bin_load_array(reader, sizeof(LeagueStat), FALSE,
+					bin_load_league_stat);
+}
+
+static void
+bin_load_player(BinReader *reader, gpointer object)
+{
+    Player *pl = object;
+
+    bin_load_unswizzle_name(reader, pl->name);
+    pl->stats = bin_load_array(reader, sizeof(PlayerCompetitionStats), FALSE, NULL);
+    pl->stats_slots = bin_load_array(reader, sizeof(gint), FALSE, NULL);
+}
+
+static void
+bin_load_team(BinReader *reader, gpointer object)
+{
+    Team *tm = object;
+
+    bin_load_unswizzle_name(reader, tm->name);
+    bin_load_unswizzle(reader, tm->symbol);
+    bin_load_unswizzle(reader, tm->names_file);
+    bin_load_unswizzle(reader, tm->def_file);
+    bin_load_unswizzle(reader, tm->strategy_sid);
+    bin_load_unswizzle(reader, tm->stadium.name);
+    tm->players = bin_load_array(reader, sizeof(Player), FALSE, bin_load_player);
+}
+
+static void
+bin_load_table(BinReader *reader, gpointer object)
+{
+    Table *table = object;
+
+    bin_load_unswizzle(reader, table->name);
+    table->elements = bin_load_array(reader, sizeof(TableElement), FALSE, NULL);
+}
+
+/** Live games of fixtures only exist while the
+    fixture gets calculated. */
+static void
+bin_load_fixture(BinReader *reader, gpointer object)
+{
+    ((Fixture*)object)->live_game = NULL;
+}
+
+static void
+bin_load_prom_rel_element(BinReader *reader, gpointer object)
+{
+    bin_load_unswizzle(reader, ((PromRelElement*)object)->dest_sid);
+}
+
+static void
+bin_load_prom_games(BinReader *reader, gpointer object)
+{
+    PromGames *games = object;
+
+    bin_load_unswizzle(reader, games->dest_sid);
+    bin_load_unswizzle(reader, games->loser_sid);
+    bin_load_unswizzle(reader, games->cup_sid);
+}
+
+static void
+bin_load_joined_league(BinReader *reader, gpointer object)
+{
+    bin_load_unswizzle(reader, ((JoinedLeague*)object)->sid);
+}
+
+static void
+bin_load_new_table(BinReader *reader, gpointer object)
+{
+    bin_load_unswizzle(reader, ((NewTable*)object)->name);
+}
+
+static void
+bin_load_league(BinReader *reader, gpointer object)
+{
+    League *league = object;
+
+    bin_load_unswizzle(reader, league->c.name);
+    bin_load_unswizzle(reader, league->short_name);
+    bin_load_unswizzle(reader, league->sid);
+    bin_load_unswizzle(reader, league->symbol);
+    bin_load_unswizzle(reader, league->names_file);
+    league->c.schedule.rounds = league->c.schedule.pairs = NULL;
+    league->c.schedule.fixtures = NULL;
+
+    league->c.teams = bin_load_objects(reader, sizeof(Team), bin_load_team);
+    league->prom_rel.elements =
+	bin_load_array(reader, sizeof(PromRelElement), FALSE, bin_load_prom_rel_element);
+    league->prom_rel.prom_games =
+	bin_load_array(reader, sizeof(PromGames), FALSE, bin_load_prom_games);
+    league->two_match_weeks[0] = bin_load_array(reader, sizeof(gint), FALSE, NULL);
+    league->two_match_weeks[1] = bin_load_array(reader, sizeof(gint), FALSE, NULL);
+    league->rr_breaks = bin_load_array(reader, sizeof(gint), FALSE, NULL);
+    league->joined_leagues =
+	bin_load_array(reader, sizeof(JoinedLeague), FALSE, bin_load_joined_league);
+    league->tables = bin_load_array(reader, sizeof(Table), FALSE, bin_load_table);
+    league->new_tables =
+	bin_load_array(reader, sizeof(NewTable), FALSE, bin_load_new_table);
+    league->fixtures = bin_load_array(reader, sizeof(Fixture), TRUE, bin_load_fixture);
+    league->properties = bin_load_strings(reader);
+    league->week_breaks = bin_load_array(reader, sizeof(WeekBreak), FALSE, NULL);
+    bin_load_league_stat(reader, &league->stats);
+    league->skip_weeks_with = bin_load_strings(reader);
+}
+
+/** Read the choose team and the rest of its chain. */
+static void
+bin_load_choose_team(BinReader *reader, gpointer object)
+{
+    gint i, len;
+    CupChooseTeam *ct = object;
+
+    bin_load_unswizzle(reader, ct->sid);
+
+    len = bin_load_int(reader);
+    for(i=0;i<len && !reader->error;i++)
+    {
+	ct->next = g_malloc(sizeof(CupChooseTeam));
+	ct = ct->next;
+	bin_load_raw(reader, ct, sizeof(CupChooseTeam));
+	bin_load_unswizzle(reader, ct->sid);
+    }
+
+    ct->next = NULL;
+}
+
+static void
+bin_load_round_wait(BinReader *reader, gpointer object)
+{
+    bin_load_unswizzle(reader, ((CupRoundWait*)object)->cup_sid);
+}
+
+static void
+bin_load_cup_round(BinReader *reader, gpointer object)
+{
+    CupRound *round = object;
+
+    bin_load_unswizzle(reader, round->name);
+    round->rr_breaks = bin_load_array(reader, sizeof(gint), FALSE, NULL);
+    round->two_match_weeks[0] = bin_load_array(reader, sizeof(gint), FALSE, NULL);
+    round->two_match_weeks[1] = bin_load_array(reader, sizeof(gint), FALSE, NULL);
+    round->team_ptrs = bin_load_refs(reader);
+    round->choose_teams =
+	bin_load_array(reader, sizeof(CupChooseTeam), FALSE, bin_load_choose_team);
+    round->tables = bin_load_array(reader, sizeof(Table), FALSE, bin_load_table);
+    round->waits = bin_load_array(reader, sizeof(CupRoundWait), FALSE, bin_load_round_wait);
+}
+
+static void
+bin_load_cup(BinReader *reader, gpointer object)
+{
+    gint i, len;
+    Cup *cup = object;
+
+    bin_load_unswizzle(reader, cup->c.name);
+    bin_load_unswizzle(reader, cup->short_name);
+    bin_load_unswizzle(reader, cup->symbol);
+    bin_load_unswizzle(reader, cup->sid);
+    cup->c.schedule.rounds = cup->c.schedule.pairs = NULL;
+    cup->c.schedule.fixtures = NULL;
+    cup->bygfoot = reader->bygfoot;
+
+    cup->c.teams = bin_load_refs(reader);
+    cup->properties = bin_load_strings(reader);
+    cup->rounds = bin_load_array(reader, sizeof(CupRound), FALSE, bin_load_cup_round);
+    cup->bye = bin_load_refs(reader);
+    cup->fixtures = bin_load_array(reader, sizeof(Fixture), TRUE, bin_load_fixture);
+    cup->week_breaks = bin_load_array(reader, sizeof(WeekBreak), FALSE, NULL);
+    cup->skip_weeks_with = bin_load_strings(reader);
+
+    cup->history = g_ptr_array_new();
+    len = bin_load_int(reader);
+    for(i=0;i<len && !reader->error;i++)
+	g_ptr_array_add(cup->history, bin_load_refs(reader));
+}
+
+static void
+bin_load_country(BinReader *reader, gpointer object)
+{
+    Country *cntry = object;
+
+    bin_load_unswizzle(reader, cntry->name);
+    bin_load_unswizzle(reader, cntry->symbol);
+    bin_load_unswizzle(reader, cntry->sid);
+    cntry->bygfoot = reader->bygfoot;
+
+    cntry->leagues = bin_load_objects(reader, sizeof(League), bin_load_league);
+    cntry->cups = bin_load_objects(reader, sizeof(Cup), bin_load_cup);
+    cntry->allcups = bin_load_refs(reader);
+}
+
+static void
+bin_load_unit(BinReader *reader, gpointer object)
+{
+    bin_load_unswizzle(reader, ((LiveGameUnit*)object)->event.commentary);
+}
+
+static void
+bin_load_live_game(BinReader *reader, LiveGame *match)
+{
+    gint i, j;
+
+    bin_load_unswizzle_name(reader, match->team_names[0]);
+    bin_load_unswizzle_name(reader, match->team_names[1]);
+    match->strings = NULL;
+
+    if(match->units == NULL)
+    {
+	for(i=0;i<2;i++)
+	{
+	    match->action_ids[i] = NULL;
+	    for(j=0;j<LIVE_GAME_STAT_ARRAY_END;j++)
+		match->stats.players[i][j] = NULL;
+	}
+	return;
+    }
+
+    match->units = bin_load_array(reader, sizeof(LiveGameUnit), FALSE, bin_load_unit);
+    for(i=0;i<2;i++)
+    {
+	match->action_ids[i] = bin_load_array(reader, sizeof(gint), FALSE, NULL);
+	for(j=0;j<LIVE_GAME_STAT_ARRAY_END;j++)
+	    match->stats.players[i][j] = bin_load_strings(reader);
+    }
+}
+
+static void
+bin_load_event(BinReader *reader, gpointer object)
+{
+    bin_load_unswizzle(reader, ((Event*)object)->value_string);
+}
+
+static void
+bin_load_history(BinReader *reader, gpointer object)
+{
+    gint i;
+    UserHistory *history = object;
+
+    bin_load_unswizzle(reader, history->team_name);
+    for(i=0;i<3;i++)
+	bin_load_unswizzle(reader, history->string[i]);
+}
+
+/** Read a GString stored as a string id. */
+static GString*
+bin_load_g_string(BinReader *reader, gconstpointer id)
+{
+    const gchar *string = bin_load_string_ref(reader, GPOINTER_TO_INT(id));
+
+    return (string == NULL) ? NULL : g_string_new(string);
+}
+
+/** The fixtures of memorable matches are gone, like
+    in the memorable matches file. */
+static void
+bin_load_mmatch(BinReader *reader, gpointer object)
+{
+    MemMatch *mmatch = object;
+
+    bin_load_unswizzle(reader, mmatch->country_name);
+    mmatch->competition_name = bin_load_g_string(reader, mmatch->competition_name);
+    mmatch->lg.fix = NULL;
+    bin_load_live_game(reader, &mmatch->lg);
+}
+
+static void
+bin_load_user(BinReader *reader, gpointer object)
+{
+    User *user = object;
+
+    bin_load_unswizzle(reader, user->name);
+    bin_load_unswizzle(reader, user->mmatches_file);
+    user->sponsor.name = bin_load_g_string(reader, user->sponsor.name);
+
+    bin_load_option_list(reader, &user->options);
+    user->events = bin_load_array(reader, sizeof(Event), FALSE, bin_load_event);
+    user->history = bin_load_array(reader, sizeof(UserHistory), FALSE, bin_load_history);
+    bin_load_live_game(reader, &user->live_game);
+    user->youth_academy.players =
+	bin_load_array(reader, sizeof(Player), FALSE, bin_load_player);
+    user->mmatches = bin_load_array(reader, sizeof(MemMatch), FALSE, bin_load_mmatch);
+    user->bets[0] = bin_load_array(reader, sizeof(BetUser), FALSE, NULL);
+    user->bets[1] = bin_load_array(reader, sizeof(BetUser), FALSE, NULL);
+    user->default_team = bin_load_array(reader, sizeof(gint), FALSE, NULL);
+}
+
+static void
+bin_load_article(BinReader *reader, gpointer object)
+{
+    NewsPaperArticle *article = object;
+
+    bin_load_unswizzle(reader, article->title_small);
+    bin_load_unswizzle(reader, article->title);
+    bin_load_unswizzle(reader, article->subtitle);
+}
+
+static void
+bin_load_transfer(BinReader *reader, gpointer object)
+{
+    ((Transfer*)object)->offers =
+	bin_load_array(reader, sizeof(TransferOffer), FALSE, NULL);
+}
+
+/** National job offers point to the names of the
+    user's country and the league of the team. */
+static void
+bin_load_job(BinReader *reader, gpointer object)
+{
+    gint i;
+    Job *job = object;
+    const gchar *league_name;
+    const GPtrArray *leagues = reader->snapshot->country.leagues;
+
+    if(job->type == JOB_TYPE_INTERNATIONAL)
+    {
+	bin_load_unswizzle(reader, job->country_file);
+	bin_load_unswizzle(reader, job->country_name);
+	bin_load_unswizzle(reader, job->league_name);
+	return;
+    }
+
+    league_name = bin_load_string_ref(reader, GPOINTER_TO_INT(job->league_name));
+    job->country_file = NULL;
+    job->country_name = reader->snapshot->country.name;
+    job->league_name = NULL;
+
+    for(i=0;i<leagues->len;i++)
+	if(job->league_name == NULL ||
+	   g_strcmp0(((League*)g_ptr_array_index(leagues, i))->c.name, league_name) == 0)
+	    job->league_name = ((League*)g_ptr_array_index(leagues, i))->c.name;
+}
+
+static void
+bin_load_snapshot(BinReader *reader, Snapshot *snapshot)
+{
+    gpointer old_country = bin_load_ptr(reader);
+
+    bin_load_raw(reader, snapshot, sizeof(Snapshot));
+    if(old_country != NULL)
+	g_hash_table_insert(reader->map, old_country, &country);
+
+    bin_load_country(reader, &snapshot->country);
+    snapshot->country_list = bin_load_objects(reader, sizeof(Country), bin_load_country);
+    snapshot->international_cups = bin_load_objects(reader, sizeof(Cup), bin_load_cup);
+    snapshot->users = bin_load_array(reader, sizeof(User), TRUE, bin_load_user);
+    bin_load_option_list(reader, &snapshot->options);
+    bin_load_option_list(reader, &snapshot->settings);
+    snapshot->newspaper.articles =
+	bin_load_array(reader, sizeof(NewsPaperArticle), FALSE, bin_load_article);
+    snapshot->transfer_list =
+	bin_load_array(reader, sizeof(Transfer), FALSE, bin_load_transfer);
+    snapshot->season_stats =
+	bin_load_array(reader, sizeof(SeasonStat), FALSE, bin_load_season_stat);
+    snapshot->bets[0] = bin_load_array(reader, sizeof(BetMatch), FALSE, NULL);
+    snapshot->bets[1] = bin_load_array(reader, sizeof(BetMatch), FALSE, NULL);
+    snapshot->jobs = bin_load_array(reader, sizeof(Job), FALSE, bin_load_job);
+}
+
+/** Check the header and read the string table. */
+static gboolean
+bin_load_header(BinReader *reader)
+{
+    gint i, len;
+    gchar magic[sizeof(BIN_LOADSAVE_MAGIC)];
+
+    bin_load_raw(reader, magic, strlen(BIN_LOADSAVE_MAGIC));
+    if(strncmp(magic, BIN_LOADSAVE_MAGIC, strlen(BIN_LOADSAVE_MAGIC)) != 0)
+    {
+	debug_print_message("bin_load_header: not a binary savegame\n");
+	return FALSE;
+    }
+
+    if(bin_load_int(reader) != BIN_LOADSAVE_VERSION ||
+       bin_load_int(reader) != BIN_LOADSAVE_BYTE_ORDER ||
+       bin_load_int(reader) != G_N_ELEMENTS(bin_loadsave_layout))
+    {
+	debug_print_message("bin_load_header: wrong savegame version or byte order\n");
+	return FALSE;
+    }
+
+    for(i=0;i<G_N_ELEMENTS(bin_loadsave_layout);i++)
+	if((guint32)bin_load_int(reader) != bin_loadsave_layout[i])
+	{
+	    debug_print_message("bin_load_header: savegame written by a different build\n");
+	    return FALSE;
+	}
+
+    len = bin_load_int(reader);
+    for(i=0;i<len && !reader->error;i++)
+    {
+	gsize string_len = (guint32)bin_load_int(reader);
+
+	if(reader->error || string_len >= reader->len - reader->pos ||
+	   reader->data[reader->pos + string_len] != '\0')
+	{
+	    reader->error = TRUE;
+	    break;
+	}
+
+	g_ptr_array_add(reader->strings, (gpointer)(reader->data + reader->pos));
+	reader->pos += string_len + 1;
+    }
+
+    return !reader->error;
+}
+
+/** Replace the current game state by the one in the file.
+    The state of the random number generator isn't saved,
+    like in the XML savegames.
+    @return FALSE if the file couldn't be read; the current
+    game state stays untouched in that case. */
+gboolean
+bin_loadsave_read(Bygfoot *bygfoot, const gchar *filename)
+{
+#ifdef DEBUG
+    printf("bin_loadsave_read\n");
+#endif
+
+    gboolean success;
+    GError *error = NULL;
+    GMappedFile *file = g_mapped_file_new(filename, FALSE, &error);
+    Snapshot *snapshot;
+    BinReader reader;
+
+    if(file == NULL)
+    {
+	misc_print_error(&error, FALSE);
+	return FALSE;
+    }
+
+    reader.data = g_mapped_file_get_contents(file);
+    reader.len = g_mapped_file_get_length(file);
+    reader.pos = 0;
+    reader.strings = g_ptr_array_new();
+    reader.map = g_hash_table_new(g_direct_hash, g_direct_equal);
+    reader.bygfoot = bygfoot;
+    reader.snapshot = NULL;
+    reader.error = FALSE;
+
+    success = bin_load_header(&reader);
+
+    if(success)
+    {
+	snapshot = g_malloc0(sizeof(Snapshot));
+	reader.snapshot = snapshot;
+	bin_load_snapshot(&reader, snapshot);
+
+	snapshot->rand_generator = (rand_generator == NULL) ?
+	    g_rand_new() : g_rand_copy(rand_generator);
+	snapshot->rand_seed = rand_seed;
+
+	success = (!reader.error && reader.pos == reader.len);
+	if(success)
+	{
+	    snapshot_relink(snapshot, reader.map);
+	    snapshot_install(bygfoot, snapshot);
+	}
+	else
+	{
+	    debug_print_message("bin_loadsave_read: savegame %s is corrupt\n", filename);
+	    snapshot_free(bygfoot, snapshot);
+	}
+    }
+
+    g_hash_table_destroy(reader.map);
+    g_ptr_array_free(reader.strings, TRUE);
+    g_mapped_file_unref(file);
+
+    return success;
+}
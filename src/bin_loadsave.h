@@ -0,0 +1,41 @@
+/*
+   bin_loadsave.h
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef BIN_LOADSAVE_H
+#define BIN_LOADSAVE_H
+
+#include "bygfoot.h"
+
+/** The version of the binary savegame format. Files with
+    a different version get rejected. */
+#define BIN_LOADSAVE_VERSION 6
+
+gboolean
+bin_loadsave_write(Bygfoot *bygfoot, const gchar *filename);
+
+gboolean
+bin_loadsave_read(Bygfoot *bygfoot, const gchar *filename);
+
+#endif
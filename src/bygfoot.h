@@ -95,7 +95,7 @@
 #define stat5 status[5]
 
 #define debug debug_level
-#define debug_writer const_int("int_debug_writer")
+#define debug_writer const_int(int_debug_writer)
 /* Uncommenting this will cause each function to print its name when it's entered.
    Makes the whole program really slow, of course. */
 //#define DEBUG
@@ -203,6 +203,14 @@ typedef struct
 
 typedef struct {
     gchar *json_filename;
+    /** Whether to read commands from stdin until EOF
+        instead of from a file (cl switch --server). */
+    gboolean json_server;
+    /** UNIX socket to listen on for commands (cl switch --socket). */
+    gchar *json_socket;
+    /** Savegame to convert between the XML and the binary
+        format (cl switch --convert-savegame). */
+    gchar *convert_savegame;
 } CommandLineArgs;
 
 void bygfoot_init(Bygfoot *bygfoot, enum BygfootFrontend frontend);
@@ -179,7 +179,7 @@ callback_player_activate(Bygfoot *bygfoot, gint idx)
         player_swap(current_user.tm, selected_row,
                     current_user.tm, idx);
 
-        if(opt_user_int("int_opt_user_swap_adapts") == 1 &&
+        if(opt_user_int(int_opt_user_swap_adapts) == 1 &&
                 current_user.tm->structure !=
                 team_find_appropriate_structure(current_user.tm))
         {
@@ -526,7 +526,7 @@ callback_transfer_list_cpu(Bygfoot *bygfoot, gint button, gint idx)
         return;
     }
 
-    if(current_user.tm->players->len == const_int("int_team_max_players"))
+    if(current_user.tm->players->len == const_int(int_team_max_players))
     {
         game_gui_show_warning(_("Your roster is already full. You can't buy more players."));
         return;
@@ -620,8 +620,8 @@ callback_offer_new_contract(gint idx)
     gint i;
     gchar buf[SMALL];
     Player *pl = player_of_idx_team(current_user.tm, idx);
-    gfloat scout_dev = math_rnd(-const_float("float_transfer_scout_deviance_wage"),
-                                const_float("float_transfer_scout_deviance_wage")) *
+    gfloat scout_dev = math_rnd(-const_float(float_transfer_scout_deviance_wage),
+                                const_float(float_transfer_scout_deviance_wage)) *
                        (current_user.scout % 10 + 1);
     GtkSpinButton *spinbuttons[4];
 
@@ -630,14 +630,14 @@ callback_offer_new_contract(gint idx)
         game_gui_show_warning(_("You can't offer a new contract if the old one is still above 2 years."));
         return;
     }
-    else if(pl->offers == const_int("int_contract_max_offers"))
+    else if(pl->offers == const_int(int_contract_max_offers))
     {
         game_gui_show_warning(_("The player won't negotiate with you anymore."));
         return;
     }
     else if(query_player_star_balks(pl, current_user.tm, FALSE))
     {
-        pl->offers = const_int("int_contract_max_offers");
+        pl->offers = const_int(int_contract_max_offers);
         game_gui_show_warning(_("The player feels he doesn't have a future in your star-studded team. He refuses to negotiate."));
         return;
     }
@@ -654,7 +654,7 @@ callback_offer_new_contract(gint idx)
 
     sprintf(buf, _("You are negotiating with %s about a new contract. Pay attention to what you're doing; if you don't come to terms with him within %d offers, he's going to leave your team after his current contract expires (unless you sell him). You may only abort BEFORE making the first offer.\nYour scout's recommendations are preset:"),
             pl->name,
-            const_int("int_contract_max_offers"));
+            const_int(int_contract_max_offers));
     gtk_label_set_text(GTK_LABEL(lookup_widget(window.contract, "label_contract")), buf);
 
     for(i=0; i<4; i++)
@@ -664,7 +664,7 @@ callback_offer_new_contract(gint idx)
 
         gtk_spin_button_set_value(spinbuttons[i],
                                   rint((gfloat)stat1 *
-                                       (1 + (i * const_float("float_contract_scale_factor") *
+                                       (1 + (i * const_float(float_contract_scale_factor) *
                                              powf(-1, (pl->age > pl->peak_age)))) *
                                        (1 + scout_dev)));
     }
@@ -786,7 +786,7 @@ callback_fire_player(gint idx)
 
     stat1 = STATUS_FIRE_PLAYER;
     stat2 = idx;
-    stat3 = (gint)rint(pl->wage * const_float("float_player_fire_wage_factor") * pl->contract);
+    stat3 = (gint)rint(pl->wage * const_float(float_player_fire_wage_factor) * pl->contract);
 
     misc_print_grouped_int(stat3, buf2);
 
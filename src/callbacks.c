@@ -132,7 +132,7 @@ on_eventbox_boost_button_press_event   (GtkWidget       *widget,
     else
 	return FALSE;
 
-    if(new_boost == 1 && sett_int("int_opt_disable_boost_on"))
+    if(new_boost == 1 && sett_int(int_opt_disable_boost_on))
 	game_gui_print_message(_("Boost ON is disabled in this country definition."));
     else
 	team_change_attribute_with_message(current_user.tm, TEAM_ATTRIBUTE_BOOST, new_boost);
@@ -189,8 +189,8 @@ on_button_back_to_main_clicked         (GtkButton       *button,
 
     gui_set_arrows(bygfoot->gui);
 
-    if((opt_int("int_opt_news_popup") == 2 ||
-        (opt_int("int_opt_news_popup") == 1 &&
+    if((opt_int(int_opt_news_popup) == 2 ||
+        (opt_int(int_opt_news_popup) == 1 &&
          counters[COUNT_NEW_NEWS] == 1)) &&
        counters[COUNT_NEWS_SHOWN] == 0 &&
        counters[COUNT_NEW_NEWS] != 0)
@@ -207,7 +207,7 @@ on_button_transfers_clicked            (GtkButton       *button,
 #endif
 
     Bygfoot *bygfoot = (Bygfoot*)user_data;
-    if(sett_int("int_opt_disable_transfers"))
+    if(sett_int(int_opt_disable_transfers))
 	game_gui_print_message(_("Transfers are disabled in this country definition."));
     else if(week < transfer_get_deadline() || transfer_list->len > 0)
     {
@@ -248,7 +248,7 @@ on_button_new_week_clicked             (GtkButton       *button,
 	stat1 = STATUS_QUERY_USER_NO_TURN;
 	window_show_yesno(_("At least one user didn't take his turn this week. Continue?"));
     }
-    else if(opt_int("int_opt_confirm_unfit") &&
+    else if(opt_int(int_opt_confirm_unfit) &&
 	    query_user_teams_have_unfit())
     {
 	stat1 = STATUS_QUERY_UNFIT;
@@ -635,7 +635,7 @@ on_menu_save_activate                  (GtkMenuItem     *menuitem,
     printf("on_menu_save_activate\n");
 #endif
 
-    if(!opt_int("int_opt_save_will_overwrite") ||
+    if(!opt_int(int_opt_save_will_overwrite) ||
        save_file == NULL)
 	on_menu_save_as_activate(NULL, user_data);
     else
@@ -664,7 +664,7 @@ on_menu_quit_activate                  (GtkMenuItem     *menuitem,
     printf("on_menu_quit_activate\n");
 #endif
 
-    if(!getsav || !opt_int("int_opt_confirm_quit"))
+    if(!getsav || !opt_int(int_opt_confirm_quit))
 	main_exit_program(EXIT_OK, NULL);
     else
     {
@@ -842,7 +842,7 @@ on_menu_show_youth_academy_activate    (GtkMenuItem     *menuitem,
 #endif
 
     Bygfoot *bygfoot = (Bygfoot*)user_data;
-    if(sett_int("int_opt_disable_ya"))
+    if(sett_int(int_opt_disable_ya))
     {
 	game_gui_print_message(
 	    _("Youth academy is disabled in this country definition."));
@@ -862,7 +862,7 @@ on_menu_set_investment_activate        (GtkMenuItem     *menuitem,
 #endif
 
     Bygfoot *bygfoot = (Bygfoot*)user_data;
-    if(sett_int("int_opt_disable_ya"))
+    if(sett_int(int_opt_disable_ya))
     {
 	game_gui_print_message(
 	    _("Youth academy is disabled in this country definition."));
@@ -894,7 +894,7 @@ on_menu_show_job_exchange_activate     (GtkMenuItem     *menuitem,
 	_("Right click to apply for job at once, left click to see team info."));
     game_gui_print_message_with_delay(
 	_("The job exchange update interval is %d weeks."),
-	const_int("int_job_update_interval"));
+	const_int(int_job_update_interval));
 }
 
 G_MODULE_EXPORT void
@@ -943,7 +943,7 @@ on_training_camp_activate              (GtkMenuItem     *menuitem,
 #endif
 
    Bygfoot *bygfoot = (Bygfoot*)user_data;
-   if(sett_int("int_opt_disable_training_camp"))
+   if(sett_int(int_opt_disable_training_camp))
     {
 	game_gui_print_message(
 	    _("Training camp is disabled in this country definition."));
@@ -951,7 +951,7 @@ on_training_camp_activate              (GtkMenuItem     *menuitem,
     }
 
    if(current_user.counters[COUNT_USER_TRAININGS_WEEK] == 
-      const_int("int_training_camps_week"))
+      const_int(int_training_camps_week))
    {
        game_gui_print_message(_("Your team has already had enough training camps this week."));
        return;
@@ -960,7 +960,7 @@ on_training_camp_activate              (GtkMenuItem     *menuitem,
    if(current_user.counters[COUNT_USER_TRAININGS_LEFT_SEASON] == 0)
    {
        game_gui_print_message(_("You've reached the limit of %d training camps for the season."),
-			      const_int("int_training_camps_per_season"));
+			      const_int(int_training_camps_per_season));
        return;
    }
 
@@ -1097,7 +1097,7 @@ on_menu_offer_new_contract_activate    (GtkMenuItem     *menuitem,
     printf("on_menu_offer_new_contract_activate\n");
 #endif
 
-    if(sett_int("int_opt_disable_contracts"))
+    if(sett_int(int_opt_disable_contracts))
     {
 	game_gui_print_message(_("Contracts are disabled in this country definition."));
 	return;
@@ -1145,7 +1145,7 @@ on_menu_put_on_transfer_list_activate  (GtkMenuItem     *menuitem,
     printf("on_menu_put_on_transfer_list_activate\n");
 #endif
 
-    if(sett_int("int_opt_disable_transfers"))
+    if(sett_int(int_opt_disable_transfers))
 	game_gui_print_message(_("Transfers are disabled in this country definition."));
     else if(selected_row == -1)
 	game_gui_print_message(_("You haven't selected a player."));
@@ -1210,9 +1210,9 @@ on_menu_shoots_penalties_activate      (GtkMenuItem     *menuitem,
     if(selected_row == -1)
 	game_gui_print_message(_("You haven't selected a player."));
     else if(player_of_idx_team(current_user.tm, selected_row)->id ==
-	    opt_user_int("int_opt_user_penalty_shooter"))
+	    opt_user_int(int_opt_user_penalty_shooter))
     {
-	opt_user_set_int("int_opt_user_penalty_shooter", -1);
+	opt_user_set_int(int_opt_user_penalty_shooter, -1);
 	game_gui_print_message(_("Penalty/free kick shooter deselected."));
 	treeview_show_user_player_list();
 	setsav0;
@@ -1221,7 +1221,7 @@ on_menu_shoots_penalties_activate      (GtkMenuItem     *menuitem,
     {
 	game_gui_print_message(_("%s will shoot penalties and free kicks when he plays."),
 			       player_of_idx_team(current_user.tm, selected_row)->name);
-	opt_user_set_int("int_opt_user_penalty_shooter",
+	opt_user_set_int(int_opt_user_penalty_shooter,
 			 player_of_idx_team(current_user.tm, selected_row)->id);
 	treeview_show_user_player_list();
 	setsav0;
@@ -1240,7 +1240,7 @@ on_menu_move_to_youth_academy_activate (GtkMenuItem     *menuitem,
     Player *pl;
     Bygfoot *bygfoot = (Bygfoot*)user_data;
 
-    if(sett_int("int_opt_disable_ya"))
+    if(sett_int(int_opt_disable_ya))
     {
 	game_gui_print_message(
 	    _("Youth academy is disabled in this country definition."));
@@ -1253,13 +1253,13 @@ on_menu_move_to_youth_academy_activate (GtkMenuItem     *menuitem,
     {
 	pl = player_of_idx_team(current_user.tm, selected_row);
 
-	if(pl->age > const_float("float_player_age_lower"))
+	if(pl->age > const_float(float_player_age_lower))
 	    game_gui_print_message(_("The player is too old for the youth academy."));
 	else if(current_user.tm->players->len <= 11)
 	    game_gui_print_message(
 		_("You can't move the player, there are too few players in your team."));
 	else if(current_user.youth_academy.players->len ==
-		const_int("int_youth_academy_max_youths"))
+		const_int(int_youth_academy_max_youths))
 	    game_gui_print_message(_("There is no room in your youth academy."));
 	else
 	{
@@ -1383,16 +1383,16 @@ on_menu_youth_move_to_team_activate    (GtkMenuItem     *menuitem,
 #endif
 
     Bygfoot *bygfoot = (Bygfoot*)user_data;
-    if(sett_int("int_opt_disable_ya"))
+    if(sett_int(int_opt_disable_ya))
     {
 	game_gui_print_message(
 	    _("Youth academy is disabled in this country definition."));
 	return;
     }
 
-    if(current_user.tm->players->len == const_int("int_team_max_players"))
+    if(current_user.tm->players->len == const_int(int_team_max_players))
 	game_gui_print_message(_("You can't have more than %d players in the team."),
-			       const_int("int_team_max_players"));
+			       const_int(int_team_max_players));
     else
     {
 	player_move_from_ya(selected_row);
@@ -1413,7 +1413,7 @@ on_menu_youth_kick_out_of_academy_activate
 #endif
 
     Bygfoot *bygfoot = (Bygfoot*)user_data;
-    if(opt_user_int("int_opt_user_confirm_youth"))
+    if(opt_user_int(int_opt_user_confirm_youth))
     {
 	stat1 = STATUS_QUERY_KICK_YOUTH;
 	window_show_yesno(_("Do you really want to kick the poor boy out of your academy?"));
@@ -1578,7 +1578,7 @@ on_automatic_loan_repayment_activate   (GtkMenuItem     *menuitem,
 #endif
 
     Bygfoot *bygfoot = (Bygfoot*)user_data;
-    if(sett_int("int_opt_disable_finances"))
+    if(sett_int(int_opt_disable_finances))
     {
 	game_gui_print_message(_("Finances are disabled in this country definition."));
 	return;
@@ -1607,7 +1607,7 @@ on_menu_show_finances_activate         (GtkMenuItem     *menuitem,
 #endif
 
     Bygfoot *bygfoot = (Bygfoot*)user_data;
-    if(sett_int("int_opt_disable_finances"))
+    if(sett_int(int_opt_disable_finances))
     {
 	game_gui_print_message(_("Finances are disabled in this country definition."));
 	return;
@@ -1631,7 +1631,7 @@ on_menu_show_stadium_activate          (GtkMenuItem     *menuitem,
 #endif
 
     Bygfoot *bygfoot = (Bygfoot*)user_data;
-    if(sett_int("int_opt_disable_stadium"))
+    if(sett_int(int_opt_disable_stadium))
     {
 	game_gui_print_message(
 	    _("Stadium management is disabled in this country definition."));
@@ -27,6 +27,7 @@
 #include "cup.h"
 #include "competition.h"
 #include "league.h"
+#include "variables.h"
 
 gboolean
 clid_is_league(gint clid)
@@ -65,3 +66,71 @@ competition_get_teams(const Competition *c)
 {
     return c->teams;
 }
+
+/** Mark the slots used by the competitions in an array.
+    @param assign Whether to give the competitions without a slot
+    the next free ones instead. */
+static void
+competition_slots_mark(GPtrArray *competitions, GArray *used,
+		       gint *next, gboolean assign)
+{
+    gint i;
+    Competition *c;
+
+    if(competitions == NULL)
+	return;
+
+    for(i=0;i<competitions->len;i++)
+    {
+	/* League and Cup both start with the Competition struct. */
+	c = g_ptr_array_index(competitions, i);
+
+	if(c->slot == -1 && assign)
+	{
+	    while(*next < used->len && g_array_index(used, gboolean, *next))
+		(*next)++;
+	    c->slot = (*next)++;
+	}
+
+	if(c->slot == -1)
+	    continue;
+
+	if(c->slot >= used->len)
+	    g_array_set_size(used, c->slot + 1);
+	g_array_index(used, gboolean, c->slot) = TRUE;
+    }
+}
+
+/** Give the leagues and cups of the game that don't have one yet
+    the lowest free slots. The slots of the other competitions stay the
+    same, so the players' stats indices remain valid. Has to be called
+    whenever leagues or cups got created or loaded. */
+void
+competition_assign_slots(Bygfoot *bygfoot)
+{
+#ifdef DEBUG
+    printf("competition_assign_slots\n");
+#endif
+
+    gint i, j, next = 0;
+    GArray *used = g_array_new(FALSE, TRUE, sizeof(gboolean));
+    Country *cntry;
+
+    /* The current country and the international cups come first,
+       so that their slots stay small. */
+    for(i=0;i<2;i++)
+    {
+	competition_slots_mark(country.leagues, used, &next, i == 1);
+	competition_slots_mark(country.cups, used, &next, i == 1);
+	competition_slots_mark(bygfoot->international_cups, used, &next, i == 1);
+
+	for(j=0;country_list != NULL && j<country_list->len;j++)
+	{
+	    cntry = g_ptr_array_index(country_list, j);
+	    competition_slots_mark(cntry->leagues, used, &next, i == 1);
+	    competition_slots_mark(cntry->cups, used, &next, i == 1);
+	}
+    }
+
+    g_array_free(used, TRUE);
+}
@@ -26,6 +26,7 @@
 #ifndef COMPETITION_H
 #define COMPETITION_H
 
+#include "bygfoot.h"
 #include "competition_struct.h"
 
 gboolean
@@ -46,4 +47,7 @@ competition_is_cup(const Competition *c);
 GPtrArray *
 competition_get_teams(const Competition *c);
 
+void
+competition_assign_slots(Bygfoot *bygfoot);
+
 #endif
@@ -28,6 +28,24 @@
 
 #include <glib.h>
 
+/** An index of the fixtures of a league or cup by week round
+    and by the teams playing.
+    @see fixture_schedule_get() */
+typedef struct
+{
+    /** Maps the week and week round to a GArray with the
+	indices of the fixtures playing then. */
+    GHashTable *rounds;
+    /** Maps the home and the away team to a GArray with
+	the indices of the fixtures between them.
+	@see fixture_get_head_to_head() */
+    GHashTable *pairs;
+    /** The fixtures array the index was built for,
+	its length and the schedule stamp at that time. */
+    const GArray *fixtures;
+    gint len, stamp;
+} FixtureSchedule;
+
 /** Competition struct represents the common parts of the Cup and League
  * structs. */
 typedef struct
@@ -35,6 +53,11 @@ typedef struct
     /** Numerical id. */
     gint id;
 
+    /** Dense index of the competition among the leagues and cups
+	of the game, used to look up the players' stats for it.
+	-1 until it gets assigned. @see competition_assign_slots() */
+    gint slot;
+
     gchar *name;
 
     /** Teams participating in the competition. */
@@ -44,5 +67,8 @@ typedef struct
 	Default: 1000 (off). */
     gint yellow_red;
 
+    /** Which fixtures play when. */
+    FixtureSchedule schedule;
+
 } Competition;
 #endif
@@ -31,6 +31,7 @@
 #include "maths.h"
 #include "misc.h"
 #include "option.h"
+#include "registry.h"
 #include "table.h"
 #include "team.h"
 #include "variables.h"
@@ -56,6 +57,8 @@ cup_new(gboolean new_id, Bygfoot *bygfoot)
     new.sid = NULL;
 
     new.c.id = (new_id) ? cup_id_new : -1;
+    new.c.slot = -1;
+    new.c.schedule.rounds = new.c.schedule.pairs = NULL;
     new.group = -1;
     new.add_week = 0;
     new.last_week = -1;
@@ -168,6 +171,7 @@ cup_reset(Cup *cup)
 
     g_array_free(cup->fixtures, TRUE);
     cup->fixtures = g_array_new(FALSE, FALSE, sizeof(Fixture));
+    fixture_schedule_invalidate();
 
     free_g_ptr_array(&cup->bye);
 
@@ -357,6 +361,7 @@ cup_get_team_pointers(Cup *cup, gint round, gboolean preload)
     for(i=existing_teams;i<cup_round->team_ptrs->len;i++)
     {
         Team *team = g_ptr_array_index(cup_round->team_ptrs, i);
+        team_fill_skeleton(team);
 	g_ptr_array_add(cup->c.teams, team);
     }
 
@@ -1093,16 +1098,12 @@ cup_round_get_new_teams(const CupRound *cup_round)
     return new_teams;
 }
 
-/** Return the cup pointer belonging to the id.
-    @param clid The id we look for.
-    @return The cup pointer or NULL if failed. */
-Cup*
-cup_from_clid(gint clid)
+/** Find a cup by scanning the cup arrays; used to
+    cross-check the registry in debug mode.
+    @see cup_from_clid() */
+static Cup*
+cup_from_clid_scan(gint clid)
 {
-#ifdef DEBUG
-    printf("cup_from_clid\n");
-#endif
-
     gint i;
 
     for(i=0;i<country.cups->len;i++) {
@@ -1116,12 +1117,31 @@ cup_from_clid(gint clid)
         if (cup->c.id == clid)
             return cup;
     }
-    main_exit_program(EXIT_POINTER_NOT_FOUND, 
-		      "cup_from_clid: didn't find cup with id %d\n", clid);
-
     return NULL;
 }
 
+/** Return the cup pointer belonging to the id.
+    @param clid The id we look for.
+    @return The cup pointer or NULL if failed. */
+Cup*
+cup_from_clid(gint clid)
+{
+#ifdef DEBUG
+    printf("cup_from_clid\n");
+#endif
+
+    Cup *cup = registry_get_cup(clid);
+
+    if(debug > 130 && cup != cup_from_clid_scan(clid))
+	debug_print_message("cup_from_clid: registry and scan disagree for cup with id %d\n", clid);
+
+    if(cup == NULL)
+	main_exit_program(EXIT_POINTER_NOT_FOUND, 
+			  "cup_from_clid: didn't find cup with id %d\n", clid);
+
+    return cup;
+}
+
 /** Find the cup with the given sid. */
 Cup*
 cup_from_sid(const gchar *sid)
@@ -1288,7 +1308,7 @@ cup_get_highlight_colour(const Cup *cup)
 	{
 	    sprintf(buf, "string_cup_%s",
 		    (gchar*)g_ptr_array_index(cup->properties, i));
-	    return const_app(buf);
+	    return option_string(buf, &constants_app);
 	}
 
     return NULL;
@@ -23,12 +23,19 @@
   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 */
 
+#include "bet.h"
 #include "callbacks.h"
 #include "debug.h"
 #include "file.h"
+#include "free.h"
+#include "game.h"
 #include "game_gui.h"
 #include "league.h"
 #include "live_game.h"
+#include "main.h"
+#include "match_model.h"
+#include "maths.h"
+#include "misc.h"
 #include "option.h"
 #include "strategy.h"
 #include "support.h"
@@ -172,7 +179,7 @@ debug_action(Bygfoot *bygfoot, const gchar *text)
         if(option_int("int_opt_user_show_live_game", &current_user.options))
             option_set_int("int_opt_user_show_live_game", &current_user.options, 0);
 
-        sett_set_int("int_opt_goto_mode", 1);
+        sett_set_int(int_opt_goto_mode, 1);
         if(value < 100)
             while(week < value)
             {
@@ -189,7 +196,7 @@ debug_action(Bygfoot *bygfoot, const gchar *text)
                 while (gtk_events_pending ())
                     gtk_main_iteration ();
             }
-        sett_set_int("int_opt_goto_mode", 0);
+        sett_set_int(int_opt_goto_mode, 0);
     }
     else if(g_str_has_prefix(text, "testcom") ||
 	    g_str_has_prefix(text, "tc"))
@@ -250,6 +257,167 @@ debug_reset_counter(gpointer data)
     return FALSE;
 }
 
+/** A part of the betting odds calibration calculated by a worker
+    thread: some matches at a skill difference between two copies of
+    a team, drawing from the job's own random number stream. */
+typedef struct
+{
+    gint skilldiff, matches;
+    /** The team the copies are made of. */
+    const Team *tm;
+    Fixture fix;
+    MathRand *rand;
+    /** The wins, draws and losses of the better team. */
+    gint res[3];
+    /** The sum of the differences of the average skills of the teams.
+	@see bet_get_average_skill() */
+    gfloat skilldiff_sum;
+} DebugCaloddsJob;
+
+/** Reset the players and the structure of a team copied by
+    debug_calodds_team_new() to the ones of the original team;
+    the match engine moves the players around when substituting. */
+static void
+debug_calodds_team_reset(Team *tm, const Team *orig)
+{
+#ifdef DEBUG
+    printf("debug_calodds_team_reset\n");
+#endif
+
+    gint i;
+    Player *pl;
+    GArray *stats, *stats_slots;
+
+    tm->structure = orig->structure;
+    tm->style = orig->style;
+    tm->boost = orig->boost;
+
+    for(i=0;i<tm->players->len;i++)
+    {
+	pl = &g_array_index(tm->players, Player, i);
+	stats = pl->stats;
+	stats_slots = pl->stats_slots;
+	*pl = g_array_index(orig->players, Player, i);
+	pl->stats = stats;
+	pl->stats_slots = stats_slots;
+	pl->team = tm;
+    }
+}
+
+/** Copy a team for a calibration job, so that the jobs don't
+    share any players. The strings are shared and the players
+    start without stats. */
+static Team*
+debug_calodds_team_new(const Team *tm)
+{
+#ifdef DEBUG
+    printf("debug_calodds_team_new\n");
+#endif
+
+    gint i;
+    Team *new = g_new(Team, 1);
+
+    *new = *tm;
+    new->players = g_array_sized_new(FALSE, FALSE, sizeof(Player), tm->players->len);
+    g_array_set_size(new->players, tm->players->len);
+
+    for(i=0;i<new->players->len;i++)
+    {
+	g_array_index(new->players, Player, i).stats =
+	    g_array_new(FALSE, FALSE, sizeof(PlayerCompetitionStats));
+	g_array_index(new->players, Player, i).stats_slots = NULL;
+    }
+
+    debug_calodds_team_reset(new, tm);
+
+    return new;
+}
+
+/** Free a team copied by debug_calodds_team_new(). */
+static void
+debug_calodds_team_free(Team *tm)
+{
+#ifdef DEBUG
+    printf("debug_calodds_team_free\n");
+#endif
+
+    gint i;
+
+    for(i=0;i<tm->players->len;i++)
+    {
+	g_array_free(g_array_index(tm->players, Player, i).stats, TRUE);
+	free_g_array(&g_array_index(tm->players, Player, i).stats_slots);
+    }
+
+    g_array_free(tm->players, TRUE);
+    g_free(tm);
+}
+
+/** Thread pool function calculating the matches of a calibration job. */
+static void
+debug_calodds_job(gpointer data, gpointer user_data)
+{
+#ifdef DEBUG
+    printf("debug_calodds_job\n");
+#endif
+
+    DebugCaloddsJob *job = (DebugCaloddsJob*)data;
+    Fixture *fix = &job->fix;
+    gint i, j, k;
+    Player *pl;
+    LiveGameContext ctx;
+    GArray *live_games = g_array_new(FALSE, TRUE, sizeof(LiveGame));
+
+    live_game_prepare_array(live_games, 1, TRUE);
+    live_game_context_init(&ctx, &g_array_index(live_games, LiveGame, 0), -1, NULL);
+    ctx.commentary = FALSE;
+    ctx.rand = job->rand;
+    ctx.recycle = TRUE;
+
+    math_rand_set_current(job->rand);
+
+    for(i=0;i<job->matches;i++)
+    {
+	fix->attendance = -1;
+	memset(fix->result, 0, sizeof(fix->result));
+
+	for(j=0;j<2;j++)
+	{
+	    debug_calodds_team_reset(fix->teams[j], job->tm);
+	    for(k=0;k<fix->teams[j]->players->len;k++)
+	    {
+		pl = &g_array_index(fix->teams[j]->players, Player, k);
+		pl->skill = 90 - j * job->skilldiff;
+		strategy_repair_player(pl);
+		pl->fitness = 0.9;
+	    }
+	}
+
+	job->skilldiff_sum += bet_get_average_skill(fix->teams[0]) -
+	    bet_get_average_skill(fix->teams[1]);
+
+	live_game_initialize(&ctx, fix, NULL);
+	live_game_calculate(&ctx);
+
+	if(fix->result[0][0] < fix->result[1][0])
+	    job->res[2]++;
+	else
+	    job->res[(fix->result[0][0] == fix->result[1][0])]++;
+    }
+
+    math_rand_set_current(NULL);
+
+    live_game_prepare_array(live_games, 0, TRUE);
+    g_array_free(live_games, TRUE);
+}
+
+/** Calibrate the betting odds by calculating a lot of matches
+    between two copies of a team at each skill difference, using
+    several threads if wanted, and save the outcome probabilities as
+    the betting odds table in the first support directory. Each job
+    gets its own copies and draws from its own random number stream,
+    so the results don't depend on the number of threads.
+    @see bet_get_odds() */
 void
 debug_calibrate_betting_odds(gint skilldiffmax, gint matches_per_skilldiff, Bygfoot *bygfoot)
 {
@@ -257,40 +425,214 @@ debug_calibrate_betting_odds(gint skilldiffmax, gint matches_per_skilldiff, Bygf
     printf("debug_calibrate_betting_odds\n");
 #endif
 
-    gint i, skilldiff, matches;
-    League *league = g_ptr_array_index(country.leagues, 0);
-    Fixture *fix = &g_array_index(league->fixtures, Fixture, 0);
-    LiveGame live_game;
+    gint i, j, k;
+    gint chunks = (matches_per_skilldiff + DEBUG_CALODDS_CHUNK - 1) / DEBUG_CALODDS_CHUNK,
+	num_jobs = (skilldiffmax + 1) * chunks,
+	num_threads = opt_int(int_opt_match_threads),
+	sim_mode = opt_int(int_opt_sim_mode);
+    gchar buf[SMALL];
+    const League *league = g_ptr_array_index(country.leagues, 0);
+    const Fixture *fix = &g_array_index(league->fixtures, Fixture, 0);
+    DebugCaloddsJob *jobs = g_new0(DebugCaloddsJob, num_jobs), *job;
+    BetOddsStep step;
+    GThreadPool *pool = NULL;
+    GError *error = NULL;
+    GTimer *timer = g_timer_new();
+
+    if(num_jobs == 0)
+    {
+	g_free(jobs);
+	g_timer_destroy(timer);
+	return;
+    }
+
+    /* The odds go with the engine, of course. */
+    opt_set_int(int_opt_sim_mode, LIVE_GAME_SIM_MODE_ENGINE);
+
+    for(i=0;i<=skilldiffmax;i++)
+	for(j=0;j<chunks;j++)
+	{
+	    job = &jobs[i * chunks + j];
+	    job->skilldiff = i;
+	    job->matches = MIN(DEBUG_CALODDS_CHUNK,
+			       matches_per_skilldiff - j * DEBUG_CALODDS_CHUNK);
+	    job->tm = fix->teams[0];
+	    job->fix = *fix;
+	    job->fix.home_advantage = FALSE;
+	    job->fix.teams[0] = debug_calodds_team_new(job->tm);
+	    job->fix.teams[1] = debug_calodds_team_new(job->tm);
+	    job->rand = math_rand_new(math_rand_key(rand_seed, -1, -1, i, -1, j));
+	}
+
+    if(num_threads <= 1)
+	for(i=0;i<num_jobs;i++)
+	    debug_calodds_job(&jobs[i], NULL);
+    else
+    {
+	pool = g_thread_pool_new(debug_calodds_job, NULL,
+				 num_threads, TRUE, &error);
+	misc_print_error(&error, TRUE);
+
+	for(i=0;i<num_jobs;i++)
+	    g_thread_pool_push(pool, &jobs[i], NULL);
+
+	/* Wait for all the jobs to finish. */
+	g_thread_pool_free(pool, FALSE, TRUE);
+    }
+
+    opt_set_int(int_opt_sim_mode, sim_mode);
 
-    fix->home_advantage = FALSE;
-    
-    for(skilldiff=0;skilldiff<=skilldiffmax;skilldiff++)
+    g_array_set_size(bet_odds_table, 0);
+    for(i=0;i<=skilldiffmax;i++)
     {
 	gint res[3] = {0, 0, 0};
+	gfloat skilldiff_sum = 0;
 
-	for(matches=0;matches<matches_per_skilldiff;matches++)
+	for(j=0;j<chunks;j++)
 	{
-	    fix->attendance = -1;
-	    fix->result[0][0] = fix->result[1][0] = 0;
-	    for(i=0;i<fix->teams[0]->players->len;i++)
-	    {
-		strategy_repair_player(&g_array_index(fix->teams[0]->players, Player, i));
-		strategy_repair_player(&g_array_index(fix->teams[1]->players, Player, i));
-		g_array_index(fix->teams[0]->players, Player, i).skill = 90;
-		g_array_index(fix->teams[1]->players, Player, i).skill = 90 - skilldiff;
-		g_array_index(fix->teams[0]->players, Player, i).fitness = 0.9;
-		g_array_index(fix->teams[1]->players, Player, i).fitness = 0.9;
-	    }
+	    job = &jobs[i * chunks + j];
+	    for(k=0;k<3;k++)
+		res[k] += job->res[k];
+	    skilldiff_sum += job->skilldiff_sum;
+	}
+
+	/* The table goes from the point of view of the better team. */
+	step.skilldiff = ABS(skilldiff_sum / matches_per_skilldiff);
+	for(k=0;k<3;k++)
+	    step.probs[k] = (gfloat)res[k] / (gfloat)matches_per_skilldiff;
+	g_array_append_val(bet_odds_table, step);
+
+	g_print("sd %3d (%5.2f) res %3d %3d %3d prob %.2f %.2f %.2f\n", i,
+		step.skilldiff, res[0], res[1], res[2],
+		step.probs[0], step.probs[1], step.probs[2]);
+    }
+
+    sprintf(buf, "%s%s%s", file_get_first_support_dir(),
+	    G_DIR_SEPARATOR_S, BET_ODDS_FILE);
+    bet_save_odds_table(buf);
 
-	    live_game_calculate_fixture(fix, &live_game, bygfoot);
-	    if(fix->result[0][0] < fix->result[1][0])
-		res[2]++;
-	    else
-		res[(fix->result[0][0] == fix->result[1][0])]++;
+    g_print("betting odds: %d matches in %.1f seconds\nsaved to %s\n",
+	    (skilldiffmax + 1) * matches_per_skilldiff,
+	    g_timer_elapsed(timer, NULL), buf);
+
+    for(i=0;i<num_jobs;i++)
+    {
+	debug_calodds_team_free(jobs[i].fix.teams[0]);
+	debug_calodds_team_free(jobs[i].fix.teams[1]);
+	math_rand_free(jobs[i].rand);
+    }
+
+    g_free(jobs);
+    g_timer_destroy(timer);
+}
+
+/** Fit the statistical match model to matches calculated by the
+    match engine and save it to the first support directory.
+    The matches are played between random teams of the same league
+    with their own players, so that the team values look like
+    the ones in real matches.
+    @param matches How many matches to calculate.
+    @see match_model_fit() */
+void
+debug_fit_match_model(gint matches, Bygfoot *bygfoot)
+{
+#ifdef DEBUG
+    printf("debug_fit_match_model\n");
+#endif
+
+    gint i, j, match, count;
+    gint sim_mode = opt_int(int_opt_sim_mode);
+    gfloat team_values[2][GAME_TEAM_VALUE_END];
+    gfloat features[MATCH_MODEL_FEATURE_END];
+    gfloat goals_observed = 0, goals_expected = 0;
+    gchar buf[SMALL];
+    League *league;
+    Fixture *fix;
+    Team *teams[2];
+    LiveGame live_game;
+    GArray *all_features = g_array_new(FALSE, FALSE, sizeof(gfloat)),
+	*counts[MATCH_MODEL_RATE_END] =
+	{g_array_new(FALSE, FALSE, sizeof(gint)),
+	 g_array_new(FALSE, FALSE, sizeof(gint))};
+
+    /* The model gets fitted to the engine, of course. */
+    opt_set_int(int_opt_sim_mode, LIVE_GAME_SIM_MODE_ENGINE);
+
+    for(match=0;match<matches;match++)
+    {
+	league = g_ptr_array_index(country.leagues,
+				   math_rndi(0, country.leagues->len - 1));
+	if(league->fixtures->len == 0 || league->c.teams->len < 2)
+	    continue;
+
+	/* We borrow the first fixture of the league. */
+	fix = &g_array_index(league->fixtures, Fixture, 0);
+	teams[0] = fix->teams[0];
+	teams[1] = fix->teams[1];
+
+	i = math_rndi(0, league->c.teams->len - 1);
+	j = math_rndi(0, league->c.teams->len - 2);
+	fix->teams[0] = g_ptr_array_index(league->c.teams, i);
+	fix->teams[1] = g_ptr_array_index(league->c.teams, (j < i) ? j : j + 1);
+	fix->attendance = -1;
+	memset(fix->result, 0, sizeof(fix->result));
+
+	for(i=0;i<2;i++)
+	{
+	    for(j=0;j<fix->teams[i]->players->len;j++)
+		strategy_repair_player(&g_array_index(fix->teams[i]->players, Player, j));
+	    strategy_update_team_pre_match(fix->teams[i]);
 	}
 
-	g_print("sd %3d res %3d %3d %3d prob %.2f %.2f %.2f\n", skilldiff,
-		res[0], res[1], res[2], (gfloat)res[0] / (gfloat)matches, 
-		(gfloat)res[1] / (gfloat)matches, (gfloat)res[2] / (gfloat)matches);
+	game_get_values(fix, team_values, 0);
+	memset(&live_game, 0, sizeof(LiveGame));
+	live_game_calculate_fixture(fix, &live_game, bygfoot);
+
+	/* The home advantage gets drawn by the engine. */
+	for(j=0;j<GAME_TEAM_VALUE_END;j++)
+	    team_values[0][j] *= 1 + live_game.home_advantage;
+
+	for(i=0;i<2;i++)
+	{
+	    match_model_get_features(fix, team_values, i, features);
+	    g_array_append_vals(all_features, features, MATCH_MODEL_FEATURE_END);
+	    g_array_append_val(counts[MATCH_MODEL_RATE_GOALS], fix->result[i][0]);
+	    count = live_game.stats.values[i][LIVE_GAME_STAT_VALUE_SHOTS];
+	    g_array_append_val(counts[MATCH_MODEL_RATE_SHOTS], count);
+	}
+
+	free_live_game(&live_game);
+	fix->teams[0] = teams[0];
+	fix->teams[1] = teams[1];
     }
+
+    opt_set_int(int_opt_sim_mode, sim_mode);
+
+    for(i=0;i<MATCH_MODEL_RATE_END;i++)
+	if(!match_model_fit(all_features, counts[i], i))
+	    main_exit_program(EXIT_GENERAL,
+			      "debug_fit_match_model: the fit didn't converge.\n");
+
+    match_model_fit_difference(all_features, counts[MATCH_MODEL_RATE_GOALS]);
+
+    for(i=0;i<counts[MATCH_MODEL_RATE_GOALS]->len;i++)
+    {
+	goals_observed += g_array_index(counts[MATCH_MODEL_RATE_GOALS], gint, i);
+	goals_expected += match_model_get_rate(
+	    &g_array_index(all_features, gfloat, i * MATCH_MODEL_FEATURE_END),
+	    MATCH_MODEL_RATE_GOALS);
+    }
+
+    sprintf(buf, "%s%s%s", file_get_first_support_dir(),
+	    G_DIR_SEPARATOR_S, MATCH_MODEL_FILE);
+    match_model_save(buf);
+
+    g_print("match model: %d teams, goals per team %.3f observed %.3f expected\n"
+	    "saved to %s\n", counts[MATCH_MODEL_RATE_GOALS]->len,
+	    goals_observed / counts[MATCH_MODEL_RATE_GOALS]->len,
+	    goals_expected / counts[MATCH_MODEL_RATE_GOALS]->len, buf);
+
+    g_array_free(all_features, TRUE);
+    g_array_free(counts[MATCH_MODEL_RATE_GOALS], TRUE);
+    g_array_free(counts[MATCH_MODEL_RATE_SHOTS], TRUE);
 }
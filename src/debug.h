@@ -37,6 +37,10 @@ enum DebugOutput
     DEBUG_OUT_STDOUT_LOGFILE
 };
 
+/** The number of matches a betting odds calibration job calculates.
+    @see debug_calibrate_betting_odds() */
+#define DEBUG_CALODDS_CHUNK 1000
+
 void
 debug_action(Bygfoot *bygfoot, const gchar *text);
 
@@ -46,6 +50,9 @@ debug_reset_counter(gpointer data);
 void
 debug_calibrate_betting_odds(gint skilldiffmax, gint matches_per_skilldiff, Bygfoot *bygfoot);
 
+void
+debug_fit_match_model(gint matches, Bygfoot *bygfoot);
+
 void
 debug_writer_out(const gchar *file_name,
 				 const gchar *method_name,
@@ -25,6 +25,7 @@
 
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <time.h>
 #include <unistd.h>
 #include <zlib.h>
 #include <glib/gstdio.h>
@@ -40,8 +41,62 @@
 #include "zip/unzip.h"
 #include "zip/zip.h"
 
-#define WRITEBUFFERSIZE (8192)
-#define MAXFILENAME (256)
+/** How many bytes of savegame members may wait to be compressed
+    or parsed before the producing threads pause. */
+#define FILE_ARCHIVE_BUFFER_MAX (64 * 1024 * 1024)
+
+/** A savegame file waiting to be compressed and added
+    to the archive being written. */
+typedef struct
+{
+  gchar *name;
+  GString *contents;
+} FileArchiveJob;
+
+enum FileArchiveMemberState
+{
+  FILE_ARCHIVE_MEMBER_PENDING = 0,
+  FILE_ARCHIVE_MEMBER_INFLATING,
+  FILE_ARCHIVE_MEMBER_READY,
+  FILE_ARCHIVE_MEMBER_TAKEN
+};
+
+/** A member of the archive being read. */
+typedef struct
+{
+  unz_file_pos pos;
+  /** @see #FileArchiveMemberState */
+  gint state;
+  /** The inflated contents if the member is ready. */
+  gchar *contents;
+  gsize length;
+} FileArchiveMember;
+
+/** The zip archive savegame files get written to, or NULL.
+    @see file_archive_begin_write() */
+static zipFile file_archive_out = NULL;
+/** Whether writing a member of the archive failed. */
+static gboolean file_archive_failed = FALSE;
+/** The zip archive savegame files get read from, or NULL.
+    @see file_archive_begin_read() */
+static unzFile file_archive_in = NULL;
+/** The name of the archive being read. */
+static gchar *file_archive_zipname = NULL;
+/** The members of the archive being read in archive order, and
+    the same members keyed by name. */
+static GPtrArray *file_archive_members = NULL;
+static GHashTable *file_archive_index = NULL;
+/** The next member the inflating threads look at. */
+static gint file_archive_next_member = 0;
+/** How many bytes wait to be compressed or parsed. */
+static gsize file_archive_buffered = 0;
+/** Tells the inflating threads to stop. */
+static gboolean file_archive_reading_done = FALSE;
+/** The threads compressing or inflating archive members. */
+static GThreadPool *file_archive_pool = NULL;
+/** Protects the archive and the member states. */
+static GMutex file_archive_mutex;
+static GCond file_archive_cond;
 
 /**
  * Adds a definition directory
@@ -102,6 +157,12 @@ file_add_support_directory_recursive(Bygfoot *bygfoot, const gchar     *director
     add_pixmap_directory(directory);
   support_directories = g_list_prepend (support_directories,
       g_strdup (directory));
+
+  if(support_files != NULL)
+  {
+    g_hash_table_destroy(support_files);
+    support_files = NULL;
+  }
   while(TRUE)
   {
     file = g_dir_read_name(newdir);
@@ -121,9 +182,54 @@ file_add_support_directory_recursive(Bygfoot *bygfoot, const gchar     *director
   g_dir_close(newdir);
 }
 
+/**
+  Map the names of the files in the support directories to their
+  full paths. Like in file_find_support_file(), the first directory
+  containing a file wins.
+  @see #support_files
+ */
+  static void
+file_index_support_files(void)
+{
+#ifdef DEBUG
+  printf("file_index_support_files\n");
+#endif
+
+  GList *elem = support_directories;
+  GDir *dir;
+  const gchar *file;
+  gchar *pathname;
+
+  support_files = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+
+  while (elem)
+  {
+    dir = g_dir_open((gchar*)elem->data, 0, NULL);
+
+    while (dir != NULL && (file = g_dir_read_name(dir)) != NULL)
+    {
+      if (g_hash_table_lookup(support_files, file) != NULL)
+        continue;
+
+      pathname = g_strdup_printf ("%s%s%s", (gchar*)elem->data,
+          G_DIR_SEPARATOR_S, file);
+      if (g_file_test(pathname, G_FILE_TEST_IS_DIR))
+        g_free(pathname);
+      else
+        g_hash_table_insert(support_files, g_strdup(file), pathname);
+    }
+
+    if (dir != NULL)
+      g_dir_close(dir);
+    elem = elem->next;
+  }
+}
+
 /**
   Search the list of support directories for a given file and return
-  the full path name.
+  the full path name. Plain file names are looked up in the index of
+  the support directories first; files created after it was built
+  get found by searching the directories and are added to it.
   The return value must be freed.
   @param filename The name of the file we look for (without path).
   @param warning Whether to show a warning if we don't find the file.
@@ -140,14 +246,32 @@ file_find_support_file                       (const gchar     *filename, gboolea
 #endif
 
   GList *elem = support_directories;
+  const gchar *indexed;
+  gboolean plain = (strchr(filename, G_DIR_SEPARATOR) == NULL);
 
+  if (plain)
+  {
+    if (support_files == NULL)
+      file_index_support_files();
+
+    indexed = (const gchar*)g_hash_table_lookup(support_files, filename);
+    if (indexed != NULL && g_file_test(indexed, G_FILE_TEST_EXISTS))
+      return g_strdup(indexed);
+  }
+
+  /* Look for the file the usual way if it's new or disappeared. */
   while (elem)
   {
     gchar *pathname = g_strdup_printf ("%s%s%s", (gchar*)elem->data,
         G_DIR_SEPARATOR_S, filename);
     if (g_file_test (pathname, G_FILE_TEST_EXISTS) &&
         !g_file_test(pathname, G_FILE_TEST_IS_DIR))
+    {
+      if (plain)
+        g_hash_table_replace(support_files, g_strdup(filename),
+            g_strdup(pathname));
       return pathname;
+    }
 
     g_free (pathname);
     elem = elem->next;
@@ -555,6 +679,35 @@ file_get_international_cup_files(void)
     return files;
 }
 
+/** Strip a trailing comment and white spaces from an option line
+  and split it into the part before and after the first white space.
+  @param buf The line, without leading white spaces. Gets modified.
+  @see file_get_next_opt_line() */
+  static void
+file_parse_opt_line(gchar *buf, gchar *opt_name, gchar *opt_value)
+{
+  gint i;
+  gchar trash[SMALL];
+
+  if(strlen(buf) > 1000)
+    debug_print_message("\n the text file I'm reading contains a line longer than 1000 chars.\n\n");
+
+  for(i=0;i<strlen(buf);i++)
+    if(buf[i] == '#')
+    {
+      buf[i] = '\0';
+      break;
+    }
+
+  for(i=strlen(buf) - 1;i>0;i--)
+    if(buf[i] == '\t' || buf[i] == ' ')
+      buf[i] = '\0';
+    else
+      break;
+
+  sscanf(buf, "%[^ \t]%[ \t]%[^\n]", opt_name, trash, opt_value);
+}
+
 /** Read the file until the next line that's not a comment or
   a blank line. Split the line into the part before and after
   the first white space and copy them into the char arrays.
@@ -570,8 +723,6 @@ file_get_next_opt_line(FILE *fil, gchar *opt_name, gchar *opt_value)
   printf("file_get_next_opt_line\n");
 #endif
 
-  gint i;
-  gchar trash[SMALL];
   gchar buf[BIG];
 
   strcpy(buf, "");
@@ -586,30 +737,13 @@ file_get_next_opt_line(FILE *fil, gchar *opt_name, gchar *opt_value)
   }
 
   if(buf[0] != '#' && strlen(buf) != 0)
-  {
-    if(strlen(buf) > 1000)
-      debug_print_message("\n the text file I'm reading contains a line longer than 1000 chars.\n\n");
-
-    for(i=0;i<strlen(buf);i++)
-      if(buf[i] == '#')
-      {
-        buf[i] = '\0';
-        break;
-      }
-
-    for(i=strlen(buf) - 1;i>0;i--)
-      if(buf[i] == '\t' || buf[i] == ' ')
-        buf[i] = '\0';
-      else
-        break;
-
-    sscanf(buf, "%[^ \t]%[ \t]%[^\n]", opt_name, trash, opt_value);
-  }
+    file_parse_opt_line(buf, opt_name, opt_value);
 
   return (feof(fil) == 0);
 }
 
-/** Save an optionlist to a file. */
+/** Save an optionlist to a file.
+  @see file_write_contents() */
   void
 file_save_opt_file(const gchar *filename, OptionList *optionlist)
 {
@@ -618,23 +752,52 @@ file_save_opt_file(const gchar *filename, OptionList *optionlist)
 #endif
 
   gint i;
-  FILE *fil = NULL;
-
-  file_my_fopen(filename, "w", &fil, TRUE);
+  GString *fil = g_string_new("");
 
   for(i=0;i<optionlist->list->len;i++)
     if(g_str_has_prefix(g_array_index(optionlist->list, Option, i).name, "string_"))
-      fprintf(fil, "%s %s\n", g_array_index(optionlist->list, Option, i).name,
+      g_string_append_printf(fil, "%s %s\n", g_array_index(optionlist->list, Option, i).name,
           g_array_index(optionlist->list, Option, i).string_value);
     else
-      fprintf(fil, "%s %d\n", g_array_index(optionlist->list, Option, i).name,
+      g_string_append_printf(fil, "%s %d\n", g_array_index(optionlist->list, Option, i).name,
           g_array_index(optionlist->list, Option, i).value);
 
-  fclose(fil);
+  file_write_contents(filename, fil);
+}
+
+/** Append an option read from an option file to the list. */
+  static void
+file_opt_list_append(OptionList *optionlist, gchar *opt_name, const gchar *opt_value)
+{
+  Option new;
+
+  new.name = g_strdup(opt_name);
+  if(g_str_has_prefix(opt_name, "string_"))
+  {
+    new.string_value = g_strdup(opt_value);
+    new.value = -1;
+  }
+  else
+  {
+    new.string_value = NULL;
+    sscanf(opt_value, "%d", &new.value);
+  }
+  g_array_append_val(optionlist->list, new);
+
+  if((g_str_has_suffix(new.name, "_unix") && os_is_unix) ||
+      (g_str_has_suffix(new.name, "_win32") && !os_is_unix))
+  {
+    strcpy(opt_name, new.name);
+    opt_name[strlen(new.name) - (os_is_unix ? 5 : 6)] = '\0';
+    new.name = g_strdup(opt_name);
+    new.string_value = g_strdup(opt_value);
+    g_array_append_val(optionlist->list, new);
+  }
 }
 
 /** Load a file containing name - value pairs into
-  the specified array. */
+  the specified array. Files stored in the savegame archive
+  being read get parsed from memory. */
   void
 file_load_opt_file(const gchar *filename, OptionList *optionlist, gboolean sort)
 {
@@ -644,104 +807,39 @@ file_load_opt_file(const gchar *filename, OptionList *optionlist, gboolean sort)
 
   gint i;
   gchar opt_name[SMALL], opt_value[SMALL];
-  Option new;
+  gchar *contents = NULL, *line = NULL;
+  gchar **lines = NULL;
   FILE *fil = NULL;
 
   free_option_list(optionlist, TRUE);
 
-  file_my_fopen(filename, "r", &fil, TRUE);
-
-  while(file_get_next_opt_line(fil, opt_name, opt_value))
+  if(file_archive_in != NULL &&
+      file_get_contents(filename, &contents, NULL, NULL))
   {
-    new.name = g_strdup(opt_name);
-    if(g_str_has_prefix(opt_name, "string_"))
+    lines = g_strsplit(contents, "\n", -1);
+    for(i=0;lines[i] != NULL;i++)
     {
-      new.string_value = g_strdup(opt_value);
-      new.value = -1;
+      line = g_strchug(lines[i]);
+      if(line[0] == '#' || line[0] == '\0')
+        continue;
+
+      strcpy(opt_name, "");
+      strcpy(opt_value, "");
+      file_parse_opt_line(line, opt_name, opt_value);
+      file_opt_list_append(optionlist, opt_name, opt_value);
     }
-    else
-    {
-      new.string_value = NULL;
-      sscanf(opt_value, "%d", &new.value);
-    }
-    g_array_append_val(optionlist->list, new);
 
-    if((g_str_has_suffix(new.name, "_unix") && os_is_unix) ||
-        (g_str_has_suffix(new.name, "_win32") && !os_is_unix))
-    {
-      strcpy(opt_name, new.name);
-      opt_name[strlen(new.name) - (os_is_unix ? 5 : 6)] = '\0';
-      new.name = g_strdup(opt_name);
-      new.string_value = g_strdup(opt_value);
-      g_array_append_val(optionlist->list, new);
-    }
+    g_strfreev(lines);
+    g_free(contents);
+  }
+  else
+  {
+    file_my_fopen(filename, "r", &fil, TRUE);
 
-    /* Cache some commonly used options, since datalist lookup can be slow. */
-    //printf("%s\n", new.name);
-    #define cache_option(option_name)  \
-    if (!strcmp(new.name, #option_name)) { \
-      if (!strncmp("float_", new.name, 6)) \
-        optionlist->option_name = (gfloat)new.value / OPTION_FLOAT_DIVISOR; \
-      else \
-        optionlist->option_name = new.value; \
-    }
+    while(file_get_next_opt_line(fil, opt_name, opt_value))
+      file_opt_list_append(optionlist, opt_name, opt_value);
 
-    cache_option(float_player_streak_influence_skill);
-    cache_option(float_player_fitness_exponent);
-    cache_option(float_player_boost_skill_effect);
-    cache_option(float_player_team_weight_forward_attack);
-    cache_option(float_player_team_weight_forward_midfield);
-    cache_option(float_player_team_weight_forward_defense);
-    cache_option(float_player_team_weight_midfielder_attack);
-    cache_option(float_player_team_weight_midfielder_midfield);
-    cache_option(float_player_team_weight_midfielder_defense);
-    cache_option(float_player_team_weight_defender_attack);
-    cache_option(float_player_team_weight_defender_midfield);
-    cache_option(float_player_team_weight_defender_defense);
-    cache_option(float_player_fitness_decrease_add);
-    cache_option(float_player_streak_influence_fitness_decrease);
-    cache_option(float_player_boost_fitness_effect);
-    cache_option(float_player_fitness_decrease_factor_goalie);
-    cache_option(float_player_lsu_update_limit);
-    cache_option(float_player_streak_prob_zero);
-    cache_option(float_player_fitness_increase_variance);
-    cache_option(float_player_fitness_decrease_younger_factor);
-    cache_option(float_player_max_skill);
-    cache_option(float_player_skill_update_younger_add);
-    cache_option(float_player_skill_update_younger_factor);
-    cache_option(float_player_streak_prob_max);
-    cache_option(float_player_streak_influence_fitness_increase);
-    cache_option(float_player_fitness_increase_add);
-    cache_option(float_player_streak_length_lower);
-    cache_option(float_player_streak_length_upper);
-    cache_option(float_player_etal_scout_factor);
-    cache_option(float_player_fitness_increase_younger_factor);
-    cache_option(float_player_average_talent_variance);
-    cache_option(float_player_age_lower);
-    cache_option(float_player_age_upper);
-    cache_option(float_player_peak_age_lower);
-    cache_option(float_player_peak_age_goalie_addition);
-    cache_option(float_player_peak_age_upper);
-    cache_option(float_player_peak_region_lower);
-    cache_option(float_player_peak_region_upper);
-    cache_option(float_player_fitness_lower);
-    cache_option(float_player_fitness_upper);
-    cache_option(float_player_contract_lower);
-    cache_option(float_player_contract_upper);
-    cache_option(float_player_lsu_lower);
-    cache_option(float_player_lsu_upper);
-    cache_option(float_player_value_skill_weight);
-    cache_option(float_player_value_power);
-    cache_option(float_player_value_younger_factor);
-    cache_option(float_player_value_older_factor);
-    cache_option(float_player_wage_value_factor);
-    cache_option(float_player_wage_random_dev);
-    cache_option(float_player_pos_bound1);
-    cache_option(float_player_pos_bound2);
-    cache_option(float_player_skill_update_older_factor);
-    cache_option(float_player_skill_update_older_add);
-    cache_option(int_team_cpu_players);
-    //printf("streak: %f\n", optionlist->float_player_streak_influence_skill);
+    fclose(fil);
   }
 
   if(sort)
@@ -751,7 +849,7 @@ file_load_opt_file(const gchar *filename, OptionList *optionlist, gboolean sort)
     g_datalist_set_data(&optionlist->datalist, g_array_index(optionlist->list, Option, i).name,
         &g_array_index(optionlist->list, Option, i));
 
-  fclose(fil);
+  option_list_update_ids(optionlist);
 }
 
 /** Load the appropriate hints file. */
@@ -793,8 +891,8 @@ file_load_conf_files(void)
   file_load_opt_file(conf_file, &options, FALSE);
   g_free(conf_file);
 
-  file_load_opt_file(opt_str("string_opt_constants_file"), &constants, TRUE);
-  file_load_opt_file(opt_str("string_opt_appearance_file"), &constants_app, TRUE);
+  file_load_opt_file(opt_str(string_opt_constants_file), &constants, TRUE);
+  file_load_opt_file(opt_str(string_opt_appearance_file), &constants_app, TRUE);
   file_load_opt_file("bygfoot_tokens", &replacement_tokens, FALSE);
   file_load_hints_file();
 
@@ -822,7 +920,7 @@ file_load_user_conf_file(User *user)
   {
     g_free(conf_file);
     conf_file = 
-      file_find_support_file(opt_str("string_opt_default_user_conf_file"), TRUE);
+      file_find_support_file(opt_str(string_opt_default_user_conf_file), TRUE);
   }
 
   file_load_opt_file(conf_file, &user->options, FALSE);
@@ -880,100 +978,445 @@ file_get_first_support_dir_suffix(const gchar *suffix)
   return NULL;    
 }
 
-/** Compress the files starting with the prefix.
-  @param destfile The name of the file to create. */
-  void
-file_compress_files(const gchar *destfile, const gchar *prefix)
+/** How many threads to use for compressing and uncompressing
+  savegames. @see int_fs_save_threads */
+  gint
+file_archive_threads(void)
+{
+  gint threads = const_int(int_fs_save_threads);
+
+  return (threads > 0) ? threads : (gint)g_get_num_processors();
+}
+
+/** Compress a savegame file and add it to the archive.
+  The deflating happens in the calling thread; only adding
+  the compressed data to the archive is serialised. */
+  static void
+file_archive_compress_job(gpointer data, gpointer user_data)
+{
+  FileArchiveJob *job = (FileArchiveJob*)data;
+  z_stream stream;
+  zip_fileinfo zi;
+  time_t now = time(NULL);
+  struct tm date;
+  Bytef *out = NULL;
+  uLong crc = crc32(0L, Z_NULL, 0);
+  gint err;
+
+  memset(&stream, 0, sizeof(z_stream));
+  err = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+      -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+
+  if(err == Z_OK)
+  {
+    out = g_malloc(deflateBound(&stream, job->contents->len));
+    stream.next_in = (Bytef*)job->contents->str;
+    stream.avail_in = job->contents->len;
+    stream.next_out = out;
+    stream.avail_out = deflateBound(&stream, job->contents->len);
+    err = (deflate(&stream, Z_FINISH) == Z_STREAM_END) ? Z_OK : Z_DATA_ERROR;
+    deflateEnd(&stream);
+    crc = crc32(crc, (Bytef*)job->contents->str, job->contents->len);
+  }
+
+  memset(&zi, 0, sizeof(zip_fileinfo));
+#ifdef G_OS_UNIX
+  localtime_r(&now, &date);
+#else
+  date = *localtime(&now);
+#endif
+  zi.tmz_date.tm_sec = date.tm_sec;
+  zi.tmz_date.tm_min = date.tm_min;
+  zi.tmz_date.tm_hour = date.tm_hour;
+  zi.tmz_date.tm_mday = date.tm_mday;
+  zi.tmz_date.tm_mon = date.tm_mon;
+  zi.tmz_date.tm_year = date.tm_year;
+
+  g_mutex_lock(&file_archive_mutex);
+
+  if(file_archive_pool != NULL)
+  {
+    file_archive_buffered -= job->contents->len;
+    g_cond_broadcast(&file_archive_cond);
+  }
+
+  if(err == Z_OK)
+    err = zipOpenNewFileInZip2(file_archive_out, job->name, &zi,
+        NULL, 0, NULL, 0, NULL,
+        Z_DEFLATED, Z_DEFAULT_COMPRESSION, 1);
+  if(err == ZIP_OK)
+  {
+    err = zipWriteInFileInZip(file_archive_out, out, stream.total_out);
+    if(zipCloseFileInZipRaw(file_archive_out,
+          job->contents->len, crc) != ZIP_OK)
+      err = ZIP_ERRNO;
+  }
+
+  if(err != ZIP_OK)
+  {
+    debug_print_message("file_archive_compress_job: could not add %s to the archive\n",
+        job->name);
+    file_archive_failed = TRUE;
+  }
+
+  g_mutex_unlock(&file_archive_mutex);
+
+  g_free(out);
+  g_free(job->name);
+  g_string_free(job->contents, TRUE);
+  g_free(job);
+}
+
+/** Open the zip archive the savegame files get written to.
+  While it's open, file_write_contents() adds files as
+  archive members instead of writing them to disk; they
+  get compressed on a thread pool.
+  @param zipname The name of the archive to create.
+  @return TRUE on success, FALSE otherwise. */
+  gboolean
+file_archive_begin_write(const gchar *zipname)
 {
 #ifdef DEBUG
-  printf("file_compress_files\n");
+  printf("file_archive_begin_write\n");
 #endif
 
-  gint i;
-  GString *buf = g_string_new("");
-  gchar *basename = g_path_get_basename(prefix),
-        *dirname = g_path_get_dirname(prefix),
-        *zipbasename = g_path_get_basename(destfile),
-        *pwd = g_get_current_dir();
-  GPtrArray *files = file_dir_get_contents(dirname, basename, "");
-  int err=0;
-
-  chdir(dirname);
-  zipFile zf = zipOpen(zipbasename, 1);
-  if (zf == NULL)
+  gint threads = file_archive_threads();
+  GError *error = NULL;
+
+  file_archive_out = zipOpen(zipname, 0);
+  file_archive_failed = (file_archive_out == NULL);
+  file_archive_buffered = 0;
+
+  if(file_archive_failed)
   {
-    printf("error opening %s\n",zipbasename);
-    err= ZIP_ERRNO;
+    debug_print_message("file_archive_begin_write: could not create %s\n", zipname);
+    return FALSE;
   }
-  for(i=0;i<files->len;i++)
+
+  if(threads > 1)
   {
-    do_compress_currentfile(zf, (gchar*)g_ptr_array_index(files, i));
+    file_archive_pool = g_thread_pool_new(file_archive_compress_job, NULL,
+        threads, TRUE, &error);
+    misc_print_error(&error, FALSE);
   }
 
-  zipClose(zf, NULL);
+  return TRUE;
+}
+
+/** Wait for the pending files and finish the zip archive
+  opened with file_archive_begin_write().
+  @return TRUE if all members got written, FALSE otherwise. */
+  gboolean
+file_archive_end_write(void)
+{
+#ifdef DEBUG
+  printf("file_archive_end_write\n");
+#endif
 
-  file_remove_files(files);
-  chdir(pwd);
+  if(file_archive_pool != NULL)
+    g_thread_pool_free(file_archive_pool, FALSE, TRUE);
+  file_archive_pool = NULL;
 
-  g_string_free(buf, TRUE);
-  free_gchar_array(&files);
+  if(file_archive_out != NULL &&
+      zipClose(file_archive_out, NULL) != ZIP_OK)
+    file_archive_failed = TRUE;
 
-  g_free(basename);
-  g_free(dirname);
-  g_free(zipbasename);
-  g_free(pwd);
+  file_archive_out = NULL;
+
+  return !file_archive_failed;
 }
 
-/** Decompress the specified file. */
-  void
-file_decompress(const gchar *filename)
+/** Inflate the current member of an archive.
+  @return The member contents or NULL on error. */
+  static gchar*
+file_archive_inflate(unzFile archive, const unz_file_pos *pos, gsize *length)
+{
+  unz_file_info info;
+  gchar *contents = NULL;
+  gint read = 0;
+
+  if(unzGoToFilePos(archive, (unz_file_pos*)pos) != UNZ_OK ||
+      unzGetCurrentFileInfo(archive, &info, NULL, 0,
+        NULL, 0, NULL, 0) != UNZ_OK ||
+      unzOpenCurrentFile(archive) != UNZ_OK)
+    return NULL;
+
+  contents = g_malloc(info.uncompressed_size + 1);
+  if(info.uncompressed_size > 0)
+    read = unzReadCurrentFile(archive, contents, info.uncompressed_size);
+
+  if(unzCloseCurrentFile(archive) != UNZ_OK ||
+      read != info.uncompressed_size)
+  {
+    g_free(contents);
+    return NULL;
+  }
+
+  contents[info.uncompressed_size] = '\0';
+  *length = info.uncompressed_size;
+
+  return contents;
+}
+
+/** Inflate archive members ahead of the parser. Each worker has
+  its own archive handle and takes the next pending member until
+  there are none left; it pauses while too much inflated data is
+  waiting to be parsed. */
+  static void
+file_archive_inflate_job(gpointer data, gpointer user_data)
+{
+  unzFile archive = unzOpen((const gchar*)user_data);
+  FileArchiveMember *member = NULL;
+
+  if(archive == NULL)
+    return;
+
+  g_mutex_lock(&file_archive_mutex);
+
+  while(!file_archive_reading_done &&
+      file_archive_next_member < file_archive_members->len)
+  {
+    if(file_archive_buffered > FILE_ARCHIVE_BUFFER_MAX)
+    {
+      g_cond_wait(&file_archive_cond, &file_archive_mutex);
+      continue;
+    }
+
+    member = (FileArchiveMember*)g_ptr_array_index(file_archive_members,
+        file_archive_next_member++);
+    if(member->state != FILE_ARCHIVE_MEMBER_PENDING)
+      continue;
+
+    member->state = FILE_ARCHIVE_MEMBER_INFLATING;
+    g_mutex_unlock(&file_archive_mutex);
+
+    member->contents = file_archive_inflate(archive, &member->pos, &member->length);
+
+    g_mutex_lock(&file_archive_mutex);
+    member->state = FILE_ARCHIVE_MEMBER_READY;
+    if(member->contents != NULL)
+      file_archive_buffered += member->length;
+    g_cond_broadcast(&file_archive_cond);
+  }
+
+  g_mutex_unlock(&file_archive_mutex);
+
+  unzClose(archive);
+}
+
+/** Free an archive member entry. */
+  static void
+file_archive_member_free(gpointer data)
+{
+  FileArchiveMember *member = (FileArchiveMember*)data;
+
+  g_free(member->contents);
+  g_free(member);
+}
+
+/** Open the zip archive the savegame files get read from.
+  While it's open, file_get_contents() takes archive members
+  instead of reading files from disk. With several threads,
+  members get inflated ahead on a thread pool. */
+  gboolean
+file_archive_begin_read(const gchar *zipname)
 {
 #ifdef DEBUG
-  printf("file_decompress\n");
+  printf("file_archive_begin_read\n");
 #endif
 
-  GString *buf = g_string_new("");
-  gchar *dirname = g_path_get_dirname(filename),
-        *basename = g_path_get_basename(filename),
-        *pwd = g_get_current_dir();
-  gchar extracted_file[256];
-  chdir(dirname);
-
-  uLong i;
-  unz_global_info gi;
-  int err;
-  unzFile uf;
-
-  uf = unzOpen(filename);
-  err = unzGetGlobalInfo(uf,&gi);
-  if (err!=UNZ_OK)
-    printf("error %d with zipfile in unzGetGlobalInfo \n",err);
-
-  for (i=0;i<gi.number_entry;i++)
+  gchar name[SMALL];
+  FileArchiveMember *member = NULL;
+  gint i, err, threads = file_archive_threads();
+  GError *error = NULL;
+
+  file_archive_in = unzOpen(zipname);
+
+  if(file_archive_in == NULL)
+  {
+    debug_print_message("file_archive_begin_read: could not open %s\n", zipname);
+    return FALSE;
+  }
+
+  /* Index the members once so that looking them up
+     doesn't scan the central directory each time. */
+  file_archive_index =
+    g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+  file_archive_members = g_ptr_array_new_with_free_func(file_archive_member_free);
+
+  err = unzGoToFirstFile(file_archive_in);
+  while(err == UNZ_OK)
   {
-    if (do_extract_currentfile(uf, extracted_file) != UNZ_OK)
+    member = g_new0(FileArchiveMember, 1);
+    if(unzGetCurrentFileInfo(file_archive_in, NULL, name, SMALL,
+          NULL, 0, NULL, 0) != UNZ_OK ||
+        unzGetFilePos(file_archive_in, &member->pos) != UNZ_OK)
+    {
+      g_free(member);
       break;
+    }
+
+    g_ptr_array_add(file_archive_members, member);
+    g_hash_table_insert(file_archive_index, g_strdup(name), member);
+    err = unzGoToNextFile(file_archive_in);
+  }
+
+  file_archive_next_member = 0;
+  file_archive_buffered = 0;
+  file_archive_reading_done = FALSE;
+
+  if(threads > 1)
+  {
+    file_archive_zipname = g_strdup(zipname);
+    file_archive_pool = g_thread_pool_new(file_archive_inflate_job,
+        file_archive_zipname, threads, TRUE, &error);
+    misc_print_error(&error, FALSE);
+
+    for(i=0;file_archive_pool != NULL && i<threads;i++)
+      g_thread_pool_push(file_archive_pool, GINT_TO_POINTER(i + 1), NULL);
+  }
+
+  return TRUE;
+}
+
+/** Close the zip archive opened with file_archive_begin_read(). */
+  void
+file_archive_end_read(void)
+{
+#ifdef DEBUG
+  printf("file_archive_end_read\n");
+#endif
+
+  if(file_archive_pool != NULL)
+  {
+    g_mutex_lock(&file_archive_mutex);
+    file_archive_reading_done = TRUE;
+    g_cond_broadcast(&file_archive_cond);
+    g_mutex_unlock(&file_archive_mutex);
+
+    g_thread_pool_free(file_archive_pool, FALSE, TRUE);
+    g_free(file_archive_zipname);
+  }
+
+  if(file_archive_in != NULL)
+  {
+    unzClose(file_archive_in);
+    g_hash_table_destroy(file_archive_index);
+    g_ptr_array_free(file_archive_members, TRUE);
+  }
+
+  file_archive_pool = NULL;
+  file_archive_zipname = NULL;
+  file_archive_in = NULL;
+  file_archive_index = NULL;
+  file_archive_members = NULL;
+}
+
+/** Write the contents into a file, or into the savegame
+  archive if one is being written. Archive members are named after
+  the basename of the file. The contents get freed.
+  @see file_archive_begin_write() */
+  void
+file_write_contents(const gchar *filename, GString *contents)
+{
+#ifdef DEBUG
+  printf("file_write_contents\n");
+#endif
+
+  FILE *fil = NULL;
+  FileArchiveJob *job = NULL;
+
+  if(file_archive_out == NULL)
+  {
+    file_my_fopen(filename, "w", &fil, TRUE);
+    fwrite(contents->str, 1, contents->len, fil);
+    fclose(fil);
+    g_string_free(contents, TRUE);
+    return;
+  }
+
+  job = g_new(FileArchiveJob, 1);
+  job->name = g_path_get_basename(filename);
+  job->contents = contents;
+
+  if(file_archive_pool == NULL)
+  {
+    file_archive_compress_job(job, NULL);
+    return;
+  }
+
+  g_mutex_lock(&file_archive_mutex);
+  while(file_archive_buffered > FILE_ARCHIVE_BUFFER_MAX)
+    g_cond_wait(&file_archive_cond, &file_archive_mutex);
+  file_archive_buffered += contents->len;
+  g_mutex_unlock(&file_archive_mutex);
+
+  g_thread_pool_push(file_archive_pool, job, NULL);
+}
+
+/** Read the contents of a file like g_file_get_contents(), or
+  take the archive member with the file's basename if a savegame
+  archive is being read.
+  @see file_archive_begin_read() */
+  gboolean
+file_get_contents(const gchar *filename, gchar **contents,
+    gsize *length, GError **error)
+{
+#ifdef DEBUG
+  printf("file_get_contents\n");
+#endif
+
+  gchar *basename = NULL;
+  FileArchiveMember *member = NULL;
+  gsize len = 0;
+
+  if(file_archive_in == NULL)
+    return g_file_get_contents(filename, contents, length, error);
 
-    if ((i+1)<gi.number_entry)
+  basename = g_path_get_basename(filename);
+  member = (FileArchiveMember*)g_hash_table_lookup(file_archive_index, basename);
+  *contents = NULL;
+
+  if(member != NULL)
+  {
+    g_mutex_lock(&file_archive_mutex);
+
+    while(member->state == FILE_ARCHIVE_MEMBER_INFLATING)
+      g_cond_wait(&file_archive_cond, &file_archive_mutex);
+
+    if(member->state == FILE_ARCHIVE_MEMBER_READY)
     {
-      err = unzGoToNextFile(uf);
-      if (err!=UNZ_OK)
-      {
-        printf("error %d with zipfile in unzGoToNextFile\n",err);
-        break;
-      }
+      *contents = member->contents;
+      len = member->length;
+      if(*contents != NULL)
+        file_archive_buffered -= len;
+      g_cond_broadcast(&file_archive_cond);
     }
+
+    member->contents = NULL;
+    member->state = FILE_ARCHIVE_MEMBER_TAKEN;
+
+    g_mutex_unlock(&file_archive_mutex);
+
+    /* Nobody inflated it yet (or it got read before). */
+    if(*contents == NULL)
+      *contents = file_archive_inflate(file_archive_in, &member->pos, &len);
   }
 
-  chdir(pwd);
+  if(*contents == NULL)
+  {
+    g_set_error(error, G_FILE_ERROR, G_FILE_ERROR_NOENT,
+        "%s not found in the archive", basename);
+    g_free(basename);
+    return FALSE;
+  }
 
-  g_string_free(buf, TRUE);
+  if(length != NULL)
+    *length = len;
 
-  g_free(dirname);
   g_free(basename);
 
-  chdir(pwd);
-  g_free(pwd);
+  return TRUE;
 }
 
 /** Remove the files defined in the 'files' array
@@ -1008,10 +1451,10 @@ file_copy_file(const gchar *source_file, const gchar *dest_file)
   GString *buf = g_string_new("");
 
   if(os_is_unix)
-    g_string_printf(buf, "%s %s %s", const_str("string_fs_copy_file_command"),
+    g_string_printf(buf, "%s %s %s", const_str(string_fs_copy_file_command),
         source_file, dest_file);
   else
-    g_string_printf(buf, "%s \"%s\" \"%s\"", const_str("string_fs_copy_file_command"),
+    g_string_printf(buf, "%s \"%s\" \"%s\"", const_str(string_fs_copy_file_command),
         source_file, dest_file);
 
   file_my_system(buf);
@@ -1134,174 +1577,6 @@ file_load_text_from_saves(const gchar *filename)
   return g_strdup(buf);   
 }
 
-int do_extract_currentfile(unzFile uf, gchar *extracted_file)
-{
-  gchar filename_inzip[256];
-  int err=UNZ_OK;
-  FILE *fout=NULL;
-  void* buf;
-  uInt size_buf;
-  unz_file_info file_info;
-  err = unzGetCurrentFileInfo(uf,&file_info,filename_inzip,sizeof(filename_inzip),NULL,0,NULL,0);
-
-  // copy the filename to extracted file
-  g_sprintf(extracted_file, "%s", filename_inzip);
-
-  if (err!=UNZ_OK)
-  {
-    printf("error %d with zipfile in unzGetCurrentFileInfo\n",err);
-    return err;
-  }
-
-  size_buf = WRITEBUFFERSIZE;
-  buf = (void*)malloc(size_buf);
-  if (buf==NULL)
-  {
-    printf("Error allocating memory\n");
-    return UNZ_INTERNALERROR;
-  }
-  err = unzOpenCurrentFile(uf);
-  if (err!=UNZ_OK)
-  {
-    printf("error %d with zipfile in unzOpenCurrentFile\n",err);
-  }
-  fout=fopen(filename_inzip,"wb");
-  if (fout==NULL)
-  {
-    printf("error opening %s\n",filename_inzip);
-  }
-
-  if (fout!=NULL)
-  {
-    #ifdef DEBUG
-      printf(" extracting: %s\n",filename_inzip);
-    #endif
-
-    do
-    {
-      err = unzReadCurrentFile(uf,buf,size_buf);
-      if (err<0)  
-      {
-        printf("error %d with zipfile in unzReadCurrentFile\n",err);
-        break;
-      }
-      if (err>0)
-        if (fwrite(buf,err,1,fout)!=1)
-        {
-          printf("error in writing extracted file\n");
-          err=UNZ_ERRNO;
-          break;
-        }
-    }
-    while (err>0);
-    if (fout)
-      fclose(fout);
-  }
-
-  if (err==UNZ_OK)
-  {
-    err = unzCloseCurrentFile (uf);
-    if (err!=UNZ_OK)
-    {
-      printf("error %d with zipfile in unzCloseCurrentFile\n",err);
-    }
-  }
-  else
-    unzCloseCurrentFile(uf); /* don't lose the error */ 
-  return err;
-}
-
-int do_compress_currentfile(zipFile zf, char* fileToZip)
-{
-  int err=0;
-  int size_buf=0;
-  void* buf=NULL;
-  size_buf = WRITEBUFFERSIZE;
-  buf = (void*)malloc(size_buf);
-  if (buf==NULL)
-  {
-    printf("Error allocating memory\n");
-    return ZIP_INTERNALERROR;
-  }
-  if (zf == NULL)
-  {
-    printf("error zip file not open");
-    err= ZIP_ERRNO;
-  }
-  #ifdef DEBUG
-  else
-    printf("creating %s\n",fileToZip);
-  #endif
-
-  FILE * fin;
-  int size_read;
-  zip_fileinfo zi;
-
-  zi.tmz_date.tm_sec = zi.tmz_date.tm_min = zi.tmz_date.tm_hour =
-    zi.tmz_date.tm_mday = zi.tmz_date.tm_mon = zi.tmz_date.tm_year = 0;
-  zi.dosDate = 0;
-  zi.internal_fa = 0;
-  zi.external_fa = 0;
-  file_time(fileToZip,&zi.tmz_date,&zi.dosDate);
-  int opt_compress_level=Z_DEFAULT_COMPRESSION;
-
-  /**/
-  err = zipOpenNewFileInZip(zf,fileToZip,&zi,
-      NULL,0,NULL,0,NULL /* comment*/,
-      (opt_compress_level != 0) ? Z_DEFLATED : 0,
-      opt_compress_level);
-
-  if (err != ZIP_OK)
-    printf("error in opening %s in zipfile\n",fileToZip);
-  else
-  {
-    fin = fopen(fileToZip,"rb");
-    if (fin==NULL)
-    {
-      err=ZIP_ERRNO;
-      printf("error in opening %s for reading\n",fileToZip);
-    }
-  }
-
-  if (err == ZIP_OK)
-    do
-    {
-      err = ZIP_OK;
-      size_read = (int)fread(buf,1,size_buf,fin);
-      if (size_read < size_buf)
-        if (feof(fin)==0)
-        {
-          printf("error in reading %s\n",fileToZip);
-          err = ZIP_ERRNO;
-        }
-
-      if (size_read>0)
-      {
-        err = zipWriteInFileInZip (zf,buf,size_read);
-        if (err<0)
-        {
-          printf("error in writing %s in the zipfile\n",
-              fileToZip);
-        }
-
-      }
-    } while ((err == ZIP_OK) && (size_read>0));
-
-  if (fin)
-    fclose(fin);
-
-  if (err<0)
-    err=ZIP_ERRNO;
-  else
-  {
-    err = zipCloseFileInZip(zf);
-    if (err!=ZIP_OK)
-      printf("error in closing %s in the zipfile\n",
-          fileToZip);
-  }
-  return 0;
-}
-
 /** Return the path to a resource in the Mac OS X bundle. */
   gchar*
 file_get_mac_resource_path(const gchar *resource)
@@ -1323,47 +1598,3 @@ file_get_mac_resource_path(const gchar *resource)
   return g_strdup(buf);
 #endif
 }
-
-/**
- *    char *f;              name of file to get info on
- *   tm_zip *tmzip;         return value: access, modific. and creation times
- *   uLong *dt;             dostime
- */
-uLong file_time(char *f, tm_zip *tmzip, uLong *dt)
-{
-  int ret=0;
-  struct stat s;        /* results of stat() */
-  struct tm* filedate;
-  time_t tm_t=0;
-
-  if (strcmp(f,"-")!=0)
-  {
-    char name[MAXFILENAME+1];
-    int len = strlen(f);
-    if (len > MAXFILENAME)
-      len = MAXFILENAME;
-
-    strncpy(name, f,MAXFILENAME-1);
-    /* strncpy doesnt append the trailing NULL, of the string is too long. */
-    name[ MAXFILENAME ] = '\0';
-
-    if (name[len - 1] == '/')
-      name[len - 1] = '\0';
-    /* not all systems allow stat'ing a file with / appended */
-    if (g_stat(name,&s)==0)
-    {
-      tm_t = s.st_mtime;
-      ret = 1;
-    }
-  }
-  filedate = localtime(&tm_t);
-
-  tmzip->tm_sec  = filedate->tm_sec;
-  tmzip->tm_min  = filedate->tm_min;
-  tmzip->tm_hour = filedate->tm_hour;
-  tmzip->tm_mday = filedate->tm_mday;
-  tmzip->tm_mon  = filedate->tm_mon ;
-  tmzip->tm_year = filedate->tm_year;
-
-  return ret;
-}
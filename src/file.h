@@ -99,11 +99,27 @@ file_get_first_support_dir(void);
 const gchar*
 file_get_first_support_dir_suffix(const gchar *suffix);
 
+gint
+file_archive_threads(void);
+
+gboolean
+file_archive_begin_write(const gchar *zipname);
+
+gboolean
+file_archive_end_write(void);
+
+gboolean
+file_archive_begin_read(const gchar *zipname);
+
 void
-file_compress_files(const gchar *destfile, const gchar *prefix);
+file_archive_end_read(void);
 
 void
-file_decompress(const gchar *filename);
+file_write_contents(const gchar *filename, GString *contents);
+
+gboolean
+file_get_contents(const gchar *filename, gchar **contents,
+                  gsize *length, GError **error);
 
 void
 file_remove_files(const GPtrArray *files);
@@ -126,16 +142,7 @@ file_load_text_from_saves(const gchar *filename);
 void
 file_store_text_in_saves(const gchar *filename, const gchar *text);
 
-int
-do_extract_currentfile(unzFile uf, gchar *extracted_file);
-
-int
-do_compress_currentfile(zipFile zf, char* fileToZip);
-
 gchar*
 file_get_mac_resource_path(const gchar *resource);
 
-uLong
-file_time(char *f, tm_zip *tmzip, uLong *dt);
-
 #endif
@@ -47,10 +47,10 @@ finance_update_user_weekly(User *user)
     Team *tm = user->tm;
     Team *new_team = NULL;
     gfloat physio_factor[4] =
-	{const_float("float_finance_physio_factor1"),
-	 const_float("float_finance_physio_factor2"),
-	 const_float("float_finance_physio_factor3"),
-	 const_float("float_finance_physio_factor4")};
+	{const_float(float_finance_physio_factor1),
+	 const_float(float_finance_physio_factor2),
+	 const_float(float_finance_physio_factor3),
+	 const_float(float_finance_physio_factor4)};
 
     if(user->money > G_MAXINT - 50000000)
     {
@@ -83,10 +83,10 @@ finance_update_user_weekly(User *user)
     if(user->counters[COUNT_USER_NEW_SPONSOR] > 1)
 	user->counters[COUNT_USER_NEW_SPONSOR]--;
     else if(user->sponsor.contract == 4 && 
-	    math_rnd(0, 1) < ((1 - const_float("float_sponsor_continue_prob")) / 
-			      (2 * (gfloat)const_int("int_user_success_offer_limit")) *
+	    math_rnd(0, 1) < ((1 - const_float(float_sponsor_continue_prob)) / 
+			      (2 * (gfloat)const_int(int_user_success_offer_limit)) *
 			      user->counters[COUNT_USER_SUCCESS]) +
-	    (1 - (1 - const_float("float_sponsor_continue_prob")) / 2))
+	    (1 - (1 - const_float(float_sponsor_continue_prob)) / 2))
 	user->counters[COUNT_USER_NEW_SPONSOR] = -1;
     else if(user->sponsor.contract == 0)
 	user->counters[COUNT_USER_NEW_SPONSOR] = 1;
@@ -128,12 +128,12 @@ finance_update_user_weekly(User *user)
     {
 	user->counters[COUNT_USER_OVERDRAWN]++;
 	if(user->counters[COUNT_USER_OVERDRAWN] <=
-	   const_int("int_finance_overdraw_limit"))
+	   const_int(int_finance_overdraw_limit))
 	{
 	    user_event_add(user, EVENT_TYPE_OVERDRAW, 
 			   user->counters[COUNT_USER_OVERDRAWN], -1, NULL, NULL);
 	    user->counters[COUNT_USER_POSITIVE] =
-		const_int("int_finance_overdraw_positive");
+		const_int(int_finance_overdraw_positive);
 	}
     }
     else if(user->counters[COUNT_USER_POSITIVE] > -1)
@@ -192,13 +192,13 @@ finance_team_drawing_credit_loan(const Team *tm, gboolean loan)
     for(i=0;i<tm->players->len;i++)
 	sum += player_of_idx_team(tm, i)->value;
     
-    sum = (sum * const_float("float_finance_credit_player_value_weight")) +
+    sum = (sum * const_float(float_finance_credit_player_value_weight)) +
 	((gfloat)tm->stadium.capacity * 
-	 powf(tm->stadium.safety, const_float("float_finance_credit_stadium_safety_exponent")) *
-	 const_float("float_finance_credit_stadium_weight"));
+	 powf(tm->stadium.safety, const_float(float_finance_credit_stadium_safety_exponent)) *
+	 const_float(float_finance_credit_stadium_weight));
 
-    sum *= (loan) ? const_float("float_finance_credit_factor_loan") :
-	const_float("float_finance_credit_factor_drawing");
+    sum *= (loan) ? const_float(float_finance_credit_factor_loan) :
+	const_float(float_finance_credit_factor_drawing);
 
     return (gint)rint(sum);
 }
@@ -220,7 +220,7 @@ finance_get_loan(gint value)
 
     if(current_user.counters[COUNT_USER_LOAN] == -1)
         {
-            current_user.counters[COUNT_USER_LOAN] = const_int("int_finance_payback_weeks");
+            current_user.counters[COUNT_USER_LOAN] = const_int(int_finance_payback_weeks);
             current_user.debt_interest = current_interest;
         }
     else
@@ -250,7 +250,7 @@ finance_pay_loan(User *user, gint value)
 #endif
 
     gint add = (gint)rint((gfloat)value / (gfloat)(-user->debt) * 
-                          (gfloat)const_int("int_finance_payback_weeks"));
+                          (gfloat)const_int(int_finance_payback_weeks));
 
     if(value > -user->debt)
         value = -user->debt;
@@ -269,7 +269,7 @@ finance_pay_loan(User *user, gint value)
     {
 	user->counters[COUNT_USER_LOAN] = 
 	    MIN(user->counters[COUNT_USER_LOAN] + add,
-		const_int("int_finance_payback_weeks"));
+		const_int(int_finance_payback_weeks));
 	game_gui_print_message(_("You have %d weeks to pay back the rest of your loan."),
 			       user->counters[COUNT_USER_LOAN]);
     }
@@ -291,30 +291,30 @@ finance_get_stadium_improvement_cost(gfloat value, gboolean capacity)
     if(capacity)
     {
 	return_value = finance_wage_unit(current_user.tm) * 
-	    (value / (gfloat)const_int("int_stadium_improvement_base_seats"))*
-	    const_float("float_stadium_improvement_wage_unit_factor_seats");
+	    (value / (gfloat)const_int(int_stadium_improvement_base_seats))*
+	    const_float(float_stadium_improvement_wage_unit_factor_seats);
 
-	if(value - (gfloat)const_int("int_stadium_improvement_base_seats") >= 
-	   const_int("int_stadium_improvement_max_discount_seats"))
-	    return_value *= (1 - const_float("float_stadium_improvement_max_discount"));
+	if(value - (gfloat)const_int(int_stadium_improvement_base_seats) >= 
+	   const_int(int_stadium_improvement_max_discount_seats))
+	    return_value *= (1 - const_float(float_stadium_improvement_max_discount));
 	else
-	    return_value *= (1 - const_float("float_stadium_improvement_max_discount") *
-			     ((value - (gfloat)const_int("int_stadium_improvement_base_seats")) / 
-			      (gfloat)const_int("int_stadium_improvement_max_discount_seats")));
+	    return_value *= (1 - const_float(float_stadium_improvement_max_discount) *
+			     ((value - (gfloat)const_int(int_stadium_improvement_base_seats)) / 
+			      (gfloat)const_int(int_stadium_improvement_max_discount_seats)));
     }
     else
     {
 	return_value = finance_wage_unit(current_user.tm) * 
-	    (value / const_float("float_stadium_improvement_base_safety"))*
-	    const_float("float_stadium_improvement_wage_unit_factor_safety");
+	    (value / const_float(float_stadium_improvement_base_safety))*
+	    const_float(float_stadium_improvement_wage_unit_factor_safety);
 
-	if(value - const_float("float_stadium_improvement_base_safety") >=
-	   const_float("float_stadium_improvement_max_discount_safety"))
-	    return_value *= (1 - const_float("float_stadium_improvement_max_discount"));
+	if(value - const_float(float_stadium_improvement_base_safety) >=
+	   const_float(float_stadium_improvement_max_discount_safety))
+	    return_value *= (1 - const_float(float_stadium_improvement_max_discount));
 	else
-	    return_value *= (1 - const_float("float_stadium_improvement_max_discount") *
-			     ((value - const_float("float_stadium_improvement_base_safety")) / 
-			      const_float("float_stadium_improvement_max_discount_safety")));
+	    return_value *= (1 - const_float(float_stadium_improvement_max_discount) *
+			     ((value - const_float(float_stadium_improvement_base_safety)) / 
+			      const_float(float_stadium_improvement_max_discount_safety)));
     }
 	
     return (gint)rint(return_value);
@@ -335,11 +335,11 @@ finance_get_stadium_improvement_duration(gfloat value, gboolean capacity)
 
     if(capacity)
 	return_value = (gint)((value - 1) /
-			      (gfloat)const_int("int_stadium_improvement_base_seats")) + 1;
+			      (gfloat)const_int(int_stadium_improvement_base_seats)) + 1;
     else
 	return_value = 
 	    (gint)(((gint)rint(value * 100) - 1) /
-		   (gint)rint(const_float("float_stadium_improvement_base_safety") * 100)) + 1;
+		   (gint)rint(const_float(float_stadium_improvement_base_safety) * 100)) + 1;
 
     return return_value;
 }
@@ -359,8 +359,8 @@ finance_assign_game_money(const Fixture *fix)
 	(fix->competition->id < ID_CUP_START ||
 	 (fix->competition->id >= ID_CUP_START &&
 	  query_league_cup_has_property(fix->competition->id, "national"))) ?
-	const_float("float_game_finance_journey_factor_national") :
-	const_float("float_game_finance_journey_factor_international");    
+	const_float(float_game_finance_journey_factor_national) :
+	const_float(float_game_finance_journey_factor_international);    
     gint ticket_income[2] = {0, 0};
     Cup *cup = (Cup*)fix->competition;
 
@@ -388,8 +388,8 @@ finance_assign_game_money(const Fixture *fix)
 	    if(i == 0 && debug < 50)
 	    {
 		fix->teams[0]->stadium.safety -= 
-		    math_rnd(const_float("float_game_stadium_safety_deterioration_lower"),
-			     const_float("float_game_stadium_safety_deterioration_upper"));
+		    math_rnd(const_float(float_game_stadium_safety_deterioration_lower),
+			     const_float(float_game_stadium_safety_deterioration_upper));
 		fix->teams[0]->stadium.safety = CLAMP(fix->teams[0]->stadium.safety, 0, 1);
 	    }
 
@@ -411,12 +411,12 @@ finance_update_current_interest(Bygfoot *bygfoot)
     printf("finance_update_current_interest\n");
 #endif
 
-    current_interest += math_rndi(-1, 1) * const_float("float_finance_interest_step");
+    current_interest += math_rndi(-1, 1) * const_float(float_finance_interest_step);
     
-    if(current_interest < const_float("float_finance_interest_lower"))
-        current_interest = const_float("float_finance_interest_lower");
-    else if(current_interest > const_float("float_finance_interest_upper"))
-        current_interest = const_float("float_finance_interest_upper"); 
+    if(current_interest < const_float(float_finance_interest_lower))
+        current_interest = const_float(float_finance_interest_lower);
+    else if(current_interest > const_float(float_finance_interest_upper))
+        current_interest = const_float(float_finance_interest_upper); 
 }
 
 /** Calculate the weekly installment for an automatic loan repayment
@@ -32,6 +32,7 @@
 #include "maths.h"
 #include "misc.h"
 #include "option.h"
+#include "registry.h"
 #include "user.h"
 #include "table.h"
 #include "team.h"
@@ -83,6 +84,7 @@ fixture_write_league_fixtures(League *league)
     g_ptr_array_free(teams, TRUE);
     g_array_sort_with_data(league->fixtures, fixture_compare_func, 
 			   GINT_TO_POINTER(FIXTURE_COMPARE_DATE + 100));
+    fixture_schedule_invalidate();
 
     if(league->joined_leagues->len > 0)
     {
@@ -107,6 +109,8 @@ fixture_write_league_fixtures(League *league)
         /** Move matches to earlier weeks if possible. */
         fixtures_condense(league->fixtures);
     }
+
+    registry_update_fixtures(&league->fixtures);
 }
 
 /** Write the fixtures for the given cup
@@ -383,6 +387,7 @@ fixture_update_write_replays(Cup *cup)
 			  &cup->c, round, replay_number,
 			  !g_array_index(cup->rounds, CupRound, round).neutral,
 			  FALSE, (g_array_index(cup->rounds, CupRound, round).replay == replay_number));
+    registry_update_fixtures(&cup->fixtures);
 
     if(g_array_index(fixtures, Fixture, fixtures->len - 1).replay_number == replay_number)
     {
@@ -422,7 +427,7 @@ fixture_write_cup_round_robin(Cup *cup, gint cup_round, GPtrArray *teams,
 			  "fixture_write_cup_round_robin: cup %s round %d: number of teams (%d) less than number of groups (%d)\n", 
 			  cup->c.name, cup_round, teams->len, number_of_groups);
 
-    if(cupround->randomise_teams || opt_int("int_opt_randomise_teams"))
+    if(cupround->randomise_teams || opt_int(int_opt_randomise_teams))
 	g_ptr_array_sort_with_data(teams, (GCompareDataFunc)team_compare_func,
 			       GINT_TO_POINTER(TEAM_COMPARE_AV_SKILL));
 
@@ -437,7 +442,7 @@ fixture_write_cup_round_robin(Cup *cup, gint cup_round, GPtrArray *teams,
     }
     
     cnt = 0;
-    if(!cupround->randomise_teams && !opt_int("int_opt_randomise_teams"))
+    if(!cupround->randomise_teams && !opt_int(int_opt_randomise_teams))
     {
 	for(i=0;i<number_of_groups;i++)
 	    for(j=0;j<team_num + (i < plus_div);j++)
@@ -486,6 +491,8 @@ fixture_write_cup_round_robin(Cup *cup, gint cup_round, GPtrArray *teams,
 
     g_array_sort_with_data(cup->fixtures, fixture_compare_func,
 			   GINT_TO_POINTER(FIXTURE_COMPARE_DATE + 100));
+    fixture_schedule_invalidate();
+    registry_update_fixtures(&cup->fixtures);
 
     cup->next_fixture_update_week = (cup_round < cup->rounds->len - 1) ?
 	g_array_index(cup->fixtures, Fixture, cup->fixtures->len - 1).week_number : 1000;
@@ -757,6 +764,8 @@ fixture_write_knockout_round(Cup *cup, gint cup_round, GPtrArray *teams,
 
     g_array_sort_with_data(cup->fixtures, fixture_compare_func,
 			   GINT_TO_POINTER(FIXTURE_COMPARE_DATE + 100));
+    fixture_schedule_invalidate();
+    registry_update_fixtures(&cup->fixtures);
 
     cup->next_fixture_update_week = 
 	(cup_round < cup->rounds->len - 1 || round->replay > 0) ?
@@ -813,6 +822,7 @@ fixture_write(GArray *fixtures, Team *home_team, Team *away_team, gint week_numb
     new.attendance = -1;
 
     g_array_append_val(fixtures, new);
+    fixture_schedule_invalidate();
 }
 
 /** Return the round of the week which doesn't contain
@@ -967,6 +977,221 @@ query_fixture_has_tables(const Fixture *fix)
 	    cup_has_tables((Cup*)fix->competition) == fix->round);
 }
 
+/** Find out whether a team takes part in more than one
+    of the fixtures.
+    @param fixtures The fixtures we examine.
+    @return TRUE or FALSE. */
+gboolean
+query_fixture_team_plays_twice(const GPtrArray *fixtures)
+{
+#ifdef DEBUG
+    printf("query_fixture_team_plays_twice\n");
+#endif
+
+    gint i, j;
+    gboolean return_value = FALSE;
+    GHashTable *teams = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    for(i=0;i<fixtures->len && !return_value;i++)
+	for(j=0;j<2 && !return_value;j++)
+	{
+	    Team *tm = ((Fixture*)g_ptr_array_index(fixtures, i))->teams[j];
+
+	    if(g_hash_table_lookup(teams, tm) != NULL)
+		return_value = TRUE;
+	    else
+		g_hash_table_insert(teams, tm, tm);
+	}
+
+    g_hash_table_destroy(teams);
+
+    return return_value;
+}
+
+/** Incremented whenever fixtures get moved around; the
+    schedules built before that are out of date then. */
+static gint fixture_schedule_stamp = 0;
+
+/** The key of a week round in the schedule tables. */
+#define fixture_schedule_key(week_number, week_round_number) GINT_TO_POINTER((week_number) * 100 + (week_round_number))
+
+/** Mark all fixture schedules as out of date. Has to be called
+    whenever fixtures are added, removed, sorted or moved
+    to a different week round.
+    @see fixture_schedule_get() */
+void
+fixture_schedule_invalidate(void)
+{
+    fixture_schedule_stamp++;
+}
+
+/** Free function for the schedule tables. */
+static void
+fixture_schedule_free_round(gpointer round)
+{
+    g_array_free((GArray*)round, TRUE);
+}
+
+/** The home and the away team of fixtures in the
+    head-to-head tables. */
+typedef struct
+{
+    const Team *home, *away;
+} FixturePair;
+
+static guint
+fixture_pair_hash(gconstpointer key)
+{
+    const FixturePair *pair = (const FixturePair*)key;
+
+    return g_direct_hash(pair->home) * 31 + g_direct_hash(pair->away);
+}
+
+static gboolean
+fixture_pair_equal(gconstpointer a, gconstpointer b)
+{
+    const FixturePair *pair1 = (const FixturePair*)a,
+	*pair2 = (const FixturePair*)b;
+
+    return (pair1->home == pair2->home && pair1->away == pair2->away);
+}
+
+/** Rebuild the schedule of the competition if the
+    fixtures changed since it was built. Not thread-safe.
+    @param comp The league or cup.
+    @param fixtures The fixtures array of the competition. */
+static FixtureSchedule*
+fixture_schedule_update(Competition *comp, const GArray *fixtures)
+{
+    gint i;
+    FixtureSchedule *schedule = &comp->schedule;
+    GArray *round = NULL, *pair_fixtures = NULL;
+    const Fixture *fix = NULL;
+    FixturePair pair, *new_pair = NULL;
+
+    if(schedule->rounds == NULL || schedule->fixtures != fixtures ||
+       schedule->len != fixtures->len || schedule->stamp != fixture_schedule_stamp)
+    {
+	if(schedule->rounds == NULL)
+	{
+	    schedule->rounds = 
+		g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL,
+				      fixture_schedule_free_round);
+	    schedule->pairs = 
+		g_hash_table_new_full(fixture_pair_hash, fixture_pair_equal, g_free,
+				      fixture_schedule_free_round);
+	}
+	else
+	{
+	    g_hash_table_remove_all(schedule->rounds);
+	    g_hash_table_remove_all(schedule->pairs);
+	}
+
+	for(i=0;i<fixtures->len;i++)
+	{
+	    fix = &g_array_index(fixtures, Fixture, i);
+	    round = g_hash_table_lookup(
+		schedule->rounds,
+		fixture_schedule_key(fix->week_number, fix->week_round_number));
+
+	    if(round == NULL)
+	    {
+		round = g_array_new(FALSE, FALSE, sizeof(gint));
+		g_hash_table_insert(
+		    schedule->rounds,
+		    fixture_schedule_key(fix->week_number, fix->week_round_number),
+		    round);
+	    }
+
+	    g_array_append_val(round, i);
+
+	    pair.home = fix->teams[0];
+	    pair.away = fix->teams[1];
+	    pair_fixtures = g_hash_table_lookup(schedule->pairs, &pair);
+
+	    if(pair_fixtures == NULL)
+	    {
+		new_pair = g_new(FixturePair, 1);
+		*new_pair = pair;
+		pair_fixtures = g_array_new(FALSE, FALSE, sizeof(gint));
+		g_hash_table_insert(schedule->pairs, new_pair, pair_fixtures);
+	    }
+
+	    g_array_append_val(pair_fixtures, i);
+	}
+
+	schedule->fixtures = fixtures;
+	schedule->len = fixtures->len;
+	schedule->stamp = fixture_schedule_stamp;
+    }
+
+    return schedule;
+}
+
+/** Return the indices of the fixtures in the array
+    playing in the given week round, or NULL if there are none.
+    The schedule of the competition gets rebuilt if the fixtures
+    changed since it was built. Not thread-safe.
+    @param comp The league or cup.
+    @param fixtures The fixtures array of the competition. */
+static const GArray*
+fixture_schedule_get(Competition *comp, const GArray *fixtures,
+		     gint week_number, gint week_round_number)
+{
+    return (const GArray*)g_hash_table_lookup(
+	fixture_schedule_update(comp, fixtures)->rounds,
+	fixture_schedule_key(week_number, week_round_number));
+}
+
+/** Return the last fixture of the cup round (-1 for leagues)
+    in which the home team played the away team up to the
+    given week round, or NULL if there's none. Not thread-safe.
+    @param comp The league or cup.
+    @param fixtures The fixtures array of the competition. */
+const Fixture*
+fixture_get_head_to_head(Competition *comp, const GArray *fixtures,
+			 const Team *home, const Team *away, gint round,
+			 gint week_number, gint week_round_number)
+{
+#ifdef DEBUG
+    printf("fixture_get_head_to_head\n");
+#endif
+
+    gint i;
+    FixturePair pair = {home, away};
+    const GArray *indices = g_hash_table_lookup(
+	fixture_schedule_update(comp, fixtures)->pairs, &pair);
+    const Fixture *fix = NULL;
+
+    if(indices != NULL)
+	for(i=indices->len - 1;i>=0;i--)
+	{
+	    fix = &g_array_index(fixtures, Fixture, g_array_index(indices, gint, i));
+	    if(fix->round == round &&
+	       fix->week_number <= week_number &&
+	       fix->week_round_number <= week_round_number)
+		return fix;
+	}
+
+    return NULL;
+}
+
+/** Append the fixtures of a competition playing in
+    the given week round to the pointer array. */
+static void
+fixture_schedule_add_fixtures(GPtrArray *fixtures_array, Competition *comp,
+			      GArray *fixtures, gint week_number, gint week_round_number)
+{
+    gint i;
+    const GArray *round = fixture_schedule_get(comp, fixtures,
+					       week_number, week_round_number);
+
+    if(round != NULL)
+	for(i=0;i<round->len;i++)
+	    g_ptr_array_add(fixtures_array, 
+			    &g_array_index(fixtures, Fixture, g_array_index(round, gint, i)));
+}
+
 /** Find out whether there were games in the specified league
     or cup at the specified time.
     @param clid The cup or league id.
@@ -980,15 +1205,9 @@ query_fixture_in_week_round(gint clid, gint week_number, gint week_round_number)
     printf("query_fixture_in_week_round\n");
 #endif
 
-    gint i;
-    GArray *fixtures = league_cup_get_fixtures(clid);
-
-    for(i=0;i<fixtures->len;i++)
-	if(g_array_index(fixtures, Fixture, i).week_number == week_number &&
-	   g_array_index(fixtures, Fixture, i).week_round_number == week_round_number)
-	    return TRUE;
-
-    return FALSE;
+    return (fixture_schedule_get(competition_get_from_clid(clid),
+				 league_cup_get_fixtures(clid),
+				 week_number, week_round_number) != NULL);
 }
 
 /** Return a pointer to the first leg going with
@@ -1033,14 +1252,11 @@ fixture_get_week_list_clid(gint clid, gint week_number, gint week_round_number)
     printf("fixture_get_week_list_clid\n");
 #endif
 
-    gint i;
-    GArray *fixtures = league_cup_get_fixtures(clid);
     GPtrArray *fixtures_array = g_ptr_array_new();
 
-    for(i=0;i<fixtures->len;i++)
-	if(g_array_index(fixtures, Fixture, i).week_number == week_number &&
-	   g_array_index(fixtures, Fixture, i).week_round_number == week_round_number)
-	    g_ptr_array_add(fixtures_array, &g_array_index(fixtures, Fixture, i));
+    fixture_schedule_add_fixtures(fixtures_array, competition_get_from_clid(clid),
+				  league_cup_get_fixtures(clid),
+				  week_number, week_round_number);
 
     return fixtures_array;
 }
@@ -1053,23 +1269,19 @@ fixture_get_week_list(gint week_number, gint week_round_number)
     printf("fixture_get_week_list\n");
 #endif
 
-    gint i, j;
+    gint i;
     GPtrArray *fixtures = g_ptr_array_new();
 
     for(i=0;i<country.leagues->len;i++) {
         League *league = g_ptr_array_index(country.leagues, i);
-	for(j=0;j<league->fixtures->len;j++)
-	    if(g_array_index(league->fixtures, Fixture, j).week_number == week_number &&
-	       g_array_index(league->fixtures, Fixture, j).week_round_number == week_round_number)
-		g_ptr_array_add(fixtures, &g_array_index(league->fixtures, Fixture, j));
+	fixture_schedule_add_fixtures(fixtures, &league->c, league->fixtures,
+				      week_number, week_round_number);
     }
 
     for(i=0;i<country.allcups->len;i++) {
         Cup *cup = g_ptr_array_index(country.allcups, i);
-	for(j=0;j<cup->fixtures->len;j++)
-	    if(g_array_index(cup->fixtures, Fixture, j).week_number == week_number &&
-	       g_array_index(cup->fixtures, Fixture, j).week_round_number == week_round_number)
-		g_ptr_array_add(fixtures, &g_array_index(cup->fixtures, Fixture, j));
+	fixture_schedule_add_fixtures(fixtures, &cup->c, cup->fixtures,
+				      week_number, week_round_number);
     }
 
     return fixtures;
@@ -1126,25 +1338,26 @@ fixture_get_number_of_matches(gint week_number, gint week_round_number)
     printf("fixture_get_number_of_matches\n");
 #endif
 
-    gint i, j;
+    gint i;
     gint sum = 0;
+    const GArray *round = NULL;
 
     for(i=0;i<country.allcups->len;i++) {
         Cup *cup = g_ptr_array_index(country.allcups, i);
-	for(j=0;j<cup->fixtures->len;j++)
-	    if(g_array_index(cup->fixtures, Fixture, j).week_number == week_number &&
-	       g_array_index(cup->fixtures, Fixture, j).week_round_number == week_round_number)
-		sum++;
+	round = fixture_schedule_get(&cup->c, cup->fixtures,
+				     week_number, week_round_number);
+	if(round != NULL)
+	    sum += round->len;
     }
 
     for(i=0;i<country.leagues->len;i++) {
         League *league = g_ptr_array_index(country.leagues, i);
 	if(week_round_number == 1)
 	{
-	    for(j=0;j<league->fixtures->len;j++)
-		if(g_array_index(league->fixtures, Fixture, j).week_number == week_number &&
-		   g_array_index(league->fixtures, Fixture, j).week_round_number == week_round_number)
-		    sum++;
+	    round = fixture_schedule_get(&league->c, league->fixtures,
+					 week_number, week_round_number);
+	    if(round != NULL)
+		sum += round->len;
 	}
     }
     
@@ -1412,14 +1625,12 @@ fixture_get_matches(const Team *tm1, const Team *tm2)
     return matches;
 }
 
-/** Return the fixture going with the id. */
-Fixture*
-fixture_from_id(gint id, gboolean abort_program)
+/** Find a fixture by scanning all fixture arrays; used to
+    cross-check the registry in debug mode.
+    @see fixture_from_id() */
+static Fixture*
+fixture_from_id_scan(gint id)
 {
-#ifdef DEBUG
-    printf("fixture_from_id\n");
-#endif
-
     gint i, j;
 
     for(i=0;i<country.leagues->len;i++) {
@@ -1445,11 +1656,27 @@ fixture_from_id(gint id, gboolean abort_program)
         }
     }
 
-    if(abort_program)
+    return NULL;
+}
+
+/** Return the fixture going with the id. */
+Fixture*
+fixture_from_id(gint id, gboolean abort_program)
+{
+#ifdef DEBUG
+    printf("fixture_from_id\n");
+#endif
+
+    Fixture *fix = registry_get_fixture(id);
+
+    if(debug > 130 && fix != fixture_from_id_scan(id))
+	debug_print_message("fixture_from_id: registry and scan disagree for fixture with id %d\n", id);
+
+    if(fix == NULL && abort_program)
 	main_exit_program(EXIT_POINTER_NOT_FOUND, 
 			  "fixture_from_id: fixture with id %d found \n", id);
 
-    return NULL;
+    return fix;
 }
 
 /** Return the last week round number of the specified week. */
@@ -1502,7 +1729,7 @@ fixture_get_next_week(gint *week_number, gint *week_round_number)
 		(fix->week_number == *week_number && 
 		 fix->week_round_number < *week_round_number)) &&
 	       (fix->competition->id == current_user.tm->league->c.id ||
-		opt_user_int("int_opt_user_show_all_leagues")))
+		opt_user_int(int_opt_user_show_all_leagues)))
 	    {
 		*week_number = fix->week_number;
 		*week_round_number = fix->week_round_number;
@@ -1556,7 +1783,7 @@ fixture_get_previous_week(gint *week_number, gint *week_round_number)
 		(fix->week_number == *week_number && 
 		 fix->week_round_number > *week_round_number)) &&
 	       (fix->competition == &current_user.tm->league->c ||
-		opt_user_int("int_opt_user_show_all_leagues")))
+		opt_user_int(int_opt_user_show_all_leagues)))
 	    {
 		*week_number = fix->week_number;
 		*week_round_number = 1;
@@ -1773,6 +2000,7 @@ fixture_remove_rrs(GArray *fixtures, gint clid1, gint clid2, gint to_remove)
                     fixture->teams[0]->id == league2_team->id))
                 {
                     g_array_remove_index(fixtures, k);
+                    fixture_schedule_invalidate();
                     removed++;
                     
                     if(removed == to_remove)
@@ -1839,6 +2067,7 @@ fixtures_condense(GArray *fixtures)
                             fix_moved = TRUE;
                             fix->week_number = j + 1;
                             fix->week_round_number = k + 1;
+                            fixture_schedule_invalidate();
                             g_array_append_val(matchday_teams[j][k], fix->teams[0]->id);
                             g_array_append_val(matchday_teams[j][k], fix->teams[1]->id);
                         }
@@ -1854,6 +2083,7 @@ fixtures_condense(GArray *fixtures)
 
         g_array_sort_with_data(fixtures, fixture_compare_func,
                                GINT_TO_POINTER(FIXTURE_COMPARE_DATE + 100));
+        fixture_schedule_invalidate();
     }
 }
 
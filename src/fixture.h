@@ -107,6 +107,17 @@ fixture_user_team_involved(const Fixture *fix);
 gboolean
 query_fixture_has_tables(const Fixture *fix);
 
+gboolean
+query_fixture_team_plays_twice(const GPtrArray *fixtures);
+
+void
+fixture_schedule_invalidate(void);
+
+const Fixture*
+fixture_get_head_to_head(Competition *comp, const GArray *fixtures,
+			 const Team *home, const Team *away, gint round,
+			 gint week_number, gint week_round_number);
+
 gboolean
 query_fixture_in_week_round(gint clid, gint week_number, gint week_round_number);
 
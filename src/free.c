@@ -27,10 +27,13 @@
 #include "free.h"
 #include "lg_commentary_struct.h"
 #include "news_struct.h"
+#include "registry.h"
 #include "strategy_struct.h"
+#include "token.h"
 #include "transfer.h"
 #include "user.h"
 #include "variables.h"
+#include "xml_cache.h"
 
 /**
    Free all memory allocated by the program.
@@ -43,6 +46,8 @@ free_memory(void)
     printf("free_memory\n");
 #endif
 
+    gint i;
+
     free_variables();
     free_names(FALSE);
     free_transfer_list();
@@ -50,12 +55,16 @@ free_memory(void)
     free_country(&country, FALSE);
     free_users(FALSE);
     free_bets(FALSE);
+    free_g_array(&bet_odds_table);
     free_lg_commentary(FALSE);
     free_news(FALSE);
     free_newspaper(FALSE);
+    xml_cache_free();
     free_support_dirs();
     free_jobs(FALSE);
 
+    for(i=0;i<live_games->len;i++)
+	free_live_game(&g_array_index(live_games, LiveGame, i));
     free_g_array(&live_games);
 }
 
@@ -254,6 +263,9 @@ free_option_list(OptionList *optionlist, gboolean reset)
 
     gint i;
 
+    g_free(optionlist->ids);
+    optionlist->ids = NULL;
+
     if(optionlist->list == NULL)
     {
 	if(reset)
@@ -299,18 +311,27 @@ free_live_game(LiveGame *match)
     for(i=0;i<2;i++)
     {
 	free_g_array(&match->action_ids[i]);
-	
-	free_gchar_ptr(match->team_names[i]);
+
+	/* The strings of recycled live games are in the string chunk,
+	   the team names in the name pool. */
 	for(j=0;j<LIVE_GAME_STAT_ARRAY_END;j++)
 	{
-	    for(k=0;k<match->stats.players[i][j]->len;k++)
-		g_free(g_ptr_array_index(match->stats.players[i][j], k));
+	    if(match->strings == NULL)
+		for(k=0;k<match->stats.players[i][j]->len;k++)
+		    g_free(g_ptr_array_index(match->stats.players[i][j], k));
 	
 	    free_g_ptr_array(&match->stats.players[i][j]);
 	}
     }
     
     free_g_array(&match->units);
+
+    if(match->strings != NULL)
+    {
+	g_string_chunk_free(match->strings);
+	match->strings = NULL;
+    }
+    match->team_names[0] = match->team_names[1] = NULL;
 }
 
 /**
@@ -378,6 +399,8 @@ free_league(League *league)
     printf("free_league\n");
 #endif
 
+    registry_invalidate();
+
     free_gchar_ptr(league->c.name);
     free_gchar_ptr(league->short_name);
     free_gchar_ptr(league->symbol);
@@ -397,6 +420,7 @@ free_league(League *league)
     free_new_tables(&league->new_tables);
 
     free_g_array(&league->fixtures);
+    free_fixture_schedule(&league->c.schedule);
     free_g_array(&league->rr_breaks);
     free_g_array(&league->week_breaks);
 
@@ -451,31 +475,13 @@ free_league_stats(LeagueStat *stats)
     printf("free_league_stats\n");
 #endif
 
-    gint i;
-
     free_gchar_ptr(stats->league_name);
     free_gchar_ptr(stats->league_symbol);
 
-    for(i=0;i<stats->teams_off->len;i++)
-    {
-	free_gchar_ptr(g_array_index(stats->teams_off, Stat, i).team_name);
-	free_gchar_ptr(g_array_index(stats->teams_off, Stat, i).value_string);
-    }
+    /* The team and player names of the stats are in the name pool. */
     free_g_array(&stats->teams_off);
-
-    for(i=0;i<stats->teams_def->len;i++)
-    {
-	free_gchar_ptr(g_array_index(stats->teams_def, Stat, i).team_name);
-	free_gchar_ptr(g_array_index(stats->teams_def, Stat, i).value_string);
-    }
     free_g_array(&stats->teams_def);
-
-    for(i=0;i<stats->player_scorers->len;i++)
-	free_gchar_ptr(g_array_index(stats->player_scorers, Stat, i).value_string);
     free_g_array(&stats->player_scorers);
-
-    for(i=0;i<stats->player_goalies->len;i++)
-	free_gchar_ptr(g_array_index(stats->player_goalies, Stat, i).value_string);
     free_g_array(&stats->player_goalies);
 }
 
@@ -555,8 +561,10 @@ free_team(Team *tm)
     printf("free_team\n");
 #endif
 
+    registry_invalidate();
+
+    /* The name is in the name pool. */
     free_gchar_ptr(tm->stadium.name);
-    free_gchar_ptr(tm->name);
     free_gchar_ptr(tm->names_file);
     free_gchar_ptr(tm->symbol);
     free_gchar_ptr(tm->def_file);
@@ -592,9 +600,9 @@ free_player(Player *pl)
     printf("free_player\n");
 #endif
 
-    free_gchar_ptr(pl->name);
-
+    /* The name is in the name pool. */
     free_g_array(&pl->stats);
+    free_g_array(&pl->stats_slots);
 }
 
 /**
@@ -639,6 +647,8 @@ free_cup(Cup *cup)
 
     gint i;
 
+    registry_invalidate();
+
     free_gchar_ptr(cup->c.name);
     free_gchar_ptr(cup->short_name);
     free_gchar_ptr(cup->symbol);
@@ -651,6 +661,7 @@ free_cup(Cup *cup)
     free_g_array(&cup->rounds);
 
     free_g_array(&cup->fixtures);
+    free_fixture_schedule(&cup->c.schedule);
     free_g_array(&cup->week_breaks);
 
     free_g_ptr_array(&cup->bye);
@@ -658,6 +669,23 @@ free_cup(Cup *cup)
     free_gchar_array(&cup->properties);
 }
 
+/** Free the fixture schedule index of a league or cup. */
+void
+free_fixture_schedule(FixtureSchedule *schedule)
+{
+#ifdef DEBUG
+    printf("free_fixture_schedule\n");
+#endif
+
+    if(schedule->rounds != NULL)
+    {
+	g_hash_table_destroy(schedule->rounds);
+	g_hash_table_destroy(schedule->pairs);
+    }
+
+    schedule->rounds = schedule->pairs = NULL;
+}
+
 void
 free_cup_round(CupRound *cup_round)
 {
@@ -742,6 +770,8 @@ free_lg_commentary(gboolean reset)
 	    {
 		free_gchar_ptr(g_array_index(lg_commentary[i], LGCommentary, j).text);
 		free_gchar_ptr(g_array_index(lg_commentary[i], LGCommentary, j).condition);
+		token_text_free(g_array_index(lg_commentary[i], LGCommentary, j).parsed_text);
+		token_condition_free(g_array_index(lg_commentary[i], LGCommentary, j).parsed_condition);
 	    }
 
 	    free_g_array(&lg_commentary[i]);
@@ -768,11 +798,14 @@ free_news(gboolean reset)
 	    for(j=0;j<news[i]->len;j++)
 	    {
 		g_free(g_array_index(news[i], NewsArticle, j).condition);
+		token_condition_free(g_array_index(news[i], NewsArticle, j).parsed_condition);
                 
                 for(k = 0; k < g_array_index(news[i], NewsArticle, j).titles->len; k++)
                 {
                     g_free(g_array_index(g_array_index(news[i], NewsArticle, j).titles, NewsText, k).text);
                     g_free(g_array_index(g_array_index(news[i], NewsArticle, j).titles, NewsText, k).condition);
+                    token_text_free(g_array_index(g_array_index(news[i], NewsArticle, j).titles, NewsText, k).parsed_text);
+                    token_condition_free(g_array_index(g_array_index(news[i], NewsArticle, j).titles, NewsText, k).parsed_condition);
                 }
 
                 g_array_free(g_array_index(news[i], NewsArticle, j).titles, TRUE);
@@ -781,6 +814,8 @@ free_news(gboolean reset)
                 {
                     g_free(g_array_index(g_array_index(news[i], NewsArticle, j).subtitles, NewsText, k).text);
                     g_free(g_array_index(g_array_index(news[i], NewsArticle, j).subtitles, NewsText, k).condition);
+                    token_text_free(g_array_index(g_array_index(news[i], NewsArticle, j).subtitles, NewsText, k).parsed_text);
+                    token_condition_free(g_array_index(g_array_index(news[i], NewsArticle, j).subtitles, NewsText, k).parsed_condition);
                 }
 
                 g_array_free(g_array_index(news[i], NewsArticle, j).subtitles, TRUE);
@@ -915,6 +950,12 @@ free_support_dirs(void)
 
   g_list_free(support_directories);
   support_directories = NULL;
+
+  if(support_files != NULL)
+  {
+      g_hash_table_destroy(support_files);
+      support_files = NULL;
+  }
 }
 
 /** Free a list of names. */
@@ -925,8 +966,6 @@ free_name_list(NameList *namelist, gboolean reset)
     printf("free_name_list\n");
 #endif
 
-    gint i;
-
     if(namelist->sid == NULL)
     {
 	if(reset)
@@ -941,12 +980,8 @@ free_name_list(NameList *namelist, gboolean reset)
 
     free_gchar_ptr(namelist->sid);
 
-    for(i=0;i<namelist->first_names->len;i++)
-	free_gchar_ptr(g_ptr_array_index(namelist->first_names, i));
+    /* The names themselves belong to the name pool. */
     free_g_ptr_array(&namelist->first_names);
-
-    for(i=0;i<namelist->last_names->len;i++)
-	free_gchar_ptr(g_ptr_array_index(namelist->last_names, i));
     free_g_ptr_array(&namelist->last_names);
 
     if(reset)
@@ -957,7 +992,9 @@ free_name_list(NameList *namelist, gboolean reset)
     }
 }
 
-/** Free the array with the name lists. */
+/** Free the array with the name lists.
+    @param reset Whether to make new empty lists. The name pool
+    only gets freed if not. */
 void
 free_names(gboolean reset)
 {
@@ -967,21 +1004,48 @@ free_names(gboolean reset)
 
     gint i;
 
-    if(name_lists == NULL)
+    if(name_lists != NULL)
     {
-	if(reset)
-	    name_lists = g_array_new(FALSE, FALSE, sizeof(NameList));
+	for(i=0;i<name_lists->len;i++)
+	    free_name_list(&g_array_index(name_lists, NameList, i), FALSE);
 
-	return;
+	free_g_array(&name_lists);
     }
 
-    for(i=0;i<name_lists->len;i++)
-	free_name_list(&g_array_index(name_lists, NameList, i), FALSE);
+    if(name_lists_index != NULL)
+    {
+	g_hash_table_destroy(name_lists_index);
+	name_lists_index = NULL;
+    }
 
-    free_g_array(&name_lists);
+    /* The pool holds the names of the players and teams, too. */
+    if(!reset && name_pool != NULL)
+    {
+	g_string_chunk_free(name_pool);
+	name_pool = NULL;
+    }
 
     if(reset)
+    {
 	name_lists = g_array_new(FALSE, FALSE, sizeof(NameList));
+	name_lists_index = g_hash_table_new_full(g_str_hash, g_str_equal,
+						 g_free, NULL);
+    }
+}
+
+/** Free a compiled strategy condition if it isn't NULL. */
+void
+free_strategy_condition(StratCondition *condition)
+{
+#ifdef DEBUG
+    printf("free_strategy_condition\n");
+#endif
+
+    if(condition == NULL)
+	return;
+
+    g_free(condition->code);
+    g_free(condition);
 }
 
 /** Free the array with the CPU strategies. */
@@ -1005,6 +1069,10 @@ free_strategies(void)
 		g_array_index(
 		    g_array_index(
 			strategies, Strategy, i).prematch, StrategyPrematch, j).condition);
+	    free_strategy_condition(
+		g_array_index(
+		    g_array_index(
+			strategies, Strategy, i).prematch, StrategyPrematch, j).parsed_condition);
 	    g_array_free(
 		g_array_index(
 		    g_array_index(strategies, Strategy, i).prematch, StrategyPrematch, j).formations, 
@@ -1018,14 +1086,18 @@ free_strategies(void)
 		g_array_index(
 		    g_array_index(
 			strategies, Strategy, i).match_action, StrategyMatchAction, j).condition);
-	    g_array_free(
+	    free_strategy_condition(
 		g_array_index(
 		    g_array_index(
-			strategies, Strategy, i).match_action, StrategyMatchAction, j).parsed_condition, TRUE);
+			strategies, Strategy, i).match_action, StrategyMatchAction, j).parsed_condition);
 	    g_free(
 		g_array_index(
 		    g_array_index(
 			strategies, Strategy, i).match_action, StrategyMatchAction, j).sub_condition);
+	    free_strategy_condition(
+		g_array_index(
+		    g_array_index(
+			strategies, Strategy, i).match_action, StrategyMatchAction, j).parsed_sub_condition);
 	}
 	g_array_free(g_array_index(strategies, Strategy, i).match_action, TRUE);
     }
@@ -34,6 +34,7 @@
 #include "name_struct.h"
 #include "news_struct.h"
 #include "player_struct.h"
+#include "strategy_struct.h"
 #include "team_struct.h"
 #include "user_struct.h"
 
@@ -135,6 +136,9 @@ free_names(gboolean reset);
 void
 free_mmatches(GArray **mmatches, gboolean reset);
 
+void
+free_strategy_condition(StratCondition *condition);
+
 void
 free_strategies(void);
 
@@ -159,6 +163,9 @@ free_newspaper_article(NewsPaperArticle *article);
 void
 free_cup_round(CupRound *cup_round);
 
+void
+free_fixture_schedule(FixtureSchedule *schedule);
+
 void
 free_prom_rel(PromRel *prom_rel);
 
@@ -42,6 +42,71 @@
 #include "user.h"
 #include "variables.h"
 
+/** Fill in how the cskill of field players get weighted for the
+    team values in a match. Rows are player position, columns value type.
+    @see game_get_player_contribution() */
+static void
+game_get_player_weights(gfloat player_weights[3][3])
+{
+    player_weights[0][0] = const_float(float_player_team_weight_defender_defense);
+    player_weights[0][1] = const_float(float_player_team_weight_defender_midfield);
+    player_weights[0][2] = const_float(float_player_team_weight_defender_attack);
+    player_weights[1][0] = const_float(float_player_team_weight_midfielder_defense);
+    player_weights[1][1] = const_float(float_player_team_weight_midfielder_midfield);
+    player_weights[1][2] = const_float(float_player_team_weight_midfielder_attack);
+    player_weights[2][0] = const_float(float_player_team_weight_forward_defense);
+    player_weights[2][1] = const_float(float_player_team_weight_forward_midfield);
+    player_weights[2][2] = const_float(float_player_team_weight_forward_attack);
+}
+
+/** Copy the attributes of the players on the pitch that the
+    match calculations need into the match view of the team and
+    drop the cached player probabilities. Has to be called whenever
+    the lineup, the fitness or the boost of the team change during
+    a match.
+    @param view The view we fill.
+    @param tm The team. */
+void
+game_view_update(LiveGameTeamView *view, const Team *tm)
+{
+#ifdef DEBUG
+    printf("game_view_update\n");
+#endif
+
+    gint i;
+    const Player *pl = NULL;
+
+    for(i=0;i<11;i++)
+    {
+	pl = player_of_idx_team(tm, i);
+
+	view->ids[i] = pl->id;
+	view->cpos[i] = pl->cpos;
+	view->cskill[i] = pl->cskill;
+	view->fitness[i] = pl->fitness;
+	view->game_skill[i] = player_get_game_skill(pl, FALSE, TRUE);
+	view->streak_factor[i] = 
+	    1 + (gfloat)pl->streak * const_float(float_player_streak_influence_skill);
+    }
+
+    memset(view->probs_valid, 0, sizeof(view->probs_valid));
+}
+
+/** Return the skill of a player in the match, taken from the
+    match view if the player is on the pitch.
+    @see player_get_game_skill() */
+gfloat
+game_view_get_game_skill(const LiveGameTeamView *view, const Player *pl)
+{
+    gint i;
+
+    for(i=0;i<11;i++)
+	if(view->ids[i] == pl->id)
+	    return view->game_skill[i];
+
+    return player_get_game_skill(pl, FALSE, TRUE);
+}
+
 /** Calculate attacking, defending and goalie values for the two teams
     of a fixture.
     @param fix The fixture we calculate.
@@ -57,33 +122,55 @@ game_get_values(const Fixture *fix, gfloat team_values[][GAME_TEAM_VALUE_END],
     printf("game_get_values\n");
 #endif
 
+    LiveGameTeamView views[2];
+
+    game_view_update(&views[0], fix->teams[0]);
+    game_view_update(&views[1], fix->teams[1]);
+
+    game_get_view_values(fix, views, team_values, home_advantage);
+}
+
+/** Calculate attacking, defending and goalie values for the two teams
+    of a fixture from the match views of the teams.
+    @see game_get_values(), game_view_update() */
+void
+game_get_view_values(const Fixture *fix, const LiveGameTeamView *views,
+		     gfloat team_values[][GAME_TEAM_VALUE_END],
+		     gfloat home_advantage)
+{
+#ifdef DEBUG
+    printf("game_get_view_values\n");
+#endif
+
     gint i, j;
-    Team *tm[2] = {fix->teams[0], fix->teams[1]};
     gfloat style_factor;
+    gfloat player_weights[3][3];
+    const gfloat *weights = NULL;
+
+    game_get_player_weights(player_weights);
 
     for(i=0;i<2;i++)
     {
 	for(j=0;j<GAME_TEAM_VALUE_END;j++)
 	    team_values[i][j] = 0;
 	
-	style_factor = (gfloat)tm[i]->style * const_float("float_game_style_factor");
+	style_factor = (gfloat)fix->teams[i]->style * const_float(float_game_style_factor);
 
 	team_values[i][GAME_TEAM_VALUE_GOALIE] = 
-	    player_get_game_skill(player_of_idx_team(tm[i], 0), FALSE, TRUE) * 
-	    (1 + home_advantage * (i == 0));
+	    views[i].game_skill[0] * (1 + home_advantage * (i == 0));
 
 	for(j=1;j<11;j++)
-	    if(player_of_idx_team(tm[i], j)->cskill > 0)
+	    if(views[i].cskill[j] > 0)
 	    {
+		weights = player_weights[views[i].cpos[j] - 1];
 		team_values[i][GAME_TEAM_VALUE_ATTACK] +=
-		    game_get_player_contribution(player_of_idx_team(tm[i], j), 
-						 GAME_TEAM_VALUE_ATTACK, TRUE);
+		    views[i].game_skill[j] * 
+		    weights[GAME_TEAM_VALUE_ATTACK - GAME_TEAM_VALUE_DEFEND];
 		team_values[i][GAME_TEAM_VALUE_MIDFIELD] +=
-		    game_get_player_contribution(player_of_idx_team(tm[i], j), 
-						 GAME_TEAM_VALUE_MIDFIELD, TRUE);
+		    views[i].game_skill[j] * 
+		    weights[GAME_TEAM_VALUE_MIDFIELD - GAME_TEAM_VALUE_DEFEND];
 		team_values[i][GAME_TEAM_VALUE_DEFEND] +=
-		    game_get_player_contribution(player_of_idx_team(tm[i], j), 
-						 GAME_TEAM_VALUE_DEFEND, TRUE);
+		    views[i].game_skill[j] * weights[0];
 	    }
 
 	for(j=GAME_TEAM_VALUE_DEFEND;j<GAME_TEAM_VALUE_DEFEND + 3;j++)
@@ -105,20 +192,9 @@ game_get_values(const Fixture *fix, gfloat team_values[][GAME_TEAM_VALUE_END],
 gfloat
 game_get_player_contribution(const Player *pl, gint type, gboolean special)
 {
+    gfloat player_weights[3][3];
 
-/** How the cskill of field players get weighted for the team values in
-    a match. Rows are player position, columns value type. 
-    @see game_get_player_contribution() */
-    gfloat player_weights[3][3] =
-	{{const_float_fast(float_player_team_weight_defender_defense),
-	  const_float_fast(float_player_team_weight_defender_midfield),
-	  const_float_fast(float_player_team_weight_defender_attack)},
-	 {const_float_fast(float_player_team_weight_midfielder_defense),
-	  const_float_fast(float_player_team_weight_midfielder_midfield),
-	  const_float_fast(float_player_team_weight_midfielder_attack)},
-	 {const_float_fast(float_player_team_weight_forward_defense),
-	  const_float_fast(float_player_team_weight_forward_midfield),
-	  const_float_fast(float_player_team_weight_forward_attack)}};
+    game_get_player_weights(player_weights);
 
     return player_get_game_skill(pl, FALSE, special) *
 	player_weights[pl->cpos - 1][type - GAME_TEAM_VALUE_DEFEND];
@@ -126,7 +202,8 @@ game_get_player_contribution(const Player *pl, gint type, gboolean special)
 
 /** Return a random attacking or defending player
     or the player that has to shoot the number_of_penalty'th penalty.
-    @param tm The team we examine.
+    @param live_game The match.
+    @param team The index of the team we examine.
     @param player_type Whether we concentrate on attacking or defending players
     or would like to have a penalty shooting player.
     @param last_penalty The player that shot the last penalty.
@@ -134,7 +211,7 @@ game_get_player_contribution(const Player *pl, gint type, gboolean special)
     @param skills Whether to weight with skills, too.
     @return A player index. */
 gint
-game_get_player(const Team *tm, gint player_type, 
+game_get_player(LiveGame *live_game, gint team, gint player_type, 
 		gint last_penalty, gint not_this_one,
 		gboolean skills)
 {
@@ -142,36 +219,46 @@ game_get_player(const Team *tm, gint player_type,
     printf("game_get_player\n");
 #endif
 
+    const Team *tm = live_game->fix->teams[team];
+    LiveGameTeamView *view = &live_game->views[team];
     gint i, player = not_this_one;
     gfloat weights[3];
-    gfloat probs[10];
+    gfloat *probs = NULL;
     gfloat rndom;
 
-    if(player_type == GAME_PLAYER_TYPE_ATTACK)
-    {
-	weights[0] = const_float("float_game_player_weight_attack_def");
-	weights[1] = const_float("float_game_player_weight_attack_mid");
-	weights[2] = const_float("float_game_player_weight_attack_fwd");
-    }
-    else if(player_type == GAME_PLAYER_TYPE_MIDFIELD)
-    {
-	weights[0] = const_float("float_game_player_weight_midfield_def");
-	weights[1] = const_float("float_game_player_weight_midfield_mid");
-	weights[2] = const_float("float_game_player_weight_midfield_fwd");
-    }
-    else if(player_type == GAME_PLAYER_TYPE_DEFEND)
-    {
-	weights[0] = const_float("float_game_player_weight_defend_def");
-	weights[1] = const_float("float_game_player_weight_defend_mid");
-	weights[2] = const_float("float_game_player_weight_defend_fwd");
-    }
-    else if(player_type == GAME_PLAYER_TYPE_PENALTY)
+    if(player_type == GAME_PLAYER_TYPE_PENALTY)
 	return game_get_penalty_taker(tm, last_penalty);
-    else
+    else if(player_type < 0 || player_type >= GAME_PLAYER_TYPE_PENALTY)
 	main_exit_program(EXIT_INT_NOT_FOUND, 
 			  "game_get_player: unknown player type %d\n", player_type);
 
-    game_get_player_probs(tm->players, probs, weights, skills);
+    probs = view->probs[player_type][skills != 0];
+
+    /* The probabilities only change when the view gets updated. */
+    if(!view->probs_valid[player_type][skills != 0])
+    {
+	if(player_type == GAME_PLAYER_TYPE_ATTACK)
+	{
+	    weights[0] = const_float(float_game_player_weight_attack_def);
+	    weights[1] = const_float(float_game_player_weight_attack_mid);
+	    weights[2] = const_float(float_game_player_weight_attack_fwd);
+	}
+	else if(player_type == GAME_PLAYER_TYPE_MIDFIELD)
+	{
+	    weights[0] = const_float(float_game_player_weight_midfield_def);
+	    weights[1] = const_float(float_game_player_weight_midfield_mid);
+	    weights[2] = const_float(float_game_player_weight_midfield_fwd);
+	}
+	else
+	{
+	    weights[0] = const_float(float_game_player_weight_defend_def);
+	    weights[1] = const_float(float_game_player_weight_defend_mid);
+	    weights[2] = const_float(float_game_player_weight_defend_fwd);
+	}
+
+	game_get_player_probs(view, probs, weights, skills);
+	view->probs_valid[player_type][skills != 0] = TRUE;
+    }
 
     if(probs[9] > 0)
     {
@@ -180,11 +267,11 @@ game_get_player(const Team *tm, gint player_type,
 	    rndom = math_rnd(0, probs[9]);
 	    
 	    if(rndom < probs[0])
-		player = player_of_idx_team(tm, 1)->id;
+		player = view->ids[1];
 	    else
 		for(i=1;i<10;i++)
 		    if(rndom < probs[i] && rndom > probs[i - 1])
-			player = player_of_idx_team(tm, i + 1)->id;
+			player = view->ids[i + 1];
 	}
     }
     else
@@ -209,12 +296,13 @@ game_get_player(const Team *tm, gint player_type,
 /** Write the probabilities for field players being picked
     (e.g. a random defender, or a player who gets injured) into
     the float array. Depends on skill mostly.
-    @param players Player array.
+    @param view The match view of the team.
     @param probs Array with probabilities that gets filled.
     @param weights How to weight the players depending on their position. 
     @param skills Whether to weight with skills, too. */
 void
-game_get_player_probs(GArray *players, gfloat *probs, gfloat *weights, gboolean skills)
+game_get_player_probs(const LiveGameTeamView *view, gfloat *probs,
+		      gfloat *weights, gboolean skills)
 {
 #ifdef DEBUG
     printf("game_get_player_probs\n");
@@ -223,25 +311,18 @@ game_get_player_probs(GArray *players, gfloat *probs, gfloat *weights, gboolean
     gint i;
 
     probs[0] = (skills) ? 
-	player_get_game_skill(&g_array_index(players, Player, 1), FALSE, TRUE) *
-	weights[g_array_index(players, Player, 1).cpos - 1] :
-	weights[g_array_index(players, Player, 1).cpos - 1] *
-	(g_array_index(players, Player, 1).cskill != 0);
+	view->game_skill[1] * weights[view->cpos[1] - 1] :
+	weights[view->cpos[1] - 1] * (view->cskill[1] != 0);
 
-    probs[0] *= (1 + (gfloat)g_array_index(players, Player, 1).streak *
-		 const_float_fast(float_player_streak_influence_skill));
-		 
+    probs[0] *= view->streak_factor[1];
 
     for(i=1;i<10;i++)
     {
 	probs[i] = probs[i - 1] + 
 	    ((skills) ? 
-	     player_get_game_skill(&g_array_index(players, Player, i + 1), FALSE, TRUE) *
-	     weights[g_array_index(players, Player, i + 1).cpos - 1] :
-	     weights[g_array_index(players, Player, i + 1).cpos - 1] *
-	     (g_array_index(players, Player, i + 1).cskill != 0));
-	probs[i] *= (1 + (gfloat)g_array_index(players, Player, i + 1).streak *
-		     const_float_fast(float_player_streak_influence_skill));
+	     view->game_skill[i + 1] * weights[view->cpos[i + 1] - 1] :
+	     weights[view->cpos[i + 1] - 1] * (view->cskill[i + 1] != 0));
+	probs[i] *= view->streak_factor[i + 1];
     }
 }
 
@@ -301,7 +382,7 @@ game_initialize(Fixture *fix)
     else
 	game_assign_attendance_neutral(fix);
 
-    if(!sett_int("int_opt_disable_finances"))
+    if(!sett_int(int_opt_disable_finances))
 	finance_assign_game_money(fix);
 
     for(i=0;i<2;i++)
@@ -324,17 +405,17 @@ game_initialize(Fixture *fix)
 		    if(query_player_is_youth((&g_array_index(fix->teams[i]->players,
 							     Player, j))))
 			g_array_index(fix->teams[i]->players, Player, j).lsu +=
-			    const_float("float_youth_lsu_addition_match");
+			    const_float(float_youth_lsu_addition_match);
 
 		    player_streak_add_to_prob(
 			&g_array_index(fix->teams[i]->players, Player, j),
-			const_float("float_player_streak_add_startup"));
+			const_float(float_player_streak_add_startup));
 		}
 	    }
 	    else
 		player_streak_add_to_prob(
 		    &g_array_index(fix->teams[i]->players, Player, j),
-		    const_float("float_player_streak_add_no_startup"));
+		    const_float(float_player_streak_add_no_startup));
 	}
 
 	if(user_idx[i] != -1)
@@ -356,36 +437,36 @@ game_assign_attendance(Fixture *fix)
 
     Team *tm[2] = {fix->teams[0], fix->teams[1]};
     gfloat factor = 
-	math_rnd(const_float("float_game_stadium_attendance_percentage_lower"),
-		 const_float("float_game_stadium_attendance_percentage_upper")) *
+	math_rnd(const_float(float_game_stadium_attendance_percentage_lower),
+		 const_float(float_game_stadium_attendance_percentage_upper)) *
 	powf(tm[0]->stadium.safety, 
-	     const_float("float_game_stadium_attendance_safety_exponent"));
+	     const_float(float_game_stadium_attendance_safety_exponent));
     gint league_att = (gint)rint((gfloat)league_cup_average_capacity(&tm[0]->league->c) *
-				  const_float("float_game_stadium_attendance_average_exceed_factor") *
+				  const_float(float_game_stadium_attendance_average_exceed_factor) *
 				  math_rnd(0.9, 1.1));
     gint max_att = MIN(league_att, tm[0]->stadium.capacity);
 
     if(fix->competition->id < ID_CUP_START && 
        team_get_league_rank(tm[1], fix->competition) <
        (gint)rint((gfloat)league_from_clid(fix->competition->id)->c.teams->len *
-		  const_float("float_game_stadium_attendance_rank_percentage")))
-	factor *= const_float("float_game_stadium_attendance_rank_factor");
+		  const_float(float_game_stadium_attendance_rank_percentage)))
+	factor *= const_float(float_game_stadium_attendance_rank_factor);
 
     if(fix->competition->id >= ID_CUP_START)
     {
 	Cup *cup = (Cup*)fix->competition;
 	if(cup->rounds->len - fix->round <=
-	   const_int("int_game_stadium_attendance_cup_rounds_full_house"))
+	   const_int(int_game_stadium_attendance_cup_rounds_full_house))
 	    factor = 1;
 	else if(query_league_cup_has_property(fix->competition->id, "national"))
-	    factor *= const_float("float_game_stadium_attendance_cup_national_factor");
+	    factor *= const_float(float_game_stadium_attendance_cup_national_factor);
 	else
-	    factor *= const_float("float_game_stadium_attendance_cup_international_factor");
+	    factor *= const_float(float_game_stadium_attendance_cup_international_factor);
     }
 
     /* calculate the differnce in ticket prices has on attendance */
-    gfloat delta_price = tm[0]->stadium.ticket_price - const_int("int_team_stadium_ticket_price");
-    gfloat price_factor = math_gauss_dist(0.92, 1.08) * 1/(1+const_float("float_team_stadium_price_attendance_factor")*delta_price);
+    gfloat delta_price = tm[0]->stadium.ticket_price - const_int(int_team_stadium_ticket_price);
+    gfloat price_factor = math_gauss_dist(0.92, 1.08) * 1/(1+const_float(float_team_stadium_price_attendance_factor)*delta_price);
 
     factor = MIN(factor * price_factor, 1);
     fix->attendance = MIN(MIN((gint)rint((gfloat)tm[0]->stadium.capacity * factor),
@@ -414,8 +495,8 @@ game_assign_attendance_neutral(Fixture *fix)
 	(gfloat)league_cup_average_capacity(&first_league->c);
 
     fix->attendance = (gint)rint(av_att * 
-				 math_rnd(const_float("float_game_stadium_attendance_neutral_lower"),
-					  const_float("float_game_stadium_attendance_neutral_upper")));
+				 math_rnd(const_float(float_game_stadium_attendance_neutral_lower),
+					  const_float(float_game_stadium_attendance_neutral_upper)));
 }
 
 /** Save the team states in the current live game
@@ -563,64 +644,64 @@ game_player_injury(Player *pl)
     gfloat rndom;
     /* probabilities of different injuries */
     gfloat injury_probs[13]={0,
-			     const_float("float_player_injury_concussion"),
-			     const_float("float_player_injury_pulled_muscle"),
-			     const_float("float_player_injury_hamstring"),
-			     const_float("float_player_injury_groin"),
-			     const_float("float_player_injury_frac_ankle"),
-			     const_float("float_player_injury_rib"),
-			     const_float("float_player_injury_leg"),
-			     const_float("float_player_injury_brok_ankle"),
-			     const_float("float_player_injury_arm"),
-			     const_float("float_player_injury_shoulder"),
-			     const_float("float_player_injury_ligament"),
-			     const_float("float_player_injury_career_stop")};
+			     const_float(float_player_injury_concussion),
+			     const_float(float_player_injury_pulled_muscle),
+			     const_float(float_player_injury_hamstring),
+			     const_float(float_player_injury_groin),
+			     const_float(float_player_injury_frac_ankle),
+			     const_float(float_player_injury_rib),
+			     const_float(float_player_injury_leg),
+			     const_float(float_player_injury_brok_ankle),
+			     const_float(float_player_injury_arm),
+			     const_float(float_player_injury_shoulder),
+			     const_float(float_player_injury_ligament),
+			     const_float(float_player_injury_career_stop)};
     
     gint duration[12]={
-	math_gauss_disti(const_int("int_player_injury_duration_concussion") - 
-			 const_int("int_player_injury_duration_dev_concussion"),
-			 const_int("int_player_injury_duration_concussion") + 
-			 const_int("int_player_injury_duration_dev_concussion")),
-	math_gauss_disti(const_int("int_player_injury_duration_pulled_muscle") -
-			 const_int("int_player_injury_duration_dev_pulled_muscle"),
-			 const_int("int_player_injury_duration_pulled_muscle") +
-			 const_int("int_player_injury_duration_dev_pulled_muscle")),
-	math_gauss_disti(const_int("int_player_injury_duration_hamstring") -
-			 const_int("int_player_injury_duration_dev_hamstring"),
-			 const_int("int_player_injury_duration_hamstring") +
-			 const_int("int_player_injury_duration_dev_hamstring")),
-	math_gauss_disti(const_int("int_player_injury_duration_groin") -
-			 const_int("int_player_injury_duration_dev_groin"),
-			 const_int("int_player_injury_duration_groin") +
-			 const_int("int_player_injury_duration_dev_groin")),
-	math_gauss_disti(const_int("int_player_injury_duration_frac_ankle") -
-			 const_int("int_player_injury_duration_dev_frac_ankle"),
-			 const_int("int_player_injury_duration_frac_ankle") +
-			 const_int("int_player_injury_duration_dev_frac_ankle")),
-	math_gauss_disti(const_int("int_player_injury_duration_rib") -
-			 const_int("int_player_injury_duration_dev_rib"),
-			 const_int("int_player_injury_duration_rib") +
-			 const_int("int_player_injury_duration_dev_rib")),
-	math_gauss_disti(const_int("int_player_injury_duration_leg") -
-			 const_int("int_player_injury_duration_dev_leg"),
-			 const_int("int_player_injury_duration_leg") +
-			 const_int("int_player_injury_duration_dev_leg")),
-	math_gauss_disti(const_int("int_player_injury_duration_brok_ankle") -
-			 const_int("int_player_injury_duration_dev_brok_ankle"),
-			 const_int("int_player_injury_duration_brok_ankle") +
-			 const_int("int_player_injury_duration_dev_brok_ankle")),
-	math_gauss_disti(const_int("int_player_injury_duration_arm") - 
-			 const_int("int_player_injury_duration_dev_arm"),
-			 const_int("int_player_injury_duration_arm") +
-			 const_int("int_player_injury_duration_dev_arm")),
-	math_gauss_disti(const_int("int_player_injury_duration_shoulder") -
-			 const_int("int_player_injury_duration_dev_shoulder"),
-			 const_int("int_player_injury_duration_shoulder") +
-			 const_int("int_player_injury_duration_dev_shoulder")),
-	math_gauss_disti(const_int("int_player_injury_duration_ligament") -
-			 const_int("int_player_injury_duration_dev_ligament"),
-			 const_int("int_player_injury_duration_ligament") +
-			 const_int("int_player_injury_duration_dev_ligament")),
+	math_gauss_disti(const_int(int_player_injury_duration_concussion) - 
+			 const_int(int_player_injury_duration_dev_concussion),
+			 const_int(int_player_injury_duration_concussion) + 
+			 const_int(int_player_injury_duration_dev_concussion)),
+	math_gauss_disti(const_int(int_player_injury_duration_pulled_muscle) -
+			 const_int(int_player_injury_duration_dev_pulled_muscle),
+			 const_int(int_player_injury_duration_pulled_muscle) +
+			 const_int(int_player_injury_duration_dev_pulled_muscle)),
+	math_gauss_disti(const_int(int_player_injury_duration_hamstring) -
+			 const_int(int_player_injury_duration_dev_hamstring),
+			 const_int(int_player_injury_duration_hamstring) +
+			 const_int(int_player_injury_duration_dev_hamstring)),
+	math_gauss_disti(const_int(int_player_injury_duration_groin) -
+			 const_int(int_player_injury_duration_dev_groin),
+			 const_int(int_player_injury_duration_groin) +
+			 const_int(int_player_injury_duration_dev_groin)),
+	math_gauss_disti(const_int(int_player_injury_duration_frac_ankle) -
+			 const_int(int_player_injury_duration_dev_frac_ankle),
+			 const_int(int_player_injury_duration_frac_ankle) +
+			 const_int(int_player_injury_duration_dev_frac_ankle)),
+	math_gauss_disti(const_int(int_player_injury_duration_rib) -
+			 const_int(int_player_injury_duration_dev_rib),
+			 const_int(int_player_injury_duration_rib) +
+			 const_int(int_player_injury_duration_dev_rib)),
+	math_gauss_disti(const_int(int_player_injury_duration_leg) -
+			 const_int(int_player_injury_duration_dev_leg),
+			 const_int(int_player_injury_duration_leg) +
+			 const_int(int_player_injury_duration_dev_leg)),
+	math_gauss_disti(const_int(int_player_injury_duration_brok_ankle) -
+			 const_int(int_player_injury_duration_dev_brok_ankle),
+			 const_int(int_player_injury_duration_brok_ankle) +
+			 const_int(int_player_injury_duration_dev_brok_ankle)),
+	math_gauss_disti(const_int(int_player_injury_duration_arm) - 
+			 const_int(int_player_injury_duration_dev_arm),
+			 const_int(int_player_injury_duration_arm) +
+			 const_int(int_player_injury_duration_dev_arm)),
+	math_gauss_disti(const_int(int_player_injury_duration_shoulder) -
+			 const_int(int_player_injury_duration_dev_shoulder),
+			 const_int(int_player_injury_duration_shoulder) +
+			 const_int(int_player_injury_duration_dev_shoulder)),
+	math_gauss_disti(const_int(int_player_injury_duration_ligament) -
+			 const_int(int_player_injury_duration_dev_ligament),
+			 const_int(int_player_injury_duration_ligament) +
+			 const_int(int_player_injury_duration_dev_ligament)),
 	50};
 
     for(i=1;i<13;i++)
@@ -642,7 +723,7 @@ game_player_injury(Player *pl)
 		       NULL, NULL);
 
     player_streak_add_to_prob(
-	pl, const_float("float_player_streak_add_injury"));
+	pl, const_float(float_player_streak_add_injury));
     if(pl->streak == PLAYER_STREAK_HOT)
     {
 	pl->streak = PLAYER_STREAK_NONE;
@@ -658,12 +739,12 @@ game_get_foul_prob(const LiveGame *live_game, const LiveGameUnit *unit)
     gint i;
 
     /* Base probability (a linear function of match time). */
-    prob = const_float("float_live_game_foul_base") + 
-        const_float("float_live_game_foul_max_inc") * MIN(1, (gfloat)(unit->minute) / 90);
+    prob = const_float(float_live_game_foul_base) + 
+        const_float(float_live_game_foul_max_inc) * MIN(1, (gfloat)(unit->minute) / 90);
 
     /* Add possible boost influence of the team not in possession. */
     prob *= (1 + live_game->fix->teams[!unit->possession]->boost * 
-             const_float("float_team_boost_foul_factor"));
+             const_float(float_team_boost_foul_factor));
 
     /* Reduce probability depending on the current cards of
        the team not in possession, except if their boost is on. */
@@ -672,10 +753,10 @@ game_get_foul_prob(const LiveGame *live_game, const LiveGameUnit *unit)
         for(i = 0; i < 11; i++)
             if(g_array_index(live_game->fix->teams[!unit->possession]->players, Player, i).card_status == 
                PLAYER_CARD_STATUS_YELLOW)
-                prob *= (1 - const_float("float_live_game_foul_prob_reduction_yellow"));
+                prob *= (1 - const_float(float_live_game_foul_prob_reduction_yellow));
             else if(g_array_index(live_game->fix->teams[!unit->possession]->players, Player, i).card_status == 
                     PLAYER_CARD_STATUS_RED)
-                prob *= (1 - const_float("float_live_game_foul_prob_reduction_red"));
+                prob *= (1 - const_float(float_live_game_foul_prob_reduction_red));
     }
 
     return prob;
@@ -698,10 +779,10 @@ game_get_foul_possession_factor(gint boost1, gint boost2)
 	return 1;
 
     if(abs(boost1 - boost2) == 1)
-	return 1 + const_float("float_team_boost_foul_by_possession_factor1") *
+	return 1 + const_float(float_team_boost_foul_by_possession_factor1) *
 	    (1 - 2 * (boost1 < boost2));
 
-    return 1 + const_float("float_team_boost_foul_by_possession_factor2") *
+    return 1 + const_float(float_team_boost_foul_by_possession_factor2) *
 	(1 - 2 * (boost1 < boost2));
 }
 
@@ -828,11 +909,11 @@ game_player_get_ban_duration(void)
     gfloat rndom;
     gfloat duration_probs[6] =
 	{0,
-	 const_float("float_live_game_ban_1"),
-	 const_float("float_live_game_ban_2"),
-	 const_float("float_live_game_ban_3"),
-	 const_float("float_live_game_ban_4"),
-	 const_float("float_live_game_ban_5")};
+	 const_float(float_live_game_ban_1),
+	 const_float(float_live_game_ban_2),
+	 const_float(float_live_game_ban_3),
+	 const_float(float_live_game_ban_4),
+	 const_float(float_live_game_ban_5)};
 
     for(i=1;i<6;i++)
 	duration_probs[i] += duration_probs[i - 1];
@@ -980,7 +1061,7 @@ game_update_stats(LiveGame *lg, const LiveGameUnit *unit)
     else if(unit->event.type == LIVE_GAME_EVENT_GOAL ||
 	    unit->event.type == LIVE_GAME_EVENT_OWN_GOAL)
     {
-	if(live_game_unit_before(unit, -1)->event.type != LIVE_GAME_EVENT_PENALTY &&
+	if(live_game_unit_before(lg, unit, -1)->event.type != LIVE_GAME_EVENT_PENALTY &&
 	   unit->event.type != LIVE_GAME_EVENT_OWN_GOAL)
 	    stats->values[unit->event.team][LIVE_GAME_STAT_VALUE_GOALS_REGULAR]++;
 	game_update_stats_player(lg, unit);
@@ -1008,7 +1089,7 @@ game_update_stats_player(LiveGame *lg, const LiveGameUnit *unit)
     gint i;
     gchar buf[SMALL], buf2[SMALL];    
     LiveGameStats *stats = &lg->stats;
-    gint minute = live_game_unit_get_minute(unit), array_index = -1;
+    gint minute = live_game_unit_get_minute(lg, unit), array_index = -1;
     gboolean own_goal;
     gint team = unit->event.team,
 	player = unit->event.player,
@@ -1017,6 +1098,10 @@ game_update_stats_player(LiveGame *lg, const LiveGameUnit *unit)
 			 lg->fix->teams[1]};
     GPtrArray *players = NULL;
     const gchar *player_name;
+
+    /* A results-only match only keeps the scorers for the news. */
+    if(lg->results_only && unit->event.type != LIVE_GAME_EVENT_GOAL)
+	return;
     
     if(unit->event.type == LIVE_GAME_EVENT_GOAL ||
        unit->event.type == LIVE_GAME_EVENT_OWN_GOAL)
@@ -1024,10 +1109,10 @@ game_update_stats_player(LiveGame *lg, const LiveGameUnit *unit)
 	own_goal = (unit->event.type == LIVE_GAME_EVENT_OWN_GOAL);
 	array_index = (own_goal) ? !team : team;
 
-	if(live_game_unit_before(unit, -1)->event.type == LIVE_GAME_EVENT_PENALTY)
+	if(live_game_unit_before(lg, unit, -1)->event.type == LIVE_GAME_EVENT_PENALTY)
 	    /* A goal scored with penalty. */
 	    strcpy(buf2, _(" (P)"));
-	else if(live_game_unit_before(unit, -1)->event.type == LIVE_GAME_EVENT_FREE_KICK)
+	else if(live_game_unit_before(lg, unit, -1)->event.type == LIVE_GAME_EVENT_FREE_KICK)
 	    /* A goal scored with a free kick. */
 	    strcpy(buf2, _(" (FK)"));
 	else if(unit->event.type == LIVE_GAME_EVENT_OWN_GOAL)
@@ -1038,7 +1123,11 @@ game_update_stats_player(LiveGame *lg, const LiveGameUnit *unit)
 
         player_name = player_of_id_team(tm[team], player)->name;
         if(!own_goal)
-            g_ptr_array_add(stats->players[array_index][LIVE_GAME_STAT_ARRAY_SCORERS], g_strdup(player_name));
+            g_ptr_array_add(stats->players[array_index][LIVE_GAME_STAT_ARRAY_SCORERS],
+                            live_game_strdup(lg, player_name));
+
+        if(lg->results_only)
+            return;
 
 	for(i=0;i<stats->players[array_index][LIVE_GAME_STAT_ARRAY_SCORERS_FOR_DISPLAY]->len;i++)
 	{
@@ -1050,7 +1139,7 @@ game_update_stats_player(LiveGame *lg, const LiveGameUnit *unit)
 			(gchar*)g_ptr_array_index(
 			    stats->players[array_index][LIVE_GAME_STAT_ARRAY_SCORERS_FOR_DISPLAY], i),
 			minute, buf2);
-		misc_string_assign((gchar**)&g_ptr_array_index(
+		live_game_string_assign(lg, (gchar**)&g_ptr_array_index(
 				       stats->players[array_index][LIVE_GAME_STAT_ARRAY_SCORERS_FOR_DISPLAY], i), buf);
 		return;
 	    }
@@ -1058,7 +1147,8 @@ game_update_stats_player(LiveGame *lg, const LiveGameUnit *unit)
     
 	sprintf(buf, "%s %d%s", player_name,
 		minute, buf2);
-	g_ptr_array_add(stats->players[array_index][LIVE_GAME_STAT_ARRAY_SCORERS_FOR_DISPLAY], g_strdup(buf));
+	g_ptr_array_add(stats->players[array_index][LIVE_GAME_STAT_ARRAY_SCORERS_FOR_DISPLAY],
+			live_game_strdup(lg, buf));
     }
     else
     {
@@ -1080,7 +1170,7 @@ game_update_stats_player(LiveGame *lg, const LiveGameUnit *unit)
 	}
 
 	if(strlen(buf) > 0)
-	    g_ptr_array_add(players, strdup(buf));
+	    g_ptr_array_add(players, live_game_strdup(lg, buf));
     }
 }
 
@@ -1177,12 +1267,12 @@ game_stadium_event(Stadium *stadium, gint type)
 
     gfloat reduce;
     gfloat reduce_factor[3][2] =
-	{{const_float("float_game_stadium_safety_reduce_breakdown_lower"),
-	  const_float("float_game_stadium_safety_reduce_breakdown_upper")},
-	 {const_float("float_game_stadium_safety_reduce_riots_lower"),
-	  const_float("float_game_stadium_safety_reduce_riots_upper")},
-	 {const_float("float_game_stadium_safety_reduce_fire_lower"),
-	  const_float("float_game_stadium_safety_reduce_fire_upper")}};
+	{{const_float(float_game_stadium_safety_reduce_breakdown_lower),
+	  const_float(float_game_stadium_safety_reduce_breakdown_upper)},
+	 {const_float(float_game_stadium_safety_reduce_riots_lower),
+	  const_float(float_game_stadium_safety_reduce_riots_upper)},
+	 {const_float(float_game_stadium_safety_reduce_fire_lower),
+	  const_float(float_game_stadium_safety_reduce_fire_upper)}};
 
     reduce = math_rnd(reduce_factor[type - LIVE_GAME_EVENT_STADIUM_BREAKDOWN][0],
 		      reduce_factor[type - LIVE_GAME_EVENT_STADIUM_BREAKDOWN][1]);
@@ -1190,7 +1280,7 @@ game_stadium_event(Stadium *stadium, gint type)
     stadium->safety *= (1 - reduce);
     stadium->capacity = (gint)rint((gfloat)stadium->capacity *
 				   (1 - reduce *
-				    const_float("float_game_stadium_capacity_reduce_factor")));
+				    const_float(float_game_stadium_capacity_reduce_factor)));
 }
 
 /** Return the maximum possible values for defence, midfield and attack. 
@@ -1205,11 +1295,11 @@ game_get_max_values(gfloat max_values[4])
     gint i, j;
     Player pl;
 
-    pl.skill = pl.cskill = const_float_fast(float_player_max_skill);
+    pl.skill = pl.cskill = const_float(float_player_max_skill);
     pl.fitness = 1;
     pl.streak = 0;
 
-    max_values[0] = const_float_fast(float_player_max_skill);
+    max_values[0] = const_float(float_player_max_skill);
 
     for(i=1;i<4;i++)
     {
@@ -1262,7 +1352,7 @@ game_boost_cost(void)
 
     gfloat wage_unit = finance_wage_unit(usr(stat2).tm);
     gint deduce = 
-	(gint)rint(wage_unit * const_float("float_boost_cost_factor"));
+	(gint)rint(wage_unit * const_float(float_boost_cost_factor));
 
     usr(stat2).money -= deduce;
     usr(stat2).money_out[1][MON_OUT_BOOST] -= deduce;
@@ -41,20 +41,32 @@ enum GamePlayerType
     GAME_PLAYER_TYPE_END
 };
 
+void
+game_view_update(LiveGameTeamView *view, const Team *tm);
+
+gfloat
+game_view_get_game_skill(const LiveGameTeamView *view, const Player *pl);
+
 void
 game_get_values(const Fixture *fix, gfloat team_values[][GAME_TEAM_VALUE_END],
 		gfloat home_advantage);
 
+void
+game_get_view_values(const Fixture *fix, const LiveGameTeamView *views,
+		     gfloat team_values[][GAME_TEAM_VALUE_END],
+		     gfloat home_advantage);
+
 gfloat
 game_get_player_contribution(const Player *pl, gboolean attack, gboolean special);
 
 gint
-game_get_player(const Team *tm, gint player_type, 
+game_get_player(LiveGame *live_game, gint team, gint player_type, 
 		gint number_of_penalty, gint not_this_one,
 		gboolean skills);
 
 void
-game_get_player_probs(GArray *players, gfloat *probs, gfloat *weights, gboolean skills);
+game_get_player_probs(const LiveGameTeamView *view, gfloat *probs,
+		      gfloat *weights, gboolean skills);
 
 gint
 game_get_penalty_taker(const Team *tm, gint last_penalty);
@@ -51,8 +51,8 @@ game_gui_live_game_show_unit(const LiveGameUnit *unit)
 
     gchar buf[SMALL];
     gfloat sleep_factor = (unit->time == 3) ? 
-	const_float("float_game_gui_live_game_speed_penalties_factor") : 1;
-    gfloat fraction = (gfloat)live_game_unit_get_minute(unit) / 90;
+	const_float(float_game_gui_live_game_speed_penalties_factor) : 1;
+    gfloat fraction = (gfloat)live_game_unit_get_minute((LiveGame*)statp, unit) / 90;
     GtkProgressBar *progress_bar =
 	GTK_PROGRESS_BAR(lookup_widget(window.live, "progressbar_live"));
     GtkHScale *hscale = 
@@ -72,7 +72,7 @@ game_gui_live_game_show_unit(const LiveGameUnit *unit)
 
     treeview_live_game_show_result(unit);
 
-    gdk_color_parse (const_app("string_live_game_possession_color"), &color);
+    gdk_color_parse (const_app(string_live_game_possession_color), &color);
     gtk_widget_modify_bg(eventbox_poss[unit->possession], GTK_STATE_NORMAL, &color);
     gtk_widget_modify_bg(eventbox_poss[!unit->possession], GTK_STATE_NORMAL, NULL);
 
@@ -82,13 +82,13 @@ game_gui_live_game_show_unit(const LiveGameUnit *unit)
     else
 	gtk_widget_hide(GTK_WIDGET(hscale));
 
-    sprintf(buf, "%d.", live_game_unit_get_minute(unit));
+    sprintf(buf, "%d.", live_game_unit_get_minute((LiveGame*)statp, unit));
     gtk_progress_bar_set_fraction(progress_bar, (fraction > 1) ? 1 : fraction);
     gtk_progress_bar_set_text(progress_bar, buf);
     g_usleep((gint)rint(sleep_factor * 
-			(gfloat)(const_int("int_game_gui_live_game_speed_max") +
+			(gfloat)(const_int(int_game_gui_live_game_speed_max) +
 				 (option_int("int_opt_user_live_game_speed", &usr(stat2).options) * 
-				  const_int("int_game_gui_live_game_speed_grad")))));
+				  const_int(int_game_gui_live_game_speed_grad)))));
 
     while(gtk_events_pending())
 	gtk_main_iteration();
@@ -133,52 +133,52 @@ game_gui_live_game_set_hscale(const LiveGameUnit *unit, GtkHScale *hscale)
 
     if(unit->area == LIVE_GAME_UNIT_AREA_MIDFIELD)
     {
-	gdk_color_parse(const_app("string_game_gui_live_game_scale_color_midfield"), &color);
+	gdk_color_parse(const_app(string_game_gui_live_game_scale_color_midfield), &color);
 	gtk_range_set_value(GTK_RANGE(hscale),
-			    const_float("float_game_gui_live_game_scale_range") / 2);
+			    const_float(float_game_gui_live_game_scale_range) / 2);
     }
     else if(unit->event.type == LIVE_GAME_EVENT_GOAL ||
 	    unit->event.type == LIVE_GAME_EVENT_OWN_GOAL)
     {
-	gdk_color_parse(const_app("string_game_gui_live_game_scale_color_goal"), &color);
+	gdk_color_parse(const_app(string_game_gui_live_game_scale_color_goal), &color);
 
 	gtk_range_set_value(GTK_RANGE(hscale), 
-			    const_float("float_game_gui_live_game_scale_range") *
+			    const_float(float_game_gui_live_game_scale_range) *
 			    (unit->possession == 0));
     }
     else if(unit->event.type == LIVE_GAME_EVENT_SCORING_CHANCE ||
 	    unit->event.type == LIVE_GAME_EVENT_PENALTY ||
 	    unit->event.type == LIVE_GAME_EVENT_FREE_KICK)
     {
-	gdk_color_parse(const_app("string_game_gui_live_game_scale_color_chance"), &color);
+	gdk_color_parse(const_app(string_game_gui_live_game_scale_color_chance), &color);
 
 	gtk_range_set_value(GTK_RANGE(hscale), 
-			    const_float("float_game_gui_live_game_scale_range") / 2 +
-			    (const_float("float_game_gui_live_game_scale_range") * 
-			     const_float("float_game_gui_live_game_scale_chance") *
+			    const_float(float_game_gui_live_game_scale_range) / 2 +
+			    (const_float(float_game_gui_live_game_scale_range) * 
+			     const_float(float_game_gui_live_game_scale_chance) *
 			     ((unit->possession == 0) ? 1 : -1)));
     }
     else if(unit->event.type == LIVE_GAME_EVENT_POST ||
 	    unit->event.type == LIVE_GAME_EVENT_MISS ||
 	    unit->event.type == LIVE_GAME_EVENT_SAVE ||
 	    unit->event.type == LIVE_GAME_EVENT_CROSS_BAR)
-	gdk_color_parse(const_app("string_game_gui_live_game_scale_color_miss"), &color);
+	gdk_color_parse(const_app(string_game_gui_live_game_scale_color_miss), &color);
     else if(unit->area == LIVE_GAME_UNIT_AREA_ATTACK)
     {
-	gdk_color_parse(const_app("string_game_gui_live_game_scale_color_attack"), &color);	
+	gdk_color_parse(const_app(string_game_gui_live_game_scale_color_attack), &color);	
 	gtk_range_set_value(GTK_RANGE(hscale),
-			    const_float("float_game_gui_live_game_scale_range") / 2 +
-			    (const_float("float_game_gui_live_game_scale_range") * 
-			     const_float("float_game_gui_live_game_scale_attack") *
+			    const_float(float_game_gui_live_game_scale_range) / 2 +
+			    (const_float(float_game_gui_live_game_scale_range) * 
+			     const_float(float_game_gui_live_game_scale_attack) *
 			     ((unit->possession == 0) ? 1 : -1)));
     }
     else if(unit->area == LIVE_GAME_UNIT_AREA_DEFEND)
     {
-	gdk_color_parse(const_app("string_game_gui_live_game_scale_color_defend"), &color);
+	gdk_color_parse(const_app(string_game_gui_live_game_scale_color_defend), &color);
 	gtk_range_set_value(GTK_RANGE(hscale),
-			    const_float("float_game_gui_live_game_scale_range") / 2 +
-			    (const_float("float_game_gui_live_game_scale_range") * 
-			     const_float("float_game_gui_live_game_scale_attack") *
+			    const_float(float_game_gui_live_game_scale_range) / 2 +
+			    (const_float(float_game_gui_live_game_scale_range) * 
+			     const_float(float_game_gui_live_game_scale_attack) *
 			     ((unit->possession == 0) ? -1 : 1)));
     }
     else
@@ -291,7 +291,7 @@ game_gui_set_main_window_header(void)
     gui_label_set_text_from_int(label_week, week, FALSE);
     gui_label_set_text_from_int(label_round, week_round, FALSE);
 
-    if(!sett_int("int_opt_disable_finances"))
+    if(!sett_int(int_opt_disable_finances))
     {
 	misc_print_grouped_int(current_user.money, buf);
 	gtk_label_set_text(label_money, buf);
@@ -366,15 +366,15 @@ game_gui_write_meter_images(const Team *tm, GtkImage *style, GtkImage *boost)
     gint i;
 
     gchar *image_style_files[5] = 
-	{file_find_support_file(const_app("string_game_gui_style_all_out_defend_icon"), TRUE),
-	 file_find_support_file(const_app("string_game_gui_style_defend_icon"), TRUE),
-	 file_find_support_file(const_app("string_game_gui_style_balanced_icon"), TRUE),
-	 file_find_support_file(const_app("string_game_gui_style_attack_icon"), TRUE),
-	 file_find_support_file(const_app("string_game_gui_style_all_out_attack_icon"), TRUE)};
+	{file_find_support_file(const_app(string_game_gui_style_all_out_defend_icon), TRUE),
+	 file_find_support_file(const_app(string_game_gui_style_defend_icon), TRUE),
+	 file_find_support_file(const_app(string_game_gui_style_balanced_icon), TRUE),
+	 file_find_support_file(const_app(string_game_gui_style_attack_icon), TRUE),
+	 file_find_support_file(const_app(string_game_gui_style_all_out_attack_icon), TRUE)};
     gchar *image_boost_files[3] =
-	{file_find_support_file(const_app("string_game_gui_boost_anti_icon"), TRUE),
-	 file_find_support_file(const_app("string_game_gui_boost_off_icon"), TRUE),
-	 file_find_support_file(const_app("string_game_gui_boost_on_icon"), TRUE)};
+	{file_find_support_file(const_app(string_game_gui_boost_anti_icon), TRUE),
+	 file_find_support_file(const_app(string_game_gui_boost_off_icon), TRUE),
+	 file_find_support_file(const_app(string_game_gui_boost_on_icon), TRUE)};
 
     gtk_image_set_from_file(style, image_style_files[tm->style + 2]);
     gtk_image_set_from_file(boost, image_boost_files[tm->boost + 1]);    
@@ -462,7 +462,7 @@ game_gui_read_radio_items(GtkWidget *widget)
 	{
 	    current_user.tm->boost = i - 1;
 
-	    if(current_user.tm->boost == 1 && sett_int("int_opt_disable_boost_on"))
+	    if(current_user.tm->boost == 1 && sett_int(int_opt_disable_boost_on))
 	    {
 		current_user.tm->boost = 0;
 		game_gui_print_message(_("Boost ON is disabled in this country definition."));
@@ -473,28 +473,28 @@ game_gui_read_radio_items(GtkWidget *widget)
 	if(widget == style[i])
 	    current_user.tm->style = i - 2;
     
-    if(!sett_int("int_opt_disable_transfers"))
+    if(!sett_int(int_opt_disable_transfers))
     {
 	for(i=0;i<4;i++)
 	    if(widget == scout[i])
 		current_user.scout = 100 + i * 10 + old_scout % 10;
     }
 
-    if(!sett_int("int_opt_disable_transfers"))
+    if(!sett_int(int_opt_disable_transfers))
     {
 	for(i=0;i<4;i++)
 	    if(widget == physio[i])
 		current_user.physio = 100 + i * 10 + old_physio % 10;
     }
 
-    if(!sett_int("int_opt_disable_ya"))
+    if(!sett_int(int_opt_disable_ya))
     {
 	for(i=0;i<4;i++)
 	    if(widget == yc[i])
 		current_user.youth_academy.coach = 100 + i * 10 + old_yc % 10;
     }
     
-    if(!sett_int("int_opt_disable_ya"))
+    if(!sett_int(int_opt_disable_ya))
     {
 	for(i=0;i<5;i++)
 	    if(widget == ya_pos_pref[i])
@@ -534,8 +534,8 @@ game_gui_show_main(Bygfoot *bygfoot)
 
     current_user.counters[COUNT_USER_TOOK_TURN] = 1;
 
-    if((opt_int("int_opt_news_popup") == 2 ||
-        (opt_int("int_opt_news_popup") == 1 &&
+    if((opt_int(int_opt_news_popup) == 2 ||
+        (opt_int(int_opt_news_popup) == 1 &&
          counters[COUNT_NEW_NEWS] == 1)) &&
        counters[COUNT_NEWS_SHOWN] == 0 &&
        counters[COUNT_NEW_NEWS] != 0)
@@ -578,7 +578,7 @@ game_gui_print_message(gchar *format, ...)
     if(timeout_id != -1)
 	g_source_remove(timeout_id);
 
-    timeout_id = g_timeout_add(const_int("int_game_gui_message_duration") * 1000,
+    timeout_id = g_timeout_add(const_int(int_game_gui_message_duration) * 1000,
 			       (GSourceFunc)game_gui_clear_entry_message, NULL);
 }
 
@@ -615,7 +615,7 @@ game_gui_print_message_with_delay(const gchar *format, ...)
     if(timeout_id != -1)
 	g_source_remove(timeout_id);
 
-    g_timeout_add(const_int("int_game_gui_message_delay") * 1000,
+    g_timeout_add(const_int(int_game_gui_message_delay) * 1000,
 		  (GSourceFunc)game_gui_print_message_source,
 		  (gpointer)g_strdup(text));
 }
@@ -754,7 +754,7 @@ game_gui_show_warning(const gchar *format, ...)
     g_vsprintf(text, format, args);
     va_end (args);
 
-    if(opt_int("int_opt_prefer_messages") &&
+    if(opt_int(int_opt_prefer_messages) &&
        window.main != NULL)
 	game_gui_print_message(text, NULL);
     else
@@ -840,8 +840,8 @@ game_gui_show_job_offer(Team *team, Job *job, gint type)
 
     misc_print_grouped_int(
 	math_round_integer(tm->stadium.capacity * 
-			   math_rndi(const_int("int_initial_money_lower"),
-				     const_int("int_initial_money_upper")), 2),
+			   math_rndi(const_int(int_initial_money_lower),
+				     const_int(int_initial_money_upper)), 2),
 	buf);
 
     gtk_label_set_text(label_money, buf);
@@ -876,11 +876,11 @@ game_gui_write_check_items(void)
 	GTK_CHECK_MENU_ITEM(lookup_widget(window.main, "menu_overwrite"));
 
     gtk_check_menu_item_set_active(menu_job_offers,
-				   opt_user_int("int_opt_user_show_job_offers"));
+				   opt_user_int(int_opt_user_show_job_offers));
     gtk_check_menu_item_set_active(menu_live_game,
-				   opt_user_int("int_opt_user_show_live_game"));
+				   opt_user_int(int_opt_user_show_live_game));
     gtk_check_menu_item_set_active(menu_overwrite,
-				   opt_int("int_opt_save_will_overwrite"));
+				   opt_int(int_opt_save_will_overwrite));
 }
 
 /** Change the options according to the check menu widgets. */
@@ -898,30 +898,30 @@ game_gui_read_check_items(GtkWidget *widget)
 
     if(widget == menu_job_offers)
     {
-	opt_user_set_int("int_opt_user_show_job_offers", 
-			 !opt_user_int("int_opt_user_show_job_offers"));
+	opt_user_set_int(int_opt_user_show_job_offers, 
+			 !opt_user_int(int_opt_user_show_job_offers));
 	game_gui_print_message(_("Job offers set to %s."),
 			       team_attribute_to_char(
 				   TEAM_ATTRIBUTE_BOOST, 
-				   opt_user_int("int_opt_user_show_job_offers")));
+				   opt_user_int(int_opt_user_show_job_offers)));
     }
     else if(widget == menu_live_game)
     {
-	opt_user_set_int("int_opt_user_show_live_game", 
-			 !opt_user_int("int_opt_user_show_live_game"));
+	opt_user_set_int(int_opt_user_show_live_game, 
+			 !opt_user_int(int_opt_user_show_live_game));
 	game_gui_print_message(_("Live game set to %s."),
 			       team_attribute_to_char(
 				   TEAM_ATTRIBUTE_BOOST, 
-				   opt_user_int("int_opt_user_show_live_game")));
+				   opt_user_int(int_opt_user_show_live_game)));
     }
     else if(widget == menu_overwrite)
     {
-	opt_set_int("int_opt_save_will_overwrite", 
-		    !opt_int("int_opt_save_will_overwrite"));
+	opt_set_int(int_opt_save_will_overwrite, 
+		    !opt_int(int_opt_save_will_overwrite));
 	game_gui_print_message(_("Overwrite set to %s."),
 			       team_attribute_to_char(
 				   TEAM_ATTRIBUTE_BOOST, 
-				   opt_int("int_opt_save_will_overwrite")));
+				   opt_int(int_opt_save_will_overwrite)));
     }
     else
 	debug_print_message("game_gui_read_check_items: unknown widget.");
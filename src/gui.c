@@ -63,7 +63,7 @@ gui_label_set_text_from_int(GtkLabel *label, gint number, gboolean append)
 gdouble
 gui_get_progress_bar_fraction(void)
 {
-    if(sett_int("int_opt_goto_mode"))
+    if(sett_int(int_opt_goto_mode))
         return 0;
     
     return gtk_progress_bar_get_fraction(
@@ -84,7 +84,7 @@ gui_show_progress(gfloat value, const gchar *text, gint pictype)
 
     GtkProgressBar *progressbar = NULL;
 
-    if(sett_int("int_opt_goto_mode"))
+    if(sett_int(int_opt_goto_mode))
     {
 	window_destroy(&window.progress);        
         return;  
@@ -24,6 +24,7 @@
 */
 
 #include "bet.h"
+#include "competition.h"
 #include "cup.h"
 #include "file.h"
 #include "free.h"
@@ -60,7 +61,7 @@ job_update(Bygfoot *bygfoot)
 	    job_remove(&g_array_index(jobs, Job, i), TRUE);
     }
 
-    if(week % const_int("int_job_update_interval") != 2)
+    if(week % const_int(int_job_update_interval) != 2)
 	return;
 
     for (i = 0; i < country.leagues->len; i++) {
@@ -72,13 +73,13 @@ job_update(Bygfoot *bygfoot)
      * job_pick_team_from_country();
      */
 
-    new_offers = math_rndi(const_int("int_job_new_offers_lower"),
-			   const_int("int_job_new_offers_upper"));
+    new_offers = math_rndi(const_int(int_job_new_offers_lower),
+			   const_int(int_job_new_offers_upper));
 
     new_offers = MIN(new_offers, national_teams - jobs->len);
     int_offers = (users->len == 1) ? 
 	(gint)rint((gfloat)new_offers *
-		   const_float("float_job_international_perc")) : 0;
+		   const_float(float_job_international_perc)) : 0;
 
     for(i=0;i<new_offers - int_offers;i++)
 	job_add_new_national();
@@ -115,8 +116,8 @@ job_add_new_international(gint num_of_new)
 
 	new_job.country_file = 
 	    g_strdup_printf("country_%s.xml", job_country->sid);
-	new_job.time = math_rndi(const_int("int_job_update_interval") - 1,
-				 const_int("int_job_update_interval") + 1);
+	new_job.time = math_rndi(const_int(int_job_update_interval) - 1,
+				 const_int(int_job_update_interval) + 1);
 	new_job.country_name = g_strdup(job_country->name);
 	new_job.country_rating = job_country->rating;
 	new_job.league_name = g_strdup(league->c.name);
@@ -182,8 +183,8 @@ job_add_new_national(void)
     job_pick_team_from_country(&country, &tm, &league);
 
     new_job.type = JOB_TYPE_NATIONAL;
-    new_job.time = math_rndi(const_int("int_job_update_interval") - 1,
-			     const_int("int_job_update_interval") + 1);
+    new_job.time = math_rndi(const_int(int_job_update_interval) - 1,
+			     const_int(int_job_update_interval) + 1);
     new_job.country_file = NULL;
     new_job.country_name = country.name;
     new_job.country_rating = -1;
@@ -234,6 +235,8 @@ job_pick_team_from_country(const Country *cntry, Team **tm, League **league)
     }
     while(team_is_user(*tm) != -1 ||
 	  job_team_is_on_list((*tm)->id) != -1);
+
+    team_fill_skeleton(*tm);
 }
 
 /** Find out whether the team with given id is already on the
@@ -321,20 +324,20 @@ query_job_application_successful(const Job *job, const User *user)
 	job_av_skill = team_get_average_skill(tm, FALSE);
 
     success_needed = (job_av_skill - user_av_skill) * 
-	(gfloat)const_int("int_job_application_points_per_av_skill");
+	(gfloat)const_int(int_job_application_points_per_av_skill);
 
     success_needed += 
 	((gfloat)(job->league_layer - user->tm->league->layer) *
-	 (gfloat)const_int("int_job_application_points_per_layer"));
+	 (gfloat)const_int(int_job_application_points_per_layer));
 
     if(job->type != JOB_TYPE_NATIONAL)
     {
 	success_needed += 
-	    (gfloat)const_int("int_job_application_points_international");
+	    (gfloat)const_int(int_job_application_points_international);
 
 	success_needed +=
 	    ((gfloat)(job->country_rating - country.rating) *
-	     (gfloat)const_int("int_job_application_points_per_rating"));
+	     (gfloat)const_int(int_job_application_points_per_rating));
     }
 
     return (user->counters[COUNT_USER_SUCCESS] >= success_needed);
@@ -392,6 +395,7 @@ job_change_country(Job *job, Bygfoot *bygfoot)
     free_country(&country, TRUE);
 
     xml_country_read(job->country_file, &country, bygfoot);
+    competition_assign_slots(bygfoot);
 
     stat5 = STATUS_GENERATE_TEAMS;
     for(i=0;i<country.leagues->len;i++) {
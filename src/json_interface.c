@@ -1,4 +1,5 @@
 
+#include <errno.h>
 #include <json-c/json.h>
 #include <json-c/json_tokener.h>
 #include <json-c/json_object.h>
@@ -10,9 +11,19 @@
 #include "misc.h"
 #include "team.h"
 #include "option.h"
+#include "snapshot.h"
 #include "start_end.h"
 
+#ifdef G_OS_UNIX
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
 static int bygfoot_json_do_commands(Bygfoot *bygfoot, const json_object *commands);
+static gboolean bygfoot_json_do_command(Bygfoot *bygfoot, const json_object *command);
+static int bygfoot_json_serve(Bygfoot *bygfoot, const CommandLineArgs *cl_args);
 static int bygfoot_json_do_add_user(Bygfoot *bygfoot, const json_object *args);
 static void bygfoot_json_call_load_bygfoot(Bygfoot *bygfoot, const json_object *args);
 static void bygfoot_json_call_save_bygfoot(Bygfoot *bygfoot, const json_object *args);
@@ -20,6 +31,8 @@ static void bygfoot_json_call_dump_bygfoot(Bygfoot *bygfoot, const json_object *
 static void bygfoot_json_call_add_country(Bygfoot *bygfoot, const json_object *args);
 static void bygfoot_json_call_add_user(Bygfoot *bygfoot, const json_object *args);
 static void bygfoot_json_call_start_bygfoot(Bygfoot *bygfoot, const json_object *args);
+static void bygfoot_json_call_snapshot(Bygfoot *bygfoot, const json_object *args);
+static void bygfoot_json_call_restore(Bygfoot *bygfoot, const json_object *args);
 static void bygfoot_json_call_simulate_games(Bygfoot *bygfoot,
                                                       const json_object *args);
 static void bygfoot_json_call_get_tables(Bygfoot *bygfoot,
@@ -37,6 +50,18 @@ void bygfoot_json_player_to_json(const Player *player);
 void bygfoot_json_user_to_json(const User *user);
 void bygfoot_json_table_to_json(const Table *table);
 
+/** Where the responses go: stdout, or the connection
+    we're serving in socket mode. */
+static void (*json_write)(const char *s, gpointer userdata) =
+    bygfoot_json_serialize_write_stdout;
+static gpointer json_write_data = NULL;
+
+/** Set when a 'quit' command arrives in server mode. */
+static gboolean json_quit = FALSE;
+
+/** The snapshots taken with the 'snapshot' command, by name. */
+static GHashTable *json_snapshots = NULL;
+
 struct json_field {
     const gchar *name;
     enum json_type type;
@@ -67,7 +92,10 @@ int bygfoot_json_main(Bygfoot *bygfoot, const CommandLineArgs *cl_args)
 
     /* Disable option to skip rounds without user games, so the simulate_games
      * command works correctly. */
-    opt_set_int("int_opt_skip", 0);
+    opt_set_int(int_opt_skip, 0);
+
+    if (cl_args->json_server || cl_args->json_socket)
+        return bygfoot_json_serve(bygfoot, cl_args);
 
     if (!g_file_get_contents(cl_args->json_filename, &contents, NULL, &error)) {
         misc_print_error(&error, FALSE);
@@ -94,9 +122,11 @@ int bygfoot_json_main(Bygfoot *bygfoot, const CommandLineArgs *cl_args)
     return 1;
 }
 
-static int bygfoot_json_do_commands(Bygfoot *bygfoot, const json_object *commands)
+/** Run a single command object, e.g. { 'simulate_games' : { 'weeks' : 1 } }.
+    @return FALSE if none of the keys is a known command. */
+static gboolean bygfoot_json_do_command(Bygfoot *bygfoot, const json_object *command)
 {
-    size_t i, num_commands;
+    gboolean found = FALSE;
 
     static const struct json_func {
         const gchar *command;
@@ -109,6 +139,8 @@ static int bygfoot_json_do_commands(Bygfoot *bygfoot, const json_object *command
         { "add_user", bygfoot_json_call_add_user },
         { "start_bygfoot", bygfoot_json_call_start_bygfoot },
         { "simulate_games", bygfoot_json_call_simulate_games },
+        { "snapshot", bygfoot_json_call_snapshot },
+        { "restore", bygfoot_json_call_restore },
         { "get_tables", bygfoot_json_call_get_tables },
         { "get_players", bygfoot_json_call_get_players },
         { "get_fixtures", bygfoot_json_call_get_fixtures },
@@ -117,6 +149,26 @@ static int bygfoot_json_do_commands(Bygfoot *bygfoot, const json_object *command
         { NULL, NULL}
     };
 
+    if (!json_object_is_type(command, json_type_object))
+        return FALSE;
+
+    json_object_object_foreach(command, key, val) {
+        const struct json_func *json_func;
+        for (json_func = json_funcs; json_func->command; json_func++) {
+            if (!strcmp(json_func->command, key)) {
+                json_func->func(bygfoot, val);
+                found = TRUE;
+                break;
+            }
+        }
+    }
+    return found;
+}
+
+static int bygfoot_json_do_commands(Bygfoot *bygfoot, const json_object *commands)
+{
+    size_t i, num_commands;
+
     if (!json_object_is_type(commands, json_type_array)) {
         fprintf(stderr, "json commands should be in an array\n");
         return 1;
@@ -125,20 +177,161 @@ static int bygfoot_json_do_commands(Bygfoot *bygfoot, const json_object *command
     num_commands = json_object_array_length(commands);
     for (i = 0; i < num_commands; i++) {
         const json_object *command = json_object_array_get_idx(commands, i);
-        struct json_object *response = NULL;
         // TODO: CHECK COMMAND SIZE
+        bygfoot_json_do_command(bygfoot, command);
+    }
+    return 0;
+}
 
-        json_object_object_foreach(command, key, val) {
-            const struct json_func *json_func;
-            for (json_func = json_funcs; json_func->command; json_func++) {
-                if (!strcmp(json_func->command, key)) {
-                    json_func->func(bygfoot, val);
-                    break;
-                }
-            }
+/** Write function for the responses in socket mode. */
+static void
+bygfoot_json_write_file(const char *s, gpointer userdata)
+{
+    fputs(s, (FILE*)userdata);
+}
+
+/** Handle one line of input in server mode. The line is either a
+    single command object, an object with a 'commands' array like
+    in the command files or { 'quit' : { } }. Every request is answered
+    by the output of the commands followed by a line { "done" : true }
+    (or false if the request couldn't be handled), so clients
+    know when the response is complete. */
+static void
+bygfoot_json_serve_line(Bygfoot *bygfoot, const gchar *line)
+{
+    struct json_object *json, *commands;
+    enum json_tokener_error json_error;
+    gboolean done = TRUE;
+
+    json = json_tokener_parse_verbose(line, &json_error);
+    if (!json) {
+        bygfoot_json_response_error("", json_tokener_error_desc(json_error));
+        done = FALSE;
+    } else if (json_object_object_get_ex(json, "quit", NULL)) {
+        json_quit = TRUE;
+    } else if (json_object_object_get_ex(json, "commands", &commands)) {
+        done = (bygfoot_json_do_commands(bygfoot, commands) == 0);
+    } else if (!bygfoot_json_do_command(bygfoot, json)) {
+        bygfoot_json_response_error("", "unknown command");
+        done = FALSE;
+    }
+
+    json_write(done ? "\n{ \"done\" : true }\n" : "\n{ \"done\" : false }\n",
+               json_write_data);
+    if (json_write_data != NULL)
+        fflush((FILE*)json_write_data);
+    else
+        fflush(stdout);
+
+    if (json)
+        json_object_put(json);
+}
+
+/** Read commands line by line from the file descriptor until
+    EOF or a 'quit' command. */
+static void
+bygfoot_json_serve_fd(Bygfoot *bygfoot, gint fd)
+{
+    GIOChannel *channel = g_io_channel_unix_new(fd);
+    GError *error = NULL;
+    gchar *line = NULL;
+    GIOStatus status;
+
+    while (!json_quit) {
+        status = g_io_channel_read_line(channel, &line, NULL, NULL, &error);
+        if (status != G_IO_STATUS_NORMAL)
+            break;
+
+        g_strstrip(line);
+        if (strlen(line) > 0)
+            bygfoot_json_serve_line(bygfoot, line);
+        g_free(line);
+    }
+
+    misc_print_error(&error, FALSE);
+    g_io_channel_unref(channel);
+}
+
+/** Keep the game in memory and process commands until
+    we're told to quit. The commands come from stdin or, if a socket
+    is given, from the clients connecting to it one after another. */
+static int
+bygfoot_json_serve(Bygfoot *bygfoot, const CommandLineArgs *cl_args)
+{
+#ifdef G_OS_UNIX
+    struct sockaddr_un addr;
+    gint sock, conn, out_fd;
+    FILE *out;
+
+    if (!cl_args->json_socket) {
+        bygfoot_json_serve_fd(bygfoot, fileno(stdin));
+        return 0;
+    }
+
+    if (strlen(cl_args->json_socket) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Socket path %s is too long\n", cl_args->json_socket);
+        return 1;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, cl_args->json_socket);
+    unlink(cl_args->json_socket);
+
+    sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sock < 0 || bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+        listen(sock, 1) < 0) {
+        fprintf(stderr, "Failed to listen on socket %s: %s\n",
+                cl_args->json_socket, g_strerror(errno));
+        return 1;
+    }
+
+    /* A client that goes away before reading its answer
+       mustn't take the server down with it. */
+    signal(SIGPIPE, SIG_IGN);
+
+    while (!json_quit) {
+        conn = accept(sock, NULL, NULL);
+        if (conn < 0) {
+            if (errno == EINTR)
+                continue;
+            fprintf(stderr, "accept failed: %s\n", g_strerror(errno));
+            break;
+        }
+
+        out_fd = dup(conn);
+        out = (out_fd < 0) ? NULL : fdopen(out_fd, "w");
+        if (!out) {
+            fprintf(stderr, "Failed to open connection for writing: %s\n",
+                    g_strerror(errno));
+            if (out_fd >= 0)
+                close(out_fd);
+            close(conn);
+            continue;
         }
+
+        json_write = bygfoot_json_write_file;
+        json_write_data = out;
+
+        bygfoot_json_serve_fd(bygfoot, conn);
+
+        fclose(out);
+        close(conn);
+        json_write = bygfoot_json_serialize_write_stdout;
+        json_write_data = NULL;
     }
+
+    close(sock);
+    unlink(cl_args->json_socket);
     return 0;
+#else
+    if (cl_args->json_socket) {
+        fprintf(stderr, "Sockets are only supported on UNIX systems\n");
+        return 1;
+    }
+    bygfoot_json_serve_fd(bygfoot, fileno(stdin));
+    return 0;
+#endif
 }
 
 static const gchar *
@@ -167,7 +360,8 @@ bygfoot_json_call_load_bygfoot(Bygfoot *bygfoot, const json_object *args)
     struct json_object *filename_obj;
     const gchar *filename;
     static const struct json_field fields [] = {
-        { "filename", json_type_string }
+        { "filename", json_type_string },
+        { NULL, json_type_null }
     };
 
     if (!bygfoot_json_validate_arg_types(args, fields)) {
@@ -198,7 +392,8 @@ bygfoot_json_call_save_bygfoot(Bygfoot *bygfoot, const json_object *args)
     struct json_object *filename_obj;
     const gchar *filename;
     static const struct json_field fields [] = {
-        { "filename", json_type_string }
+        { "filename", json_type_string },
+        { NULL, json_type_null }
     };
 
     if (!bygfoot_json_validate_arg_types(args, fields))
@@ -218,7 +413,7 @@ void
 bygfoot_json_call_dump_bygfoot(Bygfoot *bygfoot, const json_object *args)
 {
     bygfoot_json_serialize_bygfoot(bygfoot, NULL,
-                                   bygfoot_json_serialize_write_stdout, NULL);
+                                   json_write, json_write_data);
 }
 
 static void
@@ -315,6 +510,77 @@ bygfoot_json_call_start_bygfoot(Bygfoot *bygfoot,
     }
 }
 
+/** Return the 'name' argument of the snapshot commands,
+    'default' if it's missing, or NULL if it's not a string. */
+static const gchar *
+bygfoot_json_get_snapshot_name(const json_object *args)
+{
+    struct json_object *name_obj;
+
+    if (!json_object_object_get_ex(args, "name", &name_obj))
+        return "default";
+
+    if (!json_object_is_type(name_obj, json_type_string))
+        return NULL;
+
+    return json_object_get_string(name_obj);
+}
+
+/** Keep a copy of the game in memory under the given name, replacing
+    an older snapshot with the same name.
+    Example: { 'snapshot' : { 'name' : 'start' } } */
+static void
+bygfoot_json_call_snapshot(Bygfoot *bygfoot, const json_object *args)
+{
+    const gchar *name = bygfoot_json_get_snapshot_name(args);
+
+    if (!name)
+        return bygfoot_json_response_error("snapshot", "field 'name' must be a string");
+
+    if (!country_list)
+        return bygfoot_json_response_error("snapshot", "the game hasn't been started");
+
+    if (!json_snapshots)
+        json_snapshots = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+    else {
+        Snapshot *old = g_hash_table_lookup(json_snapshots, name);
+        if (old)
+            snapshot_free(bygfoot, old);
+    }
+
+    g_hash_table_insert(json_snapshots, g_strdup(name), snapshot_new(bygfoot));
+}
+
+/** Go back to a snapshot. If a seed is given, the random
+    number generator gets reseeded so the games take a different course
+    than after the last restore.
+    Example: { 'restore' : { 'name' : 'start', 'seed' : 42 } } */
+static void
+bygfoot_json_call_restore(Bygfoot *bygfoot, const json_object *args)
+{
+    const gchar *name = bygfoot_json_get_snapshot_name(args);
+    const Snapshot *snapshot;
+    struct json_object *seed_obj;
+    static const struct json_field fields [] = {
+        { "seed", json_type_int },
+        { NULL, json_type_null }
+    };
+
+    if (!name || !bygfoot_json_validate_arg_types(args, fields))
+        return bygfoot_json_response_error("restore", "wrong type for argument");
+
+    snapshot = json_snapshots ? g_hash_table_lookup(json_snapshots, name) : NULL;
+    if (!snapshot)
+        return bygfoot_json_response_error("restore", "snapshot not found");
+
+    snapshot_restore(bygfoot, snapshot);
+
+    if (json_object_object_get_ex(args, "seed", &seed_obj)) {
+        rand_seed = (guint32)json_object_get_int(seed_obj);
+        g_rand_set_seed(rand_generator, rand_seed);
+    }
+}
+
 static void simulate_weeks(Bygfoot *bygfoot, gint weeks)
 {
     gint num_weeks = 0;
@@ -372,7 +638,7 @@ bygfoot_json_call_get_fixtures(Bygfoot *bygfoot, const json_object *args)
         int j;
         for (j = 0; j < league->fixtures->len; j++) {
             const Fixture *fixture = &g_array_index(league->fixtures, Fixture, j);
-            bygfoot_json_serialize_fixture(fixture, NULL, bygfoot_json_serialize_write_stdout, NULL);
+            bygfoot_json_serialize_fixture(fixture, NULL, json_write, json_write_data);
         }
     }
     for (i = 0; i < country.cups->len; i++) {
@@ -380,7 +646,7 @@ bygfoot_json_call_get_fixtures(Bygfoot *bygfoot, const json_object *args)
         int j;
         for (j = 0; j < cup->fixtures->len; j++) {
             const Fixture *fixture = &g_array_index(cup->fixtures, Fixture, j);
-	    bygfoot_json_serialize_fixture(fixture, NULL, bygfoot_json_serialize_write_stdout, NULL);
+	    bygfoot_json_serialize_fixture(fixture, NULL, json_write, json_write_data);
         }
     }
     for (i = 0; i < bygfoot->international_cups->len; i++) {
@@ -388,7 +654,7 @@ bygfoot_json_call_get_fixtures(Bygfoot *bygfoot, const json_object *args)
         int j;
         for (j = 0; j < cup->fixtures->len; j++) {
             const Fixture *fixture = &g_array_index(cup->fixtures, Fixture, j);
-            bygfoot_json_serialize_fixture(fixture, NULL, bygfoot_json_serialize_write_stdout, NULL);
+            bygfoot_json_serialize_fixture(fixture, NULL, json_write, json_write_data);
         }
     }
 }
@@ -419,7 +685,7 @@ bygfoot_json_call_get_tables(Bygfoot *bygfoot, const json_object *args)
         int j;
         for (j = 0; j < league->tables->len; j++) {
             const Table *table = &g_array_index(league->tables, Table, j);
-            bygfoot_json_serialize_table(table, NULL, bygfoot_json_serialize_write_stdout, NULL);
+            bygfoot_json_serialize_table(table, NULL, json_write, json_write_data);
         }
     }
     return;
@@ -439,7 +705,7 @@ bygfoot_json_call_get_players(Bygfoot *bygfoot, const json_object *args)
             int k;
             for (k = 0; k < team->players->len; k++) {
                 const Player *player = &g_array_index(team->players, Player, k);
-                bygfoot_json_serialize_player(player, NULL, bygfoot_json_serialize_write_stdout, NULL);
+                bygfoot_json_serialize_player(player, NULL, json_write, json_write_data);
             }
 
         }
@@ -451,15 +717,14 @@ void
 bygfoot_json_call_get_cups(Bygfoot *bygfoot, const json_object *args)
 {
     bygfoot_json_serialize_cups(country.cups, NULL,
-                                bygfoot_json_serialize_write_stdout, NULL);
+                                json_write, json_write_data);
 }
 
 void
 bygfoot_json_call_get_leagues(Bygfoot *bygfoot, const json_object *args)
 {
     bygfoot_json_serialize_leagues(country.leagues, NULL,
-                                   bygfoot_json_serialize_write_stdout,
-                                   NULL);
+                                   json_write, json_write_data);
 }
 
 static void 
@@ -470,7 +735,10 @@ bygfoot_json_live_game_stats_to_json(const LiveGameStats *stats, gint team_index
 
 void bygfoot_json_response_error(const char *command, const char *error)
 {
-    printf("'error' : '%s'\n", error);
+    gchar *buf = g_strdup_printf("'error' : '%s'\n", error);
+
+    json_write(buf, json_write_data);
+    g_free(buf);
 }
 
 static void bygfoot_json_error_to_console(const char *command, const char *error)
@@ -22,11 +22,6 @@
 #include "json_serialize.h"
 #include "league_struct.h"
 
-static void write_json(const char *str)
-{
-    printf("%s", str);
-}
-
 static void write_json_field_key(const char *key,
                                  void (*write_func)(const char *, gpointer),
                                  gpointer userdata)
@@ -36,19 +31,18 @@ static void write_json_field_key(const char *key,
     write_func("\":", userdata);
 }
 
-static void temp_write_json_field_key(const char *key)
-{
-    printf("\"%s\":", key);
-}
-
 struct len_userdata {
     gint len;
     gpointer write_userdata;
 };
 
+/* The separators and keys are written with the userdata the object
+   started with; SERIALIZE_WITH_CUSTOM_USERDATA() only replaces it
+   for the value. */
 #define SERIALIZE_BEGIN_OBJECT(write_func, userdata) \
    { \
      gboolean __have_field = FALSE; \
+     gpointer __write_userdata = userdata; \
      write_func("{", userdata); \
 
 #define SERIALIZE_END_OBJECT(write_func, userdata) \
@@ -66,9 +60,9 @@ struct len_userdata {
     json_object *child_fields = NULL; \
     if (!field_list || json_object_object_get_ex(field_list, field, &child_fields)) { \
         if (__have_field) { \
-            write_json(","); \
+            write_func(",", __write_userdata); \
         } \
-	temp_write_json_field_key(field); \
+        write_json_field_key(field, write_func, __write_userdata); \
         serialize_stmt; \
         __have_field = TRUE; \
     } \
@@ -79,9 +73,9 @@ struct len_userdata {
     json_object *child_fields = NULL; \
     if (!field_list || json_object_object_get_ex(field_list, field, &child_fields)) { \
         if (__have_field) { \
-            write_func(",", userdata); \
+            write_func(",", __write_userdata); \
         } \
-        write_json_field_key(field, write_func, userdata); \
+        write_json_field_key(field, write_func, __write_userdata); \
         serialize_func(val, child_fields, write_func, userdata); \
         __have_field = TRUE; \
     } \
@@ -51,14 +51,14 @@ language_set(Bygfoot *bygfoot, gint index)
     gchar buf[SMALL], buf2[SMALL];
     gchar *dir;
     GPtrArray *codes =
-	misc_separate_strings(const_str("string_language_codes"));
+	misc_separate_strings(const_str(string_language_codes));
 
     if(index > 0)
 	strcpy(buf, (gchar*)g_ptr_array_index(codes, index - 1));
     else
 	strcpy(buf, "");
 
-    if(strcmp(buf, opt_str("string_opt_language_code")) != 0 ||
+    if(strcmp(buf, opt_str(string_opt_language_code)) != 0 ||
        window.main == NULL)
     {
 #ifndef MAC_BUILD
@@ -80,7 +80,7 @@ language_set(Bygfoot *bygfoot, gint index)
 #endif
 
 	g_setenv ("LANGUAGE", buf, TRUE);
-	opt_set_str("string_opt_language_code", buf);
+	opt_set_str(string_opt_language_code, buf);
 
 	{
 	    extern int _nl_msg_cat_cntr;
@@ -111,7 +111,7 @@ language_get_code_index(const gchar *code)
 
     gint i, return_value = -1;
     GPtrArray *codes =
-	misc_separate_strings(const_str("string_language_codes"));
+	misc_separate_strings(const_str(string_language_codes));
     gchar local_code[SMALL];
 
     strcpy(local_code, code);
@@ -192,9 +192,9 @@ language_pick_country(GPtrArray *country_files)
 
     gint i, j;
     GPtrArray *codes =
-	misc_separate_strings(const_str("string_language_codes"));
+	misc_separate_strings(const_str(string_language_codes));
     GPtrArray *defs =
-	misc_separate_strings(const_str("string_language_defs"));
+	misc_separate_strings(const_str(string_language_defs));
     gpointer prefdef = NULL;
     const gchar *lang = g_getenv("LANGUAGE");
 
@@ -247,14 +247,14 @@ language_get_code(gchar *buf)
     cur_locale = g_win32_getlocale ();
 #endif
 
-    if(strcmp(opt_str("string_opt_language_code"), "C") == 0)
+    if(strcmp(opt_str(string_opt_language_code), "C") == 0)
 	strcpy(buf, "en");
-    else if(strcmp(opt_str("string_opt_language_code"), "") == 0 &&
+    else if(strcmp(opt_str(string_opt_language_code), "") == 0 &&
 	    cur_locale != NULL)
     {
 	strncpy(buf, cur_locale, 2);
 	buf[2] = '\0';
     }
     else
-	strcpy(buf, opt_str("string_opt_language_code"));
+	strcpy(buf, opt_str(string_opt_language_code));
 }
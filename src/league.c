@@ -31,6 +31,7 @@
 #include "misc.h"
 #include "option.h"
 #include "player.h"
+#include "registry.h"
 #include "stat.h"
 #include "table.h"
 #include "team.h"
@@ -52,12 +53,14 @@ league_new(gboolean new_id, Country *country)
     League new;
 
     new.c.name = NULL;
-    new.names_file = g_strdup(opt_str("string_opt_player_names_file"));
+    new.names_file = g_strdup(opt_str(string_opt_player_names_file));
     new.sid = NULL;
     new.short_name = NULL;
     new.symbol = NULL;
 
     new.c.id = (new_id) ? league_id_new : -1;
+    new.c.slot = -1;
+    new.c.schedule.rounds = new.c.schedule.pairs = NULL;
     new.layer = -1;
 
     new.average_talent = 0;
@@ -174,6 +177,23 @@ league_cup_get_index_from_clid(gint clid)
     return index;
 }
 
+/** Find a league by scanning the leagues array; used to
+    cross-check the registry in debug mode.
+    @see league_from_clid() */
+static League*
+league_from_clid_scan(gint clid)
+{
+    gint i;
+
+    for(i=0;i<country.leagues->len;i++) {
+        League *league = g_ptr_array_index(country.leagues, i);
+        if(league->c.id == clid)
+            return league;
+    }
+
+    return NULL;
+}
+
 /** Return the league pointer belonging to the id.
     @param clid The id we look for.
     @return The league pointer or NULL if failed. */
@@ -184,19 +204,17 @@ league_from_clid(gint clid)
     printf("league_from_clid\n");
 #endif
 
-    gint i;
+    League *league = registry_get_league(clid);
 
-    for(i=0;i<country.leagues->len;i++) {
-        League *league = g_ptr_array_index(country.leagues, i);
-        if(league->c.id == clid)
-            return league;
-    }
+    if(debug > 130 && league != league_from_clid_scan(clid))
+	debug_print_message("league_from_clid: registry and scan disagree for league with id %d\n", clid);
 
-    main_exit_program(EXIT_POINTER_NOT_FOUND, 
-              "league_from_clid: didn't find league with id %d\n", 
-              clid);
+    if(league == NULL)
+	main_exit_program(EXIT_POINTER_NOT_FOUND, 
+			  "league_from_clid: didn't find league with id %d\n", 
+			  clid);
 
-    return NULL;
+    return league;
 }
 
 /** Return the id of the next league (or cup if we are
@@ -520,6 +538,7 @@ league_remove_team_with_id(League *league, gint id)
     if(((Team*)g_ptr_array_index(league->c.teams, i))->id == id)
     {
         g_ptr_array_remove_index(league->c.teams, i);
+        registry_invalidate();
         return;
     }
 
@@ -545,35 +564,35 @@ league_season_start(League *league)
         g_array_index(league_table(((League*)g_ptr_array_index(country.leagues, 0)))->elements, TableElement, 0).team) != -1);
     gboolean league_above_talent =
     (team_get_average_talents(league->c.teams) > league->average_talent *
-     const_float("float_season_end_league_above_talent_factor") && !user_champ);
+     const_float(float_season_end_league_above_talent_factor) && !user_champ);
     gboolean team_is_top = FALSE;
     Team *tm = NULL;
     
     gfloat team_change_lower = 
-    const_float("float_season_end_team_change_lower"),
+    const_float(float_season_end_team_change_lower),
     user_champ_addition = 
-    const_float("float_season_end_user_champ_addition"),
+    const_float(float_season_end_user_champ_addition),
     user_champ_best_teams_addition = 
-    const_float("float_season_end_user_champ_best_teams_addition"),
+    const_float(float_season_end_user_champ_best_teams_addition),
     team_change_upper = 
-    const_float("float_season_end_team_change_upper");
+    const_float(float_season_end_team_change_upper);
 
     gint user_champ_best_teams_limit =
-    const_int("int_season_end_user_champ_best_teams_limit");
+    const_int(int_season_end_user_champ_best_teams_limit);
 
     gfloat team_change_factor = 0;
 
     if(user_champ)
     {
         tm = g_array_index(league_table(((League*)g_ptr_array_index(country.leagues, 0)))->elements, TableElement, 0).team;
-        tm->luck = MAX(tm->luck * const_float("float_season_end_user_champ_luck_factor"),
-               const_float("float_luck_limit"));
+        tm->luck = MAX(tm->luck * const_float(float_season_end_user_champ_luck_factor),
+               const_float(float_luck_limit));
     }
     else
     for(i=0;i<users->len;i++)
         if(usr(i).tm->luck < 1)
         usr(i).tm->luck = 
-            MIN(usr(i).tm->luck * const_float("float_season_end_user_champ_luck_factor_regen"), 1);
+            MIN(usr(i).tm->luck * const_float(float_season_end_user_champ_luck_factor_regen), 1);
 
     /** Reset tables */
     for(i = league->tables->len - 1; i >= 0; i--)
@@ -40,11 +40,12 @@
 #include "option.h"
 #include "player.h"
 #include "team.h"
+#include "token.h"
 #include "variables.h"
 #include "xml_lg_commentary.h"
 
 /** The replacement strings for the live game commentary tokens. */
-GPtrArray *token_rep[2];
+TokenValue token_rep[REP_TOKEN_LAST];
 /** Whether there was a commentary repetition rejection. */
 gboolean repetition;
 
@@ -108,16 +109,16 @@ lg_commentary_generate(const LiveGame *live_game, LiveGameUnit *unit,
 	unit->event.commentary_id = (commentary_idx == -1) ? 
 	    -1 : g_array_index(commentaries, LGCommentary, commentary_idx).id;
 	
-	for(i=0;i<replacement_tokens.list->len;i++)
-	    if(i != option_int("string_token_team_home", &replacement_tokens) &&
-	       i != option_int("string_token_team_away", &replacement_tokens) &&
-	       i != option_int("string_token_attendance", &replacement_tokens) &&
-	       i != option_int("string_token_cup_round_name", &replacement_tokens) &&
-	       i != option_int("string_token_league_cup_name", &replacement_tokens) &&
-	       i != option_int("string_token_yellow_limit", &replacement_tokens) &&
-	       i != option_int("string_token_team_layer0", &replacement_tokens) &&
-	       i != option_int("string_token_team_layer1", &replacement_tokens))
-		misc_token_remove(token_rep, i);
+	for(i=0;i<REP_TOKEN_LAST;i++)
+	    if(i != REP_TOKEN_TEAM_HOME &&
+	       i != REP_TOKEN_TEAM_AWAY &&
+	       i != REP_TOKEN_ATTENDANCE &&
+	       i != REP_TOKEN_CUP_ROUND_NAME &&
+	       i != REP_TOKEN_LEAGUE_CUP_NAME &&
+	       i != REP_TOKEN_YELLOW_LIMIT &&
+	       i != REP_TOKEN_TEAM_LAYER0 &&
+	       i != REP_TOKEN_TEAM_LAYER1)
+		token_remove(token_rep, i);
     }
     else
 	g_print("%s: \"%s\"\n", event_name, buf);
@@ -169,12 +170,12 @@ lg_commentary_check_commentary(const LGCommentary *commentary, gchar *dest)
 #endif
 
     if(strlen(commentary->text) == 0 ||
-       (commentary->condition != NULL &&
-	!misc_parse_condition(commentary->condition, token_rep)) ||
+       (commentary->parsed_condition != NULL &&
+	!token_condition_check(commentary->parsed_condition, token_rep)) ||
        (repetition == FALSE && query_lg_commentary_is_repetition(commentary->id)))
 	return FALSE;
 
-    return misc_string_replace_all_tokens(token_rep, commentary->text, dest);
+    return token_text_fill(commentary->parsed_text, token_rep, dest);
 }
 
 /** Check whether a commentary with given id has been used in the last
@@ -187,7 +188,7 @@ query_lg_commentary_is_repetition(gint id)
 #endif
 
     const GArray *units = ((LiveGame*)statp)->units;
-    gint units_min = units->len - const_int("int_lg_commentary_check_backwards") - 1;
+    gint units_min = units->len - const_int(int_lg_commentary_check_backwards) - 1;
     gint i, min = MAX(units_min, 0);
 
     for(i=units->len - 2; i>= min; i--)
@@ -245,67 +246,51 @@ lg_commentary_get_order(const GArray *commentaries, gint *order)
 
 /** Fill the stats tokens. */
 void
-lg_commentary_set_stats_tokens(const LiveGameStats *stats, GPtrArray **token_arrays)
+lg_commentary_set_stats_tokens(const LiveGameStats *stats, TokenValue *token_arrays)
 {
 #ifdef DEBUG
     printf("lg_commentary_set_stats_tokens\n");
 #endif
 
-    misc_token_add(token_arrays, 
-		   option_int("string_token_stat_shots0", &replacement_tokens),
-		   misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_SHOTS]));
-
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_shot_per0", &replacement_tokens),
-		   misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_SHOT_PERCENTAGE]));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_poss0", &replacement_tokens),
-		   misc_int_to_char((gint)rint(100 * 
-					       ((gfloat)stats->values[0][LIVE_GAME_STAT_VALUE_POSSESSION] /
-						((gfloat)stats->values[0][LIVE_GAME_STAT_VALUE_POSSESSION] + 
-						 (gfloat)stats->values[1][LIVE_GAME_STAT_VALUE_POSSESSION])))));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_pen0", &replacement_tokens),
-		   misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_PENALTIES]));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_fouls0", &replacement_tokens),
-		   misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_FOULS]));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_yellows0", &replacement_tokens),
-		   misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_CARDS]));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_reds0", &replacement_tokens),
-		   misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_REDS]));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_injs0", &replacement_tokens),
-		   misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_INJURIES]));
-
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_shots1", &replacement_tokens),
-		   misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_SHOTS]));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_shot_per1", &replacement_tokens),
-		   misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_SHOT_PERCENTAGE]));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_poss1", &replacement_tokens),
-		   misc_int_to_char((gint)rint(100 * ((gfloat)stats->values[1][LIVE_GAME_STAT_VALUE_POSSESSION] /
-						      ((gfloat)stats->values[0][LIVE_GAME_STAT_VALUE_POSSESSION] + 
-						       (gfloat)stats->values[1][LIVE_GAME_STAT_VALUE_POSSESSION])))));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_pen1", &replacement_tokens),
-		   misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_PENALTIES]));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_fouls1", &replacement_tokens),
-		   misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_FOULS]));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_yellows1", &replacement_tokens),
-		   misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_CARDS]));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_reds1", &replacement_tokens),
-		   misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_REDS]));
-    misc_token_add(token_arrays,
-		   option_int("string_token_stat_injs1", &replacement_tokens),
-		   misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_INJURIES]));
+    token_add(token_arrays, REP_TOKEN_STAT_SHOTS0,
+	      misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_SHOTS]));
+
+    token_add(token_arrays, REP_TOKEN_STAT_SHOT_PER0,
+	      misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_SHOT_PERCENTAGE]));
+    token_add(token_arrays, REP_TOKEN_STAT_POSS0,
+	      misc_int_to_char((gint)rint(100 * 
+					  ((gfloat)stats->values[0][LIVE_GAME_STAT_VALUE_POSSESSION] /
+					   ((gfloat)stats->values[0][LIVE_GAME_STAT_VALUE_POSSESSION] + 
+					    (gfloat)stats->values[1][LIVE_GAME_STAT_VALUE_POSSESSION])))));
+    token_add(token_arrays, REP_TOKEN_STAT_PEN0,
+	      misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_PENALTIES]));
+    token_add(token_arrays, REP_TOKEN_STAT_FOULS0,
+	      misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_FOULS]));
+    token_add(token_arrays, REP_TOKEN_STAT_YELLOWS0,
+	      misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_CARDS]));
+    token_add(token_arrays, REP_TOKEN_STAT_REDS0,
+	      misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_REDS]));
+    token_add(token_arrays, REP_TOKEN_STAT_INJS0,
+	      misc_int_to_char(stats->values[0][LIVE_GAME_STAT_VALUE_INJURIES]));
+
+    token_add(token_arrays, REP_TOKEN_STAT_SHOTS1,
+	      misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_SHOTS]));
+    token_add(token_arrays, REP_TOKEN_STAT_SHOT_PER1,
+	      misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_SHOT_PERCENTAGE]));
+    token_add(token_arrays, REP_TOKEN_STAT_POSS1,
+	      misc_int_to_char((gint)rint(100 * ((gfloat)stats->values[1][LIVE_GAME_STAT_VALUE_POSSESSION] /
+						 ((gfloat)stats->values[0][LIVE_GAME_STAT_VALUE_POSSESSION] + 
+						  (gfloat)stats->values[1][LIVE_GAME_STAT_VALUE_POSSESSION])))));
+    token_add(token_arrays, REP_TOKEN_STAT_PEN1,
+	      misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_PENALTIES]));
+    token_add(token_arrays, REP_TOKEN_STAT_FOULS1,
+	      misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_FOULS]));
+    token_add(token_arrays, REP_TOKEN_STAT_YELLOWS1,
+	      misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_CARDS]));
+    token_add(token_arrays, REP_TOKEN_STAT_REDS1,
+	      misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_REDS]));
+    token_add(token_arrays, REP_TOKEN_STAT_INJS1,
+	      misc_int_to_char(stats->values[1][LIVE_GAME_STAT_VALUE_INJURIES]));
 }
 
 /** Fill the tokens that contain general information. */
@@ -317,28 +302,24 @@ lg_commentary_set_basic_tokens(const LiveGameUnit *unit, const Fixture *fix)
 #endif
 
     gchar buf[SMALL];
-    gint tmp_int = 1, current_min = live_game_unit_get_minute(unit);
+    gint tmp_int = 1, current_min = live_game_unit_get_minute(fix->live_game, unit);
     gint avskill0 = (gint)rint(team_get_average_skill(fix->teams[0], TRUE)),
 	avskill1 = (gint)rint(team_get_average_skill(fix->teams[1], TRUE));
     
     sprintf(buf, "%d : %d", unit->result[0], unit->result[1]);
-    misc_token_add(token_rep, 
-		   option_int("string_token_result", &replacement_tokens),
-		   g_strdup(buf));
-
-    misc_token_add(token_rep,
-		   option_int("string_token_time", &replacement_tokens), 
-		   misc_int_to_char(unit->time));
-    misc_token_add(token_rep,
-		   option_int("string_token_minute", &replacement_tokens), 
-		   misc_int_to_char(current_min));
-
-    tmp_int = live_game_get_minutes_remaining(unit);
+    token_add(token_rep, REP_TOKEN_RESULT,
+	      g_strdup(buf));
+
+    token_add(token_rep, REP_TOKEN_TIME, 
+	      misc_int_to_char(unit->time));
+    token_add(token_rep, REP_TOKEN_MINUTE, 
+	      misc_int_to_char(current_min));
+
+    tmp_int = live_game_get_minutes_remaining(fix->live_game, unit);
     
     if(tmp_int > 0)
-	misc_token_add(token_rep, 
-		       option_int("string_token_minute_remaining", &replacement_tokens), 
-		       misc_int_to_char(tmp_int));
+	token_add(token_rep, REP_TOKEN_MINUTE_REMAINING, 
+		  misc_int_to_char(tmp_int));
 
     if(query_fixture_is_draw(fix))
 	tmp_int = 120 - current_min;
@@ -346,39 +327,29 @@ lg_commentary_set_basic_tokens(const LiveGameUnit *unit, const Fixture *fix)
 	tmp_int = 90 - current_min;
 
     if(tmp_int > 0)
-	misc_token_add(token_rep,
-		       option_int("string_token_minute_total", &replacement_tokens),
-		       misc_int_to_char(tmp_int));
-
-    misc_token_add(token_rep,
-		   option_int("string_token_goals0", &replacement_tokens), 
-		   misc_int_to_char(unit->result[0]));
-    misc_token_add(token_rep,
-		   option_int("string_token_goals1", &replacement_tokens), 
-		   misc_int_to_char(unit->result[1]));
-    misc_token_add(token_rep,
-		   option_int("string_token_goal_diff", &replacement_tokens), 
-		   misc_int_to_char(ABS(unit->result[0] - unit->result[1])));
-    misc_token_add(token_rep,
-		   option_int("string_token_extra", &replacement_tokens), 
-		   lg_commentary_get_extra_data(unit, fix));
-
-    misc_token_add(token_rep,
-		   option_int("string_token_possession", &replacement_tokens), 
-		   misc_int_to_char(unit->possession));
-    misc_token_add(token_rep,
-		   option_int("string_token_no_possession", &replacement_tokens), 
-		   misc_int_to_char(!unit->possession));
-
-    misc_token_add(token_rep,
-		   option_int("string_token_team_avskill0", &replacement_tokens), 
-		   misc_int_to_char(avskill0));
-    misc_token_add(token_rep,
-		   option_int("string_token_team_avskill1", &replacement_tokens), 
-		   misc_int_to_char(avskill1));
-    misc_token_add(token_rep,
-		   option_int("string_token_team_avskilldiff", &replacement_tokens), 
-		   misc_int_to_char(ABS(avskill0 - avskill1)));
+	token_add(token_rep, REP_TOKEN_MINUTE_TOTAL,
+		  misc_int_to_char(tmp_int));
+
+    token_add(token_rep, REP_TOKEN_GOALS0, 
+	      misc_int_to_char(unit->result[0]));
+    token_add(token_rep, REP_TOKEN_GOALS1, 
+	      misc_int_to_char(unit->result[1]));
+    token_add(token_rep, REP_TOKEN_GOAL_DIFF, 
+	      misc_int_to_char(ABS(unit->result[0] - unit->result[1])));
+    token_add(token_rep, REP_TOKEN_EXTRA, 
+	      lg_commentary_get_extra_data(unit, fix));
+
+    token_add(token_rep, REP_TOKEN_POSSESSION, 
+	      misc_int_to_char(unit->possession));
+    token_add(token_rep, REP_TOKEN_NO_POSSESSION, 
+	      misc_int_to_char(!unit->possession));
+
+    token_add(token_rep, REP_TOKEN_TEAM_AVSKILL0, 
+	      misc_int_to_char(avskill0));
+    token_add(token_rep, REP_TOKEN_TEAM_AVSKILL1, 
+	      misc_int_to_char(avskill1));
+    token_add(token_rep, REP_TOKEN_TEAM_AVSKILLDIFF, 
+	      misc_int_to_char(ABS(avskill0 - avskill1)));
 }
 
 /** Set the tokens containing team data. */
@@ -391,24 +362,19 @@ lg_commentary_set_team_tokens(const LiveGameUnit *unit, const Fixture *fix)
 
     if(unit->result[0] != unit->result[1])
     {
-	misc_token_add(token_rep,
-		       option_int("string_token_team_losing", &replacement_tokens), 
-		       g_strdup(fix->teams[(unit->result[0] > unit->result[1])]->name));
-	misc_token_add(token_rep,
-		       option_int("string_token_team_winning", &replacement_tokens), 
-		       g_strdup(fix->teams[(unit->result[0] < unit->result[1])]->name));
-	misc_token_add(token_rep,
-		       option_int("string_token_team_losingn", &replacement_tokens), 
-		       misc_int_to_char((unit->result[0] > unit->result[1])));
-	misc_token_add(token_rep,
-		       option_int("string_token_team_winningn", &replacement_tokens), 
-		       misc_int_to_char((unit->result[0] < unit->result[1])));
+	token_add(token_rep, REP_TOKEN_TEAM_LOSING, 
+		  g_strdup(fix->teams[(unit->result[0] > unit->result[1])]->name));
+	token_add(token_rep, REP_TOKEN_TEAM_WINNING, 
+		  g_strdup(fix->teams[(unit->result[0] < unit->result[1])]->name));
+	token_add(token_rep, REP_TOKEN_TEAM_LOSINGN, 
+		  misc_int_to_char((unit->result[0] > unit->result[1])));
+	token_add(token_rep, REP_TOKEN_TEAM_WINNINGN, 
+		  misc_int_to_char((unit->result[0] < unit->result[1])));
     }
 
     if(unit->event.team != -1)
-	misc_token_add(token_rep,
-		       option_int("string_token_team", &replacement_tokens), 
-		       misc_int_to_char(unit->event.team));
+	token_add(token_rep, REP_TOKEN_TEAM, 
+		  misc_int_to_char(unit->event.team));
 }
 
 /** Set the player tokens. */
@@ -479,32 +445,25 @@ lg_commentary_set_player_tokens(const LiveGameUnit *unit, const Fixture *fix)
 
     if(pl1 != NULL)
     {
-	misc_token_add(token_rep,
-		       option_int("string_token_player0", &replacement_tokens), 
-		       player_get_last_name(pl1->name));
-	misc_token_add(token_rep,
-		       option_int("string_token_player_goals0", &replacement_tokens), 
-		       misc_int_to_char(player_games_goals_get(
-					    pl1, fix->competition->id, PLAYER_VALUE_GOALS)));
-	misc_token_add(token_rep,
-		       option_int("string_token_player_goals_all0", &replacement_tokens), 
-		       misc_int_to_char(player_all_games_goals(pl1, PLAYER_VALUE_GOALS)));
+	token_add(token_rep, REP_TOKEN_PLAYER0, 
+		  player_get_last_name(pl1->name));
+	token_add(token_rep, REP_TOKEN_PLAYER_GOALS0, 
+		  misc_int_to_char(player_games_goals_get(
+				       pl1, fix->competition, PLAYER_VALUE_GOALS)));
+	token_add(token_rep, REP_TOKEN_PLAYER_GOALS_ALL0, 
+		  misc_int_to_char(player_all_games_goals(pl1, PLAYER_VALUE_GOALS)));
     }
 
     if(pl2 != NULL)
     {
-	misc_token_add(token_rep,
-		       option_int("string_token_player1", &replacement_tokens), 
-		       player_get_last_name(pl2->name));
-	misc_token_add(token_rep,
-		       option_int("string_token_player_goals1", &replacement_tokens), 
-		       misc_int_to_char(player_games_goals_get(pl2, fix->competition->id, PLAYER_VALUE_GOALS)));
-	misc_token_add(token_rep,
-		       option_int("string_token_player_goals_all1", &replacement_tokens), 
-		       misc_int_to_char(player_all_games_goals(pl2, PLAYER_VALUE_GOALS)));
-	misc_token_add(token_rep,
-		       option_int("string_token_player_yellows", &replacement_tokens), 
-		       misc_int_to_char(player_card_get(pl2, fix->competition->id, PLAYER_VALUE_CARD_YELLOW)));
+	token_add(token_rep, REP_TOKEN_PLAYER1, 
+		  player_get_last_name(pl2->name));
+	token_add(token_rep, REP_TOKEN_PLAYER_GOALS1, 
+		  misc_int_to_char(player_games_goals_get(pl2, fix->competition, PLAYER_VALUE_GOALS)));
+	token_add(token_rep, REP_TOKEN_PLAYER_GOALS_ALL1, 
+		  misc_int_to_char(player_all_games_goals(pl2, PLAYER_VALUE_GOALS)));
+	token_add(token_rep, REP_TOKEN_PLAYER_YELLOWS, 
+		  misc_int_to_char(player_card_get(pl2, fix->competition, PLAYER_VALUE_CARD_YELLOW)));
     }
 }
 
@@ -571,15 +530,10 @@ lg_commentary_initialize(const Fixture *fix)
 
     gchar buf[SMALL];
 
-    token_rep[0] = g_ptr_array_new();
-    token_rep[1] = g_ptr_array_new();
-
-    misc_token_add(token_rep,
-		   option_int("string_token_team_home", &replacement_tokens), 
-		   g_strdup(fix->teams[0]->name));
-    misc_token_add(token_rep,
-		   option_int("string_token_team_away", &replacement_tokens), 
-		   g_strdup(fix->teams[1]->name));
+    token_add(token_rep, REP_TOKEN_TEAM_HOME, 
+	      g_strdup(fix->teams[0]->name));
+    token_add(token_rep, REP_TOKEN_TEAM_AWAY, 
+	      g_strdup(fix->teams[1]->name));
 
     if (competition_is_league(fix->competition) ||
         (competition_is_cup(fix->competition) && !cup_is_international((Cup*)fix->competition))) {
@@ -587,38 +541,31 @@ lg_commentary_initialize(const Fixture *fix)
          * In international cups the layer values don't mean much since they
          * are relative to their own country.
          */
-	misc_token_add(token_rep,
-		       option_int("string_token_team_layer0", &replacement_tokens), 
-		       misc_int_to_char(fix->teams[0]->league->layer));
-	misc_token_add(token_rep,
-		       option_int("string_token_team_layer1", &replacement_tokens), 
-		       misc_int_to_char(fix->teams[1]->league->layer));
-	misc_token_add(token_rep,
-		       option_int("string_token_team_layerdiff", &replacement_tokens),
-		       misc_int_to_char(fix->teams[0]->league->layer -
-					fix->teams[1]->league->layer));
+	token_add(token_rep, REP_TOKEN_TEAM_LAYER0, 
+		  misc_int_to_char(fix->teams[0]->league->layer));
+	token_add(token_rep, REP_TOKEN_TEAM_LAYER1, 
+		  misc_int_to_char(fix->teams[1]->league->layer));
+	token_add(token_rep, REP_TOKEN_TEAM_LAYERDIFF,
+		  misc_int_to_char(fix->teams[0]->league->layer -
+				   fix->teams[1]->league->layer));
     }
 
-    misc_token_add(token_rep,
-		   option_int("string_token_league_cup_name", &replacement_tokens), 
-		   g_strdup(fix->competition->name));
+    token_add(token_rep, REP_TOKEN_LEAGUE_CUP_NAME, 
+	      g_strdup(fix->competition->name));
 
     if(fix->competition->id >= ID_CUP_START)
     {
 	cup_get_round_name((Cup*)fix->competition, fix->round, buf);
-	misc_token_add(token_rep,
-		       option_int("string_token_cup_round_name", &replacement_tokens), 
-		       g_strdup(buf));
+	token_add(token_rep, REP_TOKEN_CUP_ROUND_NAME, 
+		  g_strdup(buf));
     }
 
     misc_print_grouped_int(fix->attendance, buf);
-    misc_token_add(token_rep,
-		   option_int("string_token_attendance", &replacement_tokens),
-		   g_strdup(buf));
+    token_add(token_rep, REP_TOKEN_ATTENDANCE,
+	      g_strdup(buf));
 
-    misc_token_add(token_rep,
-		   option_int("string_token_yellow_limit", &replacement_tokens), 
-		   misc_int_to_char(fix->competition->yellow_red));
+    token_add(token_rep, REP_TOKEN_YELLOW_LIMIT, 
+	      misc_int_to_char(fix->competition->yellow_red));
 }
 
 /** Free the memory occupied by the tokens array and the permanent tokens. */
@@ -629,16 +576,7 @@ lg_commentary_free_tokens(void)
     printf("lg_commentary_free_tokens\n");
 #endif
 
-    gint i;
-
-    for(i=token_rep[0]->len - 1;i >= 0; i--)
-    {
-	g_free(g_ptr_array_index(token_rep[0], i));
-	g_free(g_ptr_array_index(token_rep[1], i));
-    }
-
-    g_ptr_array_free(token_rep[0], TRUE);
-    g_ptr_array_free(token_rep[1], TRUE);
+    token_remove_all(token_rep);
 }
 
 /** Load the appropriate commentary file by evaluating
@@ -703,17 +641,20 @@ lg_commentary_test_load_token_file(const gchar *token_file)
 #endif
 
     gchar token_name[SMALL], token_value[SMALL];
+    gint token;
     FILE *fil = NULL;
 
     file_my_fopen(token_file, "r", &fil, TRUE);
 
-    token_rep[0] = g_ptr_array_new();
-    token_rep[1] = g_ptr_array_new();
-
     while(file_get_next_opt_line(fil, token_name, token_value))
     {
-	g_ptr_array_add(token_rep[0], (gpointer)g_strdup(token_name));
-	g_ptr_array_add(token_rep[1], (gpointer)g_strdup(token_value));
+	token = token_from_name(token_name, strlen(token_name));
+
+	if(token == REP_TOKEN_LAST)
+	    debug_print_message("lg_commentary_test_load_token_file: unknown token %s\n",
+				token_name);
+	else
+	    token_add(token_rep, token, g_strdup(token_value));
     }
 }
 
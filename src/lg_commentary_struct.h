@@ -26,6 +26,8 @@
 #ifndef LG_COMMENTARY_STRUCT_H
 #define LG_COMMENTARY_STRUCT_H
 
+#include "token_struct.h"
+
 /** Structure describing a commentary
     for the live game.  */
 typedef struct
@@ -35,6 +37,10 @@ typedef struct
     /** A condition (if not fulfilled, the commentary doesn't get
 	shown). */
     gchar *condition;
+    /** The text and condition compiled when loading the
+	commentary file; the condition may be NULL. */
+    TokenText *parsed_text;
+    TokenCondition *parsed_condition;
     /** Priority of the commentary (compared to
 	the other ones for the same event).
 	The higher the priority the higher the
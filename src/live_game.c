@@ -24,6 +24,7 @@
 */
 
 #include "callbacks.h"
+#include "country.h"
 #include "fixture.h"
 #include "free.h"
 #include "game.h"
@@ -33,9 +34,11 @@
 #include "lg_commentary.h"
 #include "live_game.h"
 #include "main.h"
+#include "match_model.h"
 #include "maths.h"
 #include "misc.h"
 #include "misc_callback_func.h"
+#include "news.h"
 #include "option.h"
 #include "player.h"
 #include "strategy.h"
@@ -47,10 +50,7 @@
 #include "window.h"
 
 /** The live game we calculate. */
-#define match ((LiveGame*)statp)
-
-/** Whether the events are actually shown or not. */
-gboolean show;
+#define match (ctx->live_game)
 
 /** Convenience abbrevs. */
 #define unis match->units
@@ -60,6 +60,30 @@ gboolean show;
 #define tm0 match->fix->teams[0]
 #define tm1 match->fix->teams[1]
 
+/** Fill in a context for calculating a live game.
+    @param ctx The context we fill in.
+    @param live_game The live game we calculate.
+    @param user_idx The user involved in the match or -1.
+    @param gui The gui the match gets shown in, or NULL. */
+void
+live_game_context_init(LiveGameContext *ctx, LiveGame *live_game,
+		       gint user_idx, GUI *gui)
+{
+#ifdef DEBUG
+    printf("live_game_context_init\n");
+#endif
+
+    ctx->live_game = live_game;
+    ctx->user_idx = user_idx;
+    ctx->show = (user_idx != -1 && 
+		 option_int("int_opt_user_show_live_game", 
+			    &usr(user_idx).options));
+    ctx->commentary = (user_idx != -1 || stat5 < -1000);
+    ctx->gui = gui;
+    ctx->rand = NULL;
+    ctx->recycle = FALSE;
+}
+
 /** Calculate the result of a fixture using
     the live game variable.
     @param fix The fixture we calculate.
@@ -71,63 +95,335 @@ live_game_calculate_fixture(Fixture *fix, LiveGame *live_game, Bygfoot *bygfoot)
 #ifdef DEBUG
     printf("live_game_calculate_fixture\n");
 #endif
-    statp = live_game;
+    LiveGameContext ctx;
     enum Status0Value stat0 = gui_get_status(bygfoot->gui);
 
+    /* The gui code still looks at the current
+       live game and user via statp and stat2. */
+    statp = live_game;
+
     if(stat0 != STATUS_LIVE_GAME_PAUSE && 
        stat0 != STATUS_LIVE_GAME_CHANGE)
-	live_game_initialize(fix, live_game, bygfoot);
+    {
+	stat2 = fixture_user_team_involved(fix);
+	live_game_context_init(&ctx, live_game, stat2, bygfoot->gui);
+	live_game_initialize(&ctx, fix, bygfoot);
+    }
     else
+    {
+	live_game_context_init(&ctx, live_game, stat2, bygfoot->gui);
         gui_set_status(bygfoot->gui, STATUS_SHOW_LIVE_GAME);
+    }
+
+    if(live_game_calculate(&ctx))
+    {
+	if(ctx.commentary)
+	    lg_commentary_free_tokens();
+	game_post_match(fix);
+        gui_set_status(bygfoot->gui, STATUS_NONE);
+    }
+    else if(gui_get_status(bygfoot->gui) == STATUS_LIVE_GAME_CHANGE)
+	live_game_resume(bygfoot);
+}
+
+/** Bring the match views of the teams up to date and
+    recalculate the team values. */
+static void
+live_game_update_team_values(LiveGameContext *ctx)
+{
+#ifdef DEBUG
+    printf("live_game_update_team_values\n");
+#endif
+
+    game_view_update(&match->views[0], tm0);
+    game_view_update(&match->views[1], tm1);
+    game_get_view_values(match->fix, match->views, match->team_values,
+			 match->home_advantage);
+}
+
+/** Calculate the goals and shots of both teams in a part of a
+    match with the statistical match model and update the players
+    and the stats like the match engine does.
+    @param res_idx The index of the result we add the goals to.
+    @param minutes How many minutes the part lasts. */
+static void
+live_game_statistical_period(LiveGameContext *ctx, gint res_idx, gint minutes)
+{
+#ifdef DEBUG
+    printf("live_game_statistical_period\n");
+#endif
+
+    gint i, j, goals[2], shots;
+    gfloat features[2][MATCH_MODEL_FEATURE_END], rates[2];
+    gfloat factor = (gfloat)minutes / 90;
+    /* The possession goes with the midfield values. */
+    gfloat possession[2] =
+	{match->team_values[0][GAME_TEAM_VALUE_MIDFIELD] /
+	 (match->team_values[0][GAME_TEAM_VALUE_MIDFIELD] +
+	  match->team_values[1][GAME_TEAM_VALUE_MIDFIELD]), 0};
+    Player *attacker, *goalie;
+
+    possession[1] = 1 - possession[0];
+
+    for(i=0;i<2;i++)
+    {
+	match_model_get_features(match->fix, match->team_values, i, features[i]);
+	rates[i] = match_model_get_rate(features[i], MATCH_MODEL_RATE_GOALS);
+    }
+
+    match_model_draw_goals(rates, minutes, goals);
+
+    for(i=0;i<2;i++)
+    {
+	shots = MAX(goals[i], math_poisson(
+			match_model_get_rate(features[i], MATCH_MODEL_RATE_SHOTS) * factor));
+	goalie = player_of_idx_team(tms[!i], 0);
+
+	/* The first shots are the goals. */
+	for(j=0;j<shots;j++)
+	{
+	    attacker = player_of_id_team(
+		tms[i], game_get_player(match, i, GAME_PLAYER_TYPE_ATTACK, 0, -1, TRUE));
+
+	    player_games_goals_set(attacker, match->fix->competition, PLAYER_VALUE_SHOTS, 1);
+	    player_games_goals_set(goalie, match->fix->competition, PLAYER_VALUE_SHOTS, 1);
+	    attacker->career[PLAYER_VALUE_SHOTS]++;
+	    goalie->career[PLAYER_VALUE_SHOTS]++;
+
+	    if(j >= goals[i])
+		continue;
+
+	    player_games_goals_set(attacker, match->fix->competition, PLAYER_VALUE_GOALS, 1);
+	    player_games_goals_set(goalie, match->fix->competition, PLAYER_VALUE_GOALS, 1);
+	    attacker->career[PLAYER_VALUE_GOALS]++;
+	    goalie->career[PLAYER_VALUE_GOALS]++;
+	    player_streak_add_to_prob(attacker,
+				      const_float(float_player_streak_add_goal));
+	    player_streak_add_to_prob(goalie,
+				      const_float(float_player_streak_add_goalie_goal));
+
+	    g_ptr_array_add(match->stats.players[i][LIVE_GAME_STAT_ARRAY_SCORERS],
+			    live_game_strdup(match, attacker->name));
+	}
+
+	match->fix->result[i][res_idx] += goals[i];
+	match->stats.values[i][LIVE_GAME_STAT_VALUE_GOALS_REGULAR] += goals[i];
+	match->stats.values[i][LIVE_GAME_STAT_VALUE_SHOTS] += shots;
+	match->stats.values[i][LIVE_GAME_STAT_VALUE_POSSESSION] +=
+	    (gint)rint(minutes * possession[i]);
+    }
+
+    for(i=0;i<2;i++)
+	match->stats.values[i][LIVE_GAME_STAT_VALUE_SHOT_PERCENTAGE] =
+	    (match->stats.values[i][LIVE_GAME_STAT_VALUE_SHOTS] > 0) ?
+	    (gint)rint((gfloat)match->stats.values[i][LIVE_GAME_STAT_VALUE_GOALS_REGULAR] /
+		       (gfloat)match->stats.values[i][LIVE_GAME_STAT_VALUE_SHOTS] * 100) : 0;
+
+    for(i=0;i<minutes;i++)
+	game_decrease_fitness(match->fix);
+}
+
+/** Calculate a results-only match with the statistical match model
+    instead of unit by unit. Extra time and penalties get played
+    if necessary; cards, injuries and substitutions don't happen.
+    Only a final unit gets added to the live game.
+    @see match_model_get_rate() */
+static void
+live_game_calculate_statistical(LiveGameContext *ctx)
+{
+#ifdef DEBUG
+    printf("live_game_calculate_statistical\n");
+#endif
+
+    gint i;
+    LiveGameUnit end;
+    gfloat penalty_prob = const_float(float_live_game_score_penalty);
 
-    game_get_values(match->fix, match->team_values,
-		    match->home_advantage);
+    memset(&end, 0, sizeof(LiveGameUnit));
+    end.minute = 90;
+    end.time = LIVE_GAME_UNIT_TIME_SECOND_HALF;
+    live_game_statistical_period(ctx, 0, 90);
 
-    if((debug > 80 && stat2 != -1) ||
+    if(query_fixture_is_draw(match->fix))
+    {
+	end.minute = 120;
+	end.time = LIVE_GAME_UNIT_TIME_EXTRA_TIME;
+	live_game_statistical_period(ctx, 1, 30);
+    }
+
+    if(query_fixture_is_draw(match->fix))
+    {
+	end.time = LIVE_GAME_UNIT_TIME_PENALTIES;
+
+	/* Five penalties each, then one each until it's decided. */
+	for(i=0;i<5 || match->fix->result[0][2] == match->fix->result[1][2];i++)
+	{
+	    match->fix->result[0][2] += (math_rnd(0, 1) < penalty_prob * tm0->luck);
+	    match->fix->result[1][2] += (math_rnd(0, 1) < penalty_prob * tm1->luck);
+	}
+    }
+
+    end.possession = math_rndi(0, 1);
+    end.area = LIVE_GAME_UNIT_AREA_MIDFIELD;
+    end.result[0] = math_sum_int_array(match->fix->result[0], 3);
+    end.result[1] = math_sum_int_array(match->fix->result[1], 3);
+    end.event.type = LIVE_GAME_EVENT_END_MATCH;
+    end.event.team = end.event.player = end.event.player2 = -1;
+    g_array_append_val(unis, end);
+}
+
+/** Create units for the live game until the match is
+    over or the user interrupts it.
+    @return TRUE if the match is over, FALSE otherwise. */
+gboolean
+live_game_calculate(LiveGameContext *ctx)
+{
+#ifdef DEBUG
+    printf("live_game_calculate\n");
+#endif
+
+    enum Status0Value stat0;
+
+    live_game_update_team_values(ctx);
+
+    if(match->results_only &&
+       opt_int(int_opt_sim_mode) == LIVE_GAME_SIM_MODE_STATISTICAL)
+    {
+	live_game_calculate_statistical(ctx);
+	return TRUE;
+    }
+
+    if((debug > 80 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\n\nlive_game_calculate_fixture\n%04d %s %s %04d\n\n",
 	       tm0->id, tm0->name, tm1->name, tm1->id);
 
     do
     {
-	live_game_create_unit(bygfoot->gui);
-	live_game_evaluate_unit(bygfoot->gui, &last_unit);
-        stat0 = gui_get_status(bygfoot->gui);
+	live_game_create_unit(ctx);
+	live_game_evaluate_unit(ctx, &last_unit);
+        stat0 = gui_get_status(ctx->gui);
     } while(last_unit.event.type != LIVE_GAME_EVENT_END_MATCH &&
 	  stat0 != STATUS_LIVE_GAME_PAUSE &&
 	  stat0 != STATUS_LIVE_GAME_CHANGE);
 
-    if(last_unit.event.type == LIVE_GAME_EVENT_END_MATCH)
+    return (last_unit.event.type == LIVE_GAME_EVENT_END_MATCH);
+}
+
+/** A fixture calculated by a worker thread. */
+typedef struct
+{
+    Fixture *fix;
+    LiveGameContext ctx;
+} LiveGameJob;
+
+/** Thread pool function calculating a CPU fixture.
+    The post-match updates are left to the caller. */
+static void
+live_game_calculate_job(gpointer data, gpointer user_data)
+{
+#ifdef DEBUG
+    printf("live_game_calculate_job\n");
+#endif
+
+    LiveGameJob *job = (LiveGameJob*)data;
+
+    math_rand_set_current(job->ctx.rand);
+    live_game_initialize(&job->ctx, job->fix, NULL);
+    live_game_calculate(&job->ctx);
+    math_rand_set_current(NULL);
+}
+
+/** Create the random number stream of a fixture. The stream
+    only depends on the random seed and the fixture, so a match
+    gives the same result no matter whether it's calculated
+    serially, in parallel or in a different order. */
+MathRand*
+live_game_fixture_rand_new(const Fixture *fix)
+{
+#ifdef DEBUG
+    printf("live_game_fixture_rand_new\n");
+#endif
+
+    return math_rand_new(math_rand_key(rand_seed, season, 
+				       fix->week_number, fix->week_round_number,
+				       fix->competition->id, fix->id));
+}
+
+/** Calculate fixtures without user involvement, using several
+    threads if wanted. The fixtures mustn't share any teams. Each
+    match draws from its own random number stream, so the results don't
+    depend on the scheduling of the threads. The post-match updates
+    (tables etc.) aren't done here; the caller has to call
+    game_post_match() for the fixtures in a fixed order.
+    @param fixtures The fixtures we calculate.
+    @param live_games The live games going with the fixtures, prepared
+    for recycling with live_game_prepare_array(); the array
+    must not be resized afterwards because the fixtures point into it.
+    @param rands The random number streams going with the fixtures.
+    @param num_threads How many threads to use; with 1 or less the
+    matches are calculated in the calling thread. */
+void
+live_game_calculate_fixtures(GPtrArray *fixtures, GArray *live_games,
+			     MathRand **rands, gint num_threads)
+{
+#ifdef DEBUG
+    printf("live_game_calculate_fixtures\n");
+#endif
+
+    gint i;
+    LiveGameJob *jobs = g_new(LiveGameJob, fixtures->len);
+    GThreadPool *pool = NULL;
+    GError *error = NULL;
+
+    for(i=0;i<fixtures->len;i++)
     {
-	if(stat2 != -1 || stat5 < -1000)
-	    lg_commentary_free_tokens();
-	game_post_match(fix);
-        gui_set_status(bygfoot->gui, STATUS_NONE);
+	jobs[i].fix = (Fixture*)g_ptr_array_index(fixtures, i);
+	live_game_context_init(&jobs[i].ctx, 
+			       &g_array_index(live_games, LiveGame, i), -1, NULL);
+	jobs[i].ctx.commentary = FALSE;
+	jobs[i].ctx.rand = rands[i];
+	jobs[i].ctx.recycle = TRUE;
     }
-    else if(gui_get_status(bygfoot->gui) == STATUS_LIVE_GAME_CHANGE)
-	live_game_resume(bygfoot);
+
+    if(num_threads <= 1)
+    {
+	for(i=0;i<fixtures->len;i++)
+	    live_game_calculate_job(&jobs[i], NULL);
+
+	g_free(jobs);
+	return;
+    }
+
+    pool = g_thread_pool_new(live_game_calculate_job, NULL,
+			     num_threads, TRUE, &error);
+    misc_print_error(&error, TRUE);
+
+    for(i=0;i<fixtures->len;i++)
+	g_thread_pool_push(pool, &jobs[i], NULL);
+
+    /* Wait for all the matches to finish. */
+    g_thread_pool_free(pool, FALSE, TRUE);
+
+    g_free(jobs);
 }
 
 /** Initialize a few things at the beginning of a live game. */
 void
-live_game_initialize(Fixture *fix, LiveGame *live_game, Bygfoot *bygfoot)
+live_game_initialize(LiveGameContext *ctx, Fixture *fix, Bygfoot *bygfoot)
 {
 #ifdef DEBUG
     printf("live_game_initialize\n");
 #endif
 
-    stat2 = fixture_user_team_involved(fix);
-
-    statp = live_game;
-    show = (stat2 != -1 && 
-	    option_int("int_opt_user_show_live_game", 
-		       &usr(stat2).options));
-
-    live_game_reset(match, fix, (stat2 != -1));
+    if(ctx->recycle)
+	live_game_recycle(match, fix);
+    else
+	live_game_reset(match, fix, (ctx->user_idx != -1));
 
-    if(show)
+    if(ctx->show)
     {
-	cur_user = stat2;
+	cur_user = ctx->user_idx;
 	on_button_back_to_main_clicked(NULL, bygfoot);
 
 	if(window.live == NULL)
@@ -141,17 +437,47 @@ live_game_initialize(Fixture *fix, LiveGame *live_game, Bygfoot *bygfoot)
     }
 
     fix->live_game = match;
+    match->results_only = (ctx->user_idx == -1 && !ctx->commentary &&
+			   query_live_game_results_only(fix));
     game_initialize(fix);
     match->attendance = fix->attendance;
 
-    if(stat2 != -1 || stat5 < -1000)
+    if(ctx->commentary)
 	lg_commentary_initialize(fix);
 }
 
+/** Drop the older units of a results-only live game. We keep
+    the latest units the match calculation looks back at, going
+    back to a unit with a minute (see live_game_unit_get_minute())
+    and to the start of a penalty shoot-out. */
+static void
+live_game_drop_units(LiveGame *live_game)
+{
+#ifdef DEBUG
+    printf("live_game_drop_units\n");
+#endif
+
+    gint i, keep = live_game->units->len - LIVE_GAME_RESULTS_ONLY_UNITS;
+    
+    while(keep > 0 &&
+	  (g_array_index(live_game->units, LiveGameUnit, keep).minute == -1 ||
+	   g_array_index(live_game->units, LiveGameUnit, keep).time == 
+	   LIVE_GAME_UNIT_TIME_PENALTIES))
+	keep--;
+
+    if(keep <= 0)
+	return;
+
+    for(i=0;i<keep;i++)
+	free_gchar_ptr(g_array_index(live_game->units, LiveGameUnit, i).event.commentary);
+
+    g_array_remove_range(live_game->units, 0, keep);
+}
+
 /** Create a game unit for the live game.
     @see #LiveGameUnit, #LiveGame, live_game_fill_new_unit() */
 void
-live_game_create_unit(GUI *gui)
+live_game_create_unit(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_create_unit\n");
@@ -159,13 +485,13 @@ live_game_create_unit(GUI *gui)
 
     LiveGameUnit new;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_create_unit\n");
 
     if(unis->len == 0)
     {
-	live_game_create_start_unit();
+	live_game_create_start_unit(ctx);
 	return;
     }
 
@@ -175,7 +501,11 @@ live_game_create_unit(GUI *gui)
 	return;
     }
 
-    new.minute = live_game_get_minute();
+    /* Dropping the units in batches keeps the copying down. */
+    if(match->results_only && unis->len >= 2 * LIVE_GAME_RESULTS_ONLY_UNITS)
+	live_game_drop_units(match);
+
+    new.minute = live_game_get_minute(ctx);
     new.time = live_game_get_time(&last_unit);
     new.event.commentary = NULL;
     new.event.team =
@@ -188,12 +518,12 @@ live_game_create_unit(GUI *gui)
     if(last_unit.event.type == LIVE_GAME_EVENT_HALF_TIME ||
        last_unit.event.type == LIVE_GAME_EVENT_EXTRA_TIME)
     {
-	live_game_event_general(gui, TRUE);
+	live_game_event_general(ctx, TRUE);
 	return;
     }
-    else if(query_live_game_event_is_break(new.minute, new.time))
+    else if(query_live_game_event_is_break(ctx, new.minute, new.time))
     {
-	new.event.type = live_game_get_break();
+	new.event.type = live_game_get_break(ctx);
 	new.possession = last_unit.possession;
 	g_array_append_val(unis, new);
 	return;
@@ -201,7 +531,7 @@ live_game_create_unit(GUI *gui)
     else if(new.time == LIVE_GAME_UNIT_TIME_PENALTIES)
 	new.event.type = LIVE_GAME_EVENT_PENALTY;
     else
-	live_game_fill_new_unit(&new);
+	live_game_fill_new_unit(ctx, &new);
 
     g_array_append_val(unis, new);
 }
@@ -209,7 +539,7 @@ live_game_create_unit(GUI *gui)
 /** Fill in a new unit depending on the team values and the constants from above.
     @param new The unit to fill in. */
 void
-live_game_fill_new_unit(LiveGameUnit *new)
+live_game_fill_new_unit(LiveGameContext *ctx, LiveGameUnit *new)
 {
 #ifdef DEBUG
     printf("live_game_fill_new_unit\n");
@@ -219,30 +549,30 @@ live_game_fill_new_unit(LiveGameUnit *new)
     gfloat rndom = math_rnd(0, 1);
     gfloat stadium_event = 
 	1 - powf(tm0->stadium.safety,
-		 const_float("float_live_game_stadium_event_exponent"));
+		 const_float(float_live_game_stadium_event_exponent));
     gfloat possession_change, scoring_chance = 0, 
 	injury_event_prob, foul_event_prob;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_fill_new_unit\n");
 
-    possession_change = const_float("float_live_game_event_general") *
-	const_float("float_live_game_possession_changes") /
-	live_game_pit_teams(old, const_float("float_live_game_possession_team_exponent"));	
+    possession_change = const_float(float_live_game_event_general) *
+	const_float(float_live_game_possession_changes) /
+	live_game_pit_teams(ctx, old, const_float(float_live_game_possession_team_exponent));	
 
-    injury_event_prob = const_float("float_live_game_injury") * 
-	(1 + (const_float("float_player_boost_injury_effect") *
+    injury_event_prob = const_float(float_live_game_injury) * 
+	(1 + (const_float(float_player_boost_injury_effect) *
 	      (tm0->boost != 0 || tm1->boost != 0)));
 
     new->possession = old->possession;
 
     if(old->event.type == LIVE_GAME_EVENT_GENERAL)
-	new->area = live_game_get_area(new);
+	new->area = live_game_get_area(ctx, new);
 
     if(new->area == LIVE_GAME_UNIT_AREA_ATTACK)
-	scoring_chance = const_float("float_live_game_scoring_chance") *
-	    live_game_pit_teams(new, const_float("float_live_game_scoring_chance_team_exponent"));
+	scoring_chance = const_float(float_live_game_scoring_chance) *
+	    live_game_pit_teams(ctx, new, const_float(float_live_game_scoring_chance_team_exponent));
 
     foul_event_prob = game_get_foul_prob(match, new);
 
@@ -278,7 +608,7 @@ live_game_fill_new_unit(LiveGameUnit *new)
 
 /** Create the first unit of a match. */
 void
-live_game_create_start_unit(void)
+live_game_create_start_unit(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_create_start_unit\n");
@@ -286,7 +616,7 @@ live_game_create_start_unit(void)
 
     LiveGameUnit new;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_create_start_unit\n");
     new.event.player =
@@ -311,7 +641,7 @@ live_game_create_start_unit(void)
     @param unit The unit we evaluate.
     @see The live_game_event* functions. */
 void
-live_game_evaluate_unit(GUI *gui, LiveGameUnit *unit)
+live_game_evaluate_unit(LiveGameContext *ctx, LiveGameUnit *unit)
 {
 #ifdef DEBUG
     printf("live_game_evaluate_unit\n");
@@ -319,34 +649,34 @@ live_game_evaluate_unit(GUI *gui, LiveGameUnit *unit)
 
     gint type = unit->event.type;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_evaluate_unit\n");
     if(type == LIVE_GAME_EVENT_FOUL)
-	live_game_event_foul(gui);
+	live_game_event_foul(ctx);
     else if(type == LIVE_GAME_EVENT_LOST_POSSESSION)
-	live_game_event_lost_possession(gui);
+	live_game_event_lost_possession(ctx);
     else if(type == LIVE_GAME_EVENT_INJURY)
-	live_game_event_injury(gui, -1, -1, FALSE);
+	live_game_event_injury(ctx, -1, -1, FALSE);
     else if(type == LIVE_GAME_EVENT_STADIUM)
-	live_game_event_stadium(gui);
+	live_game_event_stadium(ctx);
     else if(type == LIVE_GAME_EVENT_SCORING_CHANCE)
-	live_game_event_scoring_chance(gui);
+	live_game_event_scoring_chance(ctx);
     else if(type == LIVE_GAME_EVENT_PENALTY)
-	live_game_event_penalty();
+	live_game_event_penalty(ctx);
     else if(type == LIVE_GAME_EVENT_GENERAL)
-	live_game_event_general(gui, FALSE);
+	live_game_event_general(ctx, FALSE);
     else if(type == LIVE_GAME_EVENT_START_MATCH)
-	live_game_finish_unit();
+	live_game_finish_unit(ctx);
     else if(type == LIVE_GAME_EVENT_HALF_TIME ||
 	    type == LIVE_GAME_EVENT_EXTRA_TIME ||
 	    type == LIVE_GAME_EVENT_PENALTIES ||
 	    type == LIVE_GAME_EVENT_END_MATCH)
     {
-	live_game_finish_unit();
-	if(type != LIVE_GAME_EVENT_END_MATCH && show && 
-	   option_int("int_opt_user_pause_break", &usr(stat2).options))
-	    misc_callback_pause_live_game(gui);
+	live_game_finish_unit(ctx);
+	if(type != LIVE_GAME_EVENT_END_MATCH && ctx->show && 
+	   option_int("int_opt_user_pause_break", &usr(ctx->user_idx).options))
+	    misc_callback_pause_live_game(ctx->gui);
     }
     else if(type != LIVE_GAME_EVENT_END_MATCH)
 	debug_print_message("live_game_evaluate_unit: unknown event type %d\n",
@@ -355,7 +685,7 @@ live_game_evaluate_unit(GUI *gui, LiveGameUnit *unit)
 
 /** Calculate a foul event. */
 void
-live_game_event_foul(GUI *gui)
+live_game_event_foul(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_event_foul\n");
@@ -364,11 +694,12 @@ live_game_event_foul(GUI *gui)
     gfloat rndom = math_rnd(0, 1);
     gfloat reduction_factor = 1;
     gint type, fouled_player, foul_player, foul_team;
+    gboolean second_yellow;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_event_foul\n");
-    if(math_rnd(0, 1) > const_float("float_live_game_foul_by_possession") *
+    if(math_rnd(0, 1) > const_float(float_live_game_foul_by_possession) *
        game_get_foul_possession_factor(
 	   tms[last_unit.possession]->boost, tms[!last_unit.possession]->boost))
     {	
@@ -378,34 +709,38 @@ live_game_event_foul(GUI *gui)
 		uni(unis->len - 2).event.player;
 	else
 	    fouled_player = last_unit.event.player =
-		game_get_player(tms[last_unit.possession],
+		game_get_player(match, last_unit.possession,
 				last_unit.area, 0, -1, FALSE);
 
 	foul_player = last_unit.event.player2 =
-	    game_get_player(tms[!last_unit.possession],
+	    game_get_player(match, !last_unit.possession,
 			    last_unit.area, 0, -1, FALSE);
     }
     else
     {
 	foul_team = last_unit.event.team = last_unit.possession;
 	fouled_player = last_unit.event.player = 
-	    game_get_player(tms[!last_unit.possession],
+	    game_get_player(match, !last_unit.possession,
 			    last_unit.area, 0, -1, FALSE);
 	foul_player = last_unit.event.player2 =
-	    game_get_player(tms[last_unit.possession],
+	    game_get_player(match, last_unit.possession,
 			    last_unit.area, 0, -1, FALSE);
     }
 
     /* Probability of hard foul gets reduced if the player is already booked, except when boost is on. */
     if(tms[foul_team]->boost != 1 && 
        player_of_id_team(tms[foul_team], foul_player)->card_status == PLAYER_CARD_STATUS_YELLOW)
-        reduction_factor = 1 - const_float("float_live_game_foul_booked_reduction");
+        reduction_factor = 1 - const_float(float_live_game_foul_booked_reduction);
 
-    if(rndom < const_float("float_live_game_foul_red_injury") * reduction_factor)
+    /* This has to be checked before a yellow card gets recorded below. */
+    second_yellow = (rndom < const_float(float_live_game_foul_yellow) * reduction_factor &&
+		     query_live_game_second_yellow(ctx, foul_team, foul_player));
+
+    if(rndom < const_float(float_live_game_foul_red_injury) * reduction_factor)
 	type = LIVE_GAME_EVENT_FOUL_RED_INJURY;
-    else if(rndom < const_float("float_live_game_foul_red") * reduction_factor)
+    else if(rndom < const_float(float_live_game_foul_red) * reduction_factor)
 	type = LIVE_GAME_EVENT_FOUL_RED;
-    else if(rndom < const_float("float_live_game_foul_yellow") * reduction_factor)
+    else if(rndom < const_float(float_live_game_foul_yellow) * reduction_factor)
     {
 	type = LIVE_GAME_EVENT_FOUL_YELLOW;
 	player_card_set(player_of_id_team(tms[foul_team], foul_player),
@@ -418,17 +753,15 @@ live_game_event_foul(GUI *gui)
 
     last_unit.event.type = type;
 
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 
     if(type == LIVE_GAME_EVENT_FOUL_RED ||
        type == LIVE_GAME_EVENT_FOUL_RED_INJURY ||
-       (type == LIVE_GAME_EVENT_FOUL_YELLOW &&
-	query_live_game_second_yellow(foul_team, foul_player)))
+       (type == LIVE_GAME_EVENT_FOUL_YELLOW && second_yellow))
     {
-	live_game_event_send_off(gui, foul_team, foul_player, 
-				 query_live_game_second_yellow(foul_team, foul_player));
+	live_game_event_send_off(ctx, foul_team, foul_player, second_yellow);
 	if(type == LIVE_GAME_EVENT_FOUL_RED_INJURY)
-	    live_game_event_injury(gui, !foul_team, fouled_player, TRUE);
+	    live_game_event_injury(ctx, !foul_team, fouled_player, TRUE);
         player_of_id_team(tms[foul_team], foul_player)->card_status = PLAYER_CARD_STATUS_RED;
     }
 
@@ -436,10 +769,10 @@ live_game_event_foul(GUI *gui)
        last_unit.possession)
     {
 	rndom = math_rnd(0, 1);
-	if(rndom < const_float("float_live_game_penalty_prob"))
-	    live_game_event_penalty();
-	else if(rndom < const_float("float_live_game_free_kick_prob"))
-	    live_game_event_free_kick(gui);
+	if(rndom < const_float(float_live_game_penalty_prob))
+	    live_game_event_penalty(ctx);
+	else if(rndom < const_float(float_live_game_free_kick_prob))
+	    live_game_event_free_kick(ctx);
 	else
 	    last_unit.possession = !foul_team;
     }
@@ -449,17 +782,17 @@ live_game_event_foul(GUI *gui)
 
 /** Calculate a lost possession event. */
 void
-live_game_event_lost_possession(GUI *gui)
+live_game_event_lost_possession(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_event_lost_possession\n");
 #endif
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_event_lost_possession\n");
     last_unit.event.player =
-	game_get_player(tms[last_unit.possession], 
+	game_get_player(match, last_unit.possession, 
 			last_unit.area, 0, -1, TRUE);
 	
     if(uni(unis->len - 2).event.type == LIVE_GAME_EVENT_GENERAL)
@@ -467,12 +800,12 @@ live_game_event_lost_possession(GUI *gui)
 	    uni(unis->len - 2).event.player;
     else
 	last_unit.event.player2 =
-	    game_get_player(tms[!last_unit.possession], 
+	    game_get_player(match, !last_unit.possession, 
 			    uni(unis->len - 2).area, 0, -1, FALSE);
 
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 
-    live_game_event_general(gui, TRUE);
+    live_game_event_general(ctx, TRUE);
 }
 
 /** Calculate an injury event. 
@@ -482,7 +815,7 @@ live_game_event_lost_possession(GUI *gui)
     @param create_new Whether to put the event into a new unit instead of
     the last one. */
 void
-live_game_event_injury(GUI *gui, gint team, gint player, gboolean create_new)
+live_game_event_injury(LiveGameContext *ctx, gint team, gint player, gboolean create_new)
 {
 #ifdef DEBUG
     printf("live_game_event_injury\n");
@@ -492,7 +825,7 @@ live_game_event_injury(GUI *gui, gint team, gint player, gboolean create_new)
     gint old_structure = -1, sub_in = -1;
     gint usr_idx = -1;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_event_injury\n");
 
@@ -507,14 +840,14 @@ live_game_event_injury(GUI *gui, gint team, gint player, gboolean create_new)
 	    team;
     }
     else
-	live_game_injury_get_player();
+	live_game_injury_get_player(ctx);
 
     usr_idx = team_is_user(tms[last_unit.event.team]);
     
     last_unit.minute = -1;
     last_unit.event.type = LIVE_GAME_EVENT_INJURY;
 
-    if(math_rnd(0, 1) < const_float("float_live_game_injury_is_temp"))
+    if(math_rnd(0, 1) < const_float(float_live_game_injury_is_temp))
     {
 	last_unit.event.type = LIVE_GAME_EVENT_TEMP_INJURY;
 
@@ -525,11 +858,11 @@ live_game_event_injury(GUI *gui, gint team, gint player, gboolean create_new)
 		MAX(0, player_of_id_team(tms[last_unit.event.team],
 					 last_unit.event.player)->fitness -
 		    math_rnd(
-			const_float("float_live_game_temp_injury_fitness_decrease_lower"),
-			const_float("float_live_game_temp_injury_fitness_decrease_upper")));
+			const_float(float_live_game_temp_injury_fitness_decrease_lower),
+			const_float(float_live_game_temp_injury_fitness_decrease_upper)));
     }
     
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 
     if(debug >= 50 &&
        usr_idx != -1)
@@ -542,14 +875,14 @@ live_game_event_injury(GUI *gui, gint team, gint player, gboolean create_new)
 
 	if(match->subs_left[last_unit.event.team] > 0)
 	{
-	    if(show && 
+	    if(ctx->show && 
 	       usr_idx != -1 && 
 	       ((option_int("int_opt_user_pause_injury",
 			    &usr(usr_idx).options) &&
 		 !option_int("int_opt_user_auto_sub",
 			     &usr(usr_idx).options)) ||
 		tms[last_unit.event.team]->players->len == 11))
-		misc_callback_pause_live_game(gui);
+		misc_callback_pause_live_game(ctx->gui);
 	    else if(tms[last_unit.event.team]->players->len > 11)
 	    {
 		sub_in = game_substitute_player(tms[last_unit.event.team],
@@ -558,25 +891,24 @@ live_game_event_injury(GUI *gui, gint team, gint player, gboolean create_new)
 		if(sub_in != -1)
 		{
 		    old_structure = tms[last_unit.event.team]->structure;
-		    live_game_event_substitution(
+		    live_game_event_substitution(ctx, 
 			last_unit.event.team, sub_in,
 			last_unit.event.player);
 		    
 		if(old_structure != tms[last_unit.event.team]->structure)
-		    live_game_event_team_change(last_unit.event.team,
+		    live_game_event_team_change(ctx, last_unit.event.team,
 						LIVE_GAME_EVENT_STRUCTURE_CHANGE);
 		}
 	    }
 	}
     }
 
-    game_get_values(match->fix, match->team_values,
-		    match->home_advantage);
+    live_game_update_team_values(ctx);
 }
 
 /** Calculate a stadium event. */
 void
-live_game_event_stadium(GUI *gui)
+live_game_event_stadium(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_event_stadium\n");
@@ -585,14 +917,14 @@ live_game_event_stadium(GUI *gui)
     gint i;
     gfloat rndom = math_rnd(0, 1);
     gfloat probs[3] =
-	{const_float("float_live_game_stadium_event_breakdown"),
-	 const_float("float_live_game_stadium_event_riots"),
-	 const_float("float_live_game_stadium_event_fire")};
+	{const_float(float_live_game_stadium_event_breakdown),
+	 const_float(float_live_game_stadium_event_riots),
+	 const_float(float_live_game_stadium_event_fire)};
 
     for(i=1;i<3;i++)
 	probs[i] += probs[i - 1];
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_event_stadium\n");
     if(rndom <= probs[0])
@@ -602,19 +934,19 @@ live_game_event_stadium(GUI *gui)
     else if(rndom <= probs[2])
 	last_unit.event.type = LIVE_GAME_EVENT_STADIUM_FIRE;
 
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 
     if(team_is_user(tm0) != -1 && debug < 50)
 	game_stadium_event(&tm0->stadium, last_unit.event.type);
 
     match->stadium_event = last_unit.event.type;
 
-    live_game_event_general(gui, TRUE);
+    live_game_event_general(ctx, TRUE);
 }
 
 /** Calculate a scoring chance event. */
 void
-live_game_event_scoring_chance(GUI *gui)
+live_game_event_scoring_chance(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_event_scoring_chance\n");
@@ -627,29 +959,29 @@ live_game_event_scoring_chance(GUI *gui)
     else
 	res_idx = 0;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_event_scoring_chance\n");
 
-    if(math_rnd(0, 1) < const_float("float_live_game_scoring_chance_is_own_goal"))
+    if(math_rnd(0, 1) < const_float(float_live_game_scoring_chance_is_own_goal))
     {
 	last_unit.event.type = LIVE_GAME_EVENT_OWN_GOAL;
 	last_unit.event.player =
-	    game_get_player(tms[!last_unit.possession], GAME_PLAYER_TYPE_DEFEND, 0, -1, FALSE);
+	    game_get_player(match, !last_unit.possession, GAME_PLAYER_TYPE_DEFEND, 0, -1, FALSE);
 	last_unit.event.team = !last_unit.possession;
 	match->fix->result[last_unit.possession][res_idx]++;
 	last_unit.result[last_unit.possession]++;
 
 	player_streak_add_to_prob(player_of_id_team(tms[last_unit.event.team],
 						    last_unit.event.player),
-				  const_float("float_player_streak_add_own_goal"));
+				  const_float(float_player_streak_add_own_goal));
     }
     else
     {
 	last_unit.event.team = last_unit.possession;
 
 	if(uni(unis->len - 2).event.player != -1 &&
-	   math_rnd(0, 1) < const_float("float_live_game_player_in_poss_shoots") &&
+	   math_rnd(0, 1) < const_float(float_live_game_player_in_poss_shoots) &&
 	   query_player_id_in_team(uni(unis->len - 2).event.player,
 				   tms[last_unit.possession]))
 	    last_unit.event.player =
@@ -661,7 +993,7 @@ live_game_event_scoring_chance(GUI *gui)
 				       tms[last_unit.possession]))
 	    {
 		last_unit.event.player =
-		    game_get_player(tms[last_unit.possession], last_unit.area, 0, 
+		    game_get_player(match, last_unit.possession, last_unit.area, 0, 
 				    uni(unis->len - 2).event.player,
 				    TRUE);
 
@@ -672,29 +1004,29 @@ live_game_event_scoring_chance(GUI *gui)
 	    {
 		last_unit.event.player =
 		    game_get_player(
-			tms[last_unit.possession], last_unit.area, 0, -1, TRUE);
+			match, last_unit.possession, last_unit.area, 0, -1, TRUE);
 
 		last_unit.event.player2 =
-		    game_get_player(tms[last_unit.possession], last_unit.area, 0, 
+		    game_get_player(match, last_unit.possession, last_unit.area, 0, 
 				    last_unit.event.player, TRUE);
 	    }
 	}
 
-	if(math_rnd(0, 1) < const_float("float_live_game_scoring_chance_is_header"))
+	if(math_rnd(0, 1) < const_float(float_live_game_scoring_chance_is_header))
 	    last_unit.event.type = LIVE_GAME_EVENT_HEADER;
     }
 
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 
     if(last_unit.event.type != LIVE_GAME_EVENT_OWN_GOAL)
-	live_game_event_duel(gui);
+	live_game_event_duel(ctx);
     else
-	live_game_event_general(gui, TRUE);
+	live_game_event_general(ctx, TRUE);
 }
 
 /** Calculate a penalty event. */
 void
-live_game_event_penalty(GUI *gui)
+live_game_event_penalty(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_event_penalty\n");
@@ -702,7 +1034,7 @@ live_game_event_penalty(GUI *gui)
 
     LiveGameUnit new;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_event_penalty\n");
 
@@ -721,25 +1053,25 @@ live_game_event_penalty(GUI *gui)
 
     if(last_unit.time == LIVE_GAME_UNIT_TIME_PENALTIES)
     {
-	if(live_game_penalties_taken() == 1)
+	if(live_game_penalties_taken(ctx) == 1)
 	{
 	    last_unit.possession = math_rndi(0, 1);
 	    last_unit.event.player =
-		game_get_player(tms[last_unit.possession],
+		game_get_player(match, last_unit.possession,
 				GAME_PLAYER_TYPE_PENALTY, -1, -1, FALSE);
 	}
-	else if(live_game_penalties_taken() == 2)
+	else if(live_game_penalties_taken(ctx) == 2)
 	{
 	    last_unit.possession = !uni(unis->len - 3).possession;
 	    last_unit.event.player =
-		game_get_player(tms[last_unit.possession],
+		game_get_player(match, last_unit.possession,
 				GAME_PLAYER_TYPE_PENALTY, -1, -1, FALSE);
 	}
 	else
 	{
 	    last_unit.possession = !uni(unis->len - 3).possession;
 	    last_unit.event.player =
-		game_get_player(tms[last_unit.possession],
+		game_get_player(match, last_unit.possession,
 				GAME_PLAYER_TYPE_PENALTY,
 				uni(unis->len - 4).event.player, -1, FALSE);
 	}
@@ -753,18 +1085,18 @@ live_game_event_penalty(GUI *gui)
 	    game_get_default_penalty_shooter(tms[last_unit.possession]);
 	if(last_unit.event.player == -1)
 	    last_unit.event.player =
-		game_get_player(tms[last_unit.possession], GAME_PLAYER_TYPE_PENALTY, -1, -1, FALSE);
+		game_get_player(match, last_unit.possession, GAME_PLAYER_TYPE_PENALTY, -1, -1, FALSE);
     }
 
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 
-    live_game_event_duel(gui);
+    live_game_event_duel(ctx);
 }
 
 /** Calculate a general event. 
     @param create_new Whether we create a new unit for the event. */
 void
-live_game_event_general(GUI *gui, gboolean create_new)
+live_game_event_general(LiveGameContext *ctx, gboolean create_new)
 {
 #ifdef DEBUG
     printf("live_game_event_general\n");
@@ -772,16 +1104,16 @@ live_game_event_general(GUI *gui, gboolean create_new)
 
     LiveGameUnit new;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_event_general\n");
 
-    if(create_new && gui_get_status(gui) == STATUS_LIVE_GAME_PAUSE)
+    if(create_new && gui_get_status(ctx->gui) == STATUS_LIVE_GAME_PAUSE)
 	return;
 
     if(create_new)
     {
-	new.minute = live_game_get_minute();
+	new.minute = live_game_get_minute(ctx);
 	new.time = last_unit.time;
 	new.event.commentary = NULL;
 	new.event.type = LIVE_GAME_EVENT_GENERAL;
@@ -805,11 +1137,11 @@ live_game_event_general(GUI *gui, gboolean create_new)
 	    last_unit.event.type <= LIVE_GAME_EVENT_BOOST_CHANGE_ON) ||
 	   ((last_unit.event.type == LIVE_GAME_EVENT_POST ||
 	     last_unit.event.type == LIVE_GAME_EVENT_CROSS_BAR) &&
-	    math_rnd(0, 1) < const_float("float_live_game_possession_after_post")))
+	    math_rnd(0, 1) < const_float(float_live_game_possession_after_post)))
 	{
 	    new.possession = last_unit.possession;
 	    new.area = (last_unit.event.type == LIVE_GAME_EVENT_GENERAL) ?
-		live_game_get_area(&last_unit) : last_unit.area;
+		live_game_get_area(ctx, &last_unit) : last_unit.area;
 	}
 	else if(last_unit.event.type == LIVE_GAME_EVENT_GOAL ||
 		last_unit.event.type == LIVE_GAME_EVENT_OWN_GOAL ||
@@ -848,25 +1180,25 @@ live_game_event_general(GUI *gui, gboolean create_new)
 	g_array_append_val(unis, new);
     }
 
-    live_game_event_general_get_players();
+    live_game_event_general_get_players(ctx);
 
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 
     /** First, check whether CPU strategy changes are made. */
-    if(!show || team_is_user(tm0) == -1)
-	strategy_live_game_check(match, 0);
+    if(!ctx->show || team_is_user(tm0) == -1)
+	strategy_live_game_check(ctx, 0);
 
-    if(!show || team_is_user(tm1) == -1)
-	strategy_live_game_check(match, 1);
+    if(!ctx->show || team_is_user(tm1) == -1)
+	strategy_live_game_check(ctx, 1);
 
     if(last_unit.event.type >= LIVE_GAME_EVENT_STRUCTURE_CHANGE &&
        last_unit.event.type <= LIVE_GAME_EVENT_BOOST_CHANGE_ON)
-	live_game_event_general(gui, TRUE);
+	live_game_event_general(ctx, TRUE);
 }
 
 /** Fill in the players values in a general unit. */
 void
-live_game_event_general_get_players(void)
+live_game_event_general_get_players(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_event_general_get_players\n");
@@ -878,7 +1210,7 @@ live_game_event_general_get_players(void)
 	uni(unis->len - 2).event.player;
     gint type = uni(unis->len - 2).event.type;
 	
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_event_general_get_players\n");
     *pl1 = *pl2 = -1;
@@ -886,29 +1218,29 @@ live_game_event_general_get_players(void)
     if(type == LIVE_GAME_EVENT_LOST_POSSESSION)
     {
 	*pl2 = old_pl1;
-	*pl1 = game_get_player(tms[last_unit.possession], 
+	*pl1 = game_get_player(match, last_unit.possession, 
 			       last_unit.area, 0, *pl2,
 			       TRUE);
     }
     else if(type != LIVE_GAME_EVENT_GENERAL)
     {
-	*pl1 = game_get_player(tms[last_unit.possession],
+	*pl1 = game_get_player(match, last_unit.possession,
 			       last_unit.area, 0, -1, TRUE);
-	if(math_rnd(0, 1) < const_float("float_live_game_general_event_second_player"))
-	    *pl2 = game_get_player(tms[last_unit.possession],
+	if(math_rnd(0, 1) < const_float(float_live_game_general_event_second_player))
+	    *pl2 = game_get_player(match, last_unit.possession,
 				   last_unit.area, 0, *pl1, TRUE);
     }
     else
     {
 	*pl2 = query_player_id_in_team(old_pl1, tms[last_unit.possession]) ? old_pl1 : -1;
-	*pl1 = game_get_player(tms[last_unit.possession],
+	*pl1 = game_get_player(match, last_unit.possession,
 			       last_unit.area, 0, *pl2, TRUE);
     }
 }
 
 /** Calculate a free kick event. */
 void
-live_game_event_free_kick(GUI *gui)
+live_game_event_free_kick(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_event_free_kick\n");
@@ -916,7 +1248,7 @@ live_game_event_free_kick(GUI *gui)
 
     LiveGameUnit new = last_unit;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_event_free_kick\n");
     new.event.player =
@@ -934,18 +1266,18 @@ live_game_event_free_kick(GUI *gui)
 
     if(new.event.player == -1)
 	new.event.player =
-	    game_get_player(tms[new.possession], new.area, 0, -1, TRUE);
+	    game_get_player(match, new.possession, new.area, 0, -1, TRUE);
 
     g_array_append_val(unis, new);
 
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 
-    live_game_event_duel(gui);
+    live_game_event_duel(ctx);
 }
 
 /** Calculate a send-off event. */
 void
-live_game_event_send_off(GUI *gui, gint team, gint player, gboolean second_yellow)
+live_game_event_send_off(LiveGameContext *ctx, gint team, gint player, gboolean second_yellow)
 {
 #ifdef DEBUG
     printf("live_game_event_send_off\n");
@@ -955,7 +1287,7 @@ live_game_event_send_off(GUI *gui, gint team, gint player, gboolean second_yello
     gint substitute = -1, to_substitute = -1;
     gint usr_idx = team_is_user(tms[team]);
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_event_send_off\n");
     new.event.player =
@@ -970,14 +1302,14 @@ live_game_event_send_off(GUI *gui, gint team, gint player, gboolean second_yello
 
     g_array_append_val(unis, new);
 
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 
     if(debug >= 50 && usr_idx != -1)
 	return;
 
     player_streak_add_to_prob(
 	player_of_id_team(tms[team], player),
-	const_float("float_player_streak_add_sendoff"));
+	const_float(float_player_streak_add_sendoff));
     if(player_of_id_team(tms[team], player)->streak == PLAYER_STREAK_HOT)
     {
 	player_of_id_team(tms[team], player)->streak = PLAYER_STREAK_NONE;
@@ -998,18 +1330,18 @@ live_game_event_send_off(GUI *gui, gint team, gint player, gboolean second_yello
     {
 	tms[team]->structure = team_find_appropriate_structure(tms[team]);
 	team_rearrange(tms[team]);
-	live_game_event_team_change(team, LIVE_GAME_EVENT_STRUCTURE_CHANGE);
+	live_game_event_team_change(ctx, team, LIVE_GAME_EVENT_STRUCTURE_CHANGE);
     }
 
     if(match->subs_left[team] > 0)
     {
-	if(show && usr_idx != -1 &&
+	if(ctx->show && usr_idx != -1 &&
 	   ((option_int("int_opt_user_pause_red",
 			&usr(usr_idx).options) &&
 	     !option_int("int_opt_user_auto_sub",
 			 &usr(usr_idx).options)) ||
 	    tms[team]->players->len == 1))
-	    misc_callback_pause_live_game(gui);
+	    misc_callback_pause_live_game(ctx->gui);
 	else if(tms[team]->players->len > 11)
 	{
 	    game_substitute_player_send_off(match->fix->competition->id,
@@ -1017,24 +1349,23 @@ live_game_event_send_off(GUI *gui, gint team, gint player, gboolean second_yello
 					    &to_substitute, &substitute);
 
 	    if(to_substitute != -1)
-		live_game_event_substitution(team, substitute, to_substitute);
+		live_game_event_substitution(ctx, team, substitute, to_substitute);
 	    else
 	    {
 		tms[team]->structure = team_find_appropriate_structure(tms[team]);
 		team_rearrange(tms[team]);
 	    }
-	    live_game_event_team_change(team, LIVE_GAME_EVENT_STRUCTURE_CHANGE);
+	    live_game_event_team_change(ctx, team, LIVE_GAME_EVENT_STRUCTURE_CHANGE);
 	}
     }
     else if(usr_idx == -1)
     {
 	tms[team]->structure = team_find_appropriate_structure(tms[team]);
 	team_rearrange(tms[team]);
-	live_game_event_team_change(team, LIVE_GAME_EVENT_STRUCTURE_CHANGE);
+	live_game_event_team_change(ctx, team, LIVE_GAME_EVENT_STRUCTURE_CHANGE);
     }
 
-    game_get_values(match->fix, match->team_values,
-		    match->home_advantage);
+    live_game_update_team_values(ctx);
 }
 
 /** Show a substitution event.
@@ -1042,7 +1373,7 @@ live_game_event_send_off(GUI *gui, gint team, gint player, gboolean second_yello
     @param sub_in The id of the player who moves into the team.
     @param sub_out The id of the player who gets replaced. */
 void
-live_game_event_substitution(gint team_number, gint sub_in, gint sub_out)
+live_game_event_substitution(LiveGameContext *ctx, gint team_number, gint sub_in, gint sub_out)
 {
 #ifdef DEBUG
     printf("live_game_event_substitution\n");
@@ -1065,31 +1396,31 @@ live_game_event_substitution(gint team_number, gint sub_in, gint sub_out)
 
 	player_streak_add_to_prob(
 	    player_of_id_team(tms[team_number], sub_in),
-	    const_float("float_player_streak_add_sub_out"));
+	    const_float(float_player_streak_add_sub_out));
 	
 	player_streak_add_to_prob(
 	    player_of_id_team(tms[team_number], sub_in),
-	    const_float("float_player_streak_add_sub_in"));	
+	    const_float(float_player_streak_add_sub_in));	
 
 	player_games_goals_set(player_of_id_team(tms[team_number], sub_in),
 			       match->fix->competition, PLAYER_VALUE_GAMES, 1);
 	player_of_id_team(tms[team_number], sub_in)->career[PLAYER_VALUE_GAMES]++;
 	player_of_id_team(tms[team_number], sub_in)->participation = TRUE;
 
-	if(show)
+	if(ctx->show)
 	    game_gui_live_game_show_opponent();
     }
 
     g_array_append_val(unis, new);
 
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 }
 
 /** Show a team change event, e.g. structure change. 
     @param team_number The index of the team.
     @param event_type The event type. */
 void
-live_game_event_team_change(gint team_number, gint event_type)
+live_game_event_team_change(LiveGameContext *ctx, gint team_number, gint event_type)
 {
 #ifdef DEBUG
     printf("live_game_event_team_change\n");
@@ -1108,15 +1439,15 @@ live_game_event_team_change(gint team_number, gint event_type)
 
     g_array_append_val(unis, new);
     
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 
-    if(show)
+    if(ctx->show)
 	game_gui_live_game_show_opponent();
 }
 
 /** Calculate whether a player who tries to score succeeds. */
 void
-live_game_event_duel(GUI *gui)
+live_game_event_duel(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_event_duel\n");
@@ -1129,7 +1460,7 @@ live_game_event_duel(GUI *gui)
     Player *attacker, *goalie, *assistant;
     gint res_idx1, res_idx2;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_event_duel\n");
 
@@ -1146,8 +1477,8 @@ live_game_event_duel(GUI *gui)
 
     new.event.player2 = goalie->id;
 
-    duel_factor = player_get_game_skill(attacker, FALSE, TRUE) /
-	player_get_game_skill(goalie, FALSE, TRUE);
+    duel_factor = game_view_get_game_skill(&match->views[new.possession], attacker) /
+	match->views[!new.possession].game_skill[0];
 
     res_idx1 = new.possession;
     if(new.time == LIVE_GAME_UNIT_TIME_PENALTIES)
@@ -1158,15 +1489,15 @@ live_game_event_duel(GUI *gui)
 	res_idx2 = 0;
 
     if(last_unit.event.type == LIVE_GAME_EVENT_PENALTY)
-	scoring_prob = const_float("float_live_game_score_penalty") * duel_factor * attacker->team->luck;
+	scoring_prob = const_float(float_live_game_score_penalty) * duel_factor * attacker->team->luck;
     else if(last_unit.event.type == LIVE_GAME_EVENT_FREE_KICK)
-	scoring_prob = const_float("float_live_game_score_free_kick") * duel_factor * attacker->team->luck;
+	scoring_prob = const_float(float_live_game_score_free_kick) * duel_factor * attacker->team->luck;
     else
-	scoring_prob = const_float("float_live_game_score_base_prob") * 
-	    powf(duel_factor, const_float("float_live_game_score_duel_exponent")) *
+	scoring_prob = const_float(float_live_game_score_base_prob) * 
+	    powf(duel_factor, const_float(float_live_game_score_duel_exponent)) *
 	    powf(match->team_values[new.possession][GAME_TEAM_VALUE_ATTACK] /
 		 match->team_values[!new.possession][GAME_TEAM_VALUE_DEFEND],
-		 const_float("float_live_game_score_team_exponent")) * attacker->team->luck;
+		 const_float(float_live_game_score_team_exponent)) * attacker->team->luck;
 
     if(new.time != LIVE_GAME_UNIT_TIME_PENALTIES)
     {
@@ -1188,12 +1519,12 @@ live_game_event_duel(GUI *gui)
 	    goalie->career[PLAYER_VALUE_GOALS]++;
 
 	    player_streak_add_to_prob(attacker,
-				      const_float("float_player_streak_add_goal"));
+				      const_float(float_player_streak_add_goal));
 	    player_streak_add_to_prob(goalie,
-				      const_float("float_player_streak_add_goalie_goal"));
+				      const_float(float_player_streak_add_goalie_goal));
 	    if(assistant != NULL)
 		player_streak_add_to_prob(
-		    assistant, const_float("float_player_streak_add_assist"));
+		    assistant, const_float(float_player_streak_add_assist));
 	}
     }
     else {
@@ -1218,22 +1549,22 @@ live_game_event_duel(GUI *gui)
 
 	if(new.event.type == LIVE_GAME_EVENT_SAVE || new.event.type == LIVE_GAME_EVENT_KEEPER_PUSHED_IN_CORNER )
 	    player_streak_add_to_prob(goalie,
-				      const_float("float_player_streak_add_goalie_save"));
+				      const_float(float_player_streak_add_goalie_save));
     }
     
     g_array_append_val(unis, new);
 
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 
     if(last_unit.time != LIVE_GAME_UNIT_TIME_PENALTIES)
     {
        if (last_unit.event.type == LIVE_GAME_EVENT_KEEPER_PUSHED_IN_CORNER ||
            last_unit.event.type == LIVE_GAME_EVENT_PLAYER_PUSHED_IN_CORNER) {
-         live_game_event_corner_kick(gui);
+         live_game_event_corner_kick(ctx);
        }
        else
        {
-         live_game_event_general(gui, TRUE);
+         live_game_event_general(ctx, TRUE);
        }
     }
 }
@@ -1241,7 +1572,7 @@ live_game_event_duel(GUI *gui)
 /** Create an event for the corner kick.
 */
 void
-live_game_event_corner_kick(GUI *gui)
+live_game_event_corner_kick(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_event_corner_kick\n");
@@ -1249,15 +1580,15 @@ live_game_event_corner_kick(GUI *gui)
 
     LiveGameUnit new;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_event_corner_kick\n");
 
-    if(gui_get_status(gui) == STATUS_LIVE_GAME_PAUSE)
+    if(gui_get_status(ctx->gui) == STATUS_LIVE_GAME_PAUSE)
 	return;
     new.event.player =
 	new.event.player2 = -1;
-    new.minute = live_game_get_minute();
+    new.minute = live_game_get_minute(ctx);
     new.time = last_unit.time;
     new.event.commentary = NULL;
     new.event.type = LIVE_GAME_EVENT_CORNER_KICK;
@@ -1272,11 +1603,11 @@ live_game_event_corner_kick(GUI *gui)
 
     if(new.event.player == -1)
 	new.event.player =
-	    game_get_player(tms[new.possession], new.area, 0, -1, TRUE);
+	    game_get_player(match, new.possession, new.area, 0, -1, TRUE);
 
     g_array_append_val(unis, new);
 
-    live_game_finish_unit();
+    live_game_finish_unit(ctx);
 
     // The corner is taken, define what happens next
     new = last_unit;
@@ -1285,9 +1616,9 @@ live_game_event_corner_kick(GUI *gui)
     new.event.commentary = NULL;
     new.event.type = LIVE_GAME_EVENT_GENERAL;
     new.event.commentary_id = -1;
-    live_game_fill_new_unit(&new);
+    live_game_fill_new_unit(ctx, &new);
     g_array_append_val(unis, new);
-    live_game_evaluate_unit(gui, &new);
+    live_game_evaluate_unit(ctx, &new);
 }
 
 /** Find out whether the specified player already has a yellow card
@@ -1296,7 +1627,7 @@ live_game_event_corner_kick(GUI *gui)
     @param player The player index.
     @return TRUE or FALSE. */
 gboolean
-query_live_game_second_yellow(gint team, gint player)
+query_live_game_second_yellow(LiveGameContext *ctx, gint team, gint player)
 {
 #ifdef DEBUG
     printf("query_live_game_second_yellow\n");
@@ -1304,6 +1635,12 @@ query_live_game_second_yellow(gint team, gint player)
 
     gint i;
 
+    if(match->results_only)
+	/* The earlier units may be gone, but a booked player
+	   has the yellow card status until the end of the match. */
+	return (player_of_id_team(tms[team], player)->card_status ==
+		PLAYER_CARD_STATUS_YELLOW);
+
     for(i=0;i<unis->len - 1;i++)
 	if(uni(i).event.type == LIVE_GAME_EVENT_FOUL_YELLOW &&
 	   uni(i).possession != team &&
@@ -1312,6 +1649,30 @@ query_live_game_second_yellow(gint team, gint player)
 
     return FALSE;
 }
+/** Find out whether a match without user involvement only needs
+    its result and the facts the news are generated from.
+    @see #LiveGameResultsOnly */
+gboolean
+query_live_game_results_only(const Fixture *fix)
+{
+#ifdef DEBUG
+    printf("query_live_game_results_only\n");
+#endif
+
+    switch(opt_int(int_opt_results_only))
+    {
+	case LIVE_GAME_RESULTS_ONLY_NEVER:
+	    return FALSE;
+	case LIVE_GAME_RESULTS_ONLY_ALWAYS:
+	    return TRUE;
+    }
+
+    /* Matches of other countries and those the news
+       won't report about. */
+    return (country_get_competition_id(&country, fix->competition->id) == NULL ||
+	    !news_check_fixture_relevant(fix));
+}
+
 /** Find out whether there should be a half-time break 
     or extra time break or so. 
     @param minute The minute of the #LiveGameUnit we want to find
@@ -1320,7 +1681,7 @@ query_live_game_second_yellow(gint team, gint player)
     the break event for.
     @return TRUE if we have a break, FALSE otherwise. */
 gboolean
-query_live_game_event_is_break(gint minute, gint time)
+query_live_game_event_is_break(LiveGameContext *ctx, gint minute, gint time)
 {
 #ifdef DEBUG
     printf("query_live_game_event_is_break\n");
@@ -1332,20 +1693,20 @@ query_live_game_event_is_break(gint minute, gint time)
 	return (minute >= 120);
 
     if(time == LIVE_GAME_UNIT_TIME_PENALTIES)
-	return query_live_game_penalties_over();
+	return query_live_game_penalties_over(ctx);
 
     rndom = math_rnd(0, 1);
 
     if(time == LIVE_GAME_UNIT_TIME_FIRST_HALF)
 	return (minute >= 45 && rndom > 
-		powf(const_float("float_live_game_break_base"),
+		powf(const_float(float_live_game_break_base),
 		     (gfloat)(minute - 44) * 
-		     const_float("float_live_game_45_break_exponent_factor")));
+		     const_float(float_live_game_45_break_exponent_factor)));
     else
 	return (minute >= 90 && rndom > 
-		powf(const_float("float_live_game_break_base"),
+		powf(const_float(float_live_game_break_base),
 		     (gfloat)(minute - 89) * 
-		     const_float("float_live_game_90_break_exponent_factor")));
+		     const_float(float_live_game_90_break_exponent_factor)));
 }
 
 /** Find out whether the final result of the penalties is
@@ -1353,7 +1714,7 @@ query_live_game_event_is_break(gint minute, gint time)
     @return TRUE if the penalties are over,
     FALSE otherwise. */
 gboolean
-query_live_game_penalties_over(void)
+query_live_game_penalties_over(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("query_live_game_penalties_over\n");
@@ -1384,7 +1745,7 @@ query_live_game_penalties_over(void)
     of the last unit. 
     @return A new #LiveGameUnitTime. */
 gint
-live_game_get_break(void)
+live_game_get_break(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_get_break\n");
@@ -1442,7 +1803,7 @@ live_game_get_time(const LiveGameUnit *unit)
 /** Return the minute for the next game unit.
     @return A new minute for a LiveGameUnit. */
 gint
-live_game_get_minute(void)
+live_game_get_minute(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_get_minute\n");
@@ -1467,13 +1828,13 @@ live_game_get_minute(void)
 
 /** Return the minutes remaining in the match. */
 gint
-live_game_get_minutes_remaining(const LiveGameUnit *unit)
+live_game_get_minutes_remaining(const LiveGame *live_game, const LiveGameUnit *unit)
 {
 #ifdef DEBUG
     printf("live_game_get_minutes_remaining\n");
 #endif
 
-    gint current_min = live_game_unit_get_minute(unit);
+    gint current_min = live_game_unit_get_minute(live_game, unit);
     gint return_value = -1;
     
     if(unit->time == LIVE_GAME_UNIT_TIME_EXTRA_TIME)
@@ -1491,16 +1852,17 @@ live_game_get_minutes_remaining(const LiveGameUnit *unit)
     @param unit The unit we examine.
     @return A minute between 1 and 120. */
 gint
-live_game_unit_get_minute(const LiveGameUnit *unit)
+live_game_unit_get_minute(const LiveGame *live_game, const LiveGameUnit *unit)
 {
 #ifdef DEBUG
     printf("live_game_unit_get_minute\n");
 #endif
 
     gint i, j;
+    const GArray *units = live_game->units;
 
-    for(i=unis->len - 1; i >= 0; i--)
-	if(&uni(i) == unit)
+    for(i=units->len - 1; i >= 0; i--)
+	if(&g_array_index(units, LiveGameUnit, i) == unit)
 	    break;
 
     if(i == -1)
@@ -1508,8 +1870,8 @@ live_game_unit_get_minute(const LiveGameUnit *unit)
 			  "live_game_unit_get_minute: reached end of units array.");
     else
 	for(j=i;j>=0;j--)
-	    if(uni(j).minute != -1)
-		return uni(j).minute;
+	    if(g_array_index(units, LiveGameUnit, j).minute != -1)
+		return g_array_index(units, LiveGameUnit, j).minute;
 
     return -1;
 }
@@ -1518,32 +1880,33 @@ live_game_unit_get_minute(const LiveGameUnit *unit)
     @param unit The unit specified.
     @param gap How many units to skip. */
 LiveGameUnit*
-live_game_unit_before(const LiveGameUnit* unit, gint gap)
+live_game_unit_before(const LiveGame *live_game, const LiveGameUnit* unit, gint gap)
 {
 #ifdef DEBUG
     printf("live_game_unit_before\n");
 #endif
 
     gint i;
+    const GArray *units = live_game->units;
 
     if(gap > 0)
     {
-	for(i=unis->len - 1;i>=0;i--)
-	    if(&uni(i) == unit)
+	for(i=units->len - 1;i>=0;i--)
+	    if(&g_array_index(units, LiveGameUnit, i) == unit)
 	    {
 		if(i - gap > 0)
-		    return &uni(i - gap);
+		    return &g_array_index(units, LiveGameUnit, i - gap);
 		else
 		    debug_print_message("live_game_unit_before: no unit found for gap %d\n", gap);
 	    }
     }
     else
     {
-	for(i=unis->len - 1;i>=0;i--)
-	    if(&uni(i) == unit)
+	for(i=units->len - 1;i>=0;i--)
+	    if(&g_array_index(units, LiveGameUnit, i) == unit)
 	    {
-		if(i + gap < unis->len - 1)
-		    return &uni(i + gap);
+		if(i + gap < units->len - 1)
+		    return &g_array_index(units, LiveGameUnit, i + gap);
 		else
 		    debug_print_message("live_game_unit_before: no unit found for gap %d\n", gap);
 	    }
@@ -1559,7 +1922,7 @@ live_game_unit_before(const LiveGameUnit* unit, gint gap)
     @param unit The previous unit.
     @return An area, defend, midfield or attack. */
 gint
-live_game_get_area(const LiveGameUnit *unit)
+live_game_get_area(LiveGameContext *ctx, const LiveGameUnit *unit)
 {
 #ifdef DEBUG
     printf("live_game_get_area\n");
@@ -1568,14 +1931,14 @@ live_game_get_area(const LiveGameUnit *unit)
     gint new_area = unit->area;
     gfloat rndom = math_rnd(0, 1);
     gfloat probs[4] =
-	{const_float("float_live_game_area_def_mid") *
-	 live_game_pit_teams(unit, const_float("float_live_game_area_def_mid_team_exponent")),
-	 const_float("float_live_game_area_mid_att") *
-	 live_game_pit_teams(unit, const_float("float_live_game_area_mid_team_exponent")),
-	 const_float("float_live_game_area_mid_def") /
-	 live_game_pit_teams(unit, const_float("float_live_game_area_mid_team_exponent")),
-	 const_float("float_live_game_area_att_mid") /
-	 live_game_pit_teams(unit, const_float("float_live_game_area_att_mid_team_exponent"))};
+	{const_float(float_live_game_area_def_mid) *
+	 live_game_pit_teams(ctx, unit, const_float(float_live_game_area_def_mid_team_exponent)),
+	 const_float(float_live_game_area_mid_att) *
+	 live_game_pit_teams(ctx, unit, const_float(float_live_game_area_mid_team_exponent)),
+	 const_float(float_live_game_area_mid_def) /
+	 live_game_pit_teams(ctx, unit, const_float(float_live_game_area_mid_team_exponent)),
+	 const_float(float_live_game_area_att_mid) /
+	 live_game_pit_teams(ctx, unit, const_float(float_live_game_area_att_mid_team_exponent))};
 
     if(unit->area == LIVE_GAME_UNIT_AREA_DEFEND && rndom < probs[0])
 	new_area = LIVE_GAME_UNIT_AREA_MIDFIELD;
@@ -1598,7 +1961,7 @@ live_game_get_area(const LiveGameUnit *unit)
     @param unit The unit we calculate the value for.
     @param exponent The weighting exponent. */
 gfloat
-live_game_pit_teams(const LiveGameUnit *unit, gfloat exponent)
+live_game_pit_teams(LiveGameContext *ctx, const LiveGameUnit *unit, gfloat exponent)
 {
 #ifdef DEBUG
     printf("live_game_pit_teams\n");
@@ -1625,7 +1988,7 @@ live_game_pit_teams(const LiveGameUnit *unit, gfloat exponent)
 
 /** Some polishing of the latest unit. Write commentary etc. */
 void
-live_game_finish_unit(void)
+live_game_finish_unit(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_finish_unit\n");
@@ -1633,11 +1996,11 @@ live_game_finish_unit(void)
 
     LiveGameUnit *unit = &last_unit;
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("\t\tlive_game_finish_unit\n");
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("OOOO1 idx %d min %d type %d poss %d team %d pl %d %d\n", unis->len - 1,
 	       unit->minute,
@@ -1647,23 +2010,22 @@ live_game_finish_unit(void)
 
     if(unit->minute != -1 && unit->time != LIVE_GAME_UNIT_TIME_PENALTIES)
     {
-	if(stat2 != -1 && usr(stat2).tm->boost == 1)
+	if(ctx->user_idx != -1 && usr(ctx->user_idx).tm->boost == 1)
 	    game_boost_cost();
 
 	game_decrease_fitness(match->fix);
-	game_get_values(match->fix, match->team_values,
-			match->home_advantage);
-	if(stat2 != -1 &&
-	   stat2 == cur_user && show &&
-	   unit->minute % opt_int("int_opt_live_game_player_list_refresh") == 0)
+	live_game_update_team_values(ctx);
+	if(ctx->user_idx != -1 &&
+	   ctx->user_idx == cur_user && ctx->show &&
+	   unit->minute % opt_int(int_opt_live_game_player_list_refresh) == 0)
 	    treeview_show_user_player_list();
     }
 
     game_update_stats(match, unit);
 
-    if(stat2 != -1 || stat5 < -1000)
+    if(ctx->commentary)
     {
-	if(unit->time != LIVE_GAME_UNIT_TIME_PENALTIES && show)
+	if(unit->time != LIVE_GAME_UNIT_TIME_PENALTIES && ctx->show)
             treeview_show_game_stats(GTK_TREE_VIEW(lookup_widget(window.live, "treeview_stats")),
                                      match);
 
@@ -1689,10 +2051,10 @@ live_game_finish_unit(void)
 	unit->event.verbosity = live_game_event_get_verbosity(unit->event.type);
     }
 
-    if(show)
+    if(ctx->show)
 	game_gui_live_game_show_unit(unit);
 
-    if((debug > 100 && stat2 != -1) ||
+    if((debug > 100 && ctx->user_idx != -1) ||
        debug > 130)
 	g_print("OOOO idx %d type %d poss %d team %d pl %d %d\n", unis->len - 1,
 	       unit->event.type, unit->possession, unit->event.team,
@@ -1703,7 +2065,7 @@ live_game_finish_unit(void)
 /** Find a random player (influenced by fitness) who gets
     injured. */
 void
-live_game_injury_get_player(void)
+live_game_injury_get_player(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_injury_get_player\n");
@@ -1713,29 +2075,31 @@ live_game_injury_get_player(void)
     gfloat probs[22];
     gfloat rndom, fitness_factor;
     gfloat goalie_factor = 
-	const_float("float_live_game_injury_goalie_factor");
+	const_float(float_live_game_injury_goalie_factor);
     gfloat boost_factor = 
-	const_float("float_player_boost_injury_effect");
+	const_float(float_player_boost_injury_effect);
+    const LiveGameTeamView *view = NULL;
     
     for(j=0;j<2;j++)
     {
-	fitness_factor = (player_of_idx_team(tms[j], 0)->fitness < 0.025) ?
-	    40 : 1 / player_of_idx_team(tms[j], 0)->fitness;
+	view = &match->views[j];
+	fitness_factor = (view->fitness[0] < 0.025) ?
+	    40 : 1 / view->fitness[0];
 	probs[j * 11] = goalie_factor * fitness_factor * 
-	    (player_of_idx_team(tms[j], 0)->cskill != 0) * (1 + tms[j]->boost * boost_factor);
+	    (view->cskill[0] != 0) * (1 + tms[j]->boost * boost_factor);
 	if(j == 1)
 	    probs[11] += probs[10];
 	
 	for(i=1;i<11;i++)
 	{
-	    fitness_factor = (player_of_idx_team(tms[j], i)->fitness < 0.025) ?
-		40 : 1 / ((gfloat)player_of_idx_team(tms[j], i)->fitness);
+	    fitness_factor = (view->fitness[i] < 0.025) ?
+		40 : 1 / ((gfloat)view->fitness[i]);
 	    probs[i + j * 11] = probs[i + j * 11 - 1] + (1 - goalie_factor) * fitness_factor *
-		(player_of_idx_team(tms[j], i)->cskill != 0) * (1 + tms[j]->boost * boost_factor);
+		(view->cskill[i] != 0) * (1 + tms[j]->boost * boost_factor);
 	}
     }
 
-    /* math_rnd is a wrapper around g_rand_double_range().  This function will
+    /* math_rnd returns a double in [lower, upper).  This function will
      * return a double value less than probs[21].  However, because we are
      * casting the result to a float it's possible due to rounding that our
      * converted float value will equal probs[21].  So, we cannot assume rndom
@@ -1745,16 +2109,14 @@ live_game_injury_get_player(void)
 
     if(rndom <= probs[0])
     {
-	last_unit.event.player = 
-	    player_of_idx_team(tm0, 0)->id;
+	last_unit.event.player = match->views[0].ids[0];
 	last_unit.event.team = 0;
     }
     else
 	for(i=1;i<22;i++)
 	    if(probs[i - 1] < rndom && rndom <= probs[i])
 	    {
-		last_unit.event.player = 
-		    player_of_idx_team(tms[(i > 10)], i % 11)->id;
+		last_unit.event.player = match->views[(i > 10)].ids[i % 11];
 		last_unit.event.team = (i > 10);
 	    }
 }
@@ -1770,8 +2132,10 @@ live_game_resume(Bygfoot *bygfoot)
     gint i, j;
     gint subs_in[3],
 	subs_out[3];
+    LiveGameContext context, *ctx = &context;
 
-    statp = &usr(stat2).live_game;
+    live_game_context_init(ctx, &usr(stat2).live_game, stat2, bygfoot->gui);
+    statp = ctx->live_game;
 
     for(i=0;i<2;i++)
     {
@@ -1779,18 +2143,18 @@ live_game_resume(Bygfoot *bygfoot)
 	for(j=0;j<3;j++)
 	{
 	    if(subs_in[j] != -1)
-		live_game_event_substitution(i, subs_in[j], subs_out[j]);
+		live_game_event_substitution(ctx, i, subs_in[j], subs_out[j]);
 	}
 
 	if(tms[i]->structure != usr(stat2).live_game.team_state[i].structure)
-	    live_game_event_team_change(i, LIVE_GAME_EVENT_STRUCTURE_CHANGE);
+	    live_game_event_team_change(ctx, i, LIVE_GAME_EVENT_STRUCTURE_CHANGE);
 
 	if(tms[i]->style != usr(stat2).live_game.team_state[i].style)
-	    live_game_event_team_change(i, LIVE_GAME_EVENT_STYLE_CHANGE_ALL_OUT_DEFEND +
+	    live_game_event_team_change(ctx, i, LIVE_GAME_EVENT_STYLE_CHANGE_ALL_OUT_DEFEND +
 					tms[i]->style + 2);
 
 	if(tms[i]->boost != usr(stat2).live_game.team_state[i].boost)
-	    live_game_event_team_change(i, LIVE_GAME_EVENT_BOOST_CHANGE_ANTI +
+	    live_game_event_team_change(ctx, i, LIVE_GAME_EVENT_BOOST_CHANGE_ANTI +
 					tms[i]->boost + 1);
     }
 
@@ -1798,6 +2162,44 @@ live_game_resume(Bygfoot *bygfoot)
 }
 
 
+/** Fill in the values of a live game that is about to begin. */
+static void
+live_game_reset_values(LiveGame *live_game, Fixture *fix)
+{
+    gint i;
+
+    live_game->started_game = -1;
+    live_game->stats.possession = 0;
+    for(i=0;i<LIVE_GAME_STAT_VALUE_END;i++)
+	live_game->stats.values[0][i] =
+	    live_game->stats.values[1][i] = 0;
+
+    live_game->fix = fix;
+    if(fix != NULL)
+    {
+	live_game->fix_id = fix->id;
+	live_game->team_names[0] = fix->teams[0]->name;
+	live_game->team_names[1] = fix->teams[1]->name;
+    }
+    else
+    {
+	live_game->fix_id = -1;
+	live_game->attendance = -1;
+	live_game->team_names[0] = 
+	    live_game->team_names[1] = NULL;
+    }
+
+    live_game->subs_left[0] = live_game->subs_left[1] = 3;
+    live_game->stadium_event = -1;
+    
+    if(fix != NULL && fix->home_advantage)
+	live_game->home_advantage = 
+	    math_rnd(const_float(float_game_home_advantage_lower),
+		     const_float(float_game_home_advantage_upper));
+    else
+	live_game->home_advantage = 0;
+}
+
 /** Reset the live game variable before we begin a new live game.
     @param live_game The pointer to the live game.
     @param fix The fixture we'll show.
@@ -1813,7 +2215,7 @@ live_game_reset(LiveGame *live_game, Fixture *fix, gboolean free_variable)
     if(free_variable)
 	free_live_game(live_game);
 
-    live_game->started_game = -1;
+    live_game->strings = NULL;
     live_game->units = g_array_new(FALSE, FALSE, sizeof(LiveGameUnit));
     live_game->action_ids[0] = g_array_new(FALSE, FALSE, sizeof(gint));
     live_game->action_ids[1] = g_array_new(FALSE, FALSE, sizeof(gint));
@@ -1823,35 +2225,105 @@ live_game_reset(LiveGame *live_game, Fixture *fix, gboolean free_variable)
 	live_game->stats.players[0][i] = g_ptr_array_new();
 	live_game->stats.players[1][i] = g_ptr_array_new();
     }
-    live_game->stats.possession = 0;
-    for(i=0;i<LIVE_GAME_STAT_VALUE_END;i++)
-	live_game->stats.values[0][i] =
-	    live_game->stats.values[1][i] = 0;
 
-    live_game->fix = fix;
-    if(fix != NULL)
+    live_game_reset_values(live_game, fix);
+}
+
+/** Reset a recycled live game before we begin a new live game.
+    The arrays keep their memory and the strings of the last match
+    get freed in one go.
+    @see live_game_prepare_array() */
+void
+live_game_recycle(LiveGame *live_game, Fixture *fix)
+{
+#ifdef DEBUG
+    printf("live_game_recycle\n");
+#endif
+
+    gint i;
+
+    for(i=0;i<live_game->units->len;i++)
+	free_gchar_ptr(g_array_index(live_game->units, LiveGameUnit, i).event.commentary);
+
+    g_array_set_size(live_game->units, 0);
+    g_array_set_size(live_game->action_ids[0], 0);
+    g_array_set_size(live_game->action_ids[1], 0);
+
+    for(i=0;i<LIVE_GAME_STAT_ARRAY_END;i++)
     {
-	live_game->fix_id = fix->id;
-	live_game->team_names[0] = g_strdup(fix->teams[0]->name);
-	live_game->team_names[1] = g_strdup(fix->teams[1]->name);
+	g_ptr_array_set_size(live_game->stats.players[0][i], 0);
+	g_ptr_array_set_size(live_game->stats.players[1][i], 0);
     }
-    else
+
+    g_string_chunk_clear(live_game->strings);
+
+    live_game_reset_values(live_game, fix);
+}
+
+/** Make room for the matches without user involvement of a week
+    round. When recycling, the live games of the last round are
+    reused, so calculating a round hardly allocates any memory;
+    otherwise the old live games get freed and the new ones
+    have to be reset by the match calculation.
+    @param live_games The array of the matches; it has to zero
+    new elements.
+    @param len The number of matches of the new round.
+    @param recycle Whether to recycle the live games. */
+void
+live_game_prepare_array(GArray *live_games, gint len, gboolean recycle)
+{
+#ifdef DEBUG
+    printf("live_game_prepare_array\n");
+#endif
+
+    gint i;
+    LiveGame *live_game = NULL;
+
+    for(i=0;i<live_games->len;i++)
     {
-	live_game->fix_id = -1;
-	live_game->attendance = -1;
-	live_game->team_names[0] = 
-	    live_game->team_names[1] = NULL;
+	live_game = &g_array_index(live_games, LiveGame, i);
+	if(i >= len || !recycle || live_game->strings == NULL)
+	{
+	    free_live_game(live_game);
+	    memset(live_game, 0, sizeof(LiveGame));
+	}
     }
 
-    live_game->subs_left[0] = live_game->subs_left[1] = 3;
-    live_game->stadium_event = -1;
-    
-    if(fix != NULL && fix->home_advantage)
-	live_game->home_advantage = 
-	    math_rnd(const_float("float_game_home_advantage_lower"),
-		     const_float("float_game_home_advantage_upper"));
+    g_array_set_size(live_games, len);
+
+    if(!recycle)
+	return;
+
+    for(i=0;i<len;i++)
+    {
+	live_game = &g_array_index(live_games, LiveGame, i);
+	if(live_game->strings == NULL)
+	{
+	    live_game_reset(live_game, NULL, FALSE);
+	    live_game->strings = g_string_chunk_new(LIVE_GAME_STRINGS_SIZE);
+	}
+    }
+}
+
+/** Copy a string belonging to a live game. The copy ends up
+    in the string chunk of the live game if it's recycled.
+    @see live_game_recycle() */
+gchar*
+live_game_strdup(LiveGame *live_game, const gchar *string)
+{
+    return (live_game->strings == NULL) ?
+	g_strdup(string) : g_string_chunk_insert(live_game->strings, string);
+}
+
+/** Replace a string belonging to a live game.
+    @see live_game_strdup() */
+void
+live_game_string_assign(LiveGame *live_game, gchar **string, const gchar *contents)
+{
+    if(live_game->strings == NULL)
+	misc_string_assign(string, contents);
     else
-	live_game->home_advantage = 0;
+	*string = g_string_chunk_insert(live_game->strings, contents);
 }
 
 /** Determine verbosity level depending on the event type. */
@@ -1945,7 +2417,7 @@ live_game_unit_result_to_buf(const LiveGameUnit *unit, gchar *buf, gboolean swap
 
 /** Count the number of penalties taken during penalty shoot-out. */
 gint
-live_game_penalties_taken(void)
+live_game_penalties_taken(LiveGameContext *ctx)
 {
 #ifdef DEBUG
     printf("live_game_penalties_taken\n");
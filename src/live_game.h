@@ -29,110 +29,148 @@
 #include "bygfoot.h"
 #include "live_game_struct.h"
 
+/** The block size of the string chunks of recycled live games;
+    enough for the team names and the scorers etc. of a match.
+    @see live_game_recycle() */
+#define LIVE_GAME_STRINGS_SIZE 512
+
+/** How many of the latest units a results-only live game keeps
+    at least. @see live_game_drop_units() */
+#define LIVE_GAME_RESULTS_ONLY_UNITS 8
+
+void
+live_game_context_init(LiveGameContext *ctx, LiveGame *live_game,
+		       gint user_idx, GUI *gui);
+
 void
 live_game_calculate_fixture(Fixture *fix, LiveGame *live_game, Bygfoot *bygfoot);
 
+gboolean
+live_game_calculate(LiveGameContext *ctx);
+
+void
+live_game_calculate_fixtures(GPtrArray *fixtures, GArray *live_games,
+			     MathRand **rands, gint num_threads);
+
+MathRand*
+live_game_fixture_rand_new(const Fixture *fix);
+
 void
-live_game_initialize(Fixture *fix, LiveGame *live_game, Bygfoot *bygfoot);
+live_game_initialize(LiveGameContext *ctx, Fixture *fix, Bygfoot *bygfoot);
 
 gboolean
-query_live_game_event_is_break(gint minute, gint time);
+query_live_game_event_is_break(LiveGameContext *ctx, gint minute, gint time);
 
 gboolean
-query_live_game_penalties_over(void);
+query_live_game_penalties_over(LiveGameContext *ctx);
 
 gint
-live_game_get_break(void);
+live_game_get_break(LiveGameContext *ctx);
 
 gint
 live_game_get_time(const LiveGameUnit *unit);
 
 gint
-live_game_get_minute(void);
+live_game_get_minute(LiveGameContext *ctx);
 
 gint
-live_game_get_minutes_remaining(const LiveGameUnit *unit);
+live_game_get_minutes_remaining(const LiveGame *live_game, const LiveGameUnit *unit);
 
 void
-live_game_create_unit(GUI *gui);
+live_game_create_unit(LiveGameContext *ctx);
 
 void
-live_game_fill_new_unit(LiveGameUnit *new);
+live_game_fill_new_unit(LiveGameContext *ctx, LiveGameUnit *new);
 
 void
-live_game_create_start_unit(void);
+live_game_create_start_unit(LiveGameContext *ctx);
 
 void
-live_game_evaluate_unit(GUI *gui, LiveGameUnit *unit);
+live_game_evaluate_unit(LiveGameContext *ctx, LiveGameUnit *unit);
 
 void
-live_game_event_foul(GUI *gui);
+live_game_event_foul(LiveGameContext *ctx);
 
 void
-live_game_event_lost_possession(GUI *gui);
+live_game_event_lost_possession(LiveGameContext *ctx);
 
 void
-live_game_event_injury(GUI *gui, gint team, gint player, gboolean create_new);
+live_game_event_injury(LiveGameContext *ctx, gint team, gint player, gboolean create_new);
 
 void
-live_game_event_stadium(GUI *gui);
+live_game_event_stadium(LiveGameContext *ctx);
 
 void
-live_game_event_scoring_chance(GUI *gui);
+live_game_event_scoring_chance(LiveGameContext *ctx);
 
 void
-live_game_event_penalty();
+live_game_event_penalty(LiveGameContext *ctx);
 
 void
-live_game_event_general(GUI *gui, gboolean create_new);
+live_game_event_general(LiveGameContext *ctx, gboolean create_new);
 
 void
-live_game_event_general_get_players(void);
+live_game_event_general_get_players(LiveGameContext *ctx);
 
 void
-live_game_event_free_kick(GUI *gui);
+live_game_event_free_kick(LiveGameContext *ctx);
 
 void
-live_game_event_send_off(GUI *gui, gint team, gint player, gboolean second_yellow);
+live_game_event_send_off(LiveGameContext *ctx, gint team, gint player, gboolean second_yellow);
 
 void
-live_game_event_duel(GUI *gui);
+live_game_event_duel(LiveGameContext *ctx);
 
 void
-live_game_event_corner_kick(GUI *gui);
+live_game_event_corner_kick(LiveGameContext *ctx);
 
 gboolean
-query_live_game_second_yellow(gint team, gint player);
+query_live_game_second_yellow(LiveGameContext *ctx, gint team, gint player);
+
+gboolean
+query_live_game_results_only(const Fixture *fix);
 
 void
 live_game_reset(LiveGame *live_game, Fixture *fix, gboolean free_variable);
 
+void
+live_game_recycle(LiveGame *live_game, Fixture *fix);
+
+void
+live_game_prepare_array(GArray *live_games, gint len, gboolean recycle);
+
+gchar*
+live_game_strdup(LiveGame *live_game, const gchar *string);
+
+void
+live_game_string_assign(LiveGame *live_game, gchar **string, const gchar *contents);
+
 gint
-live_game_unit_get_minute(const LiveGameUnit *unit);
+live_game_unit_get_minute(const LiveGame *live_game, const LiveGameUnit *unit);
 
 gint
-live_game_get_area(const LiveGameUnit *unit);
+live_game_get_area(LiveGameContext *ctx, const LiveGameUnit *unit);
 
 gfloat
-live_game_pit_teams(const LiveGameUnit *unit, gfloat exponent);
+live_game_pit_teams(LiveGameContext *ctx, const LiveGameUnit *unit, gfloat exponent);
 
 void
-live_game_injury_get_player(void);
+live_game_injury_get_player(LiveGameContext *ctx);
 
 void
 live_game_resume(Bygfoot *bygfoot);
 
 void
-live_game_event_substitution(gint team_number, gint sub_in, gint sub_out);
+live_game_event_substitution(LiveGameContext *ctx, gint team_number, gint sub_in, gint sub_out);
 
 void
-live_game_event_team_change(gint team_number, gint event_type);
+live_game_event_team_change(LiveGameContext *ctx, gint team_number, gint event_type);
 
 void
-live_game_finish_unit(void);
+live_game_finish_unit(LiveGameContext *ctx);
 
 LiveGameUnit*
-live_game_unit_before(const LiveGameUnit* unit, gint gap);
+live_game_unit_before(const LiveGame *live_game, const LiveGameUnit* unit, gint gap);
 
 gint
 live_game_event_get_verbosity(gint event_type);
@@ -141,6 +179,6 @@ void
 live_game_unit_result_to_buf(const LiveGameUnit *unit, gchar *buf, gboolean swap);
 
 gint
-live_game_penalties_taken(void);
+live_game_penalties_taken(LiveGameContext *ctx);
 
 #endif
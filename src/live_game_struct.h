@@ -28,6 +28,7 @@
 
 #include "bygfoot.h"
 #include "fixture_struct.h"
+#include "maths_struct.h"
 
 /** Events happening during a live game.  Some of these events should always
     be ordered in blocks as they can occur.  For example LIVE_GAME_EVENT_POST
@@ -107,6 +108,26 @@ enum LiveGameUnitTime
     LIVE_GAME_UNIT_TIME_END
 };
 
+/** Which matches without user involvement only keep their
+    result. @see query_live_game_results_only() */
+enum LiveGameResultsOnly
+{
+    LIVE_GAME_RESULTS_ONLY_NEVER = 0,
+    LIVE_GAME_RESULTS_ONLY_AUTO,
+    LIVE_GAME_RESULTS_ONLY_ALWAYS,
+    LIVE_GAME_RESULTS_ONLY_END
+};
+
+/** How results-only matches get calculated: unit by unit like the
+    other matches or with the statistical match model.
+    @see match_model_get_rate() */
+enum LiveGameSimMode
+{
+    LIVE_GAME_SIM_MODE_ENGINE = 0,
+    LIVE_GAME_SIM_MODE_STATISTICAL,
+    LIVE_GAME_SIM_MODE_END
+};
+
 /** Indices for the values in #LiveGameStats. */
 enum LiveGameStatValue
 {
@@ -202,6 +223,30 @@ typedef struct
 
 } LiveGameTeamState;
 
+/** The attributes of the players on the pitch that the match
+    calculations need all the time, kept in a compact form so that
+    they don't have to be gathered from the player structs for each
+    event. Index 0 is the goalie. @see game_view_update() */
+typedef struct
+{
+    /** Ids of the players. */
+    gint ids[11];
+    /** Current positions. @see #PlayerPos */
+    gint cpos[11];
+    /** Current skills and fitness values. */
+    gfloat cskill[11], fitness[11];
+    /** The skills including boost, streak and fitness.
+	@see player_get_game_skill() */
+    gfloat game_skill[11];
+    /** The factors by which the streaks influence the skills. */
+    gfloat streak_factor[11];
+    /** Cached probabilities for picking field players, by area
+	and by whether skills count. @see game_get_player_probs() */
+    gfloat probs[LIVE_GAME_UNIT_AREA_END][2][10];
+    /** Which of the cached probabilities are up to date. */
+    gboolean probs_valid[LIVE_GAME_UNIT_AREA_END][2];
+} LiveGameTeamView;
+
 typedef struct
 {
     /** The fixture that belongs to the game. */
@@ -210,7 +255,7 @@ typedef struct
 	can change when new fixtures are added to the fixtures array). */
     gint fix_id;
     /** The names of the teams stored for later use (when the fixture
-	already got freed). */
+	already got freed). They're in the name pool. */
     gchar *team_names[2];
     /** Attendance stored for later use (when the fixture
 	already got freed). */
@@ -227,6 +272,9 @@ typedef struct
     gfloat team_values[2][GAME_TEAM_VALUE_END];
     /** The home advantage factor. */
     gfloat home_advantage;
+    /** The players on the pitch of both teams.
+	@see #LiveGameTeamView */
+    LiveGameTeamView views[2];
     /** The array of units. @see #GameUnit */
     GArray *units;    
     /** Match statistics. @see #LiveGameStats */
@@ -235,6 +283,38 @@ typedef struct
     /** Ids of strategy actions applied. 
 	Actions only get applied once. */
     GArray *action_ids[2];
+    /** The strings of a recycled live game (the player
+	strings of the stats), or NULL if they're allocated
+	one by one. @see live_game_recycle() */
+    GStringChunk *strings;
+    /** Whether only the result and the facts the news need are
+	kept: the units get dropped while the match goes on, only a
+	few of the latest ones are kept. @see query_live_game_results_only() */
+    gboolean results_only;
 } LiveGame;
 
+/** Everything the match engine needs to calculate a live game.
+    The context gets passed to the live_game_* functions explicitly
+    so that several fixtures can be calculated at the same time. */
+typedef struct
+{
+    /** The live game we calculate. */
+    LiveGame *live_game;
+    /** The user involved in the match or -1. */
+    gint user_idx;
+    /** Whether the events are actually shown or not. */
+    gboolean show;
+    /** Whether commentary gets generated for the units. */
+    gboolean commentary;
+    /** The gui the match is shown in; NULL when the match
+	is calculated in the background. */
+    GUI *gui;
+    /** The random number stream of the match; NULL means
+	the global generator. */
+    MathRand *rand;
+    /** Whether the live game gets recycled instead of being
+	reset. @see live_game_recycle() */
+    gboolean recycle;
+} LiveGameContext;
+
 #endif
@@ -25,7 +25,9 @@
 #include <ctype.h>
 #include <glib/gstdio.h>
 
+#include "bin_loadsave.h"
 #include "callbacks.h"
+#include "competition.h"
 #include "cup.h"
 #include "file.h"
 #include "free.h"
@@ -35,6 +37,8 @@
 #include "load_save.h"
 #include "misc.h"
 #include "option.h"
+#include "player.h"
+#include "registry.h"
 #include "support.h"
 #include "team.h"
 #include "user.h"
@@ -53,118 +57,225 @@
 
 #define PROGRESS_MAX 9
 
-/** Save the game to the specified file. */
-void
-load_save_save_game(Bygfoot *bygfoot, const gchar *filename)
+/** Whether the file is a binary savegame (judging by the suffix). */
+static gboolean
+load_save_is_binary(const gchar *filename)
+{
+    return g_str_has_suffix(filename, const_str(string_fs_binary_save_suffix));
+}
+
+/** Save the game to a binary savegame.
+    @see bin_loadsave_write() */
+static void
+load_save_save_binary(Bygfoot *bygfoot, const gchar *filename)
 {
 #ifdef DEBUG
-    printf("load_save_save_game\n");
+    printf("load_save_save_binary\n");
 #endif
 
-    gchar buf[SMALL];
-    gchar *prefix = (g_str_has_suffix(filename, const_str("string_fs_save_suffix"))) ?
-                    g_strndup(filename, strlen(filename) - strlen(const_str("string_fs_save_suffix"))) :
-                    g_strdup(filename);
-    GString *fullname = g_string_new("");
-
-    g_string_append(fullname,(g_str_has_suffix(filename, const_str("string_fs_save_suffix"))) ?
-                    g_strdup(filename) :
-                    g_strdup_printf("%s%s", filename, const_str("string_fs_save_suffix")));
-
-    misc_string_assign(&save_file, fullname->str);
-
-    if(g_file_test(fullname->str, G_FILE_TEST_EXISTS))
-        g_remove(fullname->str);
+    bygfoot_show_progress(bygfoot, 0, _("Saving game..."),
+                      PIC_TYPE_SAVE);
 
-    if(debug > 60)
-        g_print("load_save_save options\n");
+    if(bin_loadsave_write(bygfoot, filename))
+    {
+        misc_string_assign(&save_file, filename);
+        file_store_text_in_saves("last_save", filename);
+    }
+    else if (bygfoot->frontend == BYGFOOT_FRONTEND_GTK2)
+        game_gui_show_warning(_("Could not write savegame %s."), filename);
 
-    bygfoot_show_progress(bygfoot, 0, _("Saving options..."),
+    bygfoot_show_progress(bygfoot, -1, "",
                       PIC_TYPE_SAVE);
+    if (bygfoot->frontend == BYGFOOT_FRONTEND_GTK2) {
+        setsav1;
+    }
+}
 
-    sprintf(buf, "%s___options", prefix);
-    file_save_opt_file(buf, &options);
-    sprintf(buf, "%s___settings", prefix);
-    file_save_opt_file(buf, &settings);
-
-    if(debug > 60)
-        g_print("load_save_save leagues/cups \n");
+/** The parts of a savegame that get written independently
+    of each other. */
+enum LoadSavePart
+{
+    LOAD_SAVE_PART_LEAGUES_CUPS = 0,
+    LOAD_SAVE_PART_USERS,
+    LOAD_SAVE_PART_TRANSFERS,
+    LOAD_SAVE_PART_SEASON_STATS,
+    LOAD_SAVE_PART_JOBS,
+    LOAD_SAVE_PART_NEWSPAPER,
+    LOAD_SAVE_PART_MISC,
+    LOAD_SAVE_PART_END
+};
+
+/** A savegame part written by a worker thread. */
+typedef struct
+{
+    gint part;
+    Bygfoot *bygfoot;
+    const gchar *prefix;
+    /** Finished jobs get pushed here. */
+    GAsyncQueue *done;
+} LoadSaveJob;
+
+/** Write a part of a savegame. The writers only read the game
+    state, so the parts can be written concurrently. */
+static void
+load_save_write_part(gpointer data, gpointer user_data)
+{
+    LoadSaveJob *job = (LoadSaveJob*)data;
 
-    bygfoot_show_progress(bygfoot,
-        ((PROGRESS_MAX * bygfoot_get_progress_bar_fraction(bygfoot)) + 1) / PROGRESS_MAX,
-        _("Saving leagues and cups..."),
-        PIC_TYPE_SAVE);
+    switch(job->part)
+    {
+    case LOAD_SAVE_PART_LEAGUES_CUPS:
+        xml_loadsave_leagues_cups_write(job->prefix);
+        break;
+    case LOAD_SAVE_PART_USERS:
+        xml_loadsave_users_write(job->prefix);
+        break;
+    case LOAD_SAVE_PART_TRANSFERS:
+        xml_loadsave_transfers_write(job->prefix);
+        break;
+    case LOAD_SAVE_PART_SEASON_STATS:
+        xml_loadsave_season_stats_write(job->prefix);
+        break;
+    case LOAD_SAVE_PART_JOBS:
+        xml_loadsave_jobs_write(job->prefix);
+        break;
+    case LOAD_SAVE_PART_NEWSPAPER:
+        xml_loadsave_newspaper_write(job->prefix);
+        break;
+    case LOAD_SAVE_PART_MISC:
+        xml_loadsave_misc_write(job->bygfoot, job->prefix);
+        break;
+    }
 
-    xml_loadsave_leagues_cups_write(prefix);
+    if(job->done != NULL)
+        g_async_queue_push(job->done, job);
+}
 
-    if(debug > 60)
-        g_print("load_save_save users \n");
+/** Write the savegame parts, on a thread pool if we use
+    several threads for savegames. The progress bar gets
+    updated from the calling thread.
+    @see file_archive_threads() */
+static void
+load_save_write_parts(Bygfoot *bygfoot, const gchar *prefix)
+{
+#ifdef DEBUG
+    printf("load_save_write_parts\n");
+#endif
 
-    bygfoot_show_progress(bygfoot,
-        ((PROGRESS_MAX * bygfoot_get_progress_bar_fraction(bygfoot)) + 1) / PROGRESS_MAX,
-        _("Saving users..."),
-        PIC_TYPE_SAVE);
+    const gchar *messages[LOAD_SAVE_PART_END] =
+        {_("Saving leagues and cups..."),
+         _("Saving users..."),
+         _("Saving transfer list..."),
+         _("Saving season stats..."),
+         /* The 'job exchange' is a list of teams looking for a manager. */
+         _("Saving job exchange..."),
+         _("Saving newspaper..."),
+         _("Saving miscellaneous...")};
+    LoadSaveJob jobs[LOAD_SAVE_PART_END], *job = NULL;
+    gint i, threads = file_archive_threads();
+    GThreadPool *pool = NULL;
+    GError *error = NULL;
+
+    for(i=0;i<LOAD_SAVE_PART_END;i++)
+    {
+        jobs[i].part = i;
+        jobs[i].bygfoot = bygfoot;
+        jobs[i].prefix = prefix;
+        jobs[i].done = NULL;
+    }
 
-    xml_loadsave_users_write(prefix);
+    if(threads <= 1)
+    {
+        for(i=0;i<LOAD_SAVE_PART_END;i++)
+        {
+            bygfoot_show_progress(bygfoot,
+                ((PROGRESS_MAX * bygfoot_get_progress_bar_fraction(bygfoot)) + 1) / PROGRESS_MAX,
+                messages[i], PIC_TYPE_SAVE);
+            load_save_write_part(&jobs[i], NULL);
+        }
 
-    if(debug > 60)
-        g_print("load_save_save transfers \n");
+        return;
+    }
 
-    bygfoot_show_progress(bygfoot,
-        ((PROGRESS_MAX * bygfoot_get_progress_bar_fraction(bygfoot)) + 1) / PROGRESS_MAX,
-        _("Saving transfer list..."),
-        PIC_TYPE_SAVE);
+    pool = g_thread_pool_new(load_save_write_part, NULL,
+                             MIN(threads, LOAD_SAVE_PART_END), TRUE, &error);
+    misc_print_error(&error, TRUE);
 
-    xml_loadsave_transfers_write(prefix);
+    jobs[0].done = g_async_queue_new();
+    for(i=0;i<LOAD_SAVE_PART_END;i++)
+    {
+        jobs[i].done = jobs[0].done;
+        g_thread_pool_push(pool, &jobs[i], NULL);
+    }
 
-    if(debug > 60)
-        g_print("load_save_save stats \n");
+    for(i=0;i<LOAD_SAVE_PART_END;i++)
+    {
+        job = (LoadSaveJob*)g_async_queue_pop(jobs[0].done);
+        bygfoot_show_progress(bygfoot,
+            ((PROGRESS_MAX * bygfoot_get_progress_bar_fraction(bygfoot)) + 1) / PROGRESS_MAX,
+            messages[job->part], PIC_TYPE_SAVE);
+    }
 
-    bygfoot_show_progress(bygfoot,
-        ((PROGRESS_MAX * bygfoot_get_progress_bar_fraction(bygfoot)) + 1) / PROGRESS_MAX,
-        _("Saving season stats..."),
-        PIC_TYPE_SAVE);
+    g_thread_pool_free(pool, FALSE, TRUE);
+    g_async_queue_unref(jobs[0].done);
+}
 
-    xml_loadsave_season_stats_write(prefix);
+/** Save the game to the specified file. Files with the binary
+    save suffix get written in the binary format, all others as
+    zipped XML files. */
+void
+load_save_save_game(Bygfoot *bygfoot, const gchar *filename)
+{
+#ifdef DEBUG
+    printf("load_save_save_game\n");
+#endif
 
-    if(debug > 60)
-        g_print("load_save_save jobs \n");
+    if(load_save_is_binary(filename))
+    {
+        load_save_save_binary(bygfoot, filename);
+        return;
+    }
 
-    bygfoot_show_progress(bygfoot,
-        ((PROGRESS_MAX * bygfoot_get_progress_bar_fraction(bygfoot)) + 1) / PROGRESS_MAX,
-        /* The 'job exchange' is a list of teams looking for a manager. */
-        _("Saving job exchange..."),
-        PIC_TYPE_SAVE);
+    gchar buf[SMALL];
+    gchar *prefix = (g_str_has_suffix(filename, const_str(string_fs_save_suffix))) ?
+                    g_strndup(filename, strlen(filename) - strlen(const_str(string_fs_save_suffix))) :
+                    g_strdup(filename);
+    GString *fullname = g_string_new("");
 
-    xml_loadsave_jobs_write(prefix);
+    g_string_append(fullname,(g_str_has_suffix(filename, const_str(string_fs_save_suffix))) ?
+                    g_strdup(filename) :
+                    g_strdup_printf("%s%s", filename, const_str(string_fs_save_suffix)));
 
-    if(debug > 60)
-        g_print("load_save_save newspaper \n");
+    misc_string_assign(&save_file, fullname->str);
 
-    bygfoot_show_progress(bygfoot,
-        ((PROGRESS_MAX * bygfoot_get_progress_bar_fraction(bygfoot)) + 1) / PROGRESS_MAX,
-        _("Saving newspaper..."),
-        PIC_TYPE_SAVE);
+    if(g_file_test(fullname->str, G_FILE_TEST_EXISTS))
+        g_remove(fullname->str);
 
-    xml_loadsave_newspaper_write(prefix);
+    if(!file_archive_begin_write(fullname->str))
+    {
+        if (bygfoot->frontend == BYGFOOT_FRONTEND_GTK2)
+            game_gui_show_warning(_("Could not write savegame %s."), fullname->str);
+        g_free(prefix);
+        g_string_free(fullname, TRUE);
+        return;
+    }
 
     if(debug > 60)
-        g_print("load_save_save misc \n");
+        g_print("load_save_save options\n");
 
-    bygfoot_show_progress(bygfoot,
-        ((PROGRESS_MAX * bygfoot_get_progress_bar_fraction(bygfoot)) + 1) / PROGRESS_MAX,
-        _("Saving miscellaneous..."),
-        PIC_TYPE_SAVE);
+    bygfoot_show_progress(bygfoot, 0, _("Saving options..."),
+                      PIC_TYPE_SAVE);
 
-    xml_loadsave_misc_write(bygfoot, prefix);
+    sprintf(buf, "%s___options", prefix);
+    file_save_opt_file(buf, &options);
+    sprintf(buf, "%s___settings", prefix);
+    file_save_opt_file(buf, &settings);
 
-    bygfoot_show_progress(bygfoot,
-        ((PROGRESS_MAX * bygfoot_get_progress_bar_fraction(bygfoot)) + 1) / PROGRESS_MAX,
-        _("Compressing savegame..."),
-        PIC_TYPE_SAVE);
+    load_save_write_parts(bygfoot, prefix);
 
-    sprintf(buf, "%s___", prefix);
-    file_compress_files(fullname->str, buf);
+    if(!file_archive_end_write() &&
+       bygfoot->frontend == BYGFOOT_FRONTEND_GTK2)
+        game_gui_show_warning(_("Could not write savegame %s."), fullname->str);
 
     if(debug > 60)
         g_print("load_save_save done \n");
@@ -215,6 +326,7 @@ country_adjust_competition_pointers(Country *country)
                     gint clid = GPOINTER_TO_INT(stats->competition);
                     stats->competition = bygfoot_get_competition_id(country->bygfoot, clid);
                 }
+                player_stats_slots_update(player);
             }
         }
     }
@@ -244,7 +356,9 @@ country_adjust_first_team_ptrs(Country *country)
             if (!team_is_reserve_team(team)) {
                 team->first_team.team = team;
             } else {
-                team->first_team.team = team_of_id(team->first_team.id);
+                /* Not team_of_id(), that would generate the players
+                   of the skeleton teams of other countries. */
+                team->first_team.team = registry_get_team(team->first_team.id);
             }
         }
     }
@@ -262,6 +376,64 @@ bygfoot_adjust_first_team_pointers(Bygfoot *bygfoot)
     }
 }
 
+/** Remember the savegame and show the main window
+    after a game got loaded. */
+static void
+load_save_load_finish(Bygfoot *bygfoot, const gchar *fullname, gboolean create_main_window)
+{
+    misc_string_assign(&save_file, fullname);
+
+    file_store_text_in_saves("last_save", fullname);
+
+    bygfoot_show_progress(bygfoot, -1, "",
+                      PIC_TYPE_LOAD);
+
+    if(create_main_window)
+    {
+        window_create(WINDOW_MAIN, bygfoot);
+        on_button_back_to_main_clicked(NULL, bygfoot);
+    }
+    else if(window.main != NULL)
+    {
+        gtk_widget_show(window.main);
+        window_main_load_geometry();
+    }
+}
+
+/** Load a binary savegame.
+    @see bin_loadsave_read() */
+static gboolean
+load_save_load_binary(Bygfoot *bygfoot, const gchar *fullname, gboolean create_main_window)
+{
+#ifdef DEBUG
+    printf("load_save_load_binary\n");
+#endif
+
+    if(window.main != NULL)
+        gtk_widget_hide(window.main);
+
+    bygfoot_show_progress(bygfoot, 0, _("Loading game..."),
+                      PIC_TYPE_LOAD);
+
+    if(!bin_loadsave_read(bygfoot, fullname))
+    {
+        bygfoot_show_progress(bygfoot, -1, "",
+                          PIC_TYPE_LOAD);
+        if(window.main != NULL)
+            gtk_widget_show(window.main);
+        if (bygfoot->frontend == BYGFOOT_FRONTEND_GTK2)
+            game_gui_show_warning(_("Could not load savegame %s."), fullname);
+        return FALSE;
+    }
+
+    bygfoot_show_progress(bygfoot, 1, _("Done."),
+                      PIC_TYPE_LOAD);
+
+    load_save_load_finish(bygfoot, fullname, create_main_window);
+
+    return TRUE;
+}
+
 /** Load the game from the specified file.
     @param create_main_window Whether to create and show the main window. */
 gboolean
@@ -272,15 +444,15 @@ load_save_load_game(Bygfoot *bygfoot, const gchar* filename, gboolean create_mai
 #endif
 
     GString *buf = g_string_new("");
-    gchar *fullname = (g_str_has_suffix(filename, const_str("string_fs_save_suffix"))) ?
+    gchar *fullname = (g_str_has_suffix(filename, const_str(string_fs_save_suffix)) ||
+                       load_save_is_binary(filename)) ?
                       g_strdup(filename) :
-                      g_strdup_printf("%s%s", filename, const_str("string_fs_save_suffix"));
+                      g_strdup_printf("%s%s", filename, const_str(string_fs_save_suffix));
     gchar *basename = g_path_get_basename(fullname),
                       *dirname = g_path_get_dirname(fullname);
-    gchar *prefix = (g_str_has_suffix(basename, const_str("string_fs_save_suffix"))) ?
-                    g_strndup(basename, strlen(basename) - strlen(const_str("string_fs_save_suffix"))) :
+    gchar *prefix = (g_str_has_suffix(basename, const_str(string_fs_save_suffix))) ?
+                    g_strndup(basename, strlen(basename) - strlen(const_str(string_fs_save_suffix))) :
                     g_strdup(basename);
-    gchar *pwd = g_get_current_dir();
 
     if (!country.bygfoot)
         country.bygfoot = bygfoot;
@@ -306,13 +478,41 @@ load_save_load_game(Bygfoot *bygfoot, const gchar* filename, gboolean create_mai
         }
     }
 
+    if(load_save_is_binary(fullname))
+    {
+        gboolean success =
+            load_save_load_binary(bygfoot, fullname, create_main_window);
+
+        g_string_free(buf, TRUE);
+        g_free(basename);
+        g_free(dirname);
+        g_free(prefix);
+        g_free(fullname);
+
+        return success;
+    }
+
     if(window.main != NULL)
         gtk_widget_hide(window.main);
 
     bygfoot_show_progress(bygfoot, 0, _("Uncompressing savegame..."),
                       PIC_TYPE_LOAD);
 
-    file_decompress(fullname);
+    if(!file_archive_begin_read(fullname))
+    {
+        bygfoot_show_progress(bygfoot, -1, "",
+                          PIC_TYPE_LOAD);
+        if(window.main != NULL)
+            gtk_widget_show(window.main);
+        if (bygfoot->frontend == BYGFOOT_FRONTEND_GTK2)
+            game_gui_show_warning(_("Could not load savegame %s."), fullname);
+        g_string_free(buf, TRUE);
+        g_free(basename);
+        g_free(dirname);
+        g_free(prefix);
+        g_free(fullname);
+        return FALSE;
+    }
 
     if(debug > 60)
         g_print("load_save_load options\n");
@@ -352,6 +552,7 @@ load_save_load_game(Bygfoot *bygfoot, const gchar* filename, gboolean create_mai
     xml_loadsave_leagues_cups_adjust_team_ptrs();
     xml_loadsave_leagues_cups_adjust_team_ptrs_cups(bygfoot->international_cups);
     update_all_cups();
+    competition_assign_slots(bygfoot);
     bygfoot_adjust_competition_pointers(bygfoot);
     bygfoot_adjust_first_team_pointers(bygfoot);
 
@@ -412,52 +613,60 @@ load_save_load_game(Bygfoot *bygfoot, const gchar* filename, gboolean create_mai
     bygfoot_show_progress(bygfoot, 1, _("Done."),
                       PIC_TYPE_LOAD);
 
-    chdir(dirname);
-    GPtrArray *files = file_dir_get_contents(dirname, prefix, "");
-    // Remove the zipfile from the list
-    gint i;
-    for(i=0; i<files->len; i++)
-    {
-        if (g_strcmp0((gchar*)g_ptr_array_index(files, i),basename)==0)
-        {
-            g_ptr_array_remove_index_fast(files, i);
-        }
-    }
-    file_remove_files(files);
-    chdir(pwd);
-    g_free(pwd);
-    free_gchar_array(&files);
+    file_archive_end_read();
 
+    load_save_load_finish(bygfoot, fullname, create_main_window);
 
-    misc_string_assign(&save_file, fullname);
+    g_string_free(buf, TRUE);
 
-    file_store_text_in_saves("last_save", fullname);
+    g_free(basename);
+    g_free(dirname);
+    g_free(prefix);
+    g_free(fullname);
 
-    bygfoot_show_progress(bygfoot, -1, "",
-                      PIC_TYPE_LOAD);
+    return TRUE;
+}
 
-    if(create_main_window)
-    {
-        window_create(WINDOW_MAIN, bygfoot);
-        on_button_back_to_main_clicked(NULL, bygfoot);
-    }
-    else if(window.main != NULL)
+
+/** Convert a savegame between the XML and the binary
+    format. The new file gets the other suffix and
+    is put next to the old one. */
+gboolean
+load_save_convert_game(Bygfoot *bygfoot, const gchar *filename)
+{
+#ifdef DEBUG
+    printf("load_save_convert_game\n");
+#endif
+
+    gboolean binary = load_save_is_binary(filename);
+    const gchar *suffix = binary ? const_str(string_fs_binary_save_suffix) :
+                                   const_str(string_fs_save_suffix);
+    gchar *prefix, *dest;
+
+    if(!g_file_test(filename, G_FILE_TEST_EXISTS))
     {
-        gtk_widget_show(window.main);
-        window_main_load_geometry();
+        debug_print_message("load_save_convert_game: could not find file %s.\n", filename);
+        return FALSE;
     }
 
-    g_string_free(buf, TRUE);
+    if(!load_save_load_game(bygfoot, filename, FALSE))
+        return FALSE;
+
+    prefix = (g_str_has_suffix(filename, suffix)) ?
+             g_strndup(filename, strlen(filename) - strlen(suffix)) :
+             g_strdup(filename);
+    dest = g_strdup_printf("%s%s", prefix,
+                           binary ? const_str(string_fs_save_suffix) :
+                                    const_str(string_fs_binary_save_suffix));
+
+    load_save_save_game(bygfoot, dest);
 
-    g_free(basename);
-    g_free(dirname);
     g_free(prefix);
-    g_free(fullname);
+    g_free(dest);
 
     return TRUE;
 }
 
-
 /** Write an autosave. */
 void
 load_save_autosave(Bygfoot *bygfoot)
@@ -469,12 +678,11 @@ load_save_autosave(Bygfoot *bygfoot)
     gchar buf[SMALL], name[SMALL], directory[SMALL], prefix[SMALL];
     const gchar *home = g_get_home_dir();
     FILE *fil = NULL;
-    gchar *pwd = g_get_current_dir();
 
-    if(!opt_int("int_opt_autosave"))
+    if(!opt_int(int_opt_autosave))
         return;
 
-    counters[COUNT_AUTOSAVE] = (counters[COUNT_AUTOSAVE] + 1) % opt_int("int_opt_autosave_interval");
+    counters[COUNT_AUTOSAVE] = (counters[COUNT_AUTOSAVE] + 1) % opt_int(int_opt_autosave_interval);
 
     if(counters[COUNT_AUTOSAVE] != 0)
         return;
@@ -493,24 +701,22 @@ load_save_autosave(Bygfoot *bygfoot)
     fclose(fil);
     sprintf(prefix, "autosave_%02d_", counters[COUNT_AUTOSAVE_FILE]);
     load_save_save_game(bygfoot, buf);
-    chdir(directory);
     GPtrArray *files = file_dir_get_contents(directory, prefix, ".zip");
-    // Remove the zipfile from the list
+    // Remove older autosaves with the same number
     gint i;
     for(i=0; i<files->len; i++)
     {
-        if (g_strcmp0((gchar*)g_ptr_array_index(files, i),name)==0)
+        if (g_strcmp0((gchar*)g_ptr_array_index(files, i),name)!=0)
         {
-            g_ptr_array_remove_index_fast(files, i);
+            sprintf(buf, "%s%s%s", directory, G_DIR_SEPARATOR_S,
+                    (gchar*)g_ptr_array_index(files, i));
+            g_remove(buf);
         }
     }
-    file_remove_files(files);
-    chdir(pwd);
-    g_free(pwd);
     free_gchar_array(&files);
 
 
-    counters[COUNT_AUTOSAVE_FILE] = (counters[COUNT_AUTOSAVE_FILE] + 1) % opt_int("int_opt_autosave_files");
+    counters[COUNT_AUTOSAVE_FILE] = (counters[COUNT_AUTOSAVE_FILE] + 1) % opt_int(int_opt_autosave_files);
 }
 
 /** Write the autosave file name which is put together from
@@ -548,9 +754,10 @@ load_game_from_command_line(Bygfoot *bygfoot, const gchar *filename)
     if(strcmp(filename, "last_save") == 0)
         return load_save_load_game(bygfoot, filename, TRUE);
 
-    fullname = (g_str_has_suffix(filename, const_str("string_fs_save_suffix"))) ?
+    fullname = (g_str_has_suffix(filename, const_str(string_fs_save_suffix)) ||
+                load_save_is_binary(filename)) ?
                g_strdup(filename) :
-               g_strdup_printf("%s%s", filename, const_str("string_fs_save_suffix"));
+               g_strdup_printf("%s%s", filename, const_str(string_fs_save_suffix));
 
     if(g_file_test(fullname, G_FILE_TEST_EXISTS))
     {
@@ -34,6 +34,9 @@ load_save_save_game(Bygfoot *bygfoot, const gchar* filename);
 gboolean
 load_save_load_game(Bygfoot *bygfoot, const gchar* filename, gboolean create_main_window);
 
+gboolean
+load_save_convert_game(Bygfoot *bygfoot, const gchar *filename);
+
 void
 load_save_autosave(Bygfoot *bygfoot);
 
@@ -32,6 +32,7 @@
 #include <fcntl.h>
 #endif
 
+#include "bet.h"
 #include "bet_struct.h"
 #include "bygfoot_struct.h"
 #include "debug.h"
@@ -47,6 +48,7 @@
 #include "live_game.h"
 #include "load_save.h"
 #include "main.h"
+#include "match_model.h"
 #include "maths.h"
 #include "misc.h"
 #include "misc_callbacks.h"
@@ -59,6 +61,7 @@
 #include "transfer_struct.h"
 #include "variables.h"
 #include "window.h"
+#include "xml_cache.h"
 #include "xml_country.h"
 #include "xml_strategy.h"
 
@@ -86,6 +89,15 @@ main_parse_frontend_backend_cl_arguments(gint *argc, gchar ***argv, CommandLineA
 	    { "json", 0, 0, G_OPTION_ARG_FILENAME, &args->json_filename,
 	    "JSON file containing commands to run.  bygfoot will run the "
 	    "commands in this file and then exit", "FILE"},
+	    { "server", 0, 0, G_OPTION_ARG_NONE, &args->json_server,
+	    "Read newline-delimited JSON commands from stdin and keep the "
+	    "game in memory between them", NULL},
+	    { "socket", 0, 0, G_OPTION_ARG_FILENAME, &args->json_socket,
+	    "Like --server, but read the commands from connections to "
+	    "the UNIX socket FILE", "FILE"},
+	    { "convert-savegame", 0, 0, G_OPTION_ARG_FILENAME, &args->convert_savegame,
+	    "Convert the savegame FILE from the XML to the binary format "
+	    "or vice versa and exit", "FILE"},
         {NULL}
     };
 
@@ -119,9 +131,10 @@ main_parse_cl_arguments(gint *argc, gchar ***argv, Bygfoot *bygfoot)
     gchar *support_dir = NULL, *lang = NULL,
           *testcom_file = NULL, *token_file = NULL,
           *event_name = NULL,
-          *country_sid = NULL;
+          *country_sid = NULL, *sim_mode = NULL;
     gint number_of_passes = 1,
-         num_matches = 100, skilldiffmax = 20;
+         num_matches = 100, skilldiffmax = 20,
+         match_threads = 0, results_only = -1;
     guint32 random_seed = 0;
     GError *error = NULL;
     GOptionContext *context = NULL;
@@ -153,7 +166,8 @@ main_parse_cl_arguments(gint *argc, gchar ***argv, Bygfoot *bygfoot)
             _("How many commentaries to generate per event"), "N" },
 
         { "calodds", 'O', 0, G_OPTION_ARG_NONE, &calodds,
-            "[developer] Calibrate the betting odds by simulating a lot of matches", NULL },
+            "[developer] Calibrate the betting odds and fit the statistical match"
+            " model by simulating a lot of matches", NULL },
 
         { "num-matches", 'm', 0, G_OPTION_ARG_INT, &num_matches,
             "[developer] How many matches to simulate per skill diff step", "N" },
@@ -165,6 +179,19 @@ main_parse_cl_arguments(gint *argc, gchar ***argv, Bygfoot *bygfoot)
 	    "Seed to initialize random number generator.  Valid values are"
 	    " 32-bit unsigned integers > 0", "N"},
 
+        { "match-threads", 0, 0, G_OPTION_ARG_INT, &match_threads,
+            "How many threads to use for calculating the matches without"
+            " user involvement and updating the CPU teams (default: 1)", "N" },
+
+        { "results-only", 0, 0, G_OPTION_ARG_INT, &results_only,
+            "Which matches without user involvement only keep their result"
+            " and stats: 0 none, 1 those of other countries and those"
+            " without news (default), 2 all", "N" },
+
+        { "sim-mode", 0, 0, G_OPTION_ARG_STRING, &sim_mode,
+            "How to calculate the results-only matches: 'engine' (default)"
+            " or 'statistical' (using the match model fitted with --calodds)", "MODE" },
+
         {NULL}};
 
     if(argc == NULL || argv == NULL)
@@ -189,6 +216,23 @@ main_parse_cl_arguments(gint *argc, gchar ***argv, Bygfoot *bygfoot)
         option_add(&options, "int_opt_calodds_matches", num_matches, NULL);
     }
 
+    if(match_threads > 0)
+        opt_set_int(int_opt_match_threads, match_threads);
+
+    if(results_only >= 0 && results_only < LIVE_GAME_RESULTS_ONLY_END)
+        opt_set_int(int_opt_results_only, results_only);
+
+    if(sim_mode != NULL)
+    {
+        if(strcmp(sim_mode, "statistical") == 0)
+            opt_set_int(int_opt_sim_mode, LIVE_GAME_SIM_MODE_STATISTICAL);
+        else if(strcmp(sim_mode, "engine") == 0)
+            opt_set_int(int_opt_sim_mode, LIVE_GAME_SIM_MODE_ENGINE);
+        else
+            debug_print_message("main_parse_cl_arguments: unknown sim mode '%s'\n", sim_mode);
+        g_free(sim_mode);
+    }
+
     if(testcom)
     {
         lg_commentary_test(testcom_file, token_file, event_name, number_of_passes);
@@ -220,6 +264,8 @@ main_parse_cl_arguments(gint *argc, gchar ***argv, Bygfoot *bygfoot)
 
     if (random_seed)
        g_rand_set_seed(rand_generator, random_seed);
+
+    rand_seed = (random_seed) ? random_seed : g_random_int();
 }
 
 /** Parse the command line arguments given by the user. */
@@ -316,10 +362,13 @@ main_init_variables(Bygfoot *bygfoot)
     transfer_list = g_array_new(FALSE, FALSE, sizeof(Transfer));
     season_stats = g_array_new(FALSE, FALSE, sizeof(SeasonStat));
     name_lists = g_array_new(FALSE, FALSE, sizeof(NameList));
+    name_lists_index = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+    name_pool = g_string_chunk_new(NAME_POOL_CHUNK_SIZE);
     strategies = g_array_new(FALSE, FALSE, sizeof(Strategy));
-    live_games = g_array_new(FALSE, FALSE, sizeof(LiveGame));
+    live_games = g_array_new(FALSE, TRUE, sizeof(LiveGame));
     bets[0] = g_array_new(FALSE, FALSE, sizeof(BetMatch));
     bets[1] = g_array_new(FALSE, FALSE, sizeof(BetMatch));
+    bet_odds_table = g_array_new(FALSE, FALSE, sizeof(BetOddsStep));
     jobs = g_array_new(FALSE, FALSE, sizeof(Job));
     save_file = NULL;
 
@@ -329,6 +378,9 @@ main_init_variables(Bygfoot *bygfoot)
     constants_app.datalist = settings.datalist =
         constants.datalist = options.datalist =
         replacement_tokens.datalist = hints.datalist = NULL;
+    constants_app.ids = settings.ids =
+        constants.ids = options.ids =
+        replacement_tokens.ids = hints.ids = NULL;
 
     selected_row = -1;
 
@@ -344,10 +396,15 @@ main_init_variables(Bygfoot *bygfoot)
 
     file_load_conf_files();
     xml_strategy_load_strategies();
+    match_model_load();
+    bet_load_odds_table();
 
-    language_set(bygfoot, language_get_code_index(opt_str("string_opt_language_code")) + 1);
+    language_set(bygfoot, language_get_code_index(opt_str(string_opt_language_code)) + 1);
 
     option_add(&options, "int_opt_calodds", 0, NULL);
+    option_add(&options, "int_opt_match_threads", 1, NULL);
+    option_add(&options, "int_opt_results_only", LIVE_GAME_RESULTS_ONLY_AUTO, NULL);
+    option_add(&options, "int_opt_sim_mode", LIVE_GAME_SIM_MODE_ENGINE, NULL);
 
     /** Some of these (or all) are disabled (set to 1) in supernational
       country defs. */
@@ -376,6 +433,8 @@ static void validate_country_files(Bygfoot *bygfoot)
         memset(&country, 0, sizeof(country));
         xml_country_read(country_file, &country, bygfoot);
     }
+
+    xml_cache_save();
 }
 
 /**
@@ -397,6 +456,7 @@ main_init(gint *argc, gchar ***argv, Bygfoot *bygfoot)
     GPtrArray *country_files = NULL;
 
     support_directories = NULL;
+    support_files = NULL;
     rand_generator = g_rand_new();
     main_parse_debug_cl_arguments(argc, argv, bygfoot);
 
@@ -428,9 +488,9 @@ main_init(gint *argc, gchar ***argv, Bygfoot *bygfoot)
      * generator, so generate the interest after the seed is set.  This help
      * keeps the value consistent when --seed is used.
      */
-    current_interest = rint(math_rnd(const_float("float_finance_interest_lower"),
-                const_float("float_finance_interest_upper")) /
-            const_float("float_finance_interest_step")) * const_float("float_finance_interest_step");
+    current_interest = rint(math_rnd(const_float(float_finance_interest_lower),
+                const_float(float_finance_interest_upper)) /
+            const_float(float_finance_interest_step)) * const_float(float_finance_interest_step);
 
 }
 
@@ -461,15 +521,26 @@ main (gint argc, gchar *argv[])
     dup2 (fd2, 2);
 #endif
     memset(&cl_args, 0, sizeof(cl_args));
-#ifdef ENABLE_JSON
     main_parse_frontend_backend_cl_arguments(&argc, &argv, &cl_args);
 
-    if (cl_args.json_filename) {
+    if (cl_args.convert_savegame) {
+        bygfoot_init(&bygfoot, BYGFOOT_FRONTEND_CONSOLE);
+        main_init(&argc, &argv, &bygfoot);
+        file_check_home_dir_create_dirs();
+        return load_save_convert_game(&bygfoot, cl_args.convert_savegame) ? 0 : 1;
+    }
+#ifdef ENABLE_JSON
+
+    if (cl_args.json_filename || cl_args.json_server || cl_args.json_socket) {
+        gint exit_code;
         bygfoot_init(&bygfoot, BYGFOOT_FRONTEND_CONSOLE);
         main_init(&argc, &argv, &bygfoot);
         file_check_home_dir_create_dirs();
         validate_country_files(&bygfoot);
-        return bygfoot_json_main(&bygfoot, &cl_args);
+        exit_code = bygfoot_json_main(&bygfoot, &cl_args);
+        /* Keep the team and name definitions read during the game. */
+        xml_cache_save();
+        return exit_code;
     }
 #endif
     bygfoot_init(&bygfoot, BYGFOOT_FRONTEND_GTK2);
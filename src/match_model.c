@@ -0,0 +1,424 @@
+/*
+   match_model.c
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <math.h>
+#include <string.h>
+
+#include "file.h"
+#include "free.h"
+#include "match_model.h"
+#include "maths.h"
+#include "option.h"
+#include "team_struct.h"
+
+/** Team values below this get raised to it so that
+    the logarithms of the ratios stay finite. */
+#define MATCH_MODEL_MIN_VALUE 0.01
+
+/** The number of Newton steps the fit may take at most and
+    the change of the coefficients at which it has converged. */
+#define MATCH_MODEL_FIT_ITERATIONS 50
+#define MATCH_MODEL_FIT_PRECISION 1e-6
+
+/** A small ridge term keeping the fit stable if the
+    features of the observations hardly vary. */
+#define MATCH_MODEL_FIT_RIDGE 1e-3
+
+/** The bisection steps and the upper bound for the fit
+    of the goal difference coefficient. */
+#define MATCH_MODEL_FIT_DIFFERENCE_STEPS 16
+#define MATCH_MODEL_FIT_DIFFERENCE_MAX 2.0
+
+/** Goal differences beyond this don't change the goal rates any further. */
+#define MATCH_MODEL_MAX_DIFFERENCE 2
+
+/** The coefficients of the rates. A rate is the exponential of
+    the sum of the features multiplied by the coefficients.
+    They only change when loading or fitting the model.
+    @see match_model_get_rate() */
+static gfloat match_model_coeffs[MATCH_MODEL_RATE_END][MATCH_MODEL_FEATURE_END];
+
+/** How much the goal rate of a team rises per goal it's behind
+    (and falls per goal it's ahead); the match engine makes trailing
+    teams push forward, which gives more draws than independent
+    goal counts would. @see match_model_draw_goals() */
+static gfloat match_model_difference;
+
+/** The names of the rates and the features in the model file. */
+static const gchar *match_model_rate_names[MATCH_MODEL_RATE_END] =
+{"goals", "shots"};
+static const gchar *match_model_feature_names[MATCH_MODEL_FEATURE_END] =
+{"base", "midfield", "attack", "goalie"};
+static const gchar *match_model_difference_name =
+"float_match_model_goals_difference";
+
+/** Write the name of a coefficient in the model file into the buffer. */
+static void
+match_model_coeff_name(gchar *buf, gint rate, gint feature)
+{
+    sprintf(buf, "float_match_model_%s_%s",
+	    match_model_rate_names[rate], match_model_feature_names[feature]);
+}
+
+/** Load the coefficients of the statistical match model
+    from the model file in the support directories. */
+void
+match_model_load(void)
+{
+#ifdef DEBUG
+    printf("match_model_load\n");
+#endif
+
+    gint i, j;
+    gchar name[SMALL];
+    OptionList model = {NULL, NULL, NULL};
+
+    file_load_opt_file(MATCH_MODEL_FILE, &model, FALSE);
+
+    for(i=0;i<MATCH_MODEL_RATE_END;i++)
+	for(j=0;j<MATCH_MODEL_FEATURE_END;j++)
+	{
+	    match_model_coeff_name(name, i, j);
+	    match_model_coeffs[i][j] = option_float(name, &model);
+	}
+
+    match_model_difference = option_float(match_model_difference_name, &model);
+
+    free_option_list(&model, FALSE);
+}
+
+/** Save the coefficients of the statistical match model.
+    @param filename The full path of the file. */
+void
+match_model_save(const gchar *filename)
+{
+#ifdef DEBUG
+    printf("match_model_save\n");
+#endif
+
+    gint i, j;
+    gchar name[SMALL];
+    OptionList model = {NULL, NULL, NULL};
+
+    for(i=0;i<MATCH_MODEL_RATE_END;i++)
+	for(j=0;j<MATCH_MODEL_FEATURE_END;j++)
+	{
+	    match_model_coeff_name(name, i, j);
+	    option_add(&model, name,
+		       (gint)rint(match_model_coeffs[i][j] * OPTION_FLOAT_DIVISOR), NULL);
+	}
+
+    option_add(&model, match_model_difference_name,
+	       (gint)rint(match_model_difference * OPTION_FLOAT_DIVISOR), NULL);
+
+    file_save_opt_file(filename, &model);
+    free_option_list(&model, FALSE);
+}
+
+/** Fill in the features of a team in a match, using the
+    same team value ratios as the match engine does.
+    @param fix The fixture.
+    @param team_values The team values, including the home advantage.
+    @see game_get_values()
+    @param team The team, 0 or 1.
+    @param features The array of #MatchModelFeature values to fill in. */
+void
+match_model_get_features(const Fixture *fix,
+			 gfloat team_values[][GAME_TEAM_VALUE_END],
+			 gint team, gfloat *features)
+{
+#ifdef DEBUG
+    printf("match_model_get_features\n");
+#endif
+
+    const gfloat *own = team_values[team], *other = team_values[!team];
+    gfloat luck = fix->teams[team]->luck / fix->teams[!team]->luck;
+
+    features[MATCH_MODEL_FEATURE_BASE] = 1;
+    features[MATCH_MODEL_FEATURE_MIDFIELD] =
+	logf(MAX(own[GAME_TEAM_VALUE_MIDFIELD], MATCH_MODEL_MIN_VALUE) * luck /
+	     MAX(other[GAME_TEAM_VALUE_MIDFIELD], MATCH_MODEL_MIN_VALUE));
+    features[MATCH_MODEL_FEATURE_ATTACK] =
+	logf(MAX(own[GAME_TEAM_VALUE_ATTACK], MATCH_MODEL_MIN_VALUE) * luck /
+	     MAX(other[GAME_TEAM_VALUE_DEFEND], MATCH_MODEL_MIN_VALUE));
+    features[MATCH_MODEL_FEATURE_GOALIE] =
+	logf(MAX(own[GAME_TEAM_VALUE_ATTACK], MATCH_MODEL_MIN_VALUE) * luck /
+	     MAX(other[GAME_TEAM_VALUE_GOALIE], MATCH_MODEL_MIN_VALUE));
+}
+
+/** Return the expected number of goals or shots of a team in 90 minutes.
+    @param features The features of the team.
+    @see match_model_get_features()
+    @param rate The #MatchModelRate we want. */
+gfloat
+match_model_get_rate(const gfloat *features, gint rate)
+{
+#ifdef DEBUG
+    printf("match_model_get_rate\n");
+#endif
+
+    gint i;
+    gfloat sum = 0;
+
+    for(i=0;i<MATCH_MODEL_FEATURE_END;i++)
+	sum += match_model_coeffs[rate][i] * features[i];
+
+    return expf(sum);
+}
+
+/** Draw the goals of both teams in a part of a match. The goals come
+    one by one, and after each one the rates change with the goal
+    difference.
+    @param rates The goal rates of the teams (per 90 minutes).
+    @see match_model_get_rate()
+    @param minutes How many minutes the part lasts.
+    @param goals The array of the two goal counts to fill in. */
+void
+match_model_draw_goals(const gfloat *rates, gint minutes, gint *goals)
+{
+#ifdef DEBUG
+    printf("match_model_draw_goals\n");
+#endif
+
+    gint diff;
+    gfloat current[2], time = 0;
+
+    goals[0] = goals[1] = 0;
+
+    while(TRUE)
+    {
+	diff = CLAMP(goals[1] - goals[0],
+		     -MATCH_MODEL_MAX_DIFFERENCE, MATCH_MODEL_MAX_DIFFERENCE);
+	current[0] = rates[0] * expf(match_model_difference * diff) / 90;
+	current[1] = rates[1] * expf(-match_model_difference * diff) / 90;
+
+	if(current[0] + current[1] <= 0)
+	    return;
+
+	/* The waiting time until the next goal. */
+	time -= logf(1 - math_rnd(0, 1)) / (current[0] + current[1]);
+	if(time >= minutes)
+	    return;
+
+	goals[math_rnd(0, current[0] + current[1]) >= current[0]]++;
+    }
+}
+
+/** Solve the linear system given by the augmented matrix
+    with Gauss-Jordan elimination; the solution ends up in
+    the last column.
+    @return FALSE if the matrix is singular. */
+static gboolean
+match_model_solve(gdouble a[][MATCH_MODEL_FEATURE_END + 1])
+{
+    gint i, j, k, pivot;
+    gdouble tmp, factor;
+
+    for(i=0;i<MATCH_MODEL_FEATURE_END;i++)
+    {
+	pivot = i;
+	for(j=i + 1;j<MATCH_MODEL_FEATURE_END;j++)
+	    if(fabs(a[j][i]) > fabs(a[pivot][i]))
+		pivot = j;
+
+	if(fabs(a[pivot][i]) < 1e-12)
+	    return FALSE;
+
+	for(k=0;k<=MATCH_MODEL_FEATURE_END;k++)
+	{
+	    tmp = a[i][k];
+	    a[i][k] = a[pivot][k];
+	    a[pivot][k] = tmp;
+	}
+
+	for(j=0;j<MATCH_MODEL_FEATURE_END;j++)
+	    if(j != i)
+	    {
+		factor = a[j][i] / a[i][i];
+		for(k=i;k<=MATCH_MODEL_FEATURE_END;k++)
+		    a[j][k] -= factor * a[i][k];
+	    }
+    }
+
+    for(i=0;i<MATCH_MODEL_FEATURE_END;i++)
+	a[i][MATCH_MODEL_FEATURE_END] /= a[i][i];
+
+    return TRUE;
+}
+
+/** Fit the coefficients of a rate to observed counts with a Poisson
+    regression (Newton's method on the log-likelihood).
+    @param features The features of the observations,
+    #MATCH_MODEL_FEATURE_END gfloats per observation.
+    @param counts The observed goals or shots, a gint per observation.
+    @param rate The #MatchModelRate we fit.
+    @return TRUE if the fit converged; otherwise the coefficients
+    stay unchanged. */
+gboolean
+match_model_fit(const GArray *features, const GArray *counts, gint rate)
+{
+#ifdef DEBUG
+    printf("match_model_fit\n");
+#endif
+
+    gint i, j, k, iteration;
+    gdouble coeffs[MATCH_MODEL_FEATURE_END],
+	a[MATCH_MODEL_FEATURE_END][MATCH_MODEL_FEATURE_END + 1];
+    gdouble mean = 0, mu, step;
+    const gfloat *x;
+
+    if(counts->len == 0)
+	return FALSE;
+
+    for(i=0;i<counts->len;i++)
+	mean += g_array_index(counts, gint, i);
+    mean /= counts->len;
+
+    /* We start with the same rate for everybody. */
+    memset(coeffs, 0, sizeof(coeffs));
+    coeffs[MATCH_MODEL_FEATURE_BASE] = log(MAX(mean, MATCH_MODEL_MIN_VALUE));
+
+    for(iteration=0;iteration<MATCH_MODEL_FIT_ITERATIONS;iteration++)
+    {
+	memset(a, 0, sizeof(a));
+
+	for(i=0;i<counts->len;i++)
+	{
+	    x = &g_array_index(features, gfloat, i * MATCH_MODEL_FEATURE_END);
+	    mu = 0;
+	    for(j=0;j<MATCH_MODEL_FEATURE_END;j++)
+		mu += coeffs[j] * x[j];
+	    mu = exp(mu);
+
+	    for(j=0;j<MATCH_MODEL_FEATURE_END;j++)
+	    {
+		a[j][MATCH_MODEL_FEATURE_END] +=
+		    x[j] * (g_array_index(counts, gint, i) - mu);
+		for(k=0;k<MATCH_MODEL_FEATURE_END;k++)
+		    a[j][k] += mu * x[j] * x[k];
+	    }
+	}
+
+	for(j=0;j<MATCH_MODEL_FEATURE_END;j++)
+	    a[j][j] += MATCH_MODEL_FIT_RIDGE;
+
+	if(!match_model_solve(a))
+	    return FALSE;
+
+	step = 0;
+	for(j=0;j<MATCH_MODEL_FEATURE_END;j++)
+	{
+	    coeffs[j] += a[j][MATCH_MODEL_FEATURE_END];
+	    step = MAX(step, fabs(a[j][MATCH_MODEL_FEATURE_END]));
+	}
+
+	if(step < MATCH_MODEL_FIT_PRECISION)
+	    break;
+    }
+
+    if(iteration == MATCH_MODEL_FIT_ITERATIONS)
+	return FALSE;
+
+    for(j=0;j<MATCH_MODEL_FEATURE_END;j++)
+	match_model_coeffs[rate][j] = coeffs[j];
+
+    return TRUE;
+}
+
+/** Draw the regular time goals of all observed matches with
+    the current goal difference coefficient.
+    @param features The features of the observations; the
+    two teams of a match are consecutive.
+    @param draws The number of drawn matches to fill in.
+    @return The sum of the goals. */
+static gint
+match_model_draw_observations(const GArray *features, gint *draws)
+{
+    gint i, goals[2], sum = 0;
+    gfloat rates[2];
+
+    *draws = 0;
+
+    for(i=0;(i + 1) * MATCH_MODEL_FEATURE_END < features->len;i+=2)
+    {
+	rates[0] = match_model_get_rate(
+	    &g_array_index(features, gfloat, i * MATCH_MODEL_FEATURE_END),
+	    MATCH_MODEL_RATE_GOALS);
+	rates[1] = match_model_get_rate(
+	    &g_array_index(features, gfloat, (i + 1) * MATCH_MODEL_FEATURE_END),
+	    MATCH_MODEL_RATE_GOALS);
+	match_model_draw_goals(rates, 90, goals);
+
+	*draws += (goals[0] == goals[1]);
+	sum += goals[0] + goals[1];
+    }
+
+    return sum;
+}
+
+/** Fit the goal difference coefficient so that the model gives
+    as many draws as the observed matches, and correct the base
+    of the goal rate for the changed number of goals. The goal
+    rate has to be fitted already.
+    @param features The features of the observations; the
+    two teams of a match are consecutive.
+    @param goals The observed regular time goals.
+    @see match_model_fit(), match_model_draw_goals() */
+void
+match_model_fit_difference(const GArray *features, const GArray *goals)
+{
+#ifdef DEBUG
+    printf("match_model_fit_difference\n");
+#endif
+
+    gint i, draws = 0, simulated_draws, sum = 0, simulated_sum;
+    gfloat lower = 0, upper = MATCH_MODEL_FIT_DIFFERENCE_MAX;
+
+    for(i=0;i + 1 < goals->len;i+=2)
+    {
+	draws += (g_array_index(goals, gint, i) ==
+		  g_array_index(goals, gint, i + 1));
+	sum += g_array_index(goals, gint, i) + g_array_index(goals, gint, i + 1);
+    }
+
+    /* More pushing gives more draws. */
+    for(i=0;i<MATCH_MODEL_FIT_DIFFERENCE_STEPS;i++)
+    {
+	match_model_difference = (lower + upper) / 2;
+	match_model_draw_observations(features, &simulated_draws);
+
+	if(simulated_draws < draws)
+	    lower = match_model_difference;
+	else
+	    upper = match_model_difference;
+    }
+
+    match_model_difference = (lower + upper) / 2;
+    simulated_sum = match_model_draw_observations(features, &simulated_draws);
+
+    if(sum > 0 && simulated_sum > 0)
+	match_model_coeffs[MATCH_MODEL_RATE_GOALS][MATCH_MODEL_FEATURE_BASE] +=
+	    logf((gfloat)sum / (gfloat)simulated_sum);
+}
@@ -0,0 +1,80 @@
+/*
+   match_model.h
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef MATCH_MODEL_H
+#define MATCH_MODEL_H
+
+#include "bygfoot.h"
+#include "live_game_struct.h"
+
+/** The file with the coefficients of the statistical match model.
+    @see debug_fit_match_model() */
+#define MATCH_MODEL_FILE "bygfoot_match_model"
+
+/** The values a rate of the statistical match model depends on.
+    Except for the base they are logarithms of the ratio of a team value
+    of the team to the opposing one of the other team.
+    @see match_model_get_features() */
+enum MatchModelFeature
+{
+    MATCH_MODEL_FEATURE_BASE = 0,
+    MATCH_MODEL_FEATURE_MIDFIELD,
+    MATCH_MODEL_FEATURE_ATTACK,
+    MATCH_MODEL_FEATURE_GOALIE,
+    MATCH_MODEL_FEATURE_END
+};
+
+/** The per-team rates (per 90 minutes) the model predicts. */
+enum MatchModelRate
+{
+    MATCH_MODEL_RATE_GOALS = 0,
+    MATCH_MODEL_RATE_SHOTS,
+    MATCH_MODEL_RATE_END
+};
+
+void
+match_model_load(void);
+
+void
+match_model_save(const gchar *filename);
+
+void
+match_model_get_features(const Fixture *fix,
+			 gfloat team_values[][GAME_TEAM_VALUE_END],
+			 gint team, gfloat *features);
+
+gfloat
+match_model_get_rate(const gfloat *features, gint rate);
+
+void
+match_model_draw_goals(const gfloat *rates, gint minutes, gint *goals);
+
+gboolean
+match_model_fit(const GArray *features, const GArray *counts, gint rate);
+
+void
+match_model_fit_difference(const GArray *features, const GArray *goals);
+
+#endif
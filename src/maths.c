@@ -27,6 +27,144 @@
 #include "misc.h"
 #include "variables.h"
 
+/** The random number stream used by the current thread,
+    or NULL if the global generator should be used. */
+static GPrivate math_rand_current = G_PRIVATE_INIT(NULL);
+
+/** The gauss generator state going with the global generator. */
+static MathRand math_rand_global;
+
+/** The SplitMix64 finalizer; scrambles the bits of the value. */
+static guint64
+math_rand_mix(guint64 value)
+{
+    value = (value ^ (value >> 30)) * G_GUINT64_CONSTANT(0xbf58476d1ce4e5b9);
+    value = (value ^ (value >> 27)) * G_GUINT64_CONSTANT(0x94d049bb133111eb);
+
+    return value ^ (value >> 31);
+}
+
+/** Compute the key of a random number stream.
+    The key depends only on the arguments, so a fixture always
+    gets the same random numbers for a given seed, no matter
+    in which order the fixtures are calculated.
+    @param seed The random seed of the game.
+    @param season The season.
+    @param week The week.
+    @param week_round The week round.
+    @param clid The id of the league or cup.
+    @param id The id of the fixture (or whatever the stream is for). */
+guint64
+math_rand_key(guint32 seed, gint season, gint week, gint week_round,
+	      gint clid, gint id)
+{
+#ifdef DEBUG
+    printf("math_rand_key\n");
+#endif
+
+    gint i;
+    gint values[5] = {season, week, week_round, clid, id};
+    guint64 key = math_rand_mix((guint64)seed);
+
+    for(i=0;i<5;i++)
+	key = math_rand_mix(key ^ (guint32)values[i]);
+
+    return key;
+}
+
+/** Create a new random number stream.
+    @param key The key of the stream. @see math_rand_key() */
+MathRand*
+math_rand_new(guint64 key)
+{
+#ifdef DEBUG
+    printf("math_rand_new\n");
+#endif
+
+    MathRand *stream = g_malloc0(sizeof(MathRand));
+
+    stream->key = key;
+
+    return stream;
+}
+
+/** Free a random number stream. */
+void
+math_rand_free(MathRand *stream)
+{
+#ifdef DEBUG
+    printf("math_rand_free\n");
+#endif
+
+    g_free(stream);
+}
+
+/** Make the calling thread draw its random numbers
+    from the given stream.
+    @param stream The stream to use, or NULL to go back
+    to the global generator. */
+void
+math_rand_set_current(MathRand *stream)
+{
+    g_private_set(&math_rand_current, stream);
+}
+
+/** Return the stream the calling thread draws its
+    random numbers from, or NULL for the global generator. */
+MathRand*
+math_rand_get_current(void)
+{
+    return g_private_get(&math_rand_current);
+}
+
+/** Return the next number of the stream, uniformly
+    distributed in [0,1), or the next number of the
+    global generator if the stream is NULL. */
+static gdouble
+math_rand_uniform(MathRand *stream)
+{
+    if(stream == NULL)
+	return g_rand_double(rand_generator);
+
+    stream->counter++;
+
+    /* The upper 53 bits make up the mantissa. */
+    return (gdouble)(math_rand_mix(stream->key + 
+				   stream->counter * G_GUINT64_CONSTANT(0x9e3779b97f4a7c15)) >> 11) *
+	(1.0 / 9007199254740992.0);
+}
+
+/** Return a random number in [lower,upper) from the stream
+    of the calling thread.
+    @see math_rnd() */
+gdouble
+math_rand_double_range(gdouble lower, gdouble upper)
+{
+    MathRand *stream = g_private_get(&math_rand_current);
+
+    if(stream == NULL)
+	return g_rand_double_range(rand_generator, lower, upper);
+
+    return lower + (upper - lower) * math_rand_uniform(stream);
+}
+
+/** Return a random integer in [begin,end) from the stream
+    of the calling thread.
+    @see math_rndi() */
+gint
+math_rand_int_range(gint begin, gint end)
+{
+    MathRand *stream = g_private_get(&math_rand_current);
+    gint value;
+
+    if(stream == NULL)
+	return g_rand_int_range(rand_generator, begin, end);
+
+    value = begin + (gint)floor((gdouble)(end - begin) * math_rand_uniform(stream));
+
+    return MIN(value, end - 1);
+}
+
 /**
    Generate a Gauss-distributed (pseudo)random number.
    "By Box and Muller, and recommended by Knuth".
@@ -39,25 +177,25 @@ math_gaussrand(void)
     printf("math_gaussrand\n");
 #endif
 
-    static gdouble V1, V2, S;
-    static gint phase = 0;
+    MathRand *stream = g_private_get(&math_rand_current);
+    MathRand *state = (stream == NULL) ? &math_rand_global : stream;
     gdouble X;
 
-    if(phase == 0) {
+    if(state->phase == 0) {
 	do {
-	    gdouble U1 = g_rand_double(rand_generator);
-	    gdouble U2 = g_rand_double(rand_generator);
+	    gdouble U1 = math_rand_uniform(stream);
+	    gdouble U2 = math_rand_uniform(stream);
 
-	    V1 = 2 * U1 - 1;
-	    V2 = 2 * U2 - 1;
-	    S = V1 * V1 + V2 * V2;
-	} while(S >= 1 || S == 0);
+	    state->V1 = 2 * U1 - 1;
+	    state->V2 = 2 * U2 - 1;
+	    state->S = state->V1 * state->V1 + state->V2 * state->V2;
+	} while(state->S >= 1 || state->S == 0);
 
-	X = V1 * sqrt(-2 * log(S) / S);
+	X = state->V1 * sqrt(-2 * log(state->S) / state->S);
     } else
-	X = V2 * sqrt(-2 * log(S) / S);
+	X = state->V2 * sqrt(-2 * log(state->S) / state->S);
 
-    phase = 1 - phase;
+    state->phase = 1 - state->phase;
 
     return X;
 }
@@ -94,6 +232,31 @@ math_gauss_dist(gdouble lower, gdouble upper)
     return result;
 }
 
+/**
+   Generate a Poisson-distributed random number with Knuth's
+   multiplication method; fine for the small means we need.
+   @param mean The expectation value of the distribution.
+   @return A non-negative integer.
+*/
+gint
+math_poisson(gdouble mean)
+{
+#ifdef DEBUG
+    printf("math_poisson\n");
+#endif
+
+    gint result = -1;
+    gdouble limit = exp(-mean), product = 1;
+
+    do
+    {
+	result++;
+	product *= math_rnd(0, 1);
+    } while(product > limit);
+
+    return result;
+}
+
 /**
    Get a certain part of an integer number.
 
@@ -29,20 +29,46 @@
 #include <math.h>
 
 #include "bygfoot.h"
+#include "maths_struct.h"
 
 /**
    Macros for random number generation.
 */
-#define math_rnd(lower,upper) g_rand_double_range(rand_generator, lower, upper)
-#define math_rndi(lower,upper) g_rand_int_range(rand_generator, lower, upper + 1)
+#define math_rnd(lower,upper) math_rand_double_range(lower, upper)
+#define math_rndi(lower,upper) math_rand_int_range(lower, upper + 1)
 #define math_gauss_disti(lower, upper) ((gint)rint( math_gauss_dist((gfloat)lower - 0.499, (gfloat)upper + 0.499)))
 
+guint64
+math_rand_key(guint32 seed, gint season, gint week, gint week_round,
+	      gint clid, gint id);
+
+MathRand*
+math_rand_new(guint64 key);
+
+void
+math_rand_free(MathRand *stream);
+
+void
+math_rand_set_current(MathRand *stream);
+
+MathRand*
+math_rand_get_current(void);
+
+gdouble
+math_rand_double_range(gdouble lower, gdouble upper);
+
+gint
+math_rand_int_range(gint begin, gint end);
+
 gdouble
 math_gaussrand(void);
 
 gdouble
 math_gauss_dist(gdouble lower, gdouble upper);
 
+gint
+math_poisson(gdouble mean);
+
 gint
 math_get_place(gint value, gint place);
 
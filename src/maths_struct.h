@@ -0,0 +1,49 @@
+/*
+   maths_struct.h
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef MATHS_STRUCT_H
+#define MATHS_STRUCT_H
+
+#include "bygfoot.h"
+
+/** A counter-based stream of random numbers. The n-th number
+    of a stream only depends on the key and on n, so a stream
+    gives the same numbers no matter which thread uses it or
+    when. We also keep the state of the Box-Muller gauss
+    generator so that streams used in parallel don't interfere.
+    @see math_rand_key(), math_gaussrand() */
+typedef struct
+{
+    /** The key identifying the stream. */
+    guint64 key;
+    /** How many numbers have been drawn from the stream. */
+    guint64 counter;
+    /** Cached values of the gauss generator. */
+    gdouble V1, V2, S;
+    /** Whether there's a cached gauss value, 0 or 1. */
+    gint phase;
+} MathRand;
+
+#endif
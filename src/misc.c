@@ -583,19 +583,6 @@ misc_string_assign(gchar **string, const gchar *contents)
     *string = g_strdup(contents);
 }
 
-/** Choose one of strings separated with '|' */
-void
-misc_string_choose_random(gchar *string)
-{
-   gint count = 1;
-   gchar **array;
-   
-   array = g_strsplit(string, "|", -1);
-   count = g_strv_length(array);
-   count = math_rndi(0, count - 1);
-   strcpy(string, array[count]);
-}
-
 /** Replace a token in a string by another string. 
     The replacement should NOT CONTAIN THE TOKEN otherwise
     we end up in an infinite loop. */
@@ -620,214 +607,6 @@ misc_string_replace_token(gchar *string, const gchar *token, const gchar *replac
     }
 }
 
-/** Replace simple arithmetic expressions like "1 + 2"
-    and comparisons like "3 < 4" with the appropriate result. */
-void
-misc_string_replace_expressions(gchar *string)
-{
-    gint i, j, last_idx = 0;
-    gint value = -1;
-    gchar buf[SMALL], buf2[SMALL];
-    gchar *occurrence = NULL,
-	*occurrence2 = NULL;
-
-    if(debug > 200)
-	g_print("misc_string_replace_expressions: #%s#\n",
-		string);
-
-    while(g_strrstr(string, "[") != NULL)
-    {
-	strcpy(buf, string);
-	strcpy(string, "");
-
-	occurrence = g_strrstr(buf, "[");
-	i = strlen(buf) - strlen(occurrence);
-
-	strncpy(buf2, buf, i);
-	buf2[i] = '\0';
-	strcat(string, buf2);	
-
-	occurrence2 = g_strstr_len(occurrence, strlen(occurrence), "]");
-
-	if(occurrence2 == NULL)
-	{
-	    debug_print_message("misc_string_replace_expressions: no matching ] found.");
-	    return;
-	}
-
-	j = strlen(buf) - strlen(occurrence2);
-	
-	strncpy(buf2, buf + i + 1, j - i - 1);
-	buf2[j - i - 1] = '\0';
-	if (g_strrstr(buf2, "|"))
-	    misc_string_choose_random(buf2);
-	else 
-	{
-	    if(g_strrstr(buf2, "<") ||
-	       g_strrstr(buf2, ">") ||
-	       g_strrstr(buf2, "=") ||
-	       g_strrstr(buf2, " G ") ||
-	       g_strrstr(buf2, " L ") ||
-	       g_strrstr(buf2, " GE ") ||
-	       g_strrstr(buf2, " LE "))
-		misc_parse(buf2, &value);
-	    else
-		misc_parse_expression(buf2, &value);
-	    sprintf(buf2, "%d", value);
-	}
-	strcat(string, buf2);
-	value = -1;
-
-	last_idx = j + 1;
-
-	if(last_idx < strlen(buf))
-	{
-	    strncpy(buf2, buf + last_idx, strlen(buf) - last_idx);
-	    buf2[strlen(buf) - last_idx] = '\0';
-	    strcat(string, buf2);
-	}
-    }
-}
-
-/** Try to replace all special tokens in the string and write the result to dest.
-    @param string The string containing tokens.
-    @param token_rep The arrays with the tokens and replacements.
-    @return TRUE if we could replace all tokens and the commentary condition
-    was fulfilled, FALSE otherwise. */
-void
-misc_string_replace_tokens(gchar *string, GPtrArray **token_rep)
-{
-    gint i;
-
-    for(i=0;i<token_rep[0]->len;i++)
-	if(g_strrstr(string, 
-		     (gchar*)g_ptr_array_index(token_rep[0], i)))
-	    misc_string_replace_token(string, 
-				      (gchar*)g_ptr_array_index(token_rep[0], i),
-				      (gchar*)g_ptr_array_index(token_rep[1], i));
-}
-
-/** Replace the portion 'paren' plus parentheses in the string. */
-void
-misc_string_replace_parenthesised(gchar *string, const gchar *paren, 
-				  const gchar *replacement)
-{
-    gchar buf[SMALL];
-
-    sprintf(buf, "(%s)", paren);
-
-    misc_string_replace_token(string, buf, replacement);
-}
-
-/** Find the innermost parenthesised portion of the string
-    and write it into the dest string. */
-void
-misc_string_get_parenthesised(const gchar *string, gchar *dest)
-{
-    const gchar *openpar = g_strrstr(string, "(");
-    const gchar *closepar = g_strstr_len(string, strlen(string), ")");
-    gint len = strlen(openpar) - strlen(closepar) - 1;
-
-    strncpy(dest, openpar + 1, len);
-    dest[len] = '\0';
-}
-
-/** Find out whether the conditions in the string are fulfilled. */
-gboolean
-misc_parse_condition(const gchar *condition, GPtrArray **token_rep)
-{
-    gboolean return_value = FALSE;
-    gchar buf[SMALL], buf2[SMALL];
-
-    strcpy(buf, condition);
-
-    while(g_strrstr(buf, "("))
-    {
-	misc_string_get_parenthesised(buf, buf2);
-
-	if(misc_parse_condition(buf2, token_rep))
-	    misc_string_replace_parenthesised(buf, buf2, "1 = 1");
-	else
-	    misc_string_replace_parenthesised(buf, buf2, "1 = 2");
-    }
-
-    do
-    {
-	strcpy(buf2, buf);
-	misc_string_replace_tokens(buf, token_rep);
-	misc_string_replace_expressions(buf);
-    }
-    while(strcmp(buf2, buf) != 0);
-
-    if(g_strrstr(buf, "_") != NULL)
-	return FALSE;
-
-    misc_parse(buf, &return_value);
-
-    return return_value;
-}
-
-/** Add a replacement rule to the token array.
-    The string should be in allocated as it will
-    get freed later. */
-void
-misc_token_add(GPtrArray **token_rep, gint token_idx, 
-	       gchar *replacement)
-{
-    g_ptr_array_add(token_rep[0], 
-		    (gpointer)g_strdup(g_array_index(replacement_tokens.list, Option, token_idx).string_value));
-    g_ptr_array_add(token_rep[1], (gpointer)replacement);
-}
-
-/** Add a 0 or 1 as a token to the token array. */
-void
-misc_token_add_bool(GPtrArray **token_rep, gint token_idx, 
-                    gboolean value)
-{
-    g_ptr_array_add(token_rep[0], 
-		    (gpointer)g_strdup(g_array_index(replacement_tokens.list, Option, token_idx).string_value));
-    g_ptr_array_add(token_rep[1], misc_int_to_char(value));
-}
-
-/** Remove the replacement rule given by the index. */
-void
-misc_token_remove(GPtrArray **token_rep, gint idx)
-{ 
-    gint i;
-
-    for(i=token_rep[0]->len - 1; i >= 0; i--)
-	if(strcmp((gchar*)g_ptr_array_index(token_rep[0], i),
-		  g_array_index(replacement_tokens.list, Option, idx).string_value) == 0)
-	{
-	    g_free(g_ptr_array_index(token_rep[0], i));
-	    g_free(g_ptr_array_index(token_rep[1], i));
-	    
-	    g_ptr_array_remove_index_fast(token_rep[0], i);
-	    g_ptr_array_remove_index_fast(token_rep[1], i);
-	}    
-}
-
-/** Try to replace all tokens in the given text and write the result
-    into the dest variable. */
-gboolean
-misc_string_replace_all_tokens(GPtrArray **token_rep,
-                               const gchar *text_tokens, gchar *dest)
-{
-    gchar buf[SMALL];
-
-    strcpy(dest, text_tokens);
-    
-    do
-    {
-	strcpy(buf, dest);
-	misc_string_replace_tokens(dest, token_rep);
-	misc_string_replace_expressions(dest);
-    }
-    while(strcmp(buf, dest) != 0);
-
-    return (g_strrstr(dest, "_") == NULL);
-}
-
 /* Alphabetic compare function. */
 gint
 misc_alphabetic_compare(gconstpointer a, gconstpointer b)
@@ -868,26 +647,6 @@ misc_alphabetic_compare(gconstpointer a, gconstpointer b)
     return 0;
 }
 
-static gboolean
-misc_condition_evaluate_var(const StratCondPart *var, GArray *operands, GArray *token_rep)
-{
-    const StratTokenValue *token_value;
-    gint token = GPOINTER_TO_INT(var->value);
-    /* I think it would be good to warn here that the variable was not found,
-     * however the the previous implementation considered the whole condition
-     * to be FALSE when a variable was not found, so for now we need to
-     * replicate the behavior.
-     */
-    if (token == REP_TOKEN_LAST) {
-        return FALSE;
-    }
-    token_value = &g_array_index(token_rep, StratTokenValue, token);
-    if (!token_value->initialized)
-        return FALSE;
-    g_array_append_val(operands, token_value->value);
-    return TRUE;
-}
-
 static gboolean
 misc_parse_condition_is_binary_op(const StratCondPart *part)
 {
@@ -922,51 +681,6 @@ misc_parse_condition_is_compare_op(const StratCondPart *part)
     }
 }
 
-static gboolean
-misc_condition_evaluate(const StratCondPart *operation, GArray *operands)
-{
-    gint op0, op1, result;
-    if (operands->len < 2)
-        return FALSE;
-
-    op0 = g_array_index(operands, gint, operands->len - 2);
-    op1 = g_array_index(operands, gint, operands->len - 1);
-
-    switch (operation->token) {
-    default:
-        g_critical("Unknown token: %d\n", operation->token);
-        return FALSE;
-    case STRAT_COND_EQ:
-        result = op0 == op1;
-        break;
-    case STRAT_COND_NE:
-        result = op0 != op1;
-        break;
-    case STRAT_COND_GT:
-        result = op0 > op1;
-        break;
-    case STRAT_COND_GE:
-        result = op0 >= op1;
-        break;
-    case STRAT_COND_LT:
-        result = op0 < op1;
-        break;
-    case STRAT_COND_LE:
-        result = op0 <= op1;
-        break;
-    case STRAT_COND_AND:
-        result = op0 && op1;
-        break;
-    case STRAT_COND_OR:
-        result = op0 || op1;
-        break;
-    }
-
-    g_array_remove_range(operands, operands->len - 2, 2);
-    g_array_append_val(operands, result);
-    return TRUE;
-}
-
 static const StratCondPart *
 misc_parse_value_expression(GArray *stack, const StratCondPart *input)
 {
@@ -1033,9 +747,56 @@ misc_parse_paren_expression(GArray *stack, const StratCondPart *input)
     return misc_parse_or_expression(stack, input);
 }
 
+/**
+ * Turn the postfix stack of the parser into the instructions
+ * strategy_check_condition() runs. Operators that lack an operand
+ * can never do anything, so they are left out, and a condition with
+ * an unknown token is never fulfilled, so it gets no instructions.
+ */
+static StratCondition *
+misc_compile_condition(const gchar *condition, const GArray *stack)
+{
+    StratCondition *compiled = g_new(StratCondition, 1);
+    gint i, depth = 0;
+
+    compiled->code = g_new(gint, 2 * stack->len);
+    compiled->len = 0;
+
+    for (i = 0; i < stack->len; i++) {
+        const StratCondPart *part = &g_array_index(stack, StratCondPart, i);
+        gint value = GPOINTER_TO_INT(part->value);
+
+        if (misc_parse_condition_is_binary_op(part)) {
+            if (depth < 2)
+                continue;
+            compiled->code[compiled->len++] = part->token;
+            depth--;
+            continue;
+        }
+
+        if (part->token == STRAT_COND_VAR && value == REP_TOKEN_LAST) {
+            compiled->len = 0;
+            break;
+        }
+
+        if (depth == STRAT_COND_STACK_SIZE) {
+            g_critical("Strategy condition %s needs more than %d operands\n",
+                       condition, STRAT_COND_STACK_SIZE);
+            g_free(compiled->code);
+            g_free(compiled);
+            return NULL;
+        }
+        compiled->code[compiled->len++] = part->token;
+        compiled->code[compiled->len++] = value;
+        depth++;
+    }
+
+    return compiled;
+}
+
 /**
  * This functions parses a condition into a stack of operations in postfix
- * notation, where the operands preceeded the operation.
+ * notation, where the operands preceeded the operation, and compiles it.
  * Lexer Tokens:
  *
  * TOKEN = COND | INT | VARIABLE | LOGIC_OP | OPEN_PAREN | CLOSE_PAREN
@@ -1069,7 +830,7 @@ misc_parse_paren_expression(GArray *stack, const StratCondPart *input)
  * <Value Expression> ::= int
  *                      | variable
  */
-GArray *
+StratCondition *
 misc_parse_condition_fast(const gchar *condition)
 {
     GError *error = NULL;
@@ -1080,6 +841,7 @@ misc_parse_condition_fast(const gchar *condition)
     GArray *tokens = g_array_new(TRUE, FALSE, sizeof(StratCondPart));
     GMatchInfo *match_info = NULL;
     GArray *stack;
+    StratCondition *compiled = NULL;
 
     /* Lexer */
 
@@ -1217,53 +979,17 @@ lexer_done:
 
     /* Parser */
     stack = g_array_new(FALSE, FALSE, sizeof(StratCondPart));
-    if (!misc_parse_paren_expression(stack, (StratCondPart*)tokens->data)) {
+    if (!misc_parse_paren_expression(stack, (StratCondPart*)tokens->data))
     	g_critical("Failed to parse strategy condiiton %s\n", condition);
-        g_array_unref(stack);
-        stack = NULL;
-    }
+    else
+        compiled = misc_compile_condition(condition, stack);
 
+    g_array_unref(stack);
     g_array_unref(tokens);
-    return stack;
+    return compiled;
 }
 
 
-
-gboolean
-misc_evaluate_condition(const GArray *condition, GArray *token_rep)
-{
-    GArray *operands = g_array_new(FALSE, FALSE, sizeof(gint));
-    gboolean result = FALSE;
-    gint i;
-    /* Execute the stack. */
-    for (i = 0; i < condition->len; i++) {
-        const StratCondPart *part = &g_array_index(condition, StratCondPart, i);
-        switch (part->token) {
-        case STRAT_COND_VAR:
-            if (!misc_condition_evaluate_var(part, operands, token_rep)) {
-                /* In order to match the behavior of the previous
-                 * implementation, we need to return FALSE if we
-                 * failed to replace a variable. */
-                goto done;
-            }
-	    break;
-        case STRAT_COND_INT: {
-	    int value = GPOINTER_TO_INT(part->value);
-            g_array_append_val(operands, value);
-            break;
-	}
-        default:
-            misc_condition_evaluate(part, operands);
-            break;
-        }
-    }
-
-    result = g_array_index(operands, gint, 0);
-done:
-    g_array_free(operands, TRUE);
-    return result;
-}
-
 struct replacement_token_value {
     const char *token;
     enum ReplacementToken value;
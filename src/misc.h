@@ -27,6 +27,7 @@
 #define MISC_H
 
 #include "bygfoot.h"
+#include "strategy_struct.h"
 
 /* Max amount of bytes written to bu by misc_print_grouped_int. */
 #define GROUPED_INT_SIZE 64 
@@ -113,49 +114,12 @@ misc_g_ptr_array_insert(GPtrArray *array, gint _index, gpointer data);
 void
 misc_string_assign(gchar **string, const gchar *contents);
 
-void
-misc_string_choose_random(gchar *string);
-
-void
-misc_string_replace_expressions(gchar *string);
-
-void
-misc_string_replace_tokens(gchar *string, GPtrArray **token_rep);
-
-gboolean
-misc_parse_condition(const gchar *condition, GPtrArray **token_rep);
-
-void
-misc_token_add(GPtrArray **token_rep, gint token_idx, 
-	       gchar *replacement);
-
-void
-misc_token_remove(GPtrArray **token_rep, gint idx);
-
-void
-misc_string_get_parenthesised(const gchar *string, gchar *dest);
-
-void
-misc_string_replace_parenthesised(gchar *string, const gchar *paren, 
-				  const gchar *replacement);
-
-gboolean
-misc_string_replace_all_tokens(GPtrArray **token_rep,
-                               const gchar *text_tokens, gchar *dest);
-
-void
-misc_token_add_bool(GPtrArray **token_rep, gint token_idx, 
-                    gboolean value);
-
 gint
 misc_alphabetic_compare(gconstpointer a, gconstpointer b);
 
-GArray *
+StratCondition *
 misc_parse_condition_fast(const gchar *condition);
 
-gboolean
-misc_evaluate_condition(const GArray *condition, GArray *token_rep);
-
 enum ReplacementToken
 misc_parse_replacement_token(const char *token, gint len);
 
@@ -55,7 +55,7 @@ misc2_callback_transfer_user_player(void)
 
     Team *new_team = transoff(stat2, 0).tm;
 
-    if (current_user.tm->players->len - 1 < const_int("int_team_min_players"))
+    if (current_user.tm->players->len - 1 < const_int(int_team_min_players))
     {
     	game_gui_show_warning(_("Your team can't have less than 11 players."));
     }
@@ -63,7 +63,7 @@ misc2_callback_transfer_user_player(void)
     {
 	    if(team_is_user(new_team) != -1)
     	{
-			if((new_team->players->len < const_int("int_team_max_players")) &&
+			if((new_team->players->len < const_int(int_team_max_players)) &&
 			   (BUDGET(team_is_user(new_team)) >= transoff(stat2, 0).fee))
 			{
 		    	current_user.money += transoff(stat2, 0).fee;
@@ -73,14 +73,14 @@ misc2_callback_transfer_user_player(void)
 				transoff(stat2, 0).fee;
 
 		    	if(player_of_id_team(trans(stat2).tm, trans(stat2).id)->id ==
-			       opt_user_int("int_opt_user_penalty_shooter"))
-				opt_user_set_int("int_opt_user_penalty_shooter", -1);
+			       opt_user_int(int_opt_user_penalty_shooter))
+				opt_user_set_int(int_opt_user_penalty_shooter, -1);
 
 			    player_copy(player_of_id_team(trans(stat2).tm, trans(stat2).id),
 					new_team, new_team->players->len);
 		    	player_of_idx_team(new_team, new_team->players->len - 1)->contract = 
-				(gfloat)math_rndi(const_int("int_transfer_contract_lower"),
-						  const_int("int_transfer_contract_upper"));
+				(gfloat)math_rndi(const_int(int_transfer_contract_lower),
+						  const_int(int_transfer_contract_upper));
 	    		player_of_idx_team(new_team, new_team->players->len - 1)->wage = 
 				transoff(stat2, 0).wage;
 			    g_array_remove_index(current_user.tm->players, 
@@ -121,7 +121,7 @@ misc2_callback_transfer_cpu_player(Bygfoot *bygfoot)
     printf("misc2_callback_transfer_cpu_player\n");
 #endif
 
-    if(current_user.tm->players->len > const_int("int_team_max_players") ||
+    if(current_user.tm->players->len > const_int(int_team_max_players) ||
        BUDGET(cur_user) < transoff(stat2, 0).fee)
     {
 	game_gui_show_warning(_("Your player roster is full or you don't enough money."));
@@ -131,8 +131,8 @@ misc2_callback_transfer_cpu_player(Bygfoot *bygfoot)
     player_copy(player_of_id_team(trans(stat2).tm, trans(stat2).id),
 		current_user.tm, current_user.tm->players->len);
     player_of_idx_team(current_user.tm, current_user.tm->players->len - 1)->contract =
-	(gfloat)math_rndi(const_int("int_transfer_contract_lower"),
-			  const_int("int_transfer_contract_upper"));
+	(gfloat)math_rndi(const_int(int_transfer_contract_lower),
+			  const_int(int_transfer_contract_upper));
     player_of_idx_team(current_user.tm, current_user.tm->players->len - 1)->wage =
 	transoff(stat2, 0).wage;
     user_from_team(current_user.tm)->money -= transoff(stat2, 0).fee;
@@ -205,7 +205,7 @@ misc2_callback_contract_offer(void)
 	    value = gtk_spin_button_get_value_as_int(spinbutton);
 
 	    if(value >= (gint)rint((gfloat)stat1 * 
-				   (1 + (i * const_float("float_contract_scale_factor") *
+				   (1 + (i * const_float(float_contract_scale_factor) *
 					 powf(-1, (pl->age > pl->peak_age))))))
 	    {
 		pl->contract += (i + 1);
@@ -217,10 +217,10 @@ misc2_callback_contract_offer(void)
 	    else
 	    {
 		pl->offers++;
-		if(pl->offers < const_int("int_contract_max_offers"))
+		if(pl->offers < const_int(int_contract_max_offers))
 		    game_gui_show_warning(_("%s rejects your offer. You may still make %d offers."), 
 					  pl->name, 
-					  const_int("int_contract_max_offers") - pl->offers);
+					  const_int(int_contract_max_offers) - pl->offers);
 		else
 		{
 		    game_gui_show_warning(_("%s rejects your offer and won't negotiate with you anymore. You should sell him before his contract expires (he'll simply leave your team otherwise)."), 
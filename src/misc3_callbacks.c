@@ -76,8 +76,8 @@ on_checkbutton_bet_all_leagues_button_press_event
     printf("on_checkbutton_bet_all_leagues_button_press_event\n");
 #endif
 
-    opt_user_set_int("int_opt_user_bet_show_all_leagues",
-		     !opt_user_int("int_opt_user_bet_show_all_leagues"));
+    opt_user_set_int(int_opt_user_bet_show_all_leagues,
+		     !opt_user_int(int_opt_user_bet_show_all_leagues));
 
     treeview2_show_bets();
 
@@ -95,8 +95,8 @@ on_checkbutton_bet_cups_button_press_event
     printf("on_checkbutton_bet_cups_button_press_event\n");
 #endif
 
-    opt_user_set_int("int_opt_user_bet_show_cups",
-		     !opt_user_int("int_opt_user_bet_show_cups"));
+    opt_user_set_int(int_opt_user_bet_show_cups,
+		     !opt_user_int(int_opt_user_bet_show_cups));
 
     treeview2_show_bets();
 
@@ -163,9 +163,9 @@ on_treeview_bets_button_press_event    (GtkWidget       *widget,
     window_show_digits(buf, _("Wager"), 0, NULL, -1, FALSE, bygfoot);
     spin_wager = GTK_SPIN_BUTTON(lookup_widget(window.digits, "spinbutton1"));
     gtk_spin_button_set_range(spin_wager, 0,
-			      (gdouble)const_int("int_bet_wager_max"));
+			      (gdouble)const_int(int_bet_wager_max));
     gtk_spin_button_set_value(spin_wager,
-			      (gdouble)opt_user_int("int_opt_user_bet_default_wager"));
+			      (gdouble)opt_user_int(int_opt_user_bet_default_wager));
 
     return TRUE;
 }
@@ -181,8 +181,8 @@ on_checkbutton_bet_user_recent_button_press_event
     printf("on_checkbutton_bet_user_recent_button_press_event\n");
 #endif
 
-    opt_user_set_int("int_opt_user_bet_show_my_recent",
-		     !opt_user_int("int_opt_user_bet_show_my_recent"));
+    opt_user_set_int(int_opt_user_bet_show_my_recent,
+		     !opt_user_int(int_opt_user_bet_show_my_recent));
 
     treeview2_show_bets();
 
@@ -91,19 +91,19 @@ misc_callback_start_game(Bygfoot *bygfoot)
 /*     option_add(&options, "int_opt_randomise_teams", 0, NULL); */
 
     if(gtk_toggle_button_get_active(checkbutton_randomise_teams))
-	opt_set_int("int_opt_randomise_teams", 1);
+	opt_set_int(int_opt_randomise_teams, 1);
 
     if(gtk_toggle_button_get_active(radio_load))
-	opt_set_int("int_opt_load_defs", 1);
+	opt_set_int(int_opt_load_defs, 1);
     else if(gtk_toggle_button_get_active(radio_names))
-	opt_set_int("int_opt_load_defs", 2);
+	opt_set_int(int_opt_load_defs, 2);
     else
-	opt_set_int("int_opt_load_defs", 0);
+	opt_set_int(int_opt_load_defs, 0);
 
     window_destroy(&window.startup);
     file_store_text_in_saves("last_country", country.sid);
 
-    if(!opt_int("int_opt_calodds"))
+    if(!opt_int(int_opt_calodds))
     {
         bygfoot_start_game(bygfoot);
 
@@ -122,8 +122,10 @@ misc_callback_start_game(Bygfoot *bygfoot)
     {
        start_new_game(bygfoot);
 	free_users(TRUE);
-	debug_calibrate_betting_odds(opt_int("int_opt_calodds_skilldiffmax"),
-				     opt_int("int_opt_calodds_matches"), bygfoot);
+	debug_fit_match_model((opt_int(int_opt_calodds_skilldiffmax) + 1) *
+			      opt_int(int_opt_calodds_matches), bygfoot);
+	debug_calibrate_betting_odds(opt_int(int_opt_calodds_skilldiffmax),
+				     opt_int(int_opt_calodds_matches), bygfoot);
 	main_exit_program(EXIT_OK, NULL);
     }
 }
@@ -139,7 +139,7 @@ on_button_font_sel_apply_clicked       (GtkButton       *button,
 
     if(font != NULL)
     {
-	opt_set_str("string_opt_font_name", font);
+	opt_set_str(string_opt_font_name, font);
 	gtk_entry_set_text(GTK_ENTRY(lookup_widget(window.options, "entry_font_name")), font);
 	g_free(font);
 
@@ -402,17 +402,17 @@ on_spinbutton_speed_button_press_event (GtkWidget       *widget,
     if(event->button == 3)
     {
 	if(option_int("int_opt_user_live_game_speed", &usr(stat2).options) == 
-	   -rint((gfloat)(const_int("int_game_gui_live_game_speed_max") - 10) /
-		 (gfloat)(const_int("int_game_gui_live_game_speed_grad"))))
+	   -rint((gfloat)(const_int(int_game_gui_live_game_speed_max) - 10) /
+		 (gfloat)(const_int(int_game_gui_live_game_speed_grad))))
 	    option_set_int("int_opt_user_live_game_speed", &usr(stat2).options, 0);
 	else if(option_int("int_opt_user_live_game_speed", &usr(stat2).options) == 0)
 	    option_set_int("int_opt_user_live_game_speed", &usr(stat2).options, 
-			   -rint((gfloat)(const_int("int_game_gui_live_game_speed_max") - 10) /
-				 (gfloat)(const_int("int_game_gui_live_game_speed_grad") * 2)));
+			   -rint((gfloat)(const_int(int_game_gui_live_game_speed_max) - 10) /
+				 (gfloat)(const_int(int_game_gui_live_game_speed_grad) * 2)));
 	else
 	    option_set_int("int_opt_user_live_game_speed", &usr(stat2).options, 
-			   -rint((gfloat)(const_int("int_game_gui_live_game_speed_max") - 10) /
-				 (gfloat)(const_int("int_game_gui_live_game_speed_grad"))));
+			   -rint((gfloat)(const_int(int_game_gui_live_game_speed_max) - 10) /
+				 (gfloat)(const_int(int_game_gui_live_game_speed_grad))));
 
 	gtk_spin_button_set_value(
 	    GTK_SPIN_BUTTON(lookup_widget(window.live, "spinbutton_speed")),
@@ -480,8 +480,8 @@ on_button_sponsors_wait_clicked        (GtkButton       *button,
 	current_user.sponsor.contract = 0;
 	current_user.sponsor.benefit = 0;
 	current_user.counters[COUNT_USER_NEW_SPONSOR] = 
-	    math_rndi(const_int("int_sponsor_without_weeks_lower"),
-		      const_int("int_sponsor_without_weeks_upper"));
+	    math_rndi(const_int(int_sponsor_without_weeks_lower),
+		      const_int(int_sponsor_without_weeks_upper));
     }
     else
 	current_user.counters[COUNT_USER_NEW_SPONSOR] = 0;
@@ -568,7 +568,7 @@ on_eventbox_lg_boost_button_press_event (GtkWidget       *widget,
     else
 	return FALSE;
 
-    if(new_boost == 1 && sett_int("int_opt_disable_boost_on"))
+    if(new_boost == 1 && sett_int(int_opt_disable_boost_on))
     {
 	game_gui_show_warning(_("Boost ON is disabled in this country definition."));
 	return FALSE;
@@ -30,24 +30,48 @@
 #include "variables.h"
 #include "xml_name.h"
 
-static void
-load_name_list(const gchar *names_file)
+/** Return the index of the name list with the given sid in the
+    name lists array, loading the list from file if necessary.
+    @param fallback Whether to take the general names list if there's
+    no file for the sid; otherwise the program exits. */
+static gint
+name_get_list_index(const gchar *sid, gboolean fallback)
 {
+#ifdef DEBUG
+    printf("name_get_list_index\n");
+#endif
+
+    gint idx = GPOINTER_TO_INT(g_hash_table_lookup(name_lists_index, sid));
     NameList new;
+
+    if(idx > 0)
+	return idx - 1;
+
     /** Create new name list. */
     new.sid = NULL;
     new.first_names = new.last_names = NULL;
 
-    xml_name_read(names_file, &new);
+    xml_name_read(sid, &new);
 
     if(new.sid == NULL)
     {
-	debug_print_message("name_get_new: names file with sid '%s' not found, taking general names file.\n",
-		  names_file);
-	load_name_list(opt_str("string_opt_player_names_file"));
+	if(!fallback)
+	    main_exit_program(EXIT_POINTER_NOT_FOUND, 
+			      "name_get_list_index: namelist with sid %s not found", sid);
+
+	debug_print_message("name_get_list_index: names file with sid '%s' not found, taking general names file.\n",
+			    sid);
+	idx = name_get_list_index(opt_str(string_opt_player_names_file), FALSE);
+	g_hash_table_insert(name_lists_index, g_strdup(sid), GINT_TO_POINTER(idx + 1));
+
+	return idx;
     }
 
     g_array_append_val(name_lists, new);
+    g_hash_table_insert(name_lists_index, g_strdup(new.sid),
+			GINT_TO_POINTER(name_lists->len));
+
+    return name_lists->len - 1;
 }
 
 /** Get a random player name from the given
@@ -65,9 +89,9 @@ name_get(const gchar *names_file)
     printf("name_get\n");
 #endif
 
-    gint i;
+    gint idx;
 
-    if(math_rnd(0, 1) < const_float("float_name_random_list_prob")) {
+    if(math_rnd(0, 1) < const_float(float_name_random_list_prob)) {
         Country *c;
         if (!country_list) {
             c = &country;
@@ -81,17 +105,14 @@ name_get(const gchar *names_file)
         names_file = ((League*)g_ptr_array_index(c->leagues, 0))->names_file;
     }
 
-    for(i=0;i<name_lists->len;i++)
-	if(strcmp(names_file, nli(i).sid) == 0)
-	    return name_get_from_list(&nli(i));
+    /* Loading the list may move the array. */
+    idx = name_get_list_index(names_file, TRUE);
 
-    load_name_list(names_file);
-
-    return name_get_from_list(&nli(name_lists->len - 1));
+    return name_get_from_list(&nli(idx));
 }
 
-/** Return a newly allocated string with a randomly
-    picked combined name from the list. */
+/** Return a randomly picked combined name from the list.
+    The name belongs to the name pool. */
 gchar*
 name_get_from_list(const NameList *namelist)
 {
@@ -105,50 +126,37 @@ name_get_from_list(const NameList *namelist)
 
     gchar buf[SMALL];
 
-    sprintf(buf, "%s %s", name_get_random_first_name(namelist),
-	    name_get_random_last_name(namelist));
+    g_snprintf(buf, SMALL, "%s %s", name_get_random_first_name(namelist),
+	       name_get_random_last_name(namelist));
+
+    return name_intern(buf);
+}
 
-    return g_strdup(buf);
+/** Return the copy of the string in the name pool, which also holds
+    the names of players and teams, or NULL if the string is NULL.
+    The copy is shared and mustn't be changed or freed. */
+gchar*
+name_intern(const gchar *string)
+{
+    return (string == NULL) ?
+	NULL : g_string_chunk_insert_const(name_pool, string);
 }
 
 /** Find the namelist with the given sid. */
 NameList*
 name_get_list_from_sid(const gchar *sid)
 {
-    gint i;
-    NameList new;
+    gint idx = name_get_list_index(sid, FALSE);
 
-    for(i=0;i<name_lists->len;i++)
-	if(strcmp(sid, nli(i).sid) == 0)
-	    return &nli(i);
-
-    new.sid = NULL;
-    new.first_names = new.last_names = NULL;
-
-    xml_name_read(sid, &new);
-
-    if(new.sid == NULL)
-	main_exit_program(EXIT_POINTER_NOT_FOUND, 
-			  "name_get_list_from_sid: namelist with sid %s not found", sid);
-    else
-    {
-	g_array_append_val(name_lists, new);
-	return &nli(name_lists->len - 1);
-    }
-
-    return NULL;
+    return &nli(idx);
 }
 
 gchar *
 name_get_from_random_list(void)
 {
-    gint i;
-
-    gint country_idx;
+    gint country_idx, idx;
     Country *country_names;
     const gchar *names_file;
-    gchar *name;
-    NameList new;
 
     if (!country_list) {
         country_names = &country;
@@ -161,15 +169,8 @@ name_get_from_random_list(void)
     }
     names_file = ((League*)g_ptr_array_index(country_names->leagues, 0))->names_file;
 
-    /** Create new name list. */
-    new.sid = NULL;
-    new.first_names = new.last_names = NULL;
-
-    xml_name_read(names_file, &new);
-
-    name = name_get_from_list(&new);
-
-    free_name_list(&new, FALSE);
+    /* Loading the list may move the array. */
+    idx = name_get_list_index(names_file, TRUE);
 
-    return name;
+    return name_get_from_list(&nli(idx));
 }
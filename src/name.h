@@ -43,6 +43,9 @@ name_get(const gchar *names_file);
 gchar*
 name_get_from_list(const NameList *namelist);
 
+gchar*
+name_intern(const gchar *string);
+
 NameList*
 name_get_list_from_sid(const gchar *sid);
 
@@ -28,6 +28,10 @@
 
 #include "bygfoot.h"
 
+/** The size of the blocks the name pool gets allocated in.
+    @see #name_pool */
+#define NAME_POOL_CHUNK_SIZE 16384
+
 /** A list of first names and last names
     from a file. */
 typedef struct
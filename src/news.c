@@ -39,12 +39,24 @@
 #include "news.h"
 #include "option.h"
 #include "team.h"
+#include "token.h"
 #include "user.h"
 #include "variables.h"
 #include "xml_news.h"
 
 /** The replacement strings for the news tokens. */
-GPtrArray *token_rep_news[2];
+TokenValue token_rep_news[REP_TOKEN_LAST];
+
+/** The streak tokens of the two teams, overall and in the league. */
+static const gint streak_won_tokens[2][2] =
+{{REP_TOKEN_STREAK_WON0, REP_TOKEN_STREAK_WON1},
+ {REP_TOKEN_STREAK_LEAGUE_WON0, REP_TOKEN_STREAK_LEAGUE_WON1}};
+static const gint streak_lost_tokens[2][2] =
+{{REP_TOKEN_STREAK_LOST0, REP_TOKEN_STREAK_LOST1},
+ {REP_TOKEN_STREAK_LEAGUE_LOST0, REP_TOKEN_STREAK_LEAGUE_LOST1}};
+static const gint streak_unbeaten_tokens[2][2] =
+{{REP_TOKEN_STREAK_UNBEATEN0, REP_TOKEN_STREAK_UNBEATEN1},
+ {REP_TOKEN_STREAK_LEAGUE_UNBEATEN0, REP_TOKEN_STREAK_LEAGUE_UNBEATEN1}};
 
 /** Generate news for a user live game or a CPU fixture. */
 void
@@ -58,9 +70,6 @@ news_generate_match(const LiveGame *live_game)
 	title[SMALL], subtitle[SMALL];
     gint title_id, subtitle_id, article_id;
     NewsPaperArticle new_article;
-    
-    token_rep_news[0] = g_ptr_array_new();
-    token_rep_news[1] = g_ptr_array_new();
 
     news_set_match_tokens(live_game);
 
@@ -121,13 +130,13 @@ news_select(const GArray *news_array, gchar *title, gchar *subtitle,
     {
 	if((!news_check_article_for_repetition(g_array_index(news_array, NewsArticle, order_articles[i]).id) ||
             g_array_index(news_array, NewsArticle, order_articles[i]).priority > 20) &&
-           misc_parse_condition(g_array_index(news_array, NewsArticle, order_articles[i]).condition, token_rep_news))
+           token_condition_check(g_array_index(news_array, NewsArticle, order_articles[i]).parsed_condition, token_rep_news))
 	    break;        
     }
 
     if(i == news_array->len)
         for(i=0;i<news_array->len;i++)
-            if(misc_parse_condition(g_array_index(news_array, NewsArticle, order_articles[i]).condition, token_rep_news))
+            if(token_condition_check(g_array_index(news_array, NewsArticle, order_articles[i]).parsed_condition, token_rep_news))
                 break;
 
     if(i == news_array->len)
@@ -143,27 +152,27 @@ news_select(const GArray *news_array, gchar *title, gchar *subtitle,
     news_titles_get_order(article->subtitles, order_subtitles);
 
     *title_id = news_get_title(article->titles, title, order_titles, TRUE, FALSE, 
-                               const_int("int_news_repetition_max_check_number"));
+                               const_int(int_news_repetition_max_check_number));
     if(*title_id == -1)
-        for(to_check = const_int("int_news_repetition_max_check_number") - 1; 
-            to_check >= const_int("int_news_repetition_min_check_number");
+        for(to_check = const_int(int_news_repetition_max_check_number) - 1; 
+            to_check >= const_int(int_news_repetition_min_check_number);
             to_check--)
         {
             *title_id = news_get_title(article->titles, title, order_titles, TRUE, 
-                                       (to_check == const_int("int_news_repetition_min_check_number")), to_check);   
+                                       (to_check == const_int(int_news_repetition_min_check_number)), to_check);   
             if(*title_id == -1)
                 break;
         }
 
     *subtitle_id = news_get_title(article->subtitles, subtitle, order_subtitles, FALSE, FALSE,
-                                  const_int("int_news_repetition_max_check_number"));
+                                  const_int(int_news_repetition_max_check_number));
     if(*subtitle_id == -1)
-        for(to_check = const_int("int_news_repetition_max_check_number") - 1; 
-            to_check >= const_int("int_news_repetition_min_check_number");
+        for(to_check = const_int(int_news_repetition_max_check_number) - 1; 
+            to_check >= const_int(int_news_repetition_min_check_number);
             to_check--)
         {
             *subtitle_id = news_get_title(article->subtitles, subtitle, order_subtitles, FALSE, 
-                                       (to_check == const_int("int_news_repetition_min_check_number")), to_check);   
+                                       (to_check == const_int(int_news_repetition_min_check_number)), to_check);   
             if(*subtitle_id == -1)
                 break;
         }
@@ -185,8 +194,8 @@ news_get_title(const GArray *titles, gchar *title, gint *order,
 
     for(i = 0; i < titles->len; i++)
     {
-        if(misc_parse_condition(g_array_index(titles, NewsText, order[i]).condition, token_rep_news) &&
-           misc_string_replace_all_tokens(token_rep_news, g_array_index(titles, NewsText, order[i]).text, title))
+        if(token_condition_check(g_array_index(titles, NewsText, order[i]).parsed_condition, token_rep_news) &&
+           token_text_fill(g_array_index(titles, NewsText, order[i]).parsed_text, token_rep_news, title))
         {
             result = g_array_index(titles, NewsText, order[i]).id;
             if(ignore_repetition || !news_check_title_for_repetition(result, is_title, to_check))
@@ -232,8 +241,8 @@ news_check_article_for_repetition(gint id)
     gint i;
     gint end;
 
-    end = (newspaper.articles->len < const_int("int_news_repetition_max_check_number")) ?
-        0 : newspaper.articles->len - const_int("int_news_repetition_max_check_number");
+    end = (newspaper.articles->len < const_int(int_news_repetition_max_check_number)) ?
+        0 : newspaper.articles->len - const_int(int_news_repetition_max_check_number);
 
     for(i = newspaper.articles->len - 1; i >= end; i--)
         if(g_array_index(newspaper.articles, NewsPaperArticle, i).id == id)
@@ -364,7 +373,6 @@ news_set_streak_tokens(const Fixture *fix)
 	streak_won, streak_lost, streak_unbeaten;
     gboolean draw;
     gint res[2];
-    gchar buf[SMALL], buf2[SMALL];
     GPtrArray *latest_fixtures;
     
     for(i = 0; i < 2; i++)
@@ -412,23 +420,12 @@ news_set_streak_tokens(const Fixture *fix)
 		}	    	    
 	    }
 
-	    if(k == 0)
-		strcpy(buf2, "");
-	    else
-		strcpy(buf2, "league_");
-
-	    sprintf(buf, "string_token_streak_%swon%d", buf2, i);
-	    misc_token_add(token_rep_news,
-			   option_int(buf, &replacement_tokens),
-			   misc_int_to_char(streak_won));
-	    sprintf(buf, "string_token_streak_%slost%d", buf2, i);
-	    misc_token_add(token_rep_news,
-			   option_int(buf, &replacement_tokens),
-			   misc_int_to_char(streak_lost));
-	    sprintf(buf, "string_token_streak_%sunbeaten%d", buf2, i);
-	    misc_token_add(token_rep_news,
-			   option_int(buf, &replacement_tokens),
-			   misc_int_to_char(streak_unbeaten));
+	    token_add(token_rep_news, streak_won_tokens[k][i],
+		      misc_int_to_char(streak_won));
+	    token_add(token_rep_news, streak_lost_tokens[k][i],
+		      misc_int_to_char(streak_lost));
+	    token_add(token_rep_news, streak_unbeaten_tokens[k][i],
+		      misc_int_to_char(streak_unbeaten));
 
 	    g_ptr_array_free(latest_fixtures, TRUE);
 	}
@@ -521,23 +518,21 @@ news_set_scorer_tokens(const LiveGameStats *stats)
         
         if(strcmp(scorer_str, "") != 0)
         {
-            sprintf(buf, "string_token_bool_multiple_scorers%d", i);
-            misc_token_add_bool(token_rep_news,
-                                option_int(buf, &replacement_tokens),
-                                (scorers[i]->len > 1));
-
-            sprintf(buf, "string_token_scorers%d", i);
-            misc_token_add(token_rep_news,
-                           option_int(buf, &replacement_tokens),
-                           g_strdup(scorer_str));
-            sprintf(buf, "string_token_highscorer%d", i);
-            misc_token_add(token_rep_news,
-                           option_int(buf, &replacement_tokens),
-                           g_strdup(high_scorer));
-            sprintf(buf, "string_token_highscorer_goals%d", i);
-            misc_token_add(token_rep_news,
-                           option_int(buf, &replacement_tokens),
-                           misc_int_to_char(max_goals));            
+            token_add_bool(token_rep_news,
+                           (i == 0) ? REP_TOKEN_BOOL_MULTIPLE_SCORERS0 :
+                           REP_TOKEN_BOOL_MULTIPLE_SCORERS1,
+                           (scorers[i]->len > 1));
+
+            token_add(token_rep_news,
+                      (i == 0) ? REP_TOKEN_SCORERS0 : REP_TOKEN_SCORERS1,
+                      g_strdup(scorer_str));
+            token_add(token_rep_news,
+                      (i == 0) ? REP_TOKEN_HIGHSCORER0 : REP_TOKEN_HIGHSCORER1,
+                      g_strdup(high_scorer));
+            token_add(token_rep_news,
+                      (i == 0) ? REP_TOKEN_HIGHSCORER_GOALS0 :
+                      REP_TOKEN_HIGHSCORER_GOALS1,
+                      misc_int_to_char(max_goals));
         }
 
         g_ptr_array_free(scorers[i], TRUE);
@@ -560,117 +555,94 @@ news_set_league_cup_tokens(const Fixture *fix)
     /* We want to avoid comparing layers between teams of different countries,
      * because the layer numbers are relative to each country.  The news xml
      * files only ever use the layer0 and layer1 values if the layerdiff is
-     * greater than 0.  We set layerdiff to 0 for international cups below,
+     * greater than 0.  We set layerdiff to 0 for international cups,
      * so it's safe to set layer0 and layer1 values unconditionally here
      * even for international cups.
      */
-    misc_token_add(token_rep_news,
-                   option_int("string_token_team_layer0", &replacement_tokens),
-                   misc_int_to_char(fix->teams[0]->league->layer));
-    misc_token_add(token_rep_news,
-                   option_int("string_token_team_layer1", &replacement_tokens),
-                   misc_int_to_char(fix->teams[1]->league->layer));
-
+    token_add(token_rep_news, REP_TOKEN_TEAM_LAYER0,
+              misc_int_to_char(fix->teams[0]->league->layer));
+    token_add(token_rep_news, REP_TOKEN_TEAM_LAYER1,
+              misc_int_to_char(fix->teams[1]->league->layer));
+
+    /* Teams from the same country may meet in international cups, too,
+       e.g. when a team from a lower league won the national cup. */
+    if(fix->competition->id >= ID_CUP_START &&
+       query_league_cup_has_property(fix->competition->id, "international"))
+        token_add(token_rep_news, REP_TOKEN_TEAM_LAYERDIFF,
+                  misc_int_to_char(0));
     /* Both teams in the same country. */
-    if(fix->teams[0]->country == fix->teams[1]->country)
-	misc_token_add(token_rep_news,
-		       option_int("string_token_team_layerdiff", &replacement_tokens),
-		       misc_int_to_char(ABS(fix->teams[0]->league->layer -
-                                            fix->teams[1]->league->layer)));
+    else if(fix->teams[0]->country == fix->teams[1]->country)
+	token_add(token_rep_news, REP_TOKEN_TEAM_LAYERDIFF,
+		  misc_int_to_char(ABS(fix->teams[0]->league->layer -
+                                       fix->teams[1]->league->layer)));
 
-    misc_token_add(token_rep_news,
-		   option_int("string_token_league_cup_name", &replacement_tokens),
-		   g_strdup(fix->competition->name));
+    token_add(token_rep_news, REP_TOKEN_LEAGUE_CUP_NAME,
+	      g_strdup(fix->competition->name));
 
-    misc_token_add_bool(token_rep_news,
-                        option_int("string_token_bool_cup", &replacement_tokens),
-                        (fix->competition->id >= ID_CUP_START));
+    token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP,
+                   (fix->competition->id >= ID_CUP_START));
 
     if(fix->competition->id >= ID_CUP_START)
     {
         cup = (Cup*)fix->competition;
         cupround = &g_array_index(cup->rounds, CupRound, fix->round);
 
-        if(query_league_cup_has_property(cup->c.id, "international"))
-            misc_token_add(token_rep_news,
-                           option_int("string_token_team_layerdiff", &replacement_tokens),
-                           misc_int_to_char(0));
-        
-        misc_token_add(token_rep_news,
-                       option_int("string_token_cup_stage", &replacement_tokens),
-                       misc_int_to_char(cup->rounds->len - fix->round));
+        token_add(token_rep_news, REP_TOKEN_CUP_STAGE,
+                  misc_int_to_char(cup->rounds->len - fix->round));
 
-        misc_token_add(token_rep_news,
-                       option_int("string_token_bool_cup_neutral", &replacement_tokens),
-                       misc_int_to_char(cupround->neutral));
+        token_add(token_rep_news, REP_TOKEN_BOOL_CUP_NEUTRAL,
+                  misc_int_to_char(cupround->neutral));
 
 	cup_get_round_name(cup, fix->round, buf);
-	misc_token_add(token_rep_news,
-		       option_int("string_token_cup_round_name", &replacement_tokens),
-		       g_strdup(buf));
+	token_add(token_rep_news, REP_TOKEN_CUP_ROUND_NAME,
+		  g_strdup(buf));
 
-        misc_token_add_bool(token_rep_news,
-                           option_int("string_token_bool_cup_knockout", &replacement_tokens),
-                            (cupround->tables->len == 0));
+        token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_KNOCKOUT,
+                       (cupround->tables->len == 0));
         
-        misc_token_add_bool(token_rep_news,
-                            option_int("string_token_bool_cup_home_away", &replacement_tokens),
-                            cupround->home_away);
+        token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_HOME_AWAY,
+                       cupround->home_away);
         
-        misc_token_add_bool(token_rep_news, 
-                            option_int("string_token_bool_cup_first_leg", &replacement_tokens),
-                            (cupround->home_away && !fix->second_leg));
-        misc_token_add_bool(token_rep_news, 
-                            option_int("string_token_bool_cup_second_leg", &replacement_tokens),
-                            (cupround->home_away && fix->second_leg));
+        token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_FIRST_LEG,
+                       (cupround->home_away && !fix->second_leg));
+        token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_SECOND_LEG,
+                       (cupround->home_away && fix->second_leg));
 
         if(fix->decisive)
         {
             tm = (Team*)fixture_winner_of(fix, FALSE);
-            misc_token_add(token_rep_news,
-                           option_int("string_token_cup_match_winner", &replacement_tokens),
-                           g_strdup(tm->name));
-            misc_token_add(token_rep_news,
-                           option_int("string_token_cup_match_loser", &replacement_tokens),
-                           g_strdup(fix->teams[fix->teams[1] != tm]->name));
-            misc_token_add(token_rep_news,
-                           option_int("string_token_cup_match_winnern", &replacement_tokens),
-                           misc_int_to_char(fix->teams[1] == tm));
-            misc_token_add(token_rep_news,
-                           option_int("string_token_cup_match_losern", &replacement_tokens),
-                           misc_int_to_char(fix->teams[1] != tm));
+            token_add(token_rep_news, REP_TOKEN_CUP_MATCH_WINNER,
+                      g_strdup(tm->name));
+            token_add(token_rep_news, REP_TOKEN_CUP_MATCH_LOSER,
+                      g_strdup(fix->teams[fix->teams[1] != tm]->name));
+            token_add(token_rep_news, REP_TOKEN_CUP_MATCH_WINNERN,
+                      misc_int_to_char(fix->teams[1] == tm));
+            token_add(token_rep_news, REP_TOKEN_CUP_MATCH_LOSERN,
+                      misc_int_to_char(fix->teams[1] != tm));
         }
         
-        misc_token_add_bool(token_rep_news,
-                            option_int("string_token_bool_cup_national", &replacement_tokens),
-                            query_league_cup_has_property(cup->c.id, "national"));
-        misc_token_add_bool(token_rep_news,
-                            option_int("string_token_bool_cup_international", &replacement_tokens),
-                            query_league_cup_has_property(cup->c.id, "international"));
-        misc_token_add_bool(token_rep_news,
-                            option_int("string_token_bool_cup_promrel", &replacement_tokens),
-                            query_league_cup_has_property(cup->c.id, "promotion"));
-        misc_token_add_bool(token_rep_news,
-                            option_int("string_token_bool_cup_aux", &replacement_tokens),
-                            query_league_cup_has_property(cup->c.id, "hide") ||
-                            query_league_cup_has_property(cup->c.id, "omit_from_history"));
+        token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_NATIONAL,
+                       query_league_cup_has_property(cup->c.id, "national"));
+        token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_INTERNATIONAL,
+                       query_league_cup_has_property(cup->c.id, "international"));
+        token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_PROMREL,
+                       query_league_cup_has_property(cup->c.id, "promotion"));
+        token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_AUX,
+                       query_league_cup_has_property(cup->c.id, "hide") ||
+                       query_league_cup_has_property(cup->c.id, "omit_from_history"));
     }
     else
     {
-        misc_token_add_bool(token_rep_news,
-                            option_int("string_token_bool_cup_knockout", &replacement_tokens),
-                            FALSE);
+        token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_KNOCKOUT,
+                       FALSE);
         
-        misc_token_add_bool(token_rep_news,
-                            option_int("string_token_bool_cup_home_away", &replacement_tokens),
-                            FALSE);
+        token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_HOME_AWAY,
+                       FALSE);
         
-        misc_token_add_bool(token_rep_news, 
-                            option_int("string_token_bool_cup_first_leg", &replacement_tokens),
-                            FALSE);
-        misc_token_add_bool(token_rep_news, 
-                            option_int("string_token_bool_cup_second_leg", &replacement_tokens),
-                            FALSE);
+        token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_FIRST_LEG,
+                       FALSE);
+        token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_SECOND_LEG,
+                       FALSE);
     }
 }
 
@@ -695,53 +667,41 @@ news_set_fixture_tokens(const Fixture *fix)
     goaldiffaggr = ABS(res[0] - res[1]);
 
     fixture_result_to_buf(fix, buf, FALSE);
-    misc_token_add(token_rep_news, 
-		   option_int("string_token_result", &replacement_tokens),
-		   g_strdup(buf));
+    token_add(token_rep_news, REP_TOKEN_RESULT,
+	      g_strdup(buf));
 
     fixture_result_to_buf(fix, buf, (res[0] < res[1]));
-    misc_token_add(token_rep_news, 
-		   option_int("string_token_result_rew", &replacement_tokens),
-		   g_strdup(buf));
+    token_add(token_rep_news, REP_TOKEN_RESULT_REW,
+	      g_strdup(buf));
 
     fixture_result_to_buf(fix, buf, (res[0] > res[1]));
-    misc_token_add(token_rep_news, 
-		   option_int("string_token_result_rel", &replacement_tokens),
-		   g_strdup(buf));
+    token_add(token_rep_news, REP_TOKEN_RESULT_REL,
+	      g_strdup(buf));
 
-    misc_token_add_bool(token_rep_news, 
-                        option_int("string_token_bool_cup_penalties", &replacement_tokens),
-                        (fix->result[0][2] + fix->result[1][2] != 0));
+    token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_PENALTIES,
+                   (fix->result[0][2] + fix->result[1][2] != 0));
 
-    misc_token_add_bool(token_rep_news, 
-                        option_int("string_token_bool_cup_extra", &replacement_tokens),
-                        (fix->result[0][2] + fix->result[1][2] == 0 &&
-                         fix->result[0][1] + fix->result[1][1] != 0));
+    token_add_bool(token_rep_news, REP_TOKEN_BOOL_CUP_EXTRA,
+                   (fix->result[0][2] + fix->result[1][2] == 0 &&
+                    fix->result[0][1] + fix->result[1][1] != 0));
 
     misc_print_grouped_int(math_round_integer(fix->attendance, 2), buf);
-    misc_token_add(token_rep_news,
-		   option_int("string_token_attendance", &replacement_tokens),
-		   g_strdup(buf));    
-
-    misc_token_add(token_rep_news,
-		   option_int("string_token_team_avskill0", &replacement_tokens), 
-		   misc_int_to_char(avskill0));
-    misc_token_add(token_rep_news,
-		   option_int("string_token_team_avskill1", &replacement_tokens), 
-		   misc_int_to_char(avskill1));
-    misc_token_add(token_rep_news,
-		   option_int("string_token_team_avskilldiff", &replacement_tokens), 
-		   misc_int_to_char(ABS(avskill0 - avskill1)));
-
-    misc_token_add(token_rep_news,
-		   option_int("string_token_goals0", &replacement_tokens), 
-		   misc_int_to_char(fix->result[0][0]));
-    misc_token_add(token_rep_news,
-		   option_int("string_token_goals1", &replacement_tokens), 
-		   misc_int_to_char(fix->result[1][0]));
-    misc_token_add(token_rep_news,
-		   option_int("string_token_goal_diff", &replacement_tokens), 
-		   misc_int_to_char(goaldiffaggr));
+    token_add(token_rep_news, REP_TOKEN_ATTENDANCE,
+	      g_strdup(buf));    
+
+    token_add(token_rep_news, REP_TOKEN_TEAM_AVSKILL0, 
+	      misc_int_to_char(avskill0));
+    token_add(token_rep_news, REP_TOKEN_TEAM_AVSKILL1, 
+	      misc_int_to_char(avskill1));
+    token_add(token_rep_news, REP_TOKEN_TEAM_AVSKILLDIFF, 
+	      misc_int_to_char(ABS(avskill0 - avskill1)));
+
+    token_add(token_rep_news, REP_TOKEN_GOALS0, 
+	      misc_int_to_char(fix->result[0][0]));
+    token_add(token_rep_news, REP_TOKEN_GOALS1, 
+	      misc_int_to_char(fix->result[1][0]));
+    token_add(token_rep_news, REP_TOKEN_GOAL_DIFF, 
+	      misc_int_to_char(goaldiffaggr));
 
     if(fix->competition->id >= ID_CUP_START)
     {
@@ -752,31 +712,24 @@ news_set_fixture_tokens(const Fixture *fix)
                                fix->result[1][0] - fix->result[1][1] - first_leg->result[0][0]);
     }
 
-    misc_token_add(token_rep_news,
-                   option_int("string_token_goal_diff_aggregate", &replacement_tokens), 
-                   misc_int_to_char(goaldiffaggr));   
+    token_add(token_rep_news, REP_TOKEN_GOAL_DIFF_AGGREGATE, 
+              misc_int_to_char(goaldiffaggr));   
     
-    misc_token_add(token_rep_news,
-		   option_int("string_token_team_home", &replacement_tokens),
-		   g_strdup(fix->teams[0]->name));
-    misc_token_add(token_rep_news,
-		   option_int("string_token_team_away", &replacement_tokens),
-		   g_strdup(fix->teams[1]->name));
+    token_add(token_rep_news, REP_TOKEN_TEAM_HOME,
+	      g_strdup(fix->teams[0]->name));
+    token_add(token_rep_news, REP_TOKEN_TEAM_AWAY,
+	      g_strdup(fix->teams[1]->name));
 
     if(fix->result[0][0] != fix->result[1][0])
     {
-	misc_token_add(token_rep_news,
-		       option_int("string_token_team_losing", &replacement_tokens), 
-		       g_strdup(fix->teams[(fix->result[0][0] > fix->result[1][0])]->name));
-	misc_token_add(token_rep_news,
-		       option_int("string_token_team_winning", &replacement_tokens), 
-		       g_strdup(fix->teams[(fix->result[0][0] < fix->result[1][0])]->name));
-	misc_token_add(token_rep_news,
-		       option_int("string_token_team_losingn", &replacement_tokens), 
-		       misc_int_to_char((fix->result[0][0] > fix->result[1][0])));
-	misc_token_add(token_rep_news,
-		       option_int("string_token_team_winningn", &replacement_tokens), 
-		       misc_int_to_char((fix->result[0][0] < fix->result[1][0])));
+	token_add(token_rep_news, REP_TOKEN_TEAM_LOSING, 
+		  g_strdup(fix->teams[(fix->result[0][0] > fix->result[1][0])]->name));
+	token_add(token_rep_news, REP_TOKEN_TEAM_WINNING, 
+		  g_strdup(fix->teams[(fix->result[0][0] < fix->result[1][0])]->name));
+	token_add(token_rep_news, REP_TOKEN_TEAM_LOSINGN, 
+		  misc_int_to_char((fix->result[0][0] > fix->result[1][0])));
+	token_add(token_rep_news, REP_TOKEN_TEAM_WINNINGN, 
+		  misc_int_to_char((fix->result[0][0] < fix->result[1][0])));
     }    
 }
 
@@ -789,7 +742,6 @@ news_set_rank_tokens(const Fixture *fix)
 #endif
     
     gint i, j;
-    gchar buf[SMALL];
     const Table *table;
 
     for(i = 0; i < 2; i++)
@@ -798,11 +750,12 @@ news_set_rank_tokens(const Fixture *fix)
         for(j = 0; j < table->elements->len; j++)
             if(g_array_index(table->elements, TableElement, j).team == fix->teams[i])
             {                
-                sprintf(buf, "string_token_rank%d", i);
-                misc_token_add(token_rep_news, option_int(buf, &replacement_tokens), misc_int_to_char(j + 1));
-                sprintf(buf, "string_token_oldrank%d", i);
-                misc_token_add(token_rep_news, option_int(buf, &replacement_tokens), 
-                               misc_int_to_char(g_array_index(table->elements, TableElement, j).old_rank));
+                token_add(token_rep_news,
+                          (i == 0) ? REP_TOKEN_RANK0 : REP_TOKEN_RANK1,
+                          misc_int_to_char(j + 1));
+                token_add(token_rep_news,
+                          (i == 0) ? REP_TOKEN_OLDRANK0 : REP_TOKEN_OLDRANK1,
+                          misc_int_to_char(g_array_index(table->elements, TableElement, j).old_rank));
                 break;
             }
     }
@@ -816,20 +769,7 @@ news_free_tokens(void)
     printf("news_free_tokens\n");
 #endif
 
-    gint i;
-
-/*     printf("-------------------------------------\n"); */
-    for(i=token_rep_news[0]->len - 1;i >= 0; i--)
-    {
-/*         printf("%s // %s\n", */
-/*                (gchar*)g_ptr_array_index(token_rep_news[0], i), */
-/*                (gchar*)g_ptr_array_index(token_rep_news[1], i)); */
-	g_free(g_ptr_array_index(token_rep_news[0], i));
-	g_free(g_ptr_array_index(token_rep_news[1], i));
-    }
-
-    g_ptr_array_free(token_rep_news[0], TRUE);
-    g_ptr_array_free(token_rep_news[1], TRUE);
+    token_remove_all(token_rep_news);
 }
 
 /** Load the appropriate news file by evaluating
@@ -894,15 +834,28 @@ news_check_match_relevant(const LiveGame *live_game)
     printf("news_check_match_relevant\n");
 #endif
 
+    return news_check_fixture_relevant(live_game->fix);
+}
+
+/** Find out if a fixture will be interesting from a newspaper
+    article generation point of view; this doesn't depend on
+    the match itself, so it can be checked beforehand. */
+gboolean
+news_check_fixture_relevant(const Fixture *fix)
+{
+#ifdef DEBUG
+    printf("news_check_fixture_relevant\n");
+#endif
+
     gint i;
     GArray *user_leagues;
 
-    if(fixture_user_team_involved(live_game->fix) != -1 &&
-       opt_int("int_opt_news_create_user"))
+    if(fixture_user_team_involved(fix) != -1 &&
+       opt_int(int_opt_news_create_user))
         return TRUE;
 
-    if(live_game->fix->competition->id >= ID_CUP_START &&
-       opt_int("int_opt_news_create_cup"))
+    if(fix->competition->id >= ID_CUP_START &&
+       opt_int(int_opt_news_create_cup))
         return TRUE;
 
     user_leagues = g_array_new(FALSE, FALSE, sizeof(gint));
@@ -911,8 +864,8 @@ news_check_match_relevant(const LiveGame *live_game)
         if(!query_misc_integer_is_in_g_array(usr(i).tm->league->c.id, user_leagues))
             g_array_append_val(user_leagues, usr(i).tm->league->c.id);
 
-    if(query_misc_integer_is_in_g_array(live_game->fix->competition->id, user_leagues) &&
-       opt_int("int_opt_news_create_league"))
+    if(query_misc_integer_is_in_g_array(fix->competition->id, user_leagues) &&
+       opt_int(int_opt_news_create_league))
     {
         g_array_free(user_leagues, TRUE);
         return TRUE;
@@ -64,6 +64,9 @@ news_titles_get_order(const GArray *titles, gint *order);
 gboolean
 news_check_match_relevant(const LiveGame *live_game);
 
+gboolean
+news_check_fixture_relevant(const Fixture *fix);
+
 void
 news_set_scorer_tokens(const LiveGameStats *stats);
 
@@ -26,6 +26,8 @@
 #ifndef NEWS_STRUCT_H
 #define NEWS_STRUCT_H
 
+#include "token_struct.h"
+
 /** Enumeration of news article types. */
 enum NewsArticleTypes
 {
@@ -53,6 +55,9 @@ typedef struct
     /** A condition (if not fulfilled, the title or subtitle
         doesn't get considered). */
     gchar *condition;
+    /** The text and condition compiled when loading the news file. */
+    TokenText *parsed_text;
+    TokenCondition *parsed_condition;
 
 } NewsText;
 
@@ -66,6 +71,7 @@ typedef struct
     /** A condition (if not fulfilled, the article doesn't get
 	shown). */
     gchar *condition;
+    TokenCondition *parsed_condition;
     /** Priority of the article. */
     gint priority;
     /** An id to avoid repetitions. */
@@ -28,6 +28,16 @@
 #include "option.h"
 #include "variables.h"
 
+/** The names going with the option ids. */
+static const gchar *option_id_names[OPTION_ID_END] = {
+#define OPTION_ID(name) #name,
+#include "option_ids.h"
+#undef OPTION_ID
+};
+
+/** Hash table mapping the names to the ids. */
+static GHashTable *option_id_table = NULL;
+
 /** Return the string going with the option
     named 'name'.
     @param name The name of the option.
@@ -177,6 +187,172 @@ option_set_int(const gchar *name, OptionList *optionlist, gint new_value)
 }
 
 
+/** Enter the index of the option in the list into
+    the id lookup table of the list if the option
+    has an id. */
+static void
+option_list_set_id(OptionList *optionlist, gint idx)
+{
+    gpointer id;
+
+    if(option_id_table == NULL)
+    {
+	gint i;
+
+	option_id_table = g_hash_table_new(g_str_hash, g_str_equal);
+	for(i=0;i<OPTION_ID_END;i++)
+	    g_hash_table_insert(option_id_table, (gpointer)option_id_names[i],
+				GINT_TO_POINTER(i));
+    }
+
+    if(g_hash_table_lookup_extended(option_id_table,
+				    g_array_index(optionlist->list, Option, idx).name,
+				    NULL, &id))
+	optionlist->ids[GPOINTER_TO_INT(id)] = idx;
+}
+
+/** Rebuild the id lookup table of the optionlist.
+    Has to be called whenever the options in the list
+    get moved around or replaced.
+    @see #OptionId */
+void
+option_list_update_ids(OptionList *optionlist)
+{
+#ifdef DEBUG
+    printf("option_list_update_ids\n");
+#endif
+
+    gint i;
+
+    if(optionlist->ids == NULL)
+	optionlist->ids = g_new(gint, OPTION_ID_END);
+
+    for(i=0;i<OPTION_ID_END;i++)
+	optionlist->ids[i] = -1;
+
+    if(optionlist->list == NULL)
+	return;
+
+    /* If a name occurs twice, the later option wins,
+       just like in the datalist. */
+    for(i=0;i<optionlist->list->len;i++)
+	option_list_set_id(optionlist, i);
+}
+
+/** Copy the options of the source list into the
+    (empty or freed) destination list. */
+void
+option_list_copy(OptionList *dest, const OptionList *source)
+{
+#ifdef DEBUG
+    printf("option_list_copy\n");
+#endif
+
+    gint i;
+    Option new;
+
+    dest->list = NULL;
+    dest->datalist = NULL;
+    dest->ids = NULL;
+
+    if(source->list == NULL)
+	return;
+
+    dest->list = g_array_sized_new(FALSE, FALSE, sizeof(Option), source->list->len);
+    g_datalist_init(&dest->datalist);
+
+    for(i=0;i<source->list->len;i++)
+    {
+	new = g_array_index(source->list, Option, i);
+	new.name = g_strdup(new.name);
+	new.string_value = g_strdup(new.string_value);
+	g_array_append_val(dest->list, new);
+    }
+
+    for(i=0;i<dest->list->len;i++)
+	g_datalist_set_data(&dest->datalist,
+			    g_array_index(dest->list, Option, i).name,
+			    &g_array_index(dest->list, Option, i));
+
+    option_list_update_ids(dest);
+}
+
+/** Return the option with the given id or exit
+    the program if the list doesn't contain it. */
+static Option*
+option_get_by_id(gint id, const OptionList *optionlist, const gchar *caller)
+{
+    if(optionlist->ids != NULL && optionlist->ids[id] != -1)
+	return &g_array_index(optionlist->list, Option, optionlist->ids[id]);
+
+    main_exit_program(EXIT_OPTION_NOT_FOUND, 
+		      "%s: option named %s not found\nMaybe you should delete the .bygfoot directory from your home dir", caller, option_id_names[id]);
+
+    return NULL;
+}
+
+/** Return the string going with the option with the given id.
+    @see option_string(), #OptionId */
+gchar*
+option_string_id(gint id, const OptionList *optionlist)
+{
+    return option_get_by_id(id, optionlist, "option_string")->string_value;
+}
+
+/** Return the string pointer going with the option with the given id. */
+gchar**
+option_string_pointer_id(gint id, OptionList *optionlist)
+{
+    return &option_get_by_id(id, optionlist, "option_string")->string_value;
+}
+
+/** Return the integer going with the option with the given id.
+    @see option_int(), #OptionId */
+gint
+option_int_id(gint id, const OptionList *optionlist)
+{
+    return option_get_by_id(id, optionlist, "option_int")->value;
+}
+
+/** Return the address of the value of the option with the given id. */
+gint*
+option_int_pointer_id(gint id, OptionList *optionlist)
+{
+    return &option_get_by_id(id, optionlist, "option_int")->value;
+}
+
+/** Return the value of the option with the given id
+    cast to float and divided by #OPTION_FLOAT_DIVISOR.
+    @see option_float(), #OptionId */
+gfloat
+option_float_id(gint id, const OptionList *optionlist)
+{
+    return (gfloat)option_get_by_id(id, optionlist, "option_float")->value /
+	OPTION_FLOAT_DIVISOR;
+}
+
+/** Change the value of the string option with the given id. */
+void
+option_set_string_id(gint id, OptionList *optionlist, const gchar *new_value)
+{
+    if(optionlist->ids == NULL || optionlist->ids[id] == -1)
+	debug_print_message("option_set_string: option named %s not found\nMaybe you should delete the .bygfoot directory from your home dir", option_id_names[id]);
+    else
+	misc_string_assign(
+	    &g_array_index(optionlist->list, Option, optionlist->ids[id]).string_value,
+	    new_value);
+}
+
+/** Change the value of the int option with the given id. */
+void
+option_set_int_id(gint id, OptionList *optionlist, gint new_value)
+{
+    if(optionlist->ids == NULL || optionlist->ids[id] == -1)
+	debug_print_message("option_set_int: option named %s not found\nMaybe you should delete the .bygfoot directory from your home dir", option_id_names[id]);
+    else
+	g_array_index(optionlist->list, Option, optionlist->ids[id]).value = new_value;
+}
+
 /** Add an option to the optionlist with the given values. */
 void
 option_add(OptionList *optionlist, const gchar *name, 
@@ -220,6 +396,11 @@ option_add(OptionList *optionlist, const gchar *name,
 	g_datalist_set_data(&optionlist->datalist, 
 			    g_array_index(optionlist->list, Option, i).name,
 			    &g_array_index(optionlist->list, Option, i));
+
+    if(optionlist->ids == NULL)
+	option_list_update_ids(optionlist);
+    else
+	option_list_set_id(optionlist, optionlist->list->len - 1);
 }
 
 gint
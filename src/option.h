@@ -37,36 +37,35 @@
 
 /** Convenience abbrevs. */
 #define option_set_float(name, option_array, value) option_set_int(name, option_array, (gint)rint(value * 1000))
+#define option_set_float_id(id, option_array, value) option_set_int_id(id, option_array, (gint)rint(value * 1000))
 
-#define opt_str(name) option_string(name, &options)
-#define opt_strp(name) option_string_pointer(name, &options)
-#define opt_int(name) option_int(name, &options)
-#define opt_intp(name) option_int_pointer(name, &options)
-#define opt_float(name) option_float(name, &options)
+#define opt_str(name) option_string_id(OPTION_ID_##name, &options)
+#define opt_strp(name) option_string_pointer_id(OPTION_ID_##name, &options)
+#define opt_int(name) option_int_id(OPTION_ID_##name, &options)
+#define opt_intp(name) option_int_pointer_id(OPTION_ID_##name, &options)
+#define opt_float(name) option_float_id(OPTION_ID_##name, &options)
 
-#define opt_set_int(name, value) option_set_int(name, &options, value)
-#define opt_set_str(name, value) option_set_string(name, &options, value)
-#define opt_set_float(name, value) option_set_float(name, &options, value)
+#define opt_set_int(name, value) option_set_int_id(OPTION_ID_##name, &options, value)
+#define opt_set_str(name, value) option_set_string_id(OPTION_ID_##name, &options, value)
+#define opt_set_float(name, value) option_set_float_id(OPTION_ID_##name, &options, value)
 
-#define opt_user_str(name) option_string(name, &current_user.options)
-#define opt_user_strp(name) option_string_pointer(name, &current_user.options)
-#define opt_user_int(name) option_int(name, &current_user.options)
-#define opt_user_intp(name) option_int_pointer(name, &current_user.options)
-#define opt_user_float(name) option_float(name, &current_user.options)
+#define opt_user_str(name) option_string_id(OPTION_ID_##name, &current_user.options)
+#define opt_user_strp(name) option_string_pointer_id(OPTION_ID_##name, &current_user.options)
+#define opt_user_int(name) option_int_id(OPTION_ID_##name, &current_user.options)
+#define opt_user_intp(name) option_int_pointer_id(OPTION_ID_##name, &current_user.options)
+#define opt_user_float(name) option_float_id(OPTION_ID_##name, &current_user.options)
 
-#define opt_user_set_int(name, value) option_set_int(name, &current_user.options, value)
-#define opt_user_set_str(name, value) option_set_string(name, &current_user.options, value)
-#define opt_user_set_float(name, value) option_set_float(name, &current_user.options, value)
+#define opt_user_set_int(name, value) option_set_int_id(OPTION_ID_##name, &current_user.options, value)
+#define opt_user_set_str(name, value) option_set_string_id(OPTION_ID_##name, &current_user.options, value)
+#define opt_user_set_float(name, value) option_set_float_id(OPTION_ID_##name, &current_user.options, value)
 
-#define const_app(name) option_string(name, &constants_app)
-#define const_str(name) option_string(name, &constants)
-#define const_int(name) option_int(name, &constants)
-#define const_int_fast(name) (constants.name)
-#define const_float(name) option_float(name, &constants)
-#define const_float_fast(name) (constants.name)
+#define const_app(name) option_string_id(OPTION_ID_##name, &constants_app)
+#define const_str(name) option_string_id(OPTION_ID_##name, &constants)
+#define const_int(name) option_int_id(OPTION_ID_##name, &constants)
+#define const_float(name) option_float_id(OPTION_ID_##name, &constants)
 
-#define sett_int(name) option_int(name, &settings)
-#define sett_set_int(name, value) option_set_int(name, &settings, value)
+#define sett_int(name) option_int_id(OPTION_ID_##name, &settings)
+#define sett_set_int(name, value) option_set_int_id(OPTION_ID_##name, &settings, value)
 
 gfloat
 option_float(const gchar *name, OptionList *optionlist);
@@ -95,4 +94,31 @@ option_add(OptionList *optionlist, const gchar *name, gint int_value, const gcha
 gint
 option_compare_func(gconstpointer a, gconstpointer b);
 
+void
+option_list_update_ids(OptionList *optionlist);
+
+void
+option_list_copy(OptionList *dest, const OptionList *source);
+
+gfloat
+option_float_id(gint id, const OptionList *optionlist);
+
+gint
+option_int_id(gint id, const OptionList *optionlist);
+
+gint*
+option_int_pointer_id(gint id, OptionList *optionlist);
+
+gchar*
+option_string_id(gint id, const OptionList *optionlist);
+
+gchar**
+option_string_pointer_id(gint id, OptionList *optionlist);
+
+void
+option_set_string_id(gint id, OptionList *optionlist, const gchar *new_value);
+
+void
+option_set_int_id(gint id, OptionList *optionlist, gint new_value);
+
 #endif
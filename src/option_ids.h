@@ -0,0 +1,662 @@
+/*
+   option_ids.h
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+/* The names of all the options and constants the source code
+   looks up with the const_*, opt_* and sett_* macros. Each entry
+   gets a compile-time id, OPTION_ID_<name>, and the lookups are
+   simple array accesses. If you use a new option or constant
+   in the code, add it here (keep the list sorted).
+   This file is included several times with different definitions
+   of OPTION_ID, so there's no include guard.
+   @see #OptionId, option_list_update_ids() */
+
+OPTION_ID(float_bet_commission_decrease)
+OPTION_ID(float_bet_lower_limit)
+OPTION_ID(float_bet_wager_limit_factor)
+OPTION_ID(float_boost_cost_factor)
+OPTION_ID(float_contract_scale_factor)
+OPTION_ID(float_contract_star_no_balk)
+OPTION_ID(float_contract_star_skill_limit)
+OPTION_ID(float_finance_credit_factor_drawing)
+OPTION_ID(float_finance_credit_factor_loan)
+OPTION_ID(float_finance_credit_player_value_weight)
+OPTION_ID(float_finance_credit_stadium_safety_exponent)
+OPTION_ID(float_finance_credit_stadium_weight)
+OPTION_ID(float_finance_interest_lower)
+OPTION_ID(float_finance_interest_step)
+OPTION_ID(float_finance_interest_upper)
+OPTION_ID(float_finance_physio_factor1)
+OPTION_ID(float_finance_physio_factor2)
+OPTION_ID(float_finance_physio_factor3)
+OPTION_ID(float_finance_physio_factor4)
+OPTION_ID(float_finance_scout_factor1)
+OPTION_ID(float_finance_scout_factor2)
+OPTION_ID(float_finance_scout_factor3)
+OPTION_ID(float_finance_scout_factor4)
+OPTION_ID(float_finance_yc_factor1)
+OPTION_ID(float_finance_yc_factor2)
+OPTION_ID(float_finance_yc_factor3)
+OPTION_ID(float_finance_yc_factor4)
+OPTION_ID(float_game_finance_journey_factor_international)
+OPTION_ID(float_game_finance_journey_factor_national)
+OPTION_ID(float_game_gui_live_game_scale_attack)
+OPTION_ID(float_game_gui_live_game_scale_chance)
+OPTION_ID(float_game_gui_live_game_scale_range)
+OPTION_ID(float_game_gui_live_game_speed_penalties_factor)
+OPTION_ID(float_game_home_advantage_lower)
+OPTION_ID(float_game_home_advantage_upper)
+OPTION_ID(float_game_player_weight_attack_def)
+OPTION_ID(float_game_player_weight_attack_fwd)
+OPTION_ID(float_game_player_weight_attack_mid)
+OPTION_ID(float_game_player_weight_defend_def)
+OPTION_ID(float_game_player_weight_defend_fwd)
+OPTION_ID(float_game_player_weight_defend_mid)
+OPTION_ID(float_game_player_weight_midfield_def)
+OPTION_ID(float_game_player_weight_midfield_fwd)
+OPTION_ID(float_game_player_weight_midfield_mid)
+OPTION_ID(float_game_stadium_attendance_average_exceed_factor)
+OPTION_ID(float_game_stadium_attendance_cup_international_factor)
+OPTION_ID(float_game_stadium_attendance_cup_national_factor)
+OPTION_ID(float_game_stadium_attendance_neutral_lower)
+OPTION_ID(float_game_stadium_attendance_neutral_upper)
+OPTION_ID(float_game_stadium_attendance_percentage_lower)
+OPTION_ID(float_game_stadium_attendance_percentage_upper)
+OPTION_ID(float_game_stadium_attendance_rank_factor)
+OPTION_ID(float_game_stadium_attendance_rank_percentage)
+OPTION_ID(float_game_stadium_attendance_safety_exponent)
+OPTION_ID(float_game_stadium_capacity_reduce_factor)
+OPTION_ID(float_game_stadium_safety_deterioration_lower)
+OPTION_ID(float_game_stadium_safety_deterioration_upper)
+OPTION_ID(float_game_stadium_safety_reduce_breakdown_lower)
+OPTION_ID(float_game_stadium_safety_reduce_breakdown_upper)
+OPTION_ID(float_game_stadium_safety_reduce_fire_lower)
+OPTION_ID(float_game_stadium_safety_reduce_fire_upper)
+OPTION_ID(float_game_stadium_safety_reduce_riots_lower)
+OPTION_ID(float_game_stadium_safety_reduce_riots_upper)
+OPTION_ID(float_game_style_factor)
+OPTION_ID(float_job_international_perc)
+OPTION_ID(float_live_game_45_break_exponent_factor)
+OPTION_ID(float_live_game_90_break_exponent_factor)
+OPTION_ID(float_live_game_area_att_mid)
+OPTION_ID(float_live_game_area_att_mid_team_exponent)
+OPTION_ID(float_live_game_area_def_mid)
+OPTION_ID(float_live_game_area_def_mid_team_exponent)
+OPTION_ID(float_live_game_area_mid_att)
+OPTION_ID(float_live_game_area_mid_def)
+OPTION_ID(float_live_game_area_mid_team_exponent)
+OPTION_ID(float_live_game_ban_1)
+OPTION_ID(float_live_game_ban_2)
+OPTION_ID(float_live_game_ban_3)
+OPTION_ID(float_live_game_ban_4)
+OPTION_ID(float_live_game_ban_5)
+OPTION_ID(float_live_game_break_base)
+OPTION_ID(float_live_game_event_general)
+OPTION_ID(float_live_game_foul_base)
+OPTION_ID(float_live_game_foul_booked_reduction)
+OPTION_ID(float_live_game_foul_by_possession)
+OPTION_ID(float_live_game_foul_max_inc)
+OPTION_ID(float_live_game_foul_prob_reduction_red)
+OPTION_ID(float_live_game_foul_prob_reduction_yellow)
+OPTION_ID(float_live_game_foul_red)
+OPTION_ID(float_live_game_foul_red_injury)
+OPTION_ID(float_live_game_foul_yellow)
+OPTION_ID(float_live_game_free_kick_prob)
+OPTION_ID(float_live_game_general_event_second_player)
+OPTION_ID(float_live_game_injury)
+OPTION_ID(float_live_game_injury_goalie_factor)
+OPTION_ID(float_live_game_injury_is_temp)
+OPTION_ID(float_live_game_penalty_prob)
+OPTION_ID(float_live_game_player_in_poss_shoots)
+OPTION_ID(float_live_game_possession_after_post)
+OPTION_ID(float_live_game_possession_changes)
+OPTION_ID(float_live_game_possession_team_exponent)
+OPTION_ID(float_live_game_score_base_prob)
+OPTION_ID(float_live_game_score_duel_exponent)
+OPTION_ID(float_live_game_score_free_kick)
+OPTION_ID(float_live_game_score_penalty)
+OPTION_ID(float_live_game_score_team_exponent)
+OPTION_ID(float_live_game_scoring_chance)
+OPTION_ID(float_live_game_scoring_chance_is_header)
+OPTION_ID(float_live_game_scoring_chance_is_own_goal)
+OPTION_ID(float_live_game_scoring_chance_team_exponent)
+OPTION_ID(float_live_game_stadium_event_breakdown)
+OPTION_ID(float_live_game_stadium_event_exponent)
+OPTION_ID(float_live_game_stadium_event_fire)
+OPTION_ID(float_live_game_stadium_event_riots)
+OPTION_ID(float_live_game_temp_injury_fitness_decrease_lower)
+OPTION_ID(float_live_game_temp_injury_fitness_decrease_upper)
+OPTION_ID(float_luck_limit)
+OPTION_ID(float_name_random_list_prob)
+OPTION_ID(float_player_age_lower)
+OPTION_ID(float_player_age_upper)
+OPTION_ID(float_player_average_talent_variance)
+OPTION_ID(float_player_boost_fitness_effect)
+OPTION_ID(float_player_boost_injury_effect)
+OPTION_ID(float_player_boost_skill_effect)
+OPTION_ID(float_player_contract_lower)
+OPTION_ID(float_player_contract_upper)
+OPTION_ID(float_player_contract_youth)
+OPTION_ID(float_player_etal_scout_factor)
+OPTION_ID(float_player_fire_wage_factor)
+OPTION_ID(float_player_fitness_decrease_add)
+OPTION_ID(float_player_fitness_decrease_factor_goalie)
+OPTION_ID(float_player_fitness_decrease_older_factor)
+OPTION_ID(float_player_fitness_decrease_younger_factor)
+OPTION_ID(float_player_fitness_exponent)
+OPTION_ID(float_player_fitness_increase_add)
+OPTION_ID(float_player_fitness_increase_older_factor)
+OPTION_ID(float_player_fitness_increase_variance)
+OPTION_ID(float_player_fitness_increase_younger_factor)
+OPTION_ID(float_player_fitness_lower)
+OPTION_ID(float_player_fitness_upper)
+OPTION_ID(float_player_injury_arm)
+OPTION_ID(float_player_injury_brok_ankle)
+OPTION_ID(float_player_injury_career_stop)
+OPTION_ID(float_player_injury_concussion)
+OPTION_ID(float_player_injury_frac_ankle)
+OPTION_ID(float_player_injury_groin)
+OPTION_ID(float_player_injury_hamstring)
+OPTION_ID(float_player_injury_leg)
+OPTION_ID(float_player_injury_ligament)
+OPTION_ID(float_player_injury_pulled_muscle)
+OPTION_ID(float_player_injury_recovery_best0)
+OPTION_ID(float_player_injury_recovery_best1)
+OPTION_ID(float_player_injury_recovery_best2)
+OPTION_ID(float_player_injury_recovery_fitness_lower)
+OPTION_ID(float_player_injury_recovery_fitness_upper)
+OPTION_ID(float_player_injury_recovery_good0)
+OPTION_ID(float_player_injury_recovery_good1)
+OPTION_ID(float_player_injury_recovery_good2)
+OPTION_ID(float_player_injury_rib)
+OPTION_ID(float_player_injury_shoulder)
+OPTION_ID(float_player_lsu_games_percentage)
+OPTION_ID(float_player_lsu_increase_prob)
+OPTION_ID(float_player_lsu_injured_old)
+OPTION_ID(float_player_lsu_lower)
+OPTION_ID(float_player_lsu_update_base_prob)
+OPTION_ID(float_player_lsu_update_limit)
+OPTION_ID(float_player_lsu_upper)
+OPTION_ID(float_player_max_skill)
+OPTION_ID(float_player_peak_age_goalie_addition)
+OPTION_ID(float_player_peak_age_lower)
+OPTION_ID(float_player_peak_age_upper)
+OPTION_ID(float_player_peak_region_lower)
+OPTION_ID(float_player_peak_region_upper)
+OPTION_ID(float_player_pos_bound1)
+OPTION_ID(float_player_pos_bound2)
+OPTION_ID(float_player_skill_update_older_add)
+OPTION_ID(float_player_skill_update_older_factor)
+OPTION_ID(float_player_skill_update_peak)
+OPTION_ID(float_player_skill_update_younger_add)
+OPTION_ID(float_player_skill_update_younger_factor)
+OPTION_ID(float_player_streak_add_assist)
+OPTION_ID(float_player_streak_add_goal)
+OPTION_ID(float_player_streak_add_goalie_clean)
+OPTION_ID(float_player_streak_add_goalie_goal)
+OPTION_ID(float_player_streak_add_goalie_save)
+OPTION_ID(float_player_streak_add_injury)
+OPTION_ID(float_player_streak_add_loss)
+OPTION_ID(float_player_streak_add_no_startup)
+OPTION_ID(float_player_streak_add_own_goal)
+OPTION_ID(float_player_streak_add_sendoff)
+OPTION_ID(float_player_streak_add_startup)
+OPTION_ID(float_player_streak_add_sub_in)
+OPTION_ID(float_player_streak_add_sub_out)
+OPTION_ID(float_player_streak_add_win)
+OPTION_ID(float_player_streak_count_decrease_add)
+OPTION_ID(float_player_streak_count_decrease_factor)
+OPTION_ID(float_player_streak_influence_fitness_decrease)
+OPTION_ID(float_player_streak_influence_fitness_increase)
+OPTION_ID(float_player_streak_influence_skill)
+OPTION_ID(float_player_streak_length_lower)
+OPTION_ID(float_player_streak_length_upper)
+OPTION_ID(float_player_streak_prob_max)
+OPTION_ID(float_player_streak_prob_zero)
+OPTION_ID(float_player_team_weight_defender_attack)
+OPTION_ID(float_player_team_weight_defender_defense)
+OPTION_ID(float_player_team_weight_defender_midfield)
+OPTION_ID(float_player_team_weight_forward_attack)
+OPTION_ID(float_player_team_weight_forward_defense)
+OPTION_ID(float_player_team_weight_forward_midfield)
+OPTION_ID(float_player_team_weight_midfielder_attack)
+OPTION_ID(float_player_team_weight_midfielder_defense)
+OPTION_ID(float_player_team_weight_midfielder_midfield)
+OPTION_ID(float_player_value_older_factor)
+OPTION_ID(float_player_value_power)
+OPTION_ID(float_player_value_skill_weight)
+OPTION_ID(float_player_value_younger_factor)
+OPTION_ID(float_player_wage_random_dev)
+OPTION_ID(float_player_wage_value_factor)
+OPTION_ID(float_season_end_league_above_talent_factor)
+OPTION_ID(float_season_end_team_change_lower)
+OPTION_ID(float_season_end_team_change_upper)
+OPTION_ID(float_season_end_user_champ_addition)
+OPTION_ID(float_season_end_user_champ_best_teams_addition)
+OPTION_ID(float_season_end_user_champ_luck_factor)
+OPTION_ID(float_season_end_user_champ_luck_factor_regen)
+OPTION_ID(float_sponsor_continue_prob)
+OPTION_ID(float_sponsor_contract_length_factor)
+OPTION_ID(float_sponsor_wage_percentage_lower)
+OPTION_ID(float_sponsor_wage_percentage_upper)
+OPTION_ID(float_stadium_improvement_base_safety)
+OPTION_ID(float_stadium_improvement_max_discount)
+OPTION_ID(float_stadium_improvement_max_discount_safety)
+OPTION_ID(float_stadium_improvement_safety_variance)
+OPTION_ID(float_stadium_improvement_wage_unit_factor_safety)
+OPTION_ID(float_stadium_improvement_wage_unit_factor_seats)
+OPTION_ID(float_stat_goalie_percentage)
+OPTION_ID(float_team_boost_foul_by_possession_factor1)
+OPTION_ID(float_team_boost_foul_by_possession_factor2)
+OPTION_ID(float_team_boost_foul_factor)
+OPTION_ID(float_team_new_player_probability)
+OPTION_ID(float_team_skill_variance)
+OPTION_ID(float_team_stadium_price_attendance_factor)
+OPTION_ID(float_team_stadium_safety_lower)
+OPTION_ID(float_team_stadium_safety_upper)
+OPTION_ID(float_team_stadium_size_wage_factor)
+OPTION_ID(float_training_camp_factor1)
+OPTION_ID(float_training_camp_factor2)
+OPTION_ID(float_training_camp_factor3)
+OPTION_ID(float_transfer_cup_percentage)
+OPTION_ID(float_transfer_deadline_percentage)
+OPTION_ID(float_transfer_good_player_prob)
+OPTION_ID(float_transfer_good_player_skill_bound)
+OPTION_ID(float_transfer_offer_fee_best_lower)
+OPTION_ID(float_transfer_offer_fee_best_upper)
+OPTION_ID(float_transfer_offer_fee_good_lower)
+OPTION_ID(float_transfer_offer_fee_good_upper)
+OPTION_ID(float_transfer_offer_prob_max)
+OPTION_ID(float_transfer_offer_prob_reduce)
+OPTION_ID(float_transfer_scout_deviance_value)
+OPTION_ID(float_transfer_scout_deviance_wage)
+OPTION_ID(float_transfer_star_goalie_accepts)
+OPTION_ID(float_transfer_star_no_balk)
+OPTION_ID(float_transfer_star_prob_decrease)
+OPTION_ID(float_transfer_star_skill_limit)
+OPTION_ID(float_treeview_helper_limit_player_contract_below1)
+OPTION_ID(float_treeview_helper_limit_player_contract_below2)
+OPTION_ID(float_treeview_helper_limit_player_contract_below3)
+OPTION_ID(float_treeview_helper_limit_player_fitness_below2)
+OPTION_ID(float_treeview_helper_limit_player_fitness_below3)
+OPTION_ID(float_user_success_base_prob)
+OPTION_ID(float_user_success_counter_check)
+OPTION_ID(float_user_success_prob_factor)
+OPTION_ID(float_user_success_table_bound_lower)
+OPTION_ID(float_user_success_table_bound_upper)
+OPTION_ID(float_youth_academy_age_lower)
+OPTION_ID(float_youth_academy_age_upper)
+OPTION_ID(float_youth_academy_average_weight)
+OPTION_ID(float_youth_academy_coach_search_addition)
+OPTION_ID(float_youth_academy_coach_weight)
+OPTION_ID(float_youth_academy_counter_decrease_min)
+OPTION_ID(float_youth_academy_lsu_addition_best)
+OPTION_ID(float_youth_academy_lsu_penalty)
+OPTION_ID(float_youth_academy_pos_defender)
+OPTION_ID(float_youth_academy_pos_forward)
+OPTION_ID(float_youth_academy_pos_goalie)
+OPTION_ID(float_youth_academy_pos_midfielder)
+OPTION_ID(float_youth_academy_talent_factor_lower)
+OPTION_ID(float_youth_academy_talent_factor_upper)
+OPTION_ID(float_youth_academy_talent_variance)
+OPTION_ID(float_youth_academy_youth_counter_lower)
+OPTION_ID(float_youth_academy_youth_counter_upper)
+OPTION_ID(float_youth_lsu_addition_match)
+OPTION_ID(int_bet_wager_max)
+OPTION_ID(int_contract_max_offers)
+OPTION_ID(int_debug_writer)
+OPTION_ID(int_finance_overdraw_limit)
+OPTION_ID(int_finance_overdraw_positive)
+OPTION_ID(int_finance_payback_weeks)
+OPTION_ID(int_fs_save_threads)
+OPTION_ID(int_game_gui_live_game_speed_grad)
+OPTION_ID(int_game_gui_live_game_speed_max)
+OPTION_ID(int_game_gui_message_delay)
+OPTION_ID(int_game_gui_message_duration)
+OPTION_ID(int_game_stadium_attendance_cup_rounds_full_house)
+OPTION_ID(int_initial_money_lower)
+OPTION_ID(int_initial_money_upper)
+OPTION_ID(int_job_application_points_international)
+OPTION_ID(int_job_application_points_per_av_skill)
+OPTION_ID(int_job_application_points_per_layer)
+OPTION_ID(int_job_application_points_per_rating)
+OPTION_ID(int_job_new_offers_lower)
+OPTION_ID(int_job_new_offers_upper)
+OPTION_ID(int_job_update_interval)
+OPTION_ID(int_lg_commentary_check_backwards)
+OPTION_ID(int_news_history_length)
+OPTION_ID(int_news_repetition_max_check_number)
+OPTION_ID(int_news_repetition_min_check_number)
+OPTION_ID(int_opt_autosave)
+OPTION_ID(int_opt_autosave_files)
+OPTION_ID(int_opt_autosave_interval)
+OPTION_ID(int_opt_calodds)
+OPTION_ID(int_opt_calodds_matches)
+OPTION_ID(int_opt_calodds_skilldiffmax)
+OPTION_ID(int_opt_confirm_quit)
+OPTION_ID(int_opt_confirm_unfit)
+OPTION_ID(int_opt_disable_boost_on)
+OPTION_ID(int_opt_disable_contracts)
+OPTION_ID(int_opt_disable_finances)
+OPTION_ID(int_opt_disable_stadium)
+OPTION_ID(int_opt_disable_training_camp)
+OPTION_ID(int_opt_disable_transfers)
+OPTION_ID(int_opt_disable_ya)
+OPTION_ID(int_opt_goto_mode)
+OPTION_ID(int_opt_live_game_player_list_refresh)
+OPTION_ID(int_opt_load_defs)
+OPTION_ID(int_opt_match_threads)
+OPTION_ID(int_opt_maximize_main_window)
+OPTION_ID(int_opt_news_create_cup)
+OPTION_ID(int_opt_news_create_league)
+OPTION_ID(int_opt_news_create_user)
+OPTION_ID(int_opt_news_popup)
+OPTION_ID(int_opt_news_show_recent)
+OPTION_ID(int_opt_player_precision)
+OPTION_ID(int_opt_prefer_messages)
+OPTION_ID(int_opt_progressbar_pics)
+OPTION_ID(int_opt_randomise_teams)
+OPTION_ID(int_opt_results_only)
+OPTION_ID(int_opt_save_will_overwrite)
+OPTION_ID(int_opt_sim_mode)
+OPTION_ID(int_opt_skip)
+OPTION_ID(int_opt_user_auto_sub)
+OPTION_ID(int_opt_user_bet_default_wager)
+OPTION_ID(int_opt_user_bet_show_all_leagues)
+OPTION_ID(int_opt_user_bet_show_cups)
+OPTION_ID(int_opt_user_bet_show_my_recent)
+OPTION_ID(int_opt_user_confirm_youth)
+OPTION_ID(int_opt_user_contract_limit)
+OPTION_ID(int_opt_user_live_game_speed)
+OPTION_ID(int_opt_user_live_game_verbosity)
+OPTION_ID(int_opt_user_pause_break)
+OPTION_ID(int_opt_user_pause_injury)
+OPTION_ID(int_opt_user_pause_red)
+OPTION_ID(int_opt_user_penalty_shooter)
+OPTION_ID(int_opt_user_pl1_att_age)
+OPTION_ID(int_opt_user_pl1_att_cards)
+OPTION_ID(int_opt_user_pl1_att_contract)
+OPTION_ID(int_opt_user_pl1_att_cpos)
+OPTION_ID(int_opt_user_pl1_att_cskill)
+OPTION_ID(int_opt_user_pl1_att_etal)
+OPTION_ID(int_opt_user_pl1_att_fitness)
+OPTION_ID(int_opt_user_pl1_att_games)
+OPTION_ID(int_opt_user_pl1_att_goals)
+OPTION_ID(int_opt_user_pl1_att_league_cup)
+OPTION_ID(int_opt_user_pl1_att_name)
+OPTION_ID(int_opt_user_pl1_att_pos)
+OPTION_ID(int_opt_user_pl1_att_shots)
+OPTION_ID(int_opt_user_pl1_att_skill)
+OPTION_ID(int_opt_user_pl1_att_status)
+OPTION_ID(int_opt_user_pl1_att_team)
+OPTION_ID(int_opt_user_pl1_att_value)
+OPTION_ID(int_opt_user_pl1_att_wage)
+OPTION_ID(int_opt_user_pl2_att_age)
+OPTION_ID(int_opt_user_pl2_att_cards)
+OPTION_ID(int_opt_user_pl2_att_contract)
+OPTION_ID(int_opt_user_pl2_att_cpos)
+OPTION_ID(int_opt_user_pl2_att_cskill)
+OPTION_ID(int_opt_user_pl2_att_etal)
+OPTION_ID(int_opt_user_pl2_att_fitness)
+OPTION_ID(int_opt_user_pl2_att_games)
+OPTION_ID(int_opt_user_pl2_att_goals)
+OPTION_ID(int_opt_user_pl2_att_league_cup)
+OPTION_ID(int_opt_user_pl2_att_name)
+OPTION_ID(int_opt_user_pl2_att_pos)
+OPTION_ID(int_opt_user_pl2_att_shots)
+OPTION_ID(int_opt_user_pl2_att_skill)
+OPTION_ID(int_opt_user_pl2_att_status)
+OPTION_ID(int_opt_user_pl2_att_team)
+OPTION_ID(int_opt_user_pl2_att_value)
+OPTION_ID(int_opt_user_pl2_att_wage)
+OPTION_ID(int_opt_user_show_all_leagues)
+OPTION_ID(int_opt_user_show_job_offers)
+OPTION_ID(int_opt_user_show_live_game)
+OPTION_ID(int_opt_user_show_overall)
+OPTION_ID(int_opt_user_show_tendency_bar)
+OPTION_ID(int_opt_user_store_restore_default_team)
+OPTION_ID(int_opt_user_swap_adapts)
+OPTION_ID(int_opt_user_training_camp_hotel)
+OPTION_ID(int_opt_user_training_camp_recreation)
+OPTION_ID(int_player_injury_duration_arm)
+OPTION_ID(int_player_injury_duration_brok_ankle)
+OPTION_ID(int_player_injury_duration_concussion)
+OPTION_ID(int_player_injury_duration_dev_arm)
+OPTION_ID(int_player_injury_duration_dev_brok_ankle)
+OPTION_ID(int_player_injury_duration_dev_concussion)
+OPTION_ID(int_player_injury_duration_dev_frac_ankle)
+OPTION_ID(int_player_injury_duration_dev_groin)
+OPTION_ID(int_player_injury_duration_dev_hamstring)
+OPTION_ID(int_player_injury_duration_dev_leg)
+OPTION_ID(int_player_injury_duration_dev_ligament)
+OPTION_ID(int_player_injury_duration_dev_pulled_muscle)
+OPTION_ID(int_player_injury_duration_dev_rib)
+OPTION_ID(int_player_injury_duration_dev_shoulder)
+OPTION_ID(int_player_injury_duration_frac_ankle)
+OPTION_ID(int_player_injury_duration_groin)
+OPTION_ID(int_player_injury_duration_hamstring)
+OPTION_ID(int_player_injury_duration_leg)
+OPTION_ID(int_player_injury_duration_ligament)
+OPTION_ID(int_player_injury_duration_pulled_muscle)
+OPTION_ID(int_player_injury_duration_rib)
+OPTION_ID(int_player_injury_duration_shoulder)
+OPTION_ID(int_player_streak_lock_length_lower)
+OPTION_ID(int_player_streak_lock_length_upper)
+OPTION_ID(int_season_end_user_champ_best_teams_limit)
+OPTION_ID(int_sponsor_offers_lower)
+OPTION_ID(int_sponsor_offers_upper)
+OPTION_ID(int_sponsor_without_weeks_lower)
+OPTION_ID(int_sponsor_without_weeks_upper)
+OPTION_ID(int_stadium_improvement_base_seats)
+OPTION_ID(int_stadium_improvement_max_discount_seats)
+OPTION_ID(int_stadium_improvement_seats_variance)
+OPTION_ID(int_stat_players_len)
+OPTION_ID(int_stat_teams_len)
+OPTION_ID(int_team_cpu_players)
+OPTION_ID(int_team_max_players)
+OPTION_ID(int_team_min_players)
+OPTION_ID(int_team_new_bound_lower)
+OPTION_ID(int_team_new_bound_upper)
+OPTION_ID(int_team_new_players_lower)
+OPTION_ID(int_team_new_players_upper)
+OPTION_ID(int_team_stadium_ticket_price)
+OPTION_ID(int_training_camps_per_season)
+OPTION_ID(int_training_camps_week)
+OPTION_ID(int_transfer_contract_lower)
+OPTION_ID(int_transfer_contract_upper)
+OPTION_ID(int_transfer_max_players)
+OPTION_ID(int_transfer_new_players_lower)
+OPTION_ID(int_transfer_new_players_upper)
+OPTION_ID(int_transfer_time_lower)
+OPTION_ID(int_transfer_time_upper)
+OPTION_ID(int_treeview_coming_matches)
+OPTION_ID(int_treeview_helper_int_empty)
+OPTION_ID(int_treeview_latest_results)
+OPTION_ID(int_treeview_max_pipes)
+OPTION_ID(int_user_success_international_final)
+OPTION_ID(int_user_success_international_quarter)
+OPTION_ID(int_user_success_international_semis)
+OPTION_ID(int_user_success_international_winner)
+OPTION_ID(int_user_success_mediocre_rank_change)
+OPTION_ID(int_user_success_national_final)
+OPTION_ID(int_user_success_national_quarter)
+OPTION_ID(int_user_success_national_semis)
+OPTION_ID(int_user_success_national_winner)
+OPTION_ID(int_user_success_offer_limit)
+OPTION_ID(int_user_success_promotion)
+OPTION_ID(int_user_success_relegation)
+OPTION_ID(int_youth_academy_default_percentage)
+OPTION_ID(int_youth_academy_max_percentage)
+OPTION_ID(int_youth_academy_max_youths)
+OPTION_ID(int_youth_academy_youths_lower)
+OPTION_ID(int_youth_academy_youths_upper)
+OPTION_ID(string_fs_binary_save_suffix)
+OPTION_ID(string_fs_copy_file_command)
+OPTION_ID(string_fs_save_suffix)
+OPTION_ID(string_game_gui_boost_anti_icon)
+OPTION_ID(string_game_gui_boost_off_icon)
+OPTION_ID(string_game_gui_boost_on_icon)
+OPTION_ID(string_game_gui_live_game_scale_color_attack)
+OPTION_ID(string_game_gui_live_game_scale_color_chance)
+OPTION_ID(string_game_gui_live_game_scale_color_defend)
+OPTION_ID(string_game_gui_live_game_scale_color_goal)
+OPTION_ID(string_game_gui_live_game_scale_color_midfield)
+OPTION_ID(string_game_gui_live_game_scale_color_miss)
+OPTION_ID(string_game_gui_style_all_out_attack_icon)
+OPTION_ID(string_game_gui_style_all_out_defend_icon)
+OPTION_ID(string_game_gui_style_attack_icon)
+OPTION_ID(string_game_gui_style_balanced_icon)
+OPTION_ID(string_game_gui_style_defend_icon)
+OPTION_ID(string_help_window_program_name_attribute)
+OPTION_ID(string_help_window_title_attribute)
+OPTION_ID(string_language_codes)
+OPTION_ID(string_language_defs)
+OPTION_ID(string_language_names)
+OPTION_ID(string_language_symbols)
+OPTION_ID(string_live_game_event_cross_bar_icon)
+OPTION_ID(string_live_game_event_foul_icon)
+OPTION_ID(string_live_game_event_foul_yellow_icon)
+OPTION_ID(string_live_game_event_goal_icon)
+OPTION_ID(string_live_game_event_header_icon)
+OPTION_ID(string_live_game_event_injury_icon)
+OPTION_ID(string_live_game_event_lost_possession_icon)
+OPTION_ID(string_live_game_event_miss_icon)
+OPTION_ID(string_live_game_event_own_goal_icon)
+OPTION_ID(string_live_game_event_penalty_icon)
+OPTION_ID(string_live_game_event_post_icon)
+OPTION_ID(string_live_game_event_save_icon)
+OPTION_ID(string_live_game_event_scoring_chance_icon)
+OPTION_ID(string_live_game_event_send_off_icon)
+OPTION_ID(string_live_game_event_stadium_breakdown_icon)
+OPTION_ID(string_live_game_event_stadium_fire_icon)
+OPTION_ID(string_live_game_event_stadium_riots_icon)
+OPTION_ID(string_live_game_event_start_match_icon)
+OPTION_ID(string_live_game_event_structure_change_icon)
+OPTION_ID(string_live_game_event_substitution_icon)
+OPTION_ID(string_live_game_event_temp_injury_icon)
+OPTION_ID(string_live_game_possession_color)
+OPTION_ID(string_news_window_league_cup_attribute)
+OPTION_ID(string_news_window_subtitle_attribute)
+OPTION_ID(string_news_window_title_attribute)
+OPTION_ID(string_news_window_title_small_attribute)
+OPTION_ID(string_news_window_week_number_attribute)
+OPTION_ID(string_opt_appearance_file)
+OPTION_ID(string_opt_constants_file)
+OPTION_ID(string_opt_default_user_conf_file)
+OPTION_ID(string_opt_font_name)
+OPTION_ID(string_opt_language_code)
+OPTION_ID(string_opt_player_names_file)
+OPTION_ID(string_treeview_current_user_bg)
+OPTION_ID(string_treeview_current_user_fg)
+OPTION_ID(string_treeview_finances_expenses_fg)
+OPTION_ID(string_treeview_fixture_header_bg)
+OPTION_ID(string_treeview_fixture_header_fg)
+OPTION_ID(string_treeview_helper_color_default_background)
+OPTION_ID(string_treeview_helper_color_default_foreground)
+OPTION_ID(string_treeview_helper_color_job_international_bg)
+OPTION_ID(string_treeview_helper_color_job_international_fg)
+OPTION_ID(string_treeview_helper_color_player_bad_cskill_bg)
+OPTION_ID(string_treeview_helper_color_player_bad_cskill_fg)
+OPTION_ID(string_treeview_helper_color_player_banned)
+OPTION_ID(string_treeview_helper_color_player_contract_below1)
+OPTION_ID(string_treeview_helper_color_player_contract_below2)
+OPTION_ID(string_treeview_helper_color_player_contract_below3)
+OPTION_ID(string_treeview_helper_color_player_contract_normal)
+OPTION_ID(string_treeview_helper_color_player_fitness_below2)
+OPTION_ID(string_treeview_helper_color_player_fitness_below3)
+OPTION_ID(string_treeview_helper_color_player_fitness_normal)
+OPTION_ID(string_treeview_helper_color_player_injury)
+OPTION_ID(string_treeview_helper_color_player_pos_defender_bg)
+OPTION_ID(string_treeview_helper_color_player_pos_defender_fg)
+OPTION_ID(string_treeview_helper_color_player_pos_disabled_bg)
+OPTION_ID(string_treeview_helper_color_player_pos_disabled_fg)
+OPTION_ID(string_treeview_helper_color_player_pos_forward_bg)
+OPTION_ID(string_treeview_helper_color_player_pos_forward_fg)
+OPTION_ID(string_treeview_helper_color_player_pos_goalie_bg)
+OPTION_ID(string_treeview_helper_color_player_pos_goalie_fg)
+OPTION_ID(string_treeview_helper_color_player_pos_midfielder_bg)
+OPTION_ID(string_treeview_helper_color_player_pos_midfielder_fg)
+OPTION_ID(string_treeview_helper_color_player_yellow_danger)
+OPTION_ID(string_treeview_helper_color_transfer_offer_accepted_current_bg)
+OPTION_ID(string_treeview_helper_color_transfer_offer_accepted_current_fg)
+OPTION_ID(string_treeview_helper_color_transfer_offer_accepted_other_bg)
+OPTION_ID(string_treeview_helper_color_transfer_offer_accepted_other_fg)
+OPTION_ID(string_treeview_helper_color_transfer_offer_bg)
+OPTION_ID(string_treeview_helper_color_transfer_offer_fg)
+OPTION_ID(string_treeview_helper_color_transfer_offer_user_bg)
+OPTION_ID(string_treeview_helper_color_transfer_offer_user_fg)
+OPTION_ID(string_treeview_helper_color_user_bet_bg)
+OPTION_ID(string_treeview_helper_color_user_bet_fg)
+OPTION_ID(string_treeview_helper_live_game_result_attributes)
+OPTION_ID(string_treeview_helper_mmatches_add_bg)
+OPTION_ID(string_treeview_helper_mmatches_add_fg)
+OPTION_ID(string_treeview_helper_mmatches_export_bg)
+OPTION_ID(string_treeview_helper_mmatches_export_fg)
+OPTION_ID(string_treeview_helper_mmatches_remove_bg)
+OPTION_ID(string_treeview_helper_mmatches_remove_fg)
+OPTION_ID(string_treeview_helper_mmatches_replay_bg)
+OPTION_ID(string_treeview_helper_mmatches_replay_fg)
+OPTION_ID(string_treeview_helper_player_status_ban)
+OPTION_ID(string_treeview_helper_player_status_cold_streak)
+OPTION_ID(string_treeview_helper_player_status_hot_streak)
+OPTION_ID(string_treeview_helper_player_status_injury)
+OPTION_ID(string_treeview_helper_player_status_ok)
+OPTION_ID(string_treeview_helper_player_status_yellow_danger)
+OPTION_ID(string_treeview_helper_season_results_draw_bg)
+OPTION_ID(string_treeview_helper_season_results_loss_bg)
+OPTION_ID(string_treeview_helper_season_results_win_bg)
+OPTION_ID(string_treeview_helper_user_history_symbol_champion_icon)
+OPTION_ID(string_treeview_helper_user_history_symbol_end_season_icon)
+OPTION_ID(string_treeview_helper_user_history_symbol_fire_failure_icon)
+OPTION_ID(string_treeview_helper_user_history_symbol_fire_finances_icon)
+OPTION_ID(string_treeview_helper_user_history_symbol_job_offer_accepted_icon)
+OPTION_ID(string_treeview_helper_user_history_symbol_lose_final_icon)
+OPTION_ID(string_treeview_helper_user_history_symbol_promoted_icon)
+OPTION_ID(string_treeview_helper_user_history_symbol_reach_cup_round_icon)
+OPTION_ID(string_treeview_helper_user_history_symbol_relegated_icon)
+OPTION_ID(string_treeview_helper_user_history_symbol_start_game_icon)
+OPTION_ID(string_treeview_helper_user_history_symbol_win_final_icon)
+OPTION_ID(string_treeview_league_stats_def_teams_icon)
+OPTION_ID(string_treeview_league_stats_goalies_icon)
+OPTION_ID(string_treeview_league_stats_off_teams_icon)
+OPTION_ID(string_treeview_league_stats_scorers_icon)
+OPTION_ID(string_treeview_live_game_commentary_away_bg)
+OPTION_ID(string_treeview_live_game_commentary_away_fg)
+OPTION_ID(string_treeview_opponent_match_later_bg)
+OPTION_ID(string_treeview_opponent_match_later_fg)
+OPTION_ID(string_treeview_opponent_skill_negative_fg)
+OPTION_ID(string_treeview_opponent_skill_positive_fg)
+OPTION_ID(string_treeview_opponent_value_colour_fg)
+OPTION_ID(string_treeview_season_hist_cup_champions_icon)
+OPTION_ID(string_treeview_season_hist_league_champions_icon)
+OPTION_ID(string_treeview_stadium_event_bg)
+OPTION_ID(string_treeview_symbol_bg)
+OPTION_ID(string_treeview_table_down_icon)
+OPTION_ID(string_treeview_table_first)
+OPTION_ID(string_treeview_table_promotion)
+OPTION_ID(string_treeview_table_relegation)
+OPTION_ID(string_treeview_table_stay_icon)
+OPTION_ID(string_treeview_table_up_icon)
+OPTION_ID(string_treeview_user_bg)
+OPTION_ID(string_treeview_user_fg)
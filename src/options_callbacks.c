@@ -227,10 +227,10 @@ on_button_constants_reload_clicked     (GtkButton       *button,
 {
     if(gtk_notebook_get_current_page(
            GTK_NOTEBOOK(lookup_widget(GTK_WIDGET(button), "notebook_constants"))) == 3)
-        file_load_opt_file(opt_str("string_opt_appearance_file"),
+        file_load_opt_file(opt_str(string_opt_appearance_file),
                            &constants_app, TRUE);
     else
-        file_load_opt_file(opt_str("string_opt_constants_file"),
+        file_load_opt_file(opt_str(string_opt_constants_file),
                            &constants, TRUE);
 
     treeview2_show_constants();
@@ -255,13 +255,13 @@ on_button_constants_save_clicked       (GtkButton       *button,
            GTK_NOTEBOOK(lookup_widget(GTK_WIDGET(button), "notebook_constants"))) == 3)
     {
         sprintf(buf, "%s%s%s", file_get_first_support_dir(),
-                G_DIR_SEPARATOR_S, opt_str("string_opt_appearance_file"));
+                G_DIR_SEPARATOR_S, opt_str(string_opt_appearance_file));
         file_save_opt_file(buf, &constants_app);
     }
     else
     {
         sprintf(buf, "%s%s%s", file_get_first_support_dir(),
-                G_DIR_SEPARATOR_S, opt_str("string_opt_constants_file"));
+                G_DIR_SEPARATOR_S, opt_str(string_opt_constants_file));
         file_save_opt_file(buf, &constants);
     }
 }
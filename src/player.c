@@ -47,6 +47,7 @@ player_init(Player *player)
 {
     memset(player, 0, sizeof(Player));
     player->stats = g_array_new(FALSE, FALSE, sizeof(PlayerCompetitionStats));
+    player->stats_slots = NULL;
 }
 
 /** Create and return a new player.
@@ -62,8 +63,8 @@ player_new(Team *tm, gfloat average_talent, gboolean new_id)
 
     gint i;
     gfloat skill_factor = 
-	math_rnd(1 - const_float_fast(float_player_average_talent_variance),
-		 1 + const_float_fast(float_player_average_talent_variance));
+	math_rnd(1 - const_float(float_player_average_talent_variance),
+		 1 + const_float(float_player_average_talent_variance));
     Player new;
 
     new.name = (new_id) ? 
@@ -72,38 +73,39 @@ player_new(Team *tm, gfloat average_talent, gboolean new_id)
     new.id = (new_id) ? player_id_new : -1;
     new.pos = player_get_position_from_structure(tm->structure, tm->players->len);
     new.cpos = new.pos;
-    new.age = math_gauss_dist(const_float_fast(float_player_age_lower),
-			      const_float_fast(float_player_age_upper));//30;
+    new.age = math_gauss_dist(const_float(float_player_age_lower),
+			      const_float(float_player_age_upper));//30;
     new.peak_age = 
-	math_rnd(const_float_fast(float_player_peak_age_lower) +
+	math_rnd(const_float(float_player_peak_age_lower) +
 		 (new.pos == PLAYER_POS_GOALIE) *
-		 const_float_fast(float_player_peak_age_goalie_addition),
-		 const_float_fast(float_player_peak_age_upper) +
+		 const_float(float_player_peak_age_goalie_addition),
+		 const_float(float_player_peak_age_upper) +
 		 (new.pos == PLAYER_POS_GOALIE) *
-		 const_float_fast(float_player_peak_age_goalie_addition));//30;
+		 const_float(float_player_peak_age_goalie_addition));//30;
 
     new.peak_region = 
-	math_gauss_dist(const_float_fast(float_player_peak_region_lower),
-			const_float_fast(float_player_peak_region_upper));//2;
+	math_gauss_dist(const_float(float_player_peak_region_lower),
+			const_float(float_player_peak_region_upper));//2;
 
     new.talent = 
 	CLAMP(average_talent * skill_factor, 0,
-	      const_float_fast(float_player_max_skill));;
+	      const_float(float_player_max_skill));;
 
     new.skill = player_skill_from_talent(&new);
     new.cskill = new.skill;
     player_estimate_talent(&new);
 
-    new.fitness = math_rnd(const_float_fast(float_player_fitness_lower),
-			   const_float_fast(float_player_fitness_upper));
+    new.fitness = math_rnd(const_float(float_player_fitness_lower),
+			   const_float(float_player_fitness_upper));
     new.health = new.recovery = 0;
     new.value = player_assign_value(&new);
     new.wage = player_assign_wage(&new);
-    new.contract = math_rnd(const_float_fast(float_player_contract_lower),
-			    const_float_fast(float_player_contract_upper));
-    new.lsu = math_rnd(const_float_fast(float_player_lsu_lower),
-		       const_float_fast(float_player_lsu_upper));
+    new.contract = math_rnd(const_float(float_player_contract_lower),
+			    const_float(float_player_contract_upper));
+    new.lsu = math_rnd(const_float(float_player_lsu_lower),
+		       const_float(float_player_lsu_upper));
     new.stats = g_array_new(FALSE, FALSE, sizeof(PlayerCompetitionStats));
+    new.stats_slots = NULL;
     new.card_status = PLAYER_CARD_STATUS_NONE;
 
     for(i=0;i<PLAYER_VALUE_END;i++)
@@ -130,34 +132,34 @@ player_complete_def(Player *pl, gfloat average_talent)
 
     gint i;
     gfloat skill_factor = 
-	math_rnd(1 - const_float("float_player_average_talent_variance"),
-		 1 + const_float("float_player_average_talent_variance"));
+	math_rnd(1 - const_float(float_player_average_talent_variance),
+		 1 + const_float(float_player_average_talent_variance));
 
-    pl->peak_age = math_rnd(const_float("float_player_peak_age_lower") +
+    pl->peak_age = math_rnd(const_float(float_player_peak_age_lower) +
 			    (pl->pos == PLAYER_POS_GOALIE) * 
-			    const_float("float_player_peak_age_goalie_addition"),
-			    const_float("float_player_peak_age_upper") +
+			    const_float(float_player_peak_age_goalie_addition),
+			    const_float(float_player_peak_age_upper) +
 			    (pl->pos == PLAYER_POS_GOALIE) * 
-		 const_float("float_player_peak_age_goalie_addition"));
+		 const_float(float_player_peak_age_goalie_addition));
 
-    if(opt_int("int_opt_load_defs") == 2)
+    if(opt_int(int_opt_load_defs) == 2)
     {
-	pl->age = math_gauss_dist(const_float("float_player_age_lower"),
-				  const_float("float_player_age_upper"));
+	pl->age = math_gauss_dist(const_float(float_player_age_lower),
+				  const_float(float_player_age_upper));
 	pl->peak_age =
-	    math_rnd(const_float("float_player_peak_age_lower") +
+	    math_rnd(const_float(float_player_peak_age_lower) +
 		     (pl->pos == PLAYER_POS_GOALIE) * 
-		     const_float("float_player_peak_age_goalie_addition"),
-		     const_float("float_player_peak_age_upper") +
+		     const_float(float_player_peak_age_goalie_addition),
+		     const_float(float_player_peak_age_upper) +
 		     (pl->pos == PLAYER_POS_GOALIE) * 
-		     const_float("float_player_peak_age_goalie_addition"));
+		     const_float(float_player_peak_age_goalie_addition));
 
 	pl->peak_region = 
-	    math_gauss_dist(const_float("float_player_peak_region_lower"),
-			    const_float("float_player_peak_region_upper"));
+	    math_gauss_dist(const_float(float_player_peak_region_lower),
+			    const_float(float_player_peak_region_upper));
 
 	pl->talent = CLAMP(average_talent * skill_factor, 0, 
-			   const_float_fast(float_player_max_skill));
+			   const_float(float_player_max_skill));
 	pl->skill = player_skill_from_talent(pl);
     }
 
@@ -165,17 +167,18 @@ player_complete_def(Player *pl, gfloat average_talent)
     player_estimate_talent(pl);
 
     pl->cskill = pl->skill;
-    pl->fitness = math_rnd(const_float("float_player_fitness_lower"),
-			   const_float("float_player_fitness_upper"));
+    pl->fitness = math_rnd(const_float(float_player_fitness_lower),
+			   const_float(float_player_fitness_upper));
 
     pl->health = pl->recovery = 0;
     pl->value = player_assign_value(pl);
     pl->wage = player_assign_wage(pl);
-    pl->contract = math_rnd(const_float("float_player_contract_lower"),
-			    const_float("float_player_contract_upper"));
-    pl->lsu = math_rnd(const_float("float_player_lsu_lower"),
-		       const_float("float_player_lsu_upper"));
+    pl->contract = math_rnd(const_float(float_player_contract_lower),
+			    const_float(float_player_contract_upper));
+    pl->lsu = math_rnd(const_float(float_player_lsu_lower),
+		       const_float(float_player_lsu_upper));
     pl->stats = g_array_new(FALSE, FALSE, sizeof(PlayerCompetitionStats));
+    pl->stats_slots = NULL;
 
     for(i=0;i<PLAYER_VALUE_END;i++)
 	pl->career[i] = 0;
@@ -208,13 +211,13 @@ player_get_position_from_structure(gint structure, gint player_number)
 	position = PLAYER_POS_GOALIE;
     else if(player_number < bound[0] ||
 	    (player_number > 10 &&
-	     player_number < (11 + (const_int_fast(int_team_cpu_players) - 11) *
-			      const_float_fast(float_player_pos_bound1))))
+	     player_number < (11 + (const_int(int_team_cpu_players) - 11) *
+			      const_float(float_player_pos_bound1))))
 	position = PLAYER_POS_DEFENDER;
     else if(player_number < bound[1] ||
 	    (player_number > 10 &&
-	     player_number < (11 + (const_int_fast(int_team_cpu_players) - 11) *
-			      const_float_fast(float_player_pos_bound2))))
+	     player_number < (11 + (const_int(int_team_cpu_players) - 11) *
+			      const_float(float_player_pos_bound2))))
 	position = PLAYER_POS_MIDFIELDER;
     else
 	position = PLAYER_POS_FORWARD;
@@ -237,22 +240,22 @@ player_skill_from_talent(const Player *pl)
     {
 	while(cur_age > pl->age)
 	{
-	    cur_age -= ((const_float_fast(float_player_lsu_update_limit) + 2) * 0.0192);
+	    cur_age -= ((const_float(float_player_lsu_update_limit) + 2) * 0.0192);
 	    if(pl->peak_age - cur_age > pl->peak_region)
 		skill *= (1 - ((pl->peak_age - cur_age) * 
-			       const_float_fast(float_player_skill_update_younger_factor) +
-			       const_float_fast(float_player_skill_update_younger_add)));
+			       const_float(float_player_skill_update_younger_factor) +
+			       const_float(float_player_skill_update_younger_add)));
 	}
     }
     else
     {
 	while(cur_age < pl->age)
 	{
-	    cur_age += ((const_float_fast(float_player_lsu_update_limit) + 2) * 0.0192);
+	    cur_age += ((const_float(float_player_lsu_update_limit) + 2) * 0.0192);
 	    if(cur_age - pl->peak_age > pl->peak_region)
 		skill *= (1 - ((cur_age - pl->peak_age) * 
-			       const_float_fast(float_player_skill_update_older_factor) +
-			       const_float_fast(float_player_skill_update_older_add)));
+			       const_float(float_player_skill_update_older_factor) +
+			       const_float(float_player_skill_update_older_add)));
 	}
     }
 
@@ -276,12 +279,12 @@ player_estimate_talent(Player *pl)
 
     /* the maximal deviance in both directions */
     gfloat deviance_bound[2] =
-	{pl->talent - pl->skill, const_float_fast(float_player_max_skill) - pl->talent};
+	{pl->talent - pl->skill, const_float(float_player_max_skill) - pl->talent};
 
     for(i=0;i<QUALITY_END;i++)
     {
-	scout_deviance[i] = (i + 1) * const_float_fast(float_player_max_skill) *
-	    (const_float_fast(float_player_etal_scout_factor) / 100);
+	scout_deviance[i] = (i + 1) * const_float(float_player_max_skill) *
+	    (const_float(float_player_etal_scout_factor) / 100);
 	/* adjust deviance_bounds with regard to the scout's
 	   deviance */
 	for(j=0;j<2;j++)
@@ -305,15 +308,15 @@ player_assign_value(const Player *pl)
 
     gfloat value;
 
-    value = powf((const_float_fast(float_player_value_skill_weight) * pl->skill +
-		  (1 - const_float_fast(float_player_value_skill_weight)) * 
-		  pl->talent * 0.7), const_float_fast(float_player_value_power));
+    value = powf((const_float(float_player_value_skill_weight) * pl->skill +
+		  (1 - const_float(float_player_value_skill_weight)) * 
+		  pl->talent * 0.7), const_float(float_player_value_power));
     
     if(pl->peak_age > pl->age)
-	value *= (1 + const_float_fast(float_player_value_younger_factor) *
+	value *= (1 + const_float(float_player_value_younger_factor) *
 		  (pl->peak_age - pl->age));
     else
-	value *= (1 - const_float_fast(float_player_value_older_factor) *
+	value *= (1 - const_float(float_player_value_older_factor) *
 		  (pl->age - pl->peak_age));
 
     return math_round_integer((gint)rint(value), 2);
@@ -332,9 +335,9 @@ player_assign_wage(const Player *pl)
 
     gfloat wage;
 
-    wage = rint(((gfloat)pl->value * const_float_fast(float_player_wage_value_factor)) *
-		math_rnd(1 - const_float_fast(float_player_wage_random_dev),
-			 1 + const_float_fast(float_player_wage_random_dev) ));
+    wage = rint(((gfloat)pl->value * const_float(float_player_wage_value_factor)) *
+		math_rnd(1 - const_float(float_player_wage_random_dev),
+			 1 + const_float(float_player_wage_random_dev) ));
 
     return math_round_integer((gint)wage, 1);
 }
@@ -511,12 +514,15 @@ player_compare_func(gconstpointer a, gconstpointer b, gpointer data)
     }
     else if(type == PLAYER_COMPARE_ATTRIBUTE_LEAGUE_GOALS)
     {
-	gint goals1 = player_games_goals_get(pl1, pl1->team->league->c.id, PLAYER_VALUE_GOALS),
-	    games1 = player_games_goals_get(pl1, pl1->team->league->c.id, PLAYER_VALUE_GAMES),
-	    shots1 = player_games_goals_get(pl1, pl1->team->league->c.id, PLAYER_VALUE_SHOTS),
-	    goals2 = player_games_goals_get(pl2, pl2->team->league->c.id, PLAYER_VALUE_GOALS),
-	    games2 = player_games_goals_get(pl2, pl2->team->league->c.id, PLAYER_VALUE_GAMES),
-	    shots2 = player_games_goals_get(pl2, pl2->team->league->c.id, PLAYER_VALUE_SHOTS);
+	const PlayerCompetitionStats 
+	    *stats1 = player_competition_stats_get(pl1, &pl1->team->league->c),
+	    *stats2 = player_competition_stats_get(pl2, &pl2->team->league->c);
+	gint goals1 = (stats1 == NULL) ? 0 : stats1->goals,
+	    games1 = (stats1 == NULL) ? 0 : stats1->games,
+	    shots1 = (stats1 == NULL) ? 0 : stats1->shots,
+	    goals2 = (stats2 == NULL) ? 0 : stats2->goals,
+	    games2 = (stats2 == NULL) ? 0 : stats2->games,
+	    shots2 = (stats2 == NULL) ? 0 : stats2->shots;
 
 	if(goals1 != goals2)
 	    return_value = misc_int_compare(goals1, goals2);
@@ -550,9 +556,9 @@ player_compare_substitute_func(gconstpointer a, gconstpointer b, gpointer data)
     const Player *pl2 = *(const Player**)b;
     gint position = GPOINTER_TO_INT(data);
     gfloat skill_for_pos1 = player_get_cskill(pl1, position, FALSE) * 
-	powf(pl1->fitness, const_float_fast(float_player_fitness_exponent)),
+	powf(pl1->fitness, const_float(float_player_fitness_exponent)),
 	skill_for_pos2 = player_get_cskill(pl2, position, FALSE) * 
-	powf(pl2->fitness, const_float_fast(float_player_fitness_exponent));
+	powf(pl2->fitness, const_float(float_player_fitness_exponent));
     gfloat game_skill1 = player_get_game_skill(pl1, FALSE, TRUE),
 	game_skill2 = player_get_game_skill(pl2, FALSE, TRUE);
     gboolean good_structure1 =
@@ -814,14 +820,14 @@ gfloat
 player_get_game_skill(const Player *pl, gboolean skill, gboolean count_special)
 {
     gfloat boost = (count_special) ? 
-	1 + const_float_fast(float_player_boost_skill_effect) * pl->team->boost : 1;
+	1 + const_float(float_player_boost_skill_effect) * pl->team->boost : 1;
     gfloat streak = (count_special) ?
-	1 + (gfloat)pl->streak * const_float_fast(float_player_streak_influence_skill) : 1;
+	1 + (gfloat)pl->streak * const_float(float_player_streak_influence_skill) : 1;
     
     return (skill) ? pl->skill * boost * streak *
-	powf(pl->fitness, const_float_fast(float_player_fitness_exponent))	:
+	powf(pl->fitness, const_float(float_player_fitness_exponent))	:
 	pl->cskill * boost * streak *
-	powf(pl->fitness, const_float_fast(float_player_fitness_exponent));
+	powf(pl->fitness, const_float(float_player_fitness_exponent));
 }
 
 /** Decrease a player's fitness during a match.
@@ -834,31 +840,31 @@ player_decrease_fitness(Player *pl)
 #endif
 
     gfloat goalie_factor = 
-	1 - const_float_fast(float_player_fitness_decrease_factor_goalie) *
+	1 - const_float(float_player_fitness_decrease_factor_goalie) *
 	(pl->cpos == 0);
     gfloat boost_factor = 
 	1 + (gfloat)pl->team->boost * 
-	const_float_fast(float_player_boost_fitness_effect);
+	const_float(float_player_boost_fitness_effect);
     gfloat streak_factor = 1 + (gfloat)pl->streak * 
-	const_float_fast(float_player_streak_influence_fitness_decrease);
+	const_float(float_player_streak_influence_fitness_decrease);
 
     if(pl->age < pl->peak_age - pl->peak_region)
     {
 	pl->fitness -= (((pl->peak_age - pl->peak_region - pl->age) *
-			 const_float_fast(float_player_fitness_decrease_younger_factor) +
-			 const_float_fast(float_player_fitness_decrease_add)) *
+			 const_float(float_player_fitness_decrease_younger_factor) +
+			 const_float(float_player_fitness_decrease_add)) *
 			goalie_factor * boost_factor * streak_factor);
     }
     else if(pl->age > pl->peak_age + pl->peak_region)
     {
 	pl->fitness -= (((pl->age - pl->peak_age - pl->peak_region) *
-			 const_float("float_player_fitness_decrease_older_factor") +
-			 const_float_fast(float_player_fitness_decrease_add)) *
+			 const_float(float_player_fitness_decrease_older_factor) +
+			 const_float(float_player_fitness_decrease_add)) *
 			goalie_factor * boost_factor * streak_factor);
     }
     else
     {
-	pl->fitness -= (const_float_fast(float_player_fitness_decrease_add) *
+	pl->fitness -= (const_float(float_player_fitness_decrease_add) *
 			goalie_factor * boost_factor * streak_factor);
     }
 
@@ -880,10 +886,10 @@ player_update_fitness(Player *pl)
 #endif
 
     gfloat variance = 
-	math_rnd(1 - const_float_fast(float_player_fitness_increase_variance),
-		 1 + const_float_fast(float_player_fitness_increase_variance));
+	math_rnd(1 - const_float(float_player_fitness_increase_variance),
+		 1 + const_float(float_player_fitness_increase_variance));
     gfloat streak_factor = 
-	1 + (pl->streak * const_float_fast(float_player_streak_influence_fitness_increase));
+	1 + (pl->streak * const_float(float_player_streak_influence_fitness_increase));
 
     if(pl->participation)
     {
@@ -893,48 +899,164 @@ player_update_fitness(Player *pl)
 
     if(pl->age < pl->peak_age - pl->peak_region)
 	pl->fitness += (((pl->peak_age - pl->peak_region - pl->age) *
-			 const_float_fast(float_player_fitness_increase_younger_factor) +
-			 const_float_fast(float_player_fitness_increase_add)) *
+			 const_float(float_player_fitness_increase_younger_factor) +
+			 const_float(float_player_fitness_increase_add)) *
 			variance * streak_factor);
     else if(pl->age > pl->peak_age + pl->peak_region)
 	pl->fitness += (((pl->age - pl->peak_age - pl->peak_region) *
-			 const_float("float_player_fitness_increase_older_factor") +
-			 const_float_fast(float_player_fitness_increase_add)) *
+			 const_float(float_player_fitness_increase_older_factor) +
+			 const_float(float_player_fitness_increase_add)) *
 			variance * streak_factor);
     else
-	pl->fitness += (const_float_fast(float_player_fitness_increase_add) * 
+	pl->fitness += (const_float(float_player_fitness_increase_add) * 
 			variance * streak_factor);
 
     pl->fitness = MIN(pl->fitness, 1);
 }
 
+/** Return the index of the player's stats for the
+    competition in the stats array or -1. */
+static gint
+player_stats_get_index(const Player *pl, const Competition *competition)
+{
+    gint i, idx = -1;
+
+    if(competition->slot == -1)
+    {
+	/* Not a competition of the game (see competition_assign_slots()). */
+	for(i=0;i<pl->stats->len;i++)
+	    if(g_array_index(pl->stats, PlayerCompetitionStats, i).competition->id ==
+	       competition->id)
+		return i;
+
+	return -1;
+    }
+
+    if(pl->stats_slots != NULL && competition->slot < pl->stats_slots->len)
+	idx = g_array_index(pl->stats_slots, gint, competition->slot) - 1;
+
+    if(debug > 130)
+    {
+	for(i=0;i<pl->stats->len;i++)
+	    if(g_array_index(pl->stats, PlayerCompetitionStats, i).competition->id ==
+	       competition->id)
+		break;
+
+	if(i == pl->stats->len)
+	    i = -1;
+
+	if(i != idx)
+	    main_exit_program(EXIT_INT_NOT_FOUND,
+			      "player_stats_get_index: stats slots of player %s broken (%d %d).\n",
+			      pl->name, idx, i);
+    }
+
+    return idx;
+}
+
+/** Enter the stats with the given index into
+    the player's stats slots. */
+static void
+player_stats_slots_add(Player *pl, gint idx)
+{
+    gint slot = g_array_index(pl->stats, PlayerCompetitionStats, idx).competition->slot,
+	len;
+
+    if(slot == -1)
+	return;
+
+    if(pl->stats_slots == NULL)
+	pl->stats_slots = g_array_new(FALSE, FALSE, sizeof(gint));
+
+    len = pl->stats_slots->len;
+    if(slot >= len)
+    {
+	g_array_set_size(pl->stats_slots, slot + 1);
+	memset(&g_array_index(pl->stats_slots, gint, len), 0,
+	       (slot + 1 - len) * sizeof(gint));
+    }
+
+    g_array_index(pl->stats_slots, gint, slot) = idx + 1;
+}
+
+/** Rebuild the stats slots of the player from the stats array.
+    Has to be called when the stats competitions
+    get set without the stats accessors, e.g. when loading. */
+void
+player_stats_slots_update(Player *pl)
+{
+#ifdef DEBUG
+    printf("player_stats_slots_update\n");
+#endif
+
+    gint i;
+
+    free_g_array(&pl->stats_slots);
+
+    for(i=pl->stats->len - 1;i>=0;i--)
+	player_stats_slots_add(pl, i);
+}
+
+/** Return the stats (games, goals, cards) of a player
+    for a league or cup.
+    @param pl The player.
+    @param competition The cup or league.
+    @return The stats or NULL if the player has none
+    for the competition. */
+const PlayerCompetitionStats*
+player_competition_stats_get(const Player *pl, const Competition *competition)
+{
+#ifdef DEBUG
+    printf("player_competition_stats_get\n");
+#endif
+
+    gint idx = player_stats_get_index(pl, competition);
+
+    return (idx == -1) ?
+	NULL : &g_array_index(pl->stats, PlayerCompetitionStats, idx);
+}
+
+/** Return the stats of a player for a competition,
+    adding empty stats if he has none yet. */
+static PlayerCompetitionStats*
+player_competition_stats_get_new(Player *pl, Competition *competition)
+{
+    gint idx = player_stats_get_index(pl, competition);
+    PlayerCompetitionStats new;
+
+    if(idx == -1)
+    {
+	memset(&new, 0, sizeof(new));
+	new.competition = competition;
+
+	g_array_append_val(pl->stats, new);
+	idx = pl->stats->len - 1;
+	player_stats_slots_add(pl, idx);
+    }
+
+    return &g_array_index(pl->stats, PlayerCompetitionStats, idx);
+}
+
 /** Return the number of yellow cards of a player
     or the number of weeks banned.
     @param pl The player.
-    @param clid The cup or league id.
+    @param competition The cup or league.
     @param card_type Whether red or yellow cards. */
 gint
-player_card_get(const Player *pl, gint clid, gint card_type)
+player_card_get(const Player *pl, const Competition *competition, gint card_type)
 {
 #ifdef DEBUG
     printf("player_card_get\n");
 #endif
 
-    gint i;
-    gint return_value = 0;
-    
-    for(i=0;i<pl->stats->len;i++)
-	if(g_array_index(pl->stats, PlayerCompetitionStats, i).competition->id == clid)
-	{
-	    if(card_type == PLAYER_VALUE_CARD_YELLOW)
-		return_value = g_array_index(pl->stats, PlayerCompetitionStats, i).yellow;
-	    else
-		return_value = g_array_index(pl->stats, PlayerCompetitionStats, i).red;
+    const PlayerCompetitionStats *stats = 
+	player_competition_stats_get(pl, competition);
 
-	    break;
-	}
+    if(stats == NULL)
+	return 0;
 
-    return return_value;
+    return (card_type == PLAYER_VALUE_CARD_YELLOW) ?
+	stats->yellow : stats->red;
 }
 
 /** Change a card value for the player.
@@ -952,67 +1074,48 @@ player_card_set(Player *pl, Competition *competition, gint card_type,
     printf("player_card_set\n");
 #endif
 
-    gint i, *card_value = NULL;
-    PlayerCompetitionStats new;
-
-    for(i=0;i<pl->stats->len;i++)
-	if(g_array_index(pl->stats, PlayerCompetitionStats, i).competition->id == competition->id)
-	{
-	    if(card_type == PLAYER_VALUE_CARD_YELLOW)
-		card_value = &g_array_index(pl->stats, PlayerCompetitionStats, i).yellow;
-	    else if(card_type == PLAYER_VALUE_CARD_RED)
-		card_value = &g_array_index(pl->stats, PlayerCompetitionStats, i).red;
-
-	    if(diff)
-		*card_value += value;
-	    else
-		*card_value = value;
-
-	    if(*card_value < 0)
-	    {
-		debug_print_message("player_card_set: negative card value; setting to 0\n");
-		*card_value = 0;
-	    }
-	    
-	    return;
-	}
-
-    memset(&new, 0, sizeof(new));
-    new.competition = competition;
+    PlayerCompetitionStats *stats = 
+	player_competition_stats_get_new(pl, competition);
+    gint *card_value = (card_type == PLAYER_VALUE_CARD_YELLOW) ?
+	&stats->yellow : &stats->red;
 
-    g_array_append_val(pl->stats, new);
+    if(diff)
+	*card_value += value;
+    else
+	*card_value = value;
 
-    player_card_set(pl, competition, card_type, value, diff);
+    if(*card_value < 0)
+    {
+	debug_print_message("player_card_set: negative card value; setting to 0\n");
+	*card_value = 0;
+    }
 }
 
 /** Return the number of games or goals.
     @param pl The player.
-    @param clid The cup or league id.
+    @param competition The cup or league.
     @param card_type Whether games or goals cards. */
 gint
-player_games_goals_get(const Player *pl, gint clid, gint type)
+player_games_goals_get(const Player *pl, const Competition *competition, gint type)
 {
 #ifdef DEBUG
     printf("player_games_goals_get\n");
 #endif
 
-    gint i, return_value = 0;
+    const PlayerCompetitionStats *stats = 
+	player_competition_stats_get(pl, competition);
 
-    for(i=0;i<pl->stats->len;i++)
-	if(g_array_index(pl->stats, PlayerCompetitionStats, i).competition->id == clid)
-	{
-	    if(type == PLAYER_VALUE_GAMES)
-		return_value = g_array_index(pl->stats, PlayerCompetitionStats, i).games;
-	    else if(type == PLAYER_VALUE_GOALS)
-		return_value = g_array_index(pl->stats, PlayerCompetitionStats, i).goals;
-	    else if(type == PLAYER_VALUE_SHOTS)
-		return_value = g_array_index(pl->stats, PlayerCompetitionStats, i).shots;
-	    else
-		main_exit_program(EXIT_INT_NOT_FOUND, 
-				  "player_games_goals_get: unknown type %d.\n", type);
-	}
+    if(type == PLAYER_VALUE_GAMES)
+	return (stats == NULL) ? 0 : stats->games;
+    else if(type == PLAYER_VALUE_GOALS)
+	return (stats == NULL) ? 0 : stats->goals;
+    else if(type == PLAYER_VALUE_SHOTS)
+	return (stats == NULL) ? 0 : stats->shots;
 
-    return return_value;
+    main_exit_program(EXIT_INT_NOT_FOUND, 
+		      "player_games_goals_get: unknown type %d.\n", type);
+
+    return 0;
 }
 
 /** Change a card value for the player.
@@ -1030,36 +1133,24 @@ player_games_goals_set(Player *pl, Competition *competition, gint type,
     printf("player_games_goals_set\n");
 #endif
 
-    gint i, *games_goals_value = NULL;
-    PlayerCompetitionStats new;
-
-    for(i=0;i<pl->stats->len;i++)
-	if(g_array_index(pl->stats, PlayerCompetitionStats, i).competition->id == competition->id)
-	{
-	    if(type == PLAYER_VALUE_GAMES)
-		games_goals_value = &g_array_index(pl->stats, PlayerCompetitionStats, i).games;
-	    else if(type == PLAYER_VALUE_GOALS)
-		games_goals_value = &g_array_index(pl->stats, PlayerCompetitionStats, i).goals;
-	    else if(type == PLAYER_VALUE_SHOTS)
-		games_goals_value = &g_array_index(pl->stats, PlayerCompetitionStats, i).shots;
-
-	    *games_goals_value += value;
-
-	    if(*games_goals_value < 0)
-	    {
-		debug_print_message("player_games_goals_set: negative value; setting to 0\n");
-		*games_goals_value = 0;
-	    }
-	    
-	    return;
-	}
+    PlayerCompetitionStats *stats = 
+	player_competition_stats_get_new(pl, competition);
+    gint *games_goals_value = NULL;
 
-    memset(&new, 0, sizeof(new));
-    new.competition = competition;
+    if(type == PLAYER_VALUE_GAMES)
+	games_goals_value = &stats->games;
+    else if(type == PLAYER_VALUE_GOALS)
+	games_goals_value = &stats->goals;
+    else if(type == PLAYER_VALUE_SHOTS)
+	games_goals_value = &stats->shots;
 
-    g_array_append_val(pl->stats, new);
+    *games_goals_value += value;
 
-    player_games_goals_set(pl, competition, type, value);
+    if(*games_goals_value < 0)
+    {
+	debug_print_message("player_games_goals_set: negative value; setting to 0\n");
+	*games_goals_value = 0;
+    }
 }
 
 /** Update skill and lsu of a user player.
@@ -1076,37 +1167,37 @@ player_update_skill(Player *pl)
     if(!query_player_is_youth(pl))
     {
 	if(pl->age > pl->peak_age)
-	    pl->lsu += (pl->health == 0) ? 1 : const_float("float_player_lsu_injured_old");
+	    pl->lsu += (pl->health == 0) ? 1 : const_float(float_player_lsu_injured_old);
 	else if(pl->health == 0 &&
-		((gfloat)player_games_goals_get(pl, pl->team->league->c.id, PLAYER_VALUE_GAMES) / (gfloat)week >=
-		 const_float("float_player_lsu_games_percentage") || 
-		 math_rnd(0, 1) <= const_float("float_player_lsu_increase_prob")))
+		((gfloat)player_games_goals_get(pl, &pl->team->league->c, PLAYER_VALUE_GAMES) / (gfloat)week >=
+		 const_float(float_player_lsu_games_percentage) || 
+		 math_rnd(0, 1) <= const_float(float_player_lsu_increase_prob)))
 	    pl->lsu++;
     }
     else
 	pl->lsu += (pl->health != 0) ? 0 :
-	    const_float("float_youth_academy_lsu_addition_best") -
+	    const_float(float_youth_academy_lsu_addition_best) -
 	    (user_from_team(pl->team)->youth_academy.av_coach *
-	     const_float("float_youth_academy_lsu_penalty"));
+	     const_float(float_youth_academy_lsu_penalty));
 
-    if(pl->lsu < const_float_fast(float_player_lsu_update_limit) ||
-       math_rnd(0, 1) < powf(const_float("float_player_lsu_update_base_prob"),
-			     pl->lsu - const_float_fast(float_player_lsu_update_limit)))
+    if(pl->lsu < const_float(float_player_lsu_update_limit) ||
+       math_rnd(0, 1) < powf(const_float(float_player_lsu_update_base_prob),
+			     pl->lsu - const_float(float_player_lsu_update_limit)))
 	return;
 	
     pl->lsu = 0;
 
     if(pl->age < pl->peak_age - pl->peak_region)
 	pl->skill *= (1 + ((pl->peak_age - pl->age) * 
-			   const_float_fast(float_player_skill_update_younger_factor) +
-			   const_float_fast(float_player_skill_update_younger_add)));
+			   const_float(float_player_skill_update_younger_factor) +
+			   const_float(float_player_skill_update_younger_add)));
     else if(pl->age > pl->peak_age + pl->peak_region)
 	pl->skill *= (1 - ((pl->age - pl->peak_age) * 
-			   const_float("float_player_skill_update_older_factor") +
-			   const_float("float_player_skill_update_older_add")));
+			   const_float(float_player_skill_update_older_factor) +
+			   const_float(float_player_skill_update_older_add)));
     else
-	pl->skill *= math_rnd(1 - const_float("float_player_skill_update_peak"),
-			      1 + const_float("float_player_skill_update_peak"));
+	pl->skill *= math_rnd(1 - const_float(float_player_skill_update_peak),
+			      1 + const_float(float_player_skill_update_peak));
 
     pl->skill = CLAMP(pl->skill, 0, pl->talent);
     pl->cskill = player_get_cskill(pl, pl->cpos, TRUE);
@@ -1135,18 +1226,18 @@ player_update_injury(Player *pl)
     gint physio = (query_player_is_cpu(pl)) ? 
 	QUALITY_GOOD : user_from_team(pl->team)->physio;
     gfloat injury_decrease_probs[4][3] =
-	{{const_float("float_player_injury_recovery_best0"),
-	  const_float("float_player_injury_recovery_best1"),
-	  const_float("float_player_injury_recovery_best2")},
-	 {const_float("float_player_injury_recovery_good0"),
-	  const_float("float_player_injury_recovery_good1"),
-	  const_float("float_player_injury_recovery_good2")},
-	 {const_float("float_player_injury_recovery_good2"),
-	  const_float("float_player_injury_recovery_good1"),
-	  const_float("float_player_injury_recovery_good0")},
-	 {const_float("float_player_injury_recovery_best2"),
-	  const_float("float_player_injury_recovery_best1"),
-	  const_float("float_player_injury_recovery_best0")}};
+	{{const_float(float_player_injury_recovery_best0),
+	  const_float(float_player_injury_recovery_best1),
+	  const_float(float_player_injury_recovery_best2)},
+	 {const_float(float_player_injury_recovery_good0),
+	  const_float(float_player_injury_recovery_good1),
+	  const_float(float_player_injury_recovery_good2)},
+	 {const_float(float_player_injury_recovery_good2),
+	  const_float(float_player_injury_recovery_good1),
+	  const_float(float_player_injury_recovery_good0)},
+	 {const_float(float_player_injury_recovery_best2),
+	  const_float(float_player_injury_recovery_best1),
+	  const_float(float_player_injury_recovery_best0)}};
 
     for(j=1;j<3;j++)
 	injury_decrease_probs[physio][j] += injury_decrease_probs[physio][j - 1];
@@ -1163,8 +1254,8 @@ player_update_injury(Player *pl)
     if(pl->recovery == 0)
     {
 	pl->health = 0;
-	pl->fitness = math_rnd(const_float("float_player_injury_recovery_fitness_lower"),
-			       const_float("float_player_injury_recovery_fitness_upper"));
+	pl->fitness = math_rnd(const_float(float_player_injury_recovery_fitness_lower),
+			       const_float(float_player_injury_recovery_fitness_upper));
     }
 }
 
@@ -1180,9 +1271,9 @@ player_update_streak(Player *pl)
     gfloat streak_type, streak_prob, 
 	streak_length, decrease_factor = 0;
     gfloat streak_prob_factor = 
-	const_float_fast(float_player_streak_prob_max) - 
-	const_float_fast(float_player_streak_prob_zero),
-	streak_prob_add = const_float_fast(float_player_streak_prob_zero);
+	const_float(float_player_streak_prob_max) - 
+	const_float(float_player_streak_prob_zero),
+	streak_prob_add = const_float(float_player_streak_prob_zero);
 
     /** Player streak is locked. */
     if(pl->streak_count < 0)
@@ -1205,8 +1296,8 @@ player_update_streak(Player *pl)
 
 	pl->streak_count -= 
 	    (pl->streak_prob * decrease_factor *
-	     const_float("float_player_streak_count_decrease_factor") +
-	     const_float("float_player_streak_count_decrease_add"));
+	     const_float(float_player_streak_count_decrease_factor) +
+	     const_float(float_player_streak_count_decrease_add));
     
 	/** Streak is over. */
 	if(pl->streak_count <= 0)
@@ -1224,8 +1315,8 @@ player_update_streak(Player *pl)
     /** Now let's find out whether there's a new streak. */
     streak_type = math_rnd(-1, 1);
     streak_prob = math_rnd(0, 1);
-    streak_length = math_rnd(const_float_fast(float_player_streak_length_lower),
-			     const_float_fast(float_player_streak_length_upper));
+    streak_length = math_rnd(const_float(float_player_streak_length_lower),
+			     const_float(float_player_streak_length_upper));
 
     if(streak_type < pl->streak_prob &&
        ((pl->streak_prob > 0 &&  
@@ -1257,7 +1348,7 @@ player_update_weekly(Player *pl)
 
     // workaround, possibly unnecessary
     if(pl->fitness < 0)
-	pl->fitness = const_float("float_player_fitness_lower");
+	pl->fitness = const_float(float_player_fitness_lower);
     
     if(pl->health > 0)
 	player_update_injury(pl);
@@ -1270,13 +1361,13 @@ player_update_weekly(Player *pl)
     pl->age += 0.0192;
 
     if(debug < 50)
-	if(!sett_int("int_opt_disable_contracts") &&
-	   pl->age > const_float("float_player_age_lower"))
+	if(!sett_int(int_opt_disable_contracts) &&
+	   pl->age > const_float(float_player_age_lower))
 	    pl->contract -= 0.0192;
 
-    if(!sett_int("int_opt_disable_contracts") && debug < 50 &&
-       pl->contract * 12 <= opt_user_int("int_opt_user_contract_limit") &&
-       (pl->contract + 0.0192) * 12 > opt_user_int("int_opt_user_contract_limit"))
+    if(!sett_int(int_opt_disable_contracts) && debug < 50 &&
+       pl->contract * 12 <= opt_user_int(int_opt_user_contract_limit) &&
+       (pl->contract + 0.0192) * 12 > opt_user_int(int_opt_user_contract_limit))
 	user_event_add(user_from_team(pl->team), EVENT_TYPE_WARNING,
 		       -1, -1, NULL, _("%s's contract expires in %.1f years."),
 		       pl->name, pl->contract);
@@ -1340,14 +1431,14 @@ player_update_post_match(Player *pl, const Fixture *fix)
 
     gint winner = -1;
 
-    if(player_card_get(pl, fix->competition->id, PLAYER_VALUE_CARD_RED) > 0)
+    if(player_card_get(pl, fix->competition, PLAYER_VALUE_CARD_RED) > 0)
 	player_card_set(pl, fix->competition, PLAYER_VALUE_CARD_RED, -1, TRUE);
 
-    if(player_card_get(pl, fix->competition->id, PLAYER_VALUE_CARD_YELLOW) >= fix->competition->yellow_red)
+    if(player_card_get(pl, fix->competition, PLAYER_VALUE_CARD_YELLOW) >= fix->competition->yellow_red)
     {
 	player_card_set(pl, fix->competition, PLAYER_VALUE_CARD_YELLOW, 0, FALSE);
 	
-	if(player_card_get(pl, fix->competition->id, PLAYER_VALUE_CARD_RED) == 0 && debug < 50)
+	if(player_card_get(pl, fix->competition, PLAYER_VALUE_CARD_RED) == 0 && debug < 50)
 	    player_card_set(pl, fix->competition, PLAYER_VALUE_CARD_RED, 1, FALSE);
     }
 
@@ -1357,7 +1448,7 @@ player_update_post_match(Player *pl, const Fixture *fix)
        ((fix->result[0][0] == 0 && fix->teams[1] == pl->team) ||
 	(fix->result[1][0] == 0 && fix->teams[0] == pl->team)))
 	player_streak_add_to_prob(
-	    pl, const_float("float_player_streak_add_goalie_clean"));
+	    pl, const_float(float_player_streak_add_goalie_clean));
 
     /** No streak change if we had a draw. */
     if(!fix->decisive && fix->result[0][0] == fix->result[1][0])
@@ -1367,10 +1458,10 @@ player_update_post_match(Player *pl, const Fixture *fix)
 
     if(winner == pl->team->id)
 	player_streak_add_to_prob(
-	    pl, const_float("float_player_streak_add_win"));
+	    pl, const_float(float_player_streak_add_win));
     else
 	player_streak_add_to_prob(
-	    pl, const_float("float_player_streak_add_loss"));
+	    pl, const_float(float_player_streak_add_loss));
 }
 
 /** Replace a player by a new one in a cpu team. 
@@ -1496,12 +1587,13 @@ player_season_start(Player *pl, gfloat skill_change)
     {
 	g_array_free(pl->stats, TRUE);
 	pl->stats = g_array_new(FALSE, FALSE, sizeof(PlayerCompetitionStats));
+	free_g_array(&pl->stats_slots);
     }    
 
     if(skill_change != 0)
     {
 	pl->talent *= (1 + skill_change);
-	pl->talent = CLAMP(pl->talent, 0, const_float_fast(float_player_max_skill));
+	pl->talent = CLAMP(pl->talent, 0, const_float(float_player_max_skill));
 
 	pl->skill *= (1 + skill_change);
 	pl->skill = CLAMP(pl->skill, 0, pl->talent);
@@ -1610,7 +1702,7 @@ player_move_from_ya(gint idx)
     Player *pl = &g_array_index(current_user.youth_academy.players, Player, idx);
     Player player = *pl;
 
-    player.contract = const_float("float_player_contract_youth");
+    player.contract = const_float(float_player_contract_youth);
 
     g_array_remove_index(current_user.youth_academy.players, idx);
     g_array_append_val(current_user.tm->players, player);
@@ -1661,20 +1753,20 @@ query_player_star_balks(const Player *pl, const Team *tm, gboolean transfer)
     gfloat skill_limit;
 
     /* Weak players never balk. */
-    if(pl->skill < const_float("float_transfer_star_skill_limit"))
+    if(pl->skill < const_float(float_transfer_star_skill_limit))
 	return FALSE;
 
     /* There is some chance that the new star doesn't balk at all. */
-    if((transfer && math_rnd(0, 1) < const_float("float_transfer_star_no_balk")) ||
-       (!transfer && math_rnd(0, 1) < const_float("float_contract_star_no_balk")))
+    if((transfer && math_rnd(0, 1) < const_float(float_transfer_star_no_balk)) ||
+       (!transfer && math_rnd(0, 1) < const_float(float_contract_star_no_balk)))
 	return FALSE;
 
     /* Find out if there are any stars at all on the team. */
     number_of_stars_field = 
 	number_of_stars_goal = 0;
     skill_limit = (transfer ? 
-		   const_float("float_transfer_star_skill_limit") :
-		   const_float("float_contract_star_skill_limit"));
+		   const_float(float_transfer_star_skill_limit) :
+		   const_float(float_contract_star_skill_limit));
     for(i = 0; i < tm->players->len; i++)
     {
 	if(g_array_index(tm->players, Player, i).skill > skill_limit)
@@ -1691,7 +1783,7 @@ query_player_star_balks(const Player *pl, const Team *tm, gboolean transfer)
 	if(number_of_stars_goal == 0)
 	    return FALSE;
 	else
-	    return (math_rnd(0, 1) > const_float("float_transfer_star_goalie_accepts"));
+	    return (math_rnd(0, 1) > const_float(float_transfer_star_goalie_accepts));
     }
     else
     {
@@ -1699,7 +1791,7 @@ query_player_star_balks(const Player *pl, const Team *tm, gboolean transfer)
 	    return FALSE;
 	else
 	    return (math_rnd(0, 1) > 1 - number_of_stars_field * 
-		    const_float("float_transfer_star_prob_decrease"));
+		    const_float(float_transfer_star_prob_decrease));
     }
 }
 
@@ -42,12 +42,12 @@ enum PlayerCompareAttrib
 };
 
 /** Whether or not a player is a youth according to his age. */
-#define query_player_is_youth(pl) (pl->age <= const_float("float_player_age_lower"))
+#define query_player_is_youth(pl) (pl->age <= const_float(float_player_age_lower))
 /** Whether the player belongs to a cpu team. */
 #define query_player_is_cpu(pl) (team_is_user(pl->team) == -1)
 
 /** Reset the streak counter. */
-#define player_streak_reset_count(pl) pl->streak_count = -math_rnd((gfloat)const_int("int_player_streak_lock_length_lower"), (gfloat)const_int("int_player_streak_lock_length_upper"))
+#define player_streak_reset_count(pl) pl->streak_count = -math_rnd((gfloat)const_int(int_player_streak_lock_length_lower), (gfloat)const_int(int_player_streak_lock_length_upper))
 
 void
 player_init(Player *player);
@@ -112,8 +112,14 @@ player_get_game_skill(const Player *pl, gboolean skill, gboolean special);
 void
 player_decrease_fitness(Player *pl);
 
+void
+player_stats_slots_update(Player *pl);
+
+const PlayerCompetitionStats*
+player_competition_stats_get(const Player *pl, const Competition *competition);
+
 gint
-player_card_get(const Player *pl, gint clid, gint card_type);
+player_card_get(const Player *pl, const Competition *competition, gint card_type);
 
 void
 player_card_set(Player *pl, Competition *competition, gint card_type,
@@ -123,7 +129,7 @@ void
 player_games_goals_set(Player *pl, Competition *competition, gint type, gint value);
 
 gint
-player_games_goals_get(const Player *pl, gint clid, gint type);
+player_games_goals_get(const Player *pl, const Competition *competition, gint type);
 
 void
 player_update_weekly(Player *pl);
@@ -114,6 +114,7 @@ enum PlayerCardStatus
 */
 typedef struct
 {
+    /** The name, which is in the name pool. @see name_intern() */
     gchar *name;
     
     gint pos, /**< Position. @see #PlayerPos */
@@ -154,6 +155,11 @@ typedef struct
     /** Array of stats (games, goals, cards); one item per league and cup.
 	@see PlayerGamesGoals */
     GArray *stats;
+    /** Maps the slots of the competitions to the index of
+	the player's stats for them plus one (0 means no stats).
+	NULL if the player has no stats.
+	@see player_competition_stats_get(), #Competition */
+    GArray *stats_slots;
 
     /** Career goals, games etc. */
     gint career[PLAYER_VALUE_END];
@@ -0,0 +1,288 @@
+/*
+   registry.c
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include "registry.h"
+#include "variables.h"
+
+/** Where to find a fixture: the fixtures array it's
+    in and its index in the array. */
+typedef struct
+{
+    GArray **fixtures;
+    gint idx;
+} RegistryFixture;
+
+/** The registry maps the ids of teams, fixtures, leagues and cups
+    to the corresponding pointers. It gets built lazily from the
+    current country, the other countries and the international cups.
+    Adding or freeing teams and competitions invalidates it.
+    The fixture entries get updated by the functions that sort
+    or resize the fixture arrays; entries of fixtures that are
+    gone get dropped on lookup. */
+static GHashTable *registry_teams = NULL,
+    *registry_fixtures = NULL,
+    *registry_leagues = NULL,
+    *registry_cups = NULL;
+
+/** Gets increased by registry_invalidate(). */
+static guint registry_generation = 1;
+
+/** The generation the registry was built for. As long as it's
+    the current one, an unknown id simply isn't there and
+    doesn't cause a rebuild. */
+static guint registry_built_generation = 0;
+
+/** The match threads look up competitions, too. */
+static GMutex registry_mutex;
+
+/** Whether the entry points to the fixture with the given id. */
+static gboolean
+registry_fixture_valid(const RegistryFixture *entry, gint id)
+{
+    return (*entry->fixtures != NULL && entry->idx < (*entry->fixtures)->len &&
+	    g_array_index(*entry->fixtures, Fixture, entry->idx).id == id);
+}
+
+/** Add the fixtures of an array to the registry.
+    @param update Whether to replace the entries that point
+    to the same array or to fixtures that are gone. */
+static void
+registry_add_fixtures(GArray **fixtures, gboolean update)
+{
+    gint i, id;
+    RegistryFixture *entry = NULL;
+
+    for(i=0;i<(*fixtures)->len;i++)
+    {
+	id = g_array_index(*fixtures, Fixture, i).id;
+	entry = (RegistryFixture*)g_hash_table_lookup(registry_fixtures,
+						      GINT_TO_POINTER(id));
+	if(entry == NULL)
+	{
+	    entry = g_new(RegistryFixture, 1);
+	    entry->fixtures = fixtures;
+	    entry->idx = i;
+	    g_hash_table_insert(registry_fixtures, GINT_TO_POINTER(id), entry);
+	}
+	else if(update &&
+		(entry->fixtures == fixtures || !registry_fixture_valid(entry, id)))
+	{
+	    entry->fixtures = fixtures;
+	    entry->idx = i;
+	}
+    }
+}
+
+/** Add the teams of a leagues array to the registry. */
+static void
+registry_add_teams(const GPtrArray *leagues)
+{
+    gint i, j;
+    Team *tm = NULL;
+
+    for(i=0;i<leagues->len;i++)
+    {
+	const League *league = g_ptr_array_index(leagues, i);
+	for(j=0;j<league->c.teams->len;j++)
+	{
+	    tm = g_ptr_array_index(league->c.teams, j);
+	    if(!g_hash_table_contains(registry_teams, GINT_TO_POINTER(tm->id)))
+		g_hash_table_insert(registry_teams, GINT_TO_POINTER(tm->id), tm);
+	}
+    }
+}
+
+/** Add the cups of an array to the registry. */
+static void
+registry_add_cups(const GPtrArray *cups)
+{
+    gint i;
+    Cup *cup = NULL;
+
+    for(i=0;i<cups->len;i++)
+    {
+	cup = g_ptr_array_index(cups, i);
+	if(!g_hash_table_contains(registry_cups, GINT_TO_POINTER(cup->c.id)))
+	    g_hash_table_insert(registry_cups, GINT_TO_POINTER(cup->c.id), cup);
+	registry_add_fixtures(&cup->fixtures, FALSE);
+    }
+}
+
+/** Fill the registry anew. If an id occurs more than once,
+    the first one found wins, in the same order the
+    old linear searches used. */
+static void
+registry_rebuild(void)
+{
+#ifdef DEBUG
+    printf("registry_rebuild\n");
+#endif
+
+    gint i;
+    League *league = NULL;
+
+    if(registry_teams == NULL)
+    {
+	registry_teams = g_hash_table_new(g_direct_hash, g_direct_equal);
+	registry_fixtures = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+						  NULL, g_free);
+	registry_leagues = g_hash_table_new(g_direct_hash, g_direct_equal);
+	registry_cups = g_hash_table_new(g_direct_hash, g_direct_equal);
+    }
+    else
+    {
+	g_hash_table_remove_all(registry_teams);
+	g_hash_table_remove_all(registry_fixtures);
+	g_hash_table_remove_all(registry_leagues);
+	g_hash_table_remove_all(registry_cups);
+    }
+
+    if(country.leagues != NULL)
+    {
+	for(i=0;i<country.leagues->len;i++)
+	{
+	    league = g_ptr_array_index(country.leagues, i);
+	    if(!g_hash_table_contains(registry_leagues, GINT_TO_POINTER(league->c.id)))
+		g_hash_table_insert(registry_leagues, GINT_TO_POINTER(league->c.id), league);
+	    registry_add_fixtures(&league->fixtures, FALSE);
+	}
+
+	registry_add_teams(country.leagues);
+    }
+
+    if(country_list != NULL)
+	for(i=0;i<country_list->len;i++)
+	    registry_add_teams(((Country*)g_ptr_array_index(country_list, i))->leagues);
+
+    if(country.cups != NULL)
+	registry_add_cups(country.cups);
+
+    if(country.bygfoot != NULL && country.bygfoot->international_cups != NULL)
+	registry_add_cups(country.bygfoot->international_cups);
+
+    registry_built_generation = registry_generation;
+}
+
+/** Look up a key in one of the tables, rebuilding the
+    registry first if it's out of date. The caller has to hold the mutex. */
+static gpointer
+registry_lookup(GHashTable **table, gint key)
+{
+    if(registry_built_generation != registry_generation)
+	registry_rebuild();
+
+    return g_hash_table_lookup(*table, GINT_TO_POINTER(key));
+}
+
+/** Return the team with the given id or NULL. */
+Team*
+registry_get_team(gint id)
+{
+    Team *tm = NULL;
+
+    g_mutex_lock(&registry_mutex);
+    tm = (Team*)registry_lookup(&registry_teams, id);
+    g_mutex_unlock(&registry_mutex);
+
+    return tm;
+}
+
+/** Return the fixture with the given id or NULL.
+    The pointer is only valid until the fixture array
+    of the competition gets changed. */
+Fixture*
+registry_get_fixture(gint id)
+{
+    RegistryFixture *entry = NULL;
+    Fixture *fix = NULL;
+
+    g_mutex_lock(&registry_mutex);
+    entry = (RegistryFixture*)registry_lookup(&registry_fixtures, id);
+    if(entry != NULL)
+    {
+	if(registry_fixture_valid(entry, id))
+	    fix = &g_array_index(*entry->fixtures, Fixture, entry->idx);
+	else
+	    /* The fixture got removed from its array. */
+	    g_hash_table_remove(registry_fixtures, GINT_TO_POINTER(id));
+    }
+    g_mutex_unlock(&registry_mutex);
+
+    return fix;
+}
+
+/** Return the league with the given id or NULL. */
+League*
+registry_get_league(gint clid)
+{
+    League *league = NULL;
+
+    g_mutex_lock(&registry_mutex);
+    league = (League*)registry_lookup(&registry_leagues, clid);
+    g_mutex_unlock(&registry_mutex);
+
+    return league;
+}
+
+/** Return the cup with the given id or NULL. */
+Cup*
+registry_get_cup(gint clid)
+{
+    Cup *cup = NULL;
+
+    g_mutex_lock(&registry_mutex);
+    cup = (Cup*)registry_lookup(&registry_cups, clid);
+    g_mutex_unlock(&registry_mutex);
+
+    return cup;
+}
+
+/** Update the entries of a fixture array after
+    fixtures got written, removed or sorted.
+    @param fixtures The address of the array in its league or cup. */
+void
+registry_update_fixtures(GArray **fixtures)
+{
+#ifdef DEBUG
+    printf("registry_update_fixtures\n");
+#endif
+
+    g_mutex_lock(&registry_mutex);
+    /* An out of date registry gets rebuilt on the next lookup anyway. */
+    if(registry_built_generation == registry_generation)
+	registry_add_fixtures(fixtures, TRUE);
+    g_mutex_unlock(&registry_mutex);
+}
+
+/** Mark the registry as out of date. Has to be called
+    whenever teams, leagues or cups get added, freed or removed
+    and when fixtures get loaded. */
+void
+registry_invalidate(void)
+{
+    g_mutex_lock(&registry_mutex);
+    registry_generation++;
+    g_mutex_unlock(&registry_mutex);
+}
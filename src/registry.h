@@ -0,0 +1,53 @@
+/*
+   registry.h
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef REGISTRY_H
+#define REGISTRY_H
+
+#include "bygfoot.h"
+#include "cup_struct.h"
+#include "fixture_struct.h"
+#include "league_struct.h"
+#include "team_struct.h"
+
+Team*
+registry_get_team(gint id);
+
+Fixture*
+registry_get_fixture(gint id);
+
+League*
+registry_get_league(gint clid);
+
+Cup*
+registry_get_cup(gint clid);
+
+void
+registry_update_fixtures(GArray **fixtures);
+
+void
+registry_invalidate(void);
+
+#endif
@@ -0,0 +1,966 @@
+/*
+   snapshot.c
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <string.h>
+
+#include "bet_struct.h"
+#include "cup_struct.h"
+#include "fixture.h"
+#include "free.h"
+#include "job_struct.h"
+#include "league_struct.h"
+#include "misc.h"
+#include "option.h"
+#include "registry.h"
+#include "snapshot.h"
+#include "table.h"
+#include "transfer_struct.h"
+#include "user.h"
+#include "variables.h"
+
+/* A snapshot gets copied in two passes: first all the structures
+   are duplicated and the addresses of the copied countries, leagues,
+   cups, teams, fixtures and users are stored in a hash table
+   mapping the old addresses to the new ones. Then the pointers in the
+   copy get replaced using the table, so the copy doesn't reference
+   anything in the original. Pointers to objects that aren't
+   part of the state any more (eg. the fixture of an old live game)
+   end up NULL. */
+
+/** Return the copy of the object at the given address
+    or NULL if it wasn't copied. */
+static gpointer
+snapshot_ptr(GHashTable *map, gconstpointer ptr)
+{
+    if(ptr == NULL)
+	return NULL;
+
+    return g_hash_table_lookup(map, ptr);
+}
+
+#define snapshot_remap(map, ptr) ((ptr) = snapshot_ptr(map, ptr))
+
+/** Return a copy of the array (NULL if the array is NULL). */
+static GArray*
+snapshot_copy_g_array(const GArray *array)
+{
+    GArray *copy;
+
+    if(array == NULL)
+	return NULL;
+
+    copy = g_array_sized_new(FALSE, FALSE,
+			     g_array_get_element_size((GArray*)array), array->len);
+    g_array_append_vals(copy, array->data, array->len);
+
+    return copy;
+}
+
+/** Return a copy of a pointer array containing strings. */
+static GPtrArray*
+snapshot_copy_gchar_array(const GPtrArray *array)
+{
+    gint i;
+    GPtrArray *copy;
+
+    if(array == NULL)
+	return NULL;
+
+    copy = g_ptr_array_new();
+    for(i=0;i<array->len;i++)
+	g_ptr_array_add(copy, g_strdup(g_ptr_array_index(array, i)));
+
+    return copy;
+}
+
+/** Replace the pointers in a pointer array by their copies. */
+static void
+snapshot_remap_ptr_array(GHashTable *map, GPtrArray *array)
+{
+    gint i;
+
+    if(array == NULL)
+	return;
+
+    for(i=0;i<array->len;i++)
+	snapshot_remap(map, g_ptr_array_index(array, i));
+}
+
+/** Copy a fixtures array and remember the new
+    addresses of the fixtures. */
+static GArray*
+snapshot_copy_fixtures(GHashTable *map, const GArray *fixtures)
+{
+    gint i;
+    GArray *copy = snapshot_copy_g_array(fixtures);
+
+    for(i=0;i<copy->len;i++)
+	g_hash_table_insert(map, &g_array_index(fixtures, Fixture, i),
+			    &g_array_index(copy, Fixture, i));
+
+    return copy;
+}
+
+/** Copy a tables array. */
+static GArray*
+snapshot_copy_tables(const GArray *tables)
+{
+    gint i;
+    Table new_table;
+    GArray *copy;
+
+    if(tables == NULL)
+	return NULL;
+
+    copy = g_array_sized_new(FALSE, FALSE, sizeof(Table), tables->len);
+    for(i=0;i<tables->len;i++)
+    {
+	new_table = table_copy(&g_array_index(tables, Table, i));
+	g_array_append_val(copy, new_table);
+    }
+
+    return copy;
+}
+
+
+static void
+snapshot_copy_league_stats(LeagueStat *stats)
+{
+    stats->league_name = g_strdup(stats->league_name);
+    stats->league_symbol = g_strdup(stats->league_symbol);
+    /* The names of the stats are in the name pool. */
+    stats->teams_off = snapshot_copy_g_array(stats->teams_off);
+    stats->teams_def = snapshot_copy_g_array(stats->teams_def);
+    stats->player_scorers = snapshot_copy_g_array(stats->player_scorers);
+    stats->player_goalies = snapshot_copy_g_array(stats->player_goalies);
+}
+
+/** Copy an array of champions. */
+static GArray*
+snapshot_copy_champs(const GArray *champs)
+{
+    gint i;
+    GArray *copy = snapshot_copy_g_array(champs);
+
+    for(i=0;i<copy->len;i++)
+    {
+	ChampStat *champ = &g_array_index(copy, ChampStat, i);
+	champ->team_name = g_strdup(champ->team_name);
+	champ->cl_name = g_strdup(champ->cl_name);
+    }
+
+    return copy;
+}
+
+/** Copy a players array. The names are in the name pool. */
+static GArray*
+snapshot_copy_players(const GArray *players)
+{
+    gint i;
+    GArray *copy = snapshot_copy_g_array(players);
+
+    if(copy == NULL)
+	return NULL;
+
+    for(i=0;i<copy->len;i++)
+    {
+	Player *pl = &g_array_index(copy, Player, i);
+	pl->stats = snapshot_copy_g_array(pl->stats);
+	pl->stats_slots = snapshot_copy_g_array(pl->stats_slots);
+    }
+
+    return copy;
+}
+
+static Team*
+snapshot_copy_team(GHashTable *map, const Team *tm)
+{
+    Team *new = g_malloc(sizeof(Team));
+
+    *new = *tm;
+    g_hash_table_insert(map, (gpointer)tm, new);
+
+    new->symbol = g_strdup(tm->symbol);
+    new->names_file = g_strdup(tm->names_file);
+    new->def_file = g_strdup(tm->def_file);
+    new->strategy_sid = g_strdup(tm->strategy_sid);
+    new->stadium.name = g_strdup(tm->stadium.name);
+    new->players = snapshot_copy_players(tm->players);
+
+    return new;
+}
+
+static League*
+snapshot_copy_league(GHashTable *map, const League *league)
+{
+    gint i;
+    League *new = g_malloc(sizeof(League));
+
+    *new = *league;
+    g_hash_table_insert(map, (gpointer)league, new);
+
+    new->c.name = g_strdup(league->c.name);
+    new->c.schedule.rounds = new->c.schedule.pairs = NULL;
+    new->c.schedule.fixtures = NULL;
+    new->short_name = g_strdup(league->short_name);
+    new->sid = g_strdup(league->sid);
+    new->symbol = g_strdup(league->symbol);
+    new->names_file = g_strdup(league->names_file);
+
+    new->c.teams = g_ptr_array_new();
+    for(i=0;i<league->c.teams->len;i++)
+	g_ptr_array_add(new->c.teams,
+			snapshot_copy_team(map, g_ptr_array_index(league->c.teams, i)));
+
+    new->prom_rel.elements = snapshot_copy_g_array(league->prom_rel.elements);
+    for(i=0;i<new->prom_rel.elements->len;i++)
+    {
+	PromRelElement *elem = &g_array_index(new->prom_rel.elements, PromRelElement, i);
+	elem->dest_sid = g_strdup(elem->dest_sid);
+    }
+
+    new->prom_rel.prom_games = snapshot_copy_g_array(league->prom_rel.prom_games);
+    for(i=0;i<new->prom_rel.prom_games->len;i++)
+    {
+	PromGames *games = &g_array_index(new->prom_rel.prom_games, PromGames, i);
+	games->dest_sid = g_strdup(games->dest_sid);
+	games->loser_sid = g_strdup(games->loser_sid);
+	games->cup_sid = g_strdup(games->cup_sid);
+    }
+
+    new->joined_leagues = snapshot_copy_g_array(league->joined_leagues);
+    for(i=0;i<new->joined_leagues->len;i++)
+	g_array_index(new->joined_leagues, JoinedLeague, i).sid =
+	    g_strdup(g_array_index(new->joined_leagues, JoinedLeague, i).sid);
+
+    new->new_tables = snapshot_copy_g_array(league->new_tables);
+    for(i=0;i<new->new_tables->len;i++)
+	g_array_index(new->new_tables, NewTable, i).name =
+	    g_strdup(g_array_index(new->new_tables, NewTable, i).name);
+
+    new->two_match_weeks[0] = snapshot_copy_g_array(league->two_match_weeks[0]);
+    new->two_match_weeks[1] = snapshot_copy_g_array(league->two_match_weeks[1]);
+    new->rr_breaks = snapshot_copy_g_array(league->rr_breaks);
+    new->week_breaks = snapshot_copy_g_array(league->week_breaks);
+    new->tables = snapshot_copy_tables(league->tables);
+    new->fixtures = snapshot_copy_fixtures(map, league->fixtures);
+    new->properties = snapshot_copy_gchar_array(league->properties);
+    new->skip_weeks_with = snapshot_copy_gchar_array(league->skip_weeks_with);
+    snapshot_copy_league_stats(&new->stats);
+
+    return new;
+}
+
+static void
+snapshot_copy_cup_round(CupRound *round)
+{
+    gint i;
+    CupChooseTeam *ct;
+
+    round->name = g_strdup(round->name);
+    round->rr_breaks = snapshot_copy_g_array(round->rr_breaks);
+    round->two_match_weeks[0] = snapshot_copy_g_array(round->two_match_weeks[0]);
+    round->two_match_weeks[1] = snapshot_copy_g_array(round->two_match_weeks[1]);
+    round->team_ptrs = misc_copy_ptr_array(round->team_ptrs);
+    round->tables = snapshot_copy_tables(round->tables);
+
+    round->waits = snapshot_copy_g_array(round->waits);
+    for(i=0;i<round->waits->len;i++)
+	g_array_index(round->waits, CupRoundWait, i).cup_sid =
+	    g_strdup(g_array_index(round->waits, CupRoundWait, i).cup_sid);
+
+    round->choose_teams = snapshot_copy_g_array(round->choose_teams);
+    for(i=0;i<round->choose_teams->len;i++)
+	for(ct = &g_array_index(round->choose_teams, CupChooseTeam, i);
+	    ct != NULL; ct = ct->next)
+	{
+	    ct->sid = g_strdup(ct->sid);
+	    if(ct->next != NULL)
+	    {
+		CupChooseTeam *next = g_malloc(sizeof(CupChooseTeam));
+		*next = *ct->next;
+		ct->next = next;
+	    }
+	}
+}
+
+static Cup*
+snapshot_copy_cup(GHashTable *map, const Cup *cup)
+{
+    gint i;
+    Cup *new = g_malloc(sizeof(Cup));
+
+    *new = *cup;
+    g_hash_table_insert(map, (gpointer)cup, new);
+
+    new->c.name = g_strdup(cup->c.name);
+    new->c.teams = misc_copy_ptr_array(cup->c.teams);
+    new->c.schedule.rounds = new->c.schedule.pairs = NULL;
+    new->c.schedule.fixtures = NULL;
+    new->short_name = g_strdup(cup->short_name);
+    new->symbol = g_strdup(cup->symbol);
+    new->sid = g_strdup(cup->sid);
+
+    new->properties = snapshot_copy_gchar_array(cup->properties);
+    new->skip_weeks_with = snapshot_copy_gchar_array(cup->skip_weeks_with);
+
+    new->rounds = snapshot_copy_g_array(cup->rounds);
+    for(i=0;i<new->rounds->len;i++)
+	snapshot_copy_cup_round(&g_array_index(new->rounds, CupRound, i));
+
+    new->bye = misc_copy_ptr_array(cup->bye);
+    new->fixtures = snapshot_copy_fixtures(map, cup->fixtures);
+    new->week_breaks = snapshot_copy_g_array(cup->week_breaks);
+
+    new->history = g_ptr_array_new();
+    for(i=0;i<cup->history->len;i++)
+	g_ptr_array_add(new->history,
+			misc_copy_ptr_array(g_ptr_array_index(cup->history, i)));
+
+    return new;
+}
+
+static GPtrArray*
+snapshot_copy_cups(GHashTable *map, const GPtrArray *cups)
+{
+    gint i;
+    GPtrArray *copy = g_ptr_array_new();
+
+    for(i=0;i<cups->len;i++)
+	g_ptr_array_add(copy, snapshot_copy_cup(map, g_ptr_array_index(cups, i)));
+
+    return copy;
+}
+
+/** Copy a country. Pointers to the user's country always point
+    to the #country variable, so only the other countries get
+    added to the map by the caller. */
+static void
+snapshot_copy_country(GHashTable *map, Country *dest, const Country *source)
+{
+    gint i;
+
+    *dest = *source;
+
+    dest->name = g_strdup(source->name);
+    dest->symbol = g_strdup(source->symbol);
+    dest->sid = g_strdup(source->sid);
+
+    dest->leagues = g_ptr_array_new();
+    for(i=0;i<source->leagues->len;i++)
+	g_ptr_array_add(dest->leagues,
+			snapshot_copy_league(map, g_ptr_array_index(source->leagues, i)));
+
+    dest->cups = snapshot_copy_cups(map, source->cups);
+    dest->allcups = misc_copy_ptr_array(source->allcups);
+}
+
+/** Copy a live game; the fixture pointer gets replaced later. */
+static void
+snapshot_copy_live_game(LiveGame *match)
+{
+    gint i, j, k;
+    GPtrArray *players;
+
+    if(match->units == NULL)
+	return;
+
+    match->units = snapshot_copy_g_array(match->units);
+    for(i=0;i<match->units->len;i++)
+    {
+	LiveGameEvent *event = &g_array_index(match->units, LiveGameUnit, i).event;
+	event->commentary = g_strdup(event->commentary);
+    }
+
+    for(i=0;i<2;i++)
+    {
+	match->action_ids[i] = snapshot_copy_g_array(match->action_ids[i]);
+
+	for(j=0;j<LIVE_GAME_STAT_ARRAY_END;j++)
+	{
+	    players = g_ptr_array_new();
+	    for(k=0;k<match->stats.players[i][j]->len;k++)
+		g_ptr_array_add(players,
+				g_strdup(g_ptr_array_index(match->stats.players[i][j], k)));
+	    match->stats.players[i][j] = players;
+	}
+    }
+}
+
+static void
+snapshot_copy_user(GHashTable *map, User *user, const User *source)
+{
+    gint i, j;
+
+    g_hash_table_insert(map, (gpointer)source, user);
+    g_hash_table_insert(map, (gpointer)&source->live_game, &user->live_game);
+
+    user->name = g_strdup(user->name);
+    option_list_copy(&user->options, &source->options);
+
+    user->events = snapshot_copy_g_array(user->events);
+    for(i=0;i<user->events->len;i++)
+	g_array_index(user->events, Event, i).value_string =
+	    g_strdup(g_array_index(user->events, Event, i).value_string);
+
+    user->history = snapshot_copy_g_array(user->history);
+    for(i=0;i<user->history->len;i++)
+    {
+	UserHistory *history = &g_array_index(user->history, UserHistory, i);
+	history->team_name = g_strdup(history->team_name);
+	for(j=0;j<3;j++)
+	    history->string[j] = g_strdup(history->string[j]);
+    }
+
+    snapshot_copy_live_game(&user->live_game);
+
+    if(user->sponsor.name != NULL)
+	user->sponsor.name = g_string_new(user->sponsor.name->str);
+
+    user->youth_academy.players = snapshot_copy_players(user->youth_academy.players);
+
+    user->mmatches_file = g_strdup(user->mmatches_file);
+    user->mmatches = snapshot_copy_g_array(user->mmatches);
+    for(i=0;i<user->mmatches->len;i++)
+    {
+	MemMatch *mmatch = &g_array_index(user->mmatches, MemMatch, i);
+	if(mmatch->competition_name != NULL)
+	    mmatch->competition_name = g_string_new(mmatch->competition_name->str);
+	mmatch->country_name = g_strdup(mmatch->country_name);
+	snapshot_copy_live_game(&mmatch->lg);
+    }
+
+    user->bets[0] = snapshot_copy_g_array(user->bets[0]);
+    user->bets[1] = snapshot_copy_g_array(user->bets[1]);
+    user->default_team = snapshot_copy_g_array(user->default_team);
+}
+
+static void
+snapshot_remap_fixtures(GHashTable *map, GArray *fixtures)
+{
+    gint i;
+
+    for(i=0;i<fixtures->len;i++)
+    {
+	Fixture *fix = &g_array_index(fixtures, Fixture, i);
+	snapshot_remap(map, fix->competition);
+	snapshot_remap(map, fix->teams[0]);
+	snapshot_remap(map, fix->teams[1]);
+	snapshot_remap(map, fix->live_game);
+    }
+}
+
+static void
+snapshot_remap_tables(GHashTable *map, GArray *tables)
+{
+    gint i, j;
+
+    for(i=0;i<tables->len;i++)
+    {
+	Table *table = &g_array_index(tables, Table, i);
+	snapshot_remap(map, table->competition);
+	for(j=0;j<table->elements->len;j++)
+	    snapshot_remap(map, g_array_index(table->elements, TableElement, j).team);
+    }
+}
+
+static void
+snapshot_remap_players(GHashTable *map, GArray *players)
+{
+    gint i, j;
+
+    for(i=0;i<players->len;i++)
+    {
+	Player *pl = &g_array_index(players, Player, i);
+	snapshot_remap(map, pl->team);
+	for(j=0;j<pl->stats->len;j++)
+	    snapshot_remap(map,
+			   g_array_index(pl->stats, PlayerCompetitionStats, j).competition);
+    }
+}
+
+static void
+snapshot_remap_cup(GHashTable *map, Cup *cup)
+{
+    gint i;
+
+    snapshot_remap_ptr_array(map, cup->c.teams);
+    snapshot_remap_ptr_array(map, cup->bye);
+    snapshot_remap_fixtures(map, cup->fixtures);
+
+    for(i=0;i<cup->rounds->len;i++)
+    {
+	CupRound *round = &g_array_index(cup->rounds, CupRound, i);
+	snapshot_remap_ptr_array(map, round->team_ptrs);
+	snapshot_remap_tables(map, round->tables);
+    }
+
+    for(i=0;i<cup->history->len;i++)
+	snapshot_remap_ptr_array(map, g_ptr_array_index(cup->history, i));
+}
+
+static void
+snapshot_remap_country(GHashTable *map, Country *cntry)
+{
+    gint i, j;
+
+    for(i=0;i<cntry->leagues->len;i++)
+    {
+	League *league = g_ptr_array_index(cntry->leagues, i);
+
+	snapshot_remap(map, league->country);
+	snapshot_remap_fixtures(map, league->fixtures);
+	snapshot_remap_tables(map, league->tables);
+
+	for(j=0;j<league->c.teams->len;j++)
+	{
+	    Team *tm = g_ptr_array_index(league->c.teams, j);
+	    snapshot_remap(map, tm->country);
+	    snapshot_remap(map, tm->league);
+	    snapshot_remap(map, tm->first_team.team);
+	    snapshot_remap_players(map, tm->players);
+	}
+    }
+
+    for(i=0;i<cntry->cups->len;i++)
+	snapshot_remap_cup(map, g_ptr_array_index(cntry->cups, i));
+
+    snapshot_remap_ptr_array(map, cntry->allcups);
+}
+
+static void
+snapshot_remap_user(GHashTable *map, User *user)
+{
+    gint i;
+
+    snapshot_remap(map, user->tm);
+    snapshot_remap(map, user->live_game.fix);
+    snapshot_remap(map, user->youth_academy.tm);
+    if(user->youth_academy.players != NULL)
+	snapshot_remap_players(map, user->youth_academy.players);
+
+    for(i=0;i<user->events->len;i++)
+    {
+	Event *event = &g_array_index(user->events, Event, i);
+	snapshot_remap(map, event->user);
+	snapshot_remap(map, event->value_pointer);
+    }
+
+    for(i=0;i<user->mmatches->len;i++)
+	snapshot_remap(map, g_array_index(user->mmatches, MemMatch, i).lg.fix);
+}
+
+/** National job offers point to the names of the user's
+    country and the league of the team; make them point to
+    the names in the copy of the country. */
+static void
+snapshot_remap_job(Job *job, const Country *dest, const Country *source)
+{
+    gint i;
+
+    job->country_name = dest->name;
+    for(i=0;i<source->leagues->len;i++)
+	if(job->league_name ==
+	   ((League*)g_ptr_array_index(source->leagues, i))->c.name)
+	{
+	    job->league_name = ((League*)g_ptr_array_index(dest->leagues, i))->c.name;
+	    return;
+	}
+}
+
+/** Replace the pointers in the snapshot by the addresses
+    the map assigns to them. */
+void
+snapshot_relink(Snapshot *snapshot, GHashTable *map)
+{
+#ifdef DEBUG
+    printf("snapshot_relink\n");
+#endif
+
+    gint i, j;
+
+    snapshot_remap_country(map, &snapshot->country);
+    for(i=0;i<snapshot->country_list->len;i++)
+	snapshot_remap_country(map, g_ptr_array_index(snapshot->country_list, i));
+
+    for(i=0;i<snapshot->international_cups->len;i++)
+	snapshot_remap_cup(map, g_ptr_array_index(snapshot->international_cups, i));
+
+    for(i=0;i<snapshot->users->len;i++)
+	snapshot_remap_user(map, &g_array_index(snapshot->users, User, i));
+
+    for(i=0;i<snapshot->newspaper.articles->len;i++)
+	snapshot_remap(map, g_array_index(snapshot->newspaper.articles,
+					  NewsPaperArticle, i).competition);
+
+    for(i=0;i<snapshot->transfer_list->len;i++)
+    {
+	Transfer *transfer = &g_array_index(snapshot->transfer_list, Transfer, i);
+	snapshot_remap(map, transfer->tm);
+	for(j=0;j<transfer->offers->len;j++)
+	    snapshot_remap(map, g_array_index(transfer->offers, TransferOffer, j).tm);
+    }
+}
+
+/** Deep-copy the game state from the source into dest. */
+static void
+snapshot_copy(Snapshot *dest, const Snapshot *source)
+{
+#ifdef DEBUG
+    printf("snapshot_copy\n");
+#endif
+
+    gint i, j;
+    GHashTable *map = g_hash_table_new(g_direct_hash, g_direct_equal);
+    Country *cntry;
+
+    *dest = *source;
+
+    /* Duplicate everything. */
+    snapshot_copy_country(map, &dest->country, &source->country);
+
+    dest->country_list = g_ptr_array_new();
+    for(i=0;i<source->country_list->len;i++)
+    {
+	cntry = g_malloc(sizeof(Country));
+	snapshot_copy_country(map, cntry, g_ptr_array_index(source->country_list, i));
+	g_hash_table_insert(map, g_ptr_array_index(source->country_list, i), cntry);
+	g_ptr_array_add(dest->country_list, cntry);
+    }
+
+    dest->international_cups = snapshot_copy_cups(map, source->international_cups);
+
+    dest->users = snapshot_copy_g_array(source->users);
+    for(i=0;i<dest->users->len;i++)
+	snapshot_copy_user(map, &g_array_index(dest->users, User, i),
+			   &g_array_index(source->users, User, i));
+
+    option_list_copy(&dest->options, &source->options);
+    option_list_copy(&dest->settings, &source->settings);
+
+    dest->newspaper.articles = snapshot_copy_g_array(source->newspaper.articles);
+    for(i=0;i<dest->newspaper.articles->len;i++)
+    {
+	NewsPaperArticle *article =
+	    &g_array_index(dest->newspaper.articles, NewsPaperArticle, i);
+	article->title_small = g_strdup(article->title_small);
+	article->title = g_strdup(article->title);
+	article->subtitle = g_strdup(article->subtitle);
+    }
+
+    dest->transfer_list = snapshot_copy_g_array(source->transfer_list);
+    for(i=0;i<dest->transfer_list->len;i++)
+	g_array_index(dest->transfer_list, Transfer, i).offers =
+	    snapshot_copy_g_array(g_array_index(dest->transfer_list, Transfer, i).offers);
+
+    dest->season_stats = snapshot_copy_g_array(source->season_stats);
+    for(i=0;i<dest->season_stats->len;i++)
+    {
+	SeasonStat *stat = &g_array_index(dest->season_stats, SeasonStat, i);
+
+	stat->league_champs = snapshot_copy_champs(stat->league_champs);
+	stat->cup_champs = snapshot_copy_champs(stat->cup_champs);
+	stat->league_stats = snapshot_copy_g_array(stat->league_stats);
+	for(j=0;j<stat->league_stats->len;j++)
+	    snapshot_copy_league_stats(&g_array_index(stat->league_stats, LeagueStat, j));
+    }
+
+    dest->bets[0] = snapshot_copy_g_array(source->bets[0]);
+    dest->bets[1] = snapshot_copy_g_array(source->bets[1]);
+
+    dest->jobs = snapshot_copy_g_array(source->jobs);
+    for(i=0;i<dest->jobs->len;i++)
+    {
+	Job *job = &g_array_index(dest->jobs, Job, i);
+	if(job->type == JOB_TYPE_INTERNATIONAL)
+	{
+	    job->country_file = g_strdup(job->country_file);
+	    job->country_name = g_strdup(job->country_name);
+	    job->league_name = g_strdup(job->league_name);
+	}
+	else
+	    snapshot_remap_job(job, &dest->country, &source->country);
+    }
+
+    dest->rand_generator = g_rand_copy(source->rand_generator);
+
+    /* Pointers to the user's country stay the same. */
+    g_hash_table_insert(map, &country, &country);
+    snapshot_relink(dest, map);
+
+    g_hash_table_destroy(map);
+}
+
+/** Fill the snapshot with the current game state
+    (without copying anything). */
+void
+snapshot_view(Bygfoot *bygfoot, Snapshot *snapshot)
+{
+    gint i;
+
+    snapshot->country = country;
+    snapshot->country_list = country_list;
+    snapshot->international_cups = bygfoot->international_cups;
+    snapshot->users = users;
+    snapshot->cur_user = cur_user;
+    snapshot->season = season;
+    snapshot->week = week;
+    snapshot->week_round = week_round;
+    snapshot->options = options;
+    snapshot->settings = settings;
+    snapshot->newspaper = newspaper;
+    snapshot->transfer_list = transfer_list;
+    snapshot->season_stats = season_stats;
+    snapshot->bets[0] = bets[0];
+    snapshot->bets[1] = bets[1];
+    snapshot->current_interest = current_interest;
+    snapshot->jobs = jobs;
+    for(i=0;i<COUNT_END;i++)
+	snapshot->counters[i] = counters[i];
+    snapshot->rand_generator = rand_generator;
+    snapshot->rand_seed = rand_seed;
+}
+
+/** Make the snapshot the current game state
+    (without copying anything). */
+static void
+snapshot_set_state(Bygfoot *bygfoot, const Snapshot *snapshot)
+{
+    gint i;
+
+    country = snapshot->country;
+    country_list = snapshot->country_list;
+    bygfoot->international_cups = snapshot->international_cups;
+    users = snapshot->users;
+    cur_user = snapshot->cur_user;
+    season = snapshot->season;
+    week = snapshot->week;
+    week_round = snapshot->week_round;
+    options = snapshot->options;
+    settings = snapshot->settings;
+    newspaper = snapshot->newspaper;
+    transfer_list = snapshot->transfer_list;
+    season_stats = snapshot->season_stats;
+    bets[0] = snapshot->bets[0];
+    bets[1] = snapshot->bets[1];
+    current_interest = snapshot->current_interest;
+    jobs = snapshot->jobs;
+    for(i=0;i<COUNT_END;i++)
+	counters[i] = snapshot->counters[i];
+    rand_generator = snapshot->rand_generator;
+    rand_seed = snapshot->rand_seed;
+
+    registry_invalidate();
+    fixture_schedule_invalidate();
+}
+
+/** Free a leagues array including the teams, which
+    free_league() leaves alone. */
+static void
+snapshot_free_leagues(GPtrArray **leagues)
+{
+    gint i, j;
+
+    if(*leagues == NULL)
+	return;
+
+    for(i=0;i<(*leagues)->len;i++)
+    {
+	League *league = g_ptr_array_index(*leagues, i);
+
+	for(j=0;j<league->c.teams->len;j++)
+	{
+	    Team *tm = g_ptr_array_index(league->c.teams, j);
+	    free_team(tm);
+	    g_free(tm->strategy_sid);
+	    g_free(tm);
+	}
+
+	free_gchar_ptr(league->names_file);
+	free_gchar_array(&league->properties);
+	free_league(league);
+	g_free(league);
+    }
+
+    free_g_ptr_array(leagues);
+}
+
+/** Free a cups array including the cup histories and
+    choose team lists, which free_cup() leaves alone. */
+static void
+snapshot_free_cups(GPtrArray **cups)
+{
+    gint i, j, k;
+    CupChooseTeam *ct, *next;
+
+    if(*cups == NULL)
+	return;
+
+    for(i=0;i<(*cups)->len;i++)
+    {
+	Cup *cup = g_ptr_array_index(*cups, i);
+
+	for(j=0;j<cup->rounds->len;j++)
+	{
+	    CupRound *round = &g_array_index(cup->rounds, CupRound, j);
+	    for(k=0;k<round->choose_teams->len;k++)
+		for(ct = g_array_index(round->choose_teams, CupChooseTeam, k).next;
+		    ct != NULL; ct = next)
+		{
+		    next = ct->next;
+		    free_cup_choose_team(ct);
+		    g_free(ct);
+		}
+	}
+
+	for(j=0;j<cup->history->len;j++)
+	    g_ptr_array_free(g_ptr_array_index(cup->history, j), TRUE);
+	free_g_ptr_array(&cup->history);
+
+	free_cup(cup);
+	g_free(cup);
+    }
+
+    free_g_ptr_array(cups);
+}
+
+static void
+snapshot_free_country(Country *cntry)
+{
+    snapshot_free_leagues(&cntry->leagues);
+    snapshot_free_cups(&cntry->cups);
+    free_country(cntry, FALSE);
+}
+
+/** Free the current game state. */
+static void
+snapshot_free_state(Bygfoot *bygfoot)
+{
+    gint i;
+
+    snapshot_free_country(&country);
+
+    if(country_list != NULL)
+	for(i=0;i<country_list->len;i++)
+	{
+	    snapshot_free_country(g_ptr_array_index(country_list, i));
+	    g_free(g_ptr_array_index(country_list, i));
+	}
+    free_g_ptr_array(&country_list);
+
+    snapshot_free_cups(&bygfoot->international_cups);
+
+    if(users != NULL)
+	for(i=0;i<users->len;i++)
+	    g_datalist_clear(&usr(i).options.datalist);
+    free_users(FALSE);
+
+    g_datalist_clear(&options.datalist);
+    free_option_list(&options, FALSE);
+    g_datalist_clear(&settings.datalist);
+    free_option_list(&settings, FALSE);
+
+    if(newspaper.articles != NULL)
+	free_newspaper(FALSE);
+    newspaper.articles = NULL;
+    if(transfer_list != NULL)
+	free_transfer_list();
+    free_season_stats(FALSE);
+    free_bets(FALSE);
+    free_jobs(FALSE);
+
+    if(rand_generator != NULL)
+	g_rand_free(rand_generator);
+    rand_generator = NULL;
+}
+
+/** Return a copy of the current game state. */
+Snapshot*
+snapshot_new(Bygfoot *bygfoot)
+{
+#ifdef DEBUG
+    printf("snapshot_new\n");
+#endif
+
+    Snapshot current, *snapshot = g_malloc(sizeof(Snapshot));
+
+    snapshot_view(bygfoot, &current);
+    snapshot_copy(snapshot, &current);
+
+    return snapshot;
+}
+
+/** Replace the current game state by the contents of
+    the snapshot. The snapshot gets used up. */
+void
+snapshot_install(Bygfoot *bygfoot, Snapshot *snapshot)
+{
+#ifdef DEBUG
+    printf("snapshot_install\n");
+#endif
+
+    snapshot_free_state(bygfoot);
+    snapshot_set_state(bygfoot, snapshot);
+
+    country.bygfoot = bygfoot;
+    statp = NULL;
+
+    g_free(snapshot);
+}
+
+/** Replace the current game state by a copy of the snapshot.
+    The snapshot stays untouched and can be restored again. */
+void
+snapshot_restore(Bygfoot *bygfoot, const Snapshot *snapshot)
+{
+#ifdef DEBUG
+    printf("snapshot_restore\n");
+#endif
+
+    Snapshot *copy = g_malloc(sizeof(Snapshot));
+
+    snapshot_copy(copy, snapshot);
+    snapshot_install(bygfoot, copy);
+}
+
+/** Free a snapshot. */
+void
+snapshot_free(Bygfoot *bygfoot, Snapshot *snapshot)
+{
+#ifdef DEBUG
+    printf("snapshot_free\n");
+#endif
+
+    Snapshot current;
+
+    /* The free functions work on the current state, so we
+       swap the snapshot in for a moment. */
+    snapshot_view(bygfoot, &current);
+    snapshot_set_state(bygfoot, snapshot);
+    snapshot_free_state(bygfoot);
+    snapshot_set_state(bygfoot, &current);
+
+    g_free(snapshot);
+}
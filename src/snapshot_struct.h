@@ -0,0 +1,66 @@
+/*
+   snapshot_struct.h
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef SNAPSHOT_STRUCT_H
+#define SNAPSHOT_STRUCT_H
+
+#include "bygfoot.h"
+#include "enums.h"
+#include "news_struct.h"
+#include "option_struct.h"
+
+/** An in-memory copy of the game state, ie. everything a
+    savegame contains. Definitions that don't change during
+    the game (names, strategies, commentary etc.) aren't part of it.
+    @see snapshot_new()
+    @see snapshot_restore() */
+typedef struct
+{
+    /** The user's country, the other countries and the
+	international cups. */
+    Country country;
+    GPtrArray *country_list;
+    GPtrArray *international_cups;
+
+    GArray *users;
+    gint cur_user;
+
+    gint season, week, week_round;
+    OptionList options, settings;
+
+    NewsPaper newspaper;
+    GArray *transfer_list;
+    GArray *season_stats;
+    GArray *bets[2];
+    gfloat current_interest;
+    GArray *jobs;
+    gint counters[COUNT_END];
+
+    /** The state of the random number generator. */
+    GRand *rand_generator;
+    guint32 rand_seed;
+} Snapshot;
+
+#endif
@@ -24,6 +24,7 @@
 */
 
 #include "bet.h"
+#include "competition.h"
 #include "cup.h"
 #include "file.h"
 #include "finance.h"
@@ -42,6 +43,7 @@
 #include "news.h"
 #include "option.h"
 #include "player.h"
+#include "registry.h"
 #include "start_end.h"
 #include "stat.h"
 #include "table.h"
@@ -100,11 +102,14 @@ start_new_game(Bygfoot *bygfoot)
 
     start_generate_cup_history_international(bygfoot);
 
+    competition_assign_slots(bygfoot);
+
     start_new_season(bygfoot);
 }
 
 /** Load other countries that the user isn't playing, so we can easily reference
- * the cups and leagues.
+ * the cups and leagues. The teams stay skeletons without players until
+ * they're needed. @see team_fill_skeleton()
  */
 void
 start_load_other_countries(Bygfoot *bygfoot)
@@ -114,22 +119,14 @@ start_load_other_countries(Bygfoot *bygfoot)
     gint i;
 
     for (i = 0; i < country_files->len; i++) {
-        gint j;
         const gchar *country_file = g_ptr_array_index(country_files, i);
         Country *new_country = g_malloc0(sizeof(Country));
 
         xml_country_read(country_file, new_country, bygfoot);
         if (!strcmp(new_country->sid, country.sid))
             continue;
-        for (j = 0; j < new_country->leagues->len; j++) {
-            League *league = g_ptr_array_index(new_country->leagues, j);
-            gint k;
-            for (k = 0; k < league->c.teams->len; k++) {
-                Team *team = g_ptr_array_index(league->c.teams, k);
-	            team_generate_players_stadium(team);
-            }
-        }
         g_ptr_array_add(country_list, new_country);
+        registry_invalidate();
     }
 }
 
@@ -173,6 +170,7 @@ generate_cup_history_leagues(Cup *cup)
                 Team *team = g_ptr_array_index(teams, m);
                 if(!ct->skip_group_check && query_team_is_in_cups(team, cup->group))
                     continue;
+                team_fill_skeleton(team);
                 g_ptr_array_add(cup->c.teams, team);
                 t++;
             }
@@ -205,6 +203,7 @@ generate_cup_history_cups(Cup *cup)
                 Team *team = g_ptr_array_index(teams, m);
                 if(!ct->skip_group_check && query_team_is_in_cups(team, cup->group))
                     continue;
+                team_fill_skeleton(team);
                 g_ptr_array_add(cup->c.teams, team);
                 t++;
             }
@@ -339,7 +338,7 @@ start_new_season(Bygfoot *bygfoot)
 			     buf, NULL);
 
 	    usr(i).counters[COUNT_USER_TRAININGS_LEFT_SEASON] =
-		const_int("int_training_camps_per_season");
+		const_int(int_training_camps_per_season);
 	}
 
         /* Promotion/relegation, mainly. */
@@ -369,6 +368,7 @@ start_new_season(Bygfoot *bygfoot)
         {
             g_array_free(league->fixtures, TRUE);
             league->fixtures = g_array_new(FALSE, FALSE, sizeof(Fixture));            
+            fixture_schedule_invalidate();
         }
     }
 
@@ -556,7 +556,13 @@ end_week_round(Bygfoot *bygfoot)
     start_week_round(bygfoot);
 }
 
-/** Calculate the match results of a week round. */
+/** Calculate the match results of a week round. The matches
+    without user involvement get calculated first (by several threads
+    if the user wants it), then the results are processed in fixture
+    order and the user matches are calculated in their turn.
+    Each of the CPU matches uses its own random number stream, so the
+    results don't depend on the number of threads.
+    @see live_game_fixture_rand_new() */
 void
 end_week_round_results(Bygfoot *bygfoot)
 {
@@ -564,91 +570,82 @@ end_week_round_results(Bygfoot *bygfoot)
     printf("end_week_round_results\n");
 #endif
 
-    gint i, j, done = 0;
-    LiveGame live_game;
+    gint i, cpu_idx = 0, done = 0;
     gchar buf[SMALL], buf2[SMALL];
     gfloat num_matches =
 	(gfloat)fixture_get_number_of_matches(week, week_round);
+    GPtrArray *fixtures = fixture_get_week_list(week, week_round);
+    GPtrArray *cpu_fixtures = g_ptr_array_new();
+    MathRand **rands = NULL;
+    Fixture *fix = NULL;
     gint usr_idx;
+    /* Commentary for all matches (stat5 < -1000) is a debugging
+       feature that only works in the main thread, and the matches
+       of a team playing twice have to be calculated one after the other. */
+    gboolean serial = (stat5 < -1000 || query_fixture_team_plays_twice(fixtures));
 
-    /** Free the matches from last week. */
-    for(i = 0; i < live_games->len; i++)
-        free_live_game(&g_array_index(live_games, LiveGame, i));
-    g_array_free(live_games, TRUE);
-    live_games = g_array_new(FALSE, FALSE, sizeof(LiveGame));
-    
-    for(i=0;i<country.leagues->len;i++)
+    for(i=0;i<fixtures->len;i++)
     {
-        League *league = g_ptr_array_index(country.leagues, i);
-	for(j=0;j<league->fixtures->len;j++)
-	    if(g_array_index(league->fixtures, Fixture, j).week_number == week &&
-	       g_array_index(league->fixtures, Fixture, j).week_round_number == week_round &&
-	       g_array_index(league->fixtures, Fixture, j).attendance == -1)
-	    {                
-                usr_idx = fixture_user_team_involved(&g_array_index(league->fixtures, Fixture, j));
-
-                if(usr_idx == -1)
-                {
-                    g_array_append_val(live_games, live_game);
-                    live_game_calculate_fixture(&g_array_index(league->fixtures, Fixture, j),
-                                                &g_array_index(live_games, LiveGame, live_games->len - 1), bygfoot);
-                }
-                else
-                    live_game_calculate_fixture(&g_array_index(league->fixtures, Fixture, j),
-                                                &usr(usr_idx).live_game, bygfoot);
-
-		done++;
-		fixture_result_to_buf(&g_array_index(league->fixtures, Fixture, j),
-				      buf, FALSE);
-		sprintf(buf2, "%s %s %s",
-			g_array_index(league->fixtures, Fixture, j).teams[0]->name,
-			buf,
-			g_array_index(league->fixtures, Fixture, j).teams[1]->name);
-		bygfoot_show_progress(bygfoot, (gfloat)done / num_matches, buf2,
-				  PIC_TYPE_MATCHPIC);
-
-		if(debug > 120)
-		    g_print("%s \n", buf2);
-	    }
+	fix = (Fixture*)g_ptr_array_index(fixtures, i);
+	if(fix->attendance == -1 && fixture_user_team_involved(fix) == -1)
+	    g_ptr_array_add(cpu_fixtures, fix);
     }
 
-    for(i=0;i<country.allcups->len;i++)
+    rands = g_new(MathRand*, cpu_fixtures->len);
+    for(i=0;i<cpu_fixtures->len;i++)
+	rands[i] = live_game_fixture_rand_new(
+	    (Fixture*)g_ptr_array_index(cpu_fixtures, i));
+
+    /* The matches of the last round make room for the new ones.
+       The fixtures point into the array, so it mustn't be resized later. */
+    live_game_prepare_array(live_games, cpu_fixtures->len, !serial);
+
+    if(!serial)
+	live_game_calculate_fixtures(cpu_fixtures, live_games, rands,
+				     opt_int(int_opt_match_threads));
+
+    for(i=0;i<fixtures->len;i++)
     {
-        Cup *cup = g_ptr_array_index(country.allcups, i);
-	for(j=0;j<cup->fixtures->len;j++)
-	{
-	    if(g_array_index(cup->fixtures, Fixture, j).week_number == week &&
-	       g_array_index(cup->fixtures, Fixture, j).week_round_number == week_round &&
-	       g_array_index(cup->fixtures, Fixture, j).attendance == -1)
-	    {
+	fix = (Fixture*)g_ptr_array_index(fixtures, i);
 
-                usr_idx = fixture_user_team_involved(&g_array_index(cup->fixtures, Fixture, j));
-
-                if(usr_idx == -1)
-                {
-                    g_array_append_val(live_games, live_game);
-                    live_game_calculate_fixture(&g_array_index(cup->fixtures, Fixture, j),
-                                                &g_array_index(live_games, LiveGame, live_games->len - 1), bygfoot);
-                }
-                else
-                    live_game_calculate_fixture(&g_array_index(cup->fixtures, Fixture, j),
-                                                &usr(usr_idx).live_game, bygfoot);
-
-		done++;
-		fixture_result_to_buf(&g_array_index(cup->fixtures, Fixture, j), 
-				      buf, FALSE);
-		sprintf(buf2, "%s %s %s",
-			g_array_index(cup->fixtures, Fixture, j).teams[0]->name,
-			buf,
-			g_array_index(cup->fixtures, Fixture, j).teams[1]->name);
-		bygfoot_show_progress(bygfoot, (gfloat)done / num_matches, buf2,
-				  PIC_TYPE_MATCHPIC);
-		if(debug > 120)
-		    g_print("%s \n", buf2);
-	    }
+	if(cpu_idx < cpu_fixtures->len &&
+	   fix == g_ptr_array_index(cpu_fixtures, cpu_idx))
+	{
+	    /* The post-match updates draw from the stream of
+	       the fixture, too. */
+	    math_rand_set_current(rands[cpu_idx]);
+	    if(serial)
+		live_game_calculate_fixture(
+		    fix, &g_array_index(live_games, LiveGame, cpu_idx), bygfoot);
+	    else
+		game_post_match(fix);
+	    math_rand_set_current(NULL);
+	    cpu_idx++;
+	}
+	else if(fix->attendance == -1)
+	{
+	    usr_idx = fixture_user_team_involved(fix);
+	    live_game_calculate_fixture(fix, &usr(usr_idx).live_game, bygfoot);
 	}
+	else
+	    continue;
+
+	done++;
+	fixture_result_to_buf(fix, buf, FALSE);
+	sprintf(buf2, "%s %s %s", fix->teams[0]->name, buf, fix->teams[1]->name);
+	bygfoot_show_progress(bygfoot, (gfloat)done / num_matches, buf2,
+			      PIC_TYPE_MATCHPIC);
+
+	if(debug > 120)
+	    g_print("%s \n", buf2);
     }
-    
+
+    for(i=0;i<cpu_fixtures->len;i++)
+	math_rand_free(rands[i]);
+    g_free(rands);
+    g_ptr_array_free(cpu_fixtures, TRUE);
+    g_ptr_array_free(fixtures, TRUE);
+
     bygfoot_show_progress(bygfoot, -1, "", PIC_TYPE_MATCHPIC);
 }
 
@@ -660,22 +657,13 @@ end_week_round_sort_tables(Bygfoot *bygfoot)
     printf("end_week_round_sort_tables\n");
 #endif
 
-    gint i, j, k;
+    gint i, j;
 
     for(i=0;i<country.leagues->len;i++) {
         League *league = g_ptr_array_index(country.leagues, i);
 	if(query_fixture_in_week_round(league->c.id, week, week_round))
-	{
-            for(k = 0; k < league->tables->len; k++)
-            {
-                for(j=0;j<g_array_index(league->tables, Table, k).elements->len;j++)
-                    g_array_index(g_array_index(league->tables, Table, k).elements, TableElement, j).old_rank = j;
-                
-                g_array_sort_with_data(g_array_index(league->tables, Table, k).elements,
-                                       (GCompareDataFunc)table_element_compare_func,
-                                       &league->c);
-            }
-	}
+            for(j = 0; j < league->tables->len; j++)
+                table_sort(&g_array_index(league->tables, Table, j), &league->c);
     }
 
     for(i=0;i<country.allcups->len;i++) {
@@ -684,17 +672,7 @@ end_week_round_sort_tables(Bygfoot *bygfoot)
 	   g_array_index(cup->fixtures, Fixture, cup->fixtures->len - 1).round ==
 	   cup_has_tables(cup))
 	    for(j=0;j<cup_get_last_tables(cup)->len;j++)
-	    {
-		for(k=0;k<g_array_index(cup_get_last_tables(cup), Table, j).elements->len;k++)
-		    g_array_index(
-			g_array_index(cup_get_last_tables(cup), Table, j).elements,
-			TableElement, k).old_rank = k;
-
-		g_array_sort_with_data(
-		    g_array_index(cup_get_last_tables(cup), Table, j).elements,
-		    (GCompareDataFunc)table_element_compare_func,
-		    &cup->c);
-	    }
+		table_sort(&g_array_index(cup_get_last_tables(cup), Table, j), &cup->c);
     }
 }
 
@@ -777,7 +755,7 @@ end_week_round_generate_news(Bygfoot *bygfoot)
             news_generate_match(&g_array_index(live_games, LiveGame, i));
 
     /* Get rid of older news. */
-    while(newspaper.articles->len > const_int("int_news_history_length"))
+    while(newspaper.articles->len > const_int(int_news_history_length))
     {
         free_newspaper_article(&g_array_index(newspaper.articles, NewsPaperArticle, 0));
         g_array_remove_index(newspaper.articles, 0);
@@ -804,7 +782,7 @@ start_week_round(Bygfoot *bygfoot)
     }
 
     if(!query_start_end_season_end() &&
-	opt_int("int_opt_skip") &&
+	opt_int(int_opt_skip) &&
        !query_user_games_this_week_round() &&
        !query_user_events() &&
        ((week_round == 1 && 
@@ -904,17 +882,20 @@ start_week_add_cups(Bygfoot *bygfoot)
     }
 }
 
+/** Update the teams of the country and those of the
+    international cups. @see team_update_teams() */
 static void
-update_teams(void (*update_func)(Team*))
+update_teams(gint update)
 {
     gint i, j;
     GHashTable *visited = g_hash_table_new(g_direct_hash, g_direct_equal);
+    GPtrArray *teams = g_ptr_array_new();
 
     for(i=0;i<country.leagues->len;i++) {
         League *league = g_ptr_array_index(country.leagues, i);
 	for(j=0;j<league->c.teams->len;j++) {
             Team *team = g_ptr_array_index(league->c.teams, j);
-	    update_func(team);
+	    g_ptr_array_add(teams, team);
             g_hash_table_insert(visited, team, team);
         }
     }
@@ -928,11 +909,14 @@ update_teams(void (*update_func)(Team*))
             Team *team = g_ptr_array_index(cup->c.teams, j);
             if (g_hash_table_lookup(visited, team))
                 continue;
-	    update_func(team);
+	    g_ptr_array_add(teams, team);
             g_hash_table_insert(visited, team, team);
         }
     }
     g_hash_table_unref(visited);
+
+    team_update_teams(teams, update, opt_int(int_opt_match_threads));
+    g_ptr_array_free(teams, TRUE);
 }
 
 /** Age increase etc. of players.
@@ -945,7 +929,7 @@ start_week_update_teams(Bygfoot *bygfoot)
     printf("start_week_update_teams\n");
 #endif
 
-    update_teams(team_update_team_weekly);
+    update_teams(TEAM_UPDATE_WEEKLY);
 }
 
 /** Do some things at the beginning of each new round for
@@ -957,7 +941,7 @@ start_week_round_update_teams(void)
     printf("start_week_round_update_teams\n");
 #endif
 
-    update_teams(team_update_team_week_roundly);
+    update_teams(TEAM_UPDATE_WEEK_ROUNDLY);
 }
 
 /** Deduce wages etc. */
@@ -970,7 +954,7 @@ start_week_update_user_finances(Bygfoot *bygfoot)
 
     gint i;
 
-    if(sett_int("int_opt_disable_finances"))
+    if(sett_int(int_opt_disable_finances))
 	return;
 
     for(i=0;i<users->len;i++)
@@ -79,7 +79,96 @@ stat_update_leagues(void)
     }
 }
 
-/** Update the league player stats. */
+/** A player competing for a place in the league player stats. */
+typedef struct
+{
+    const Player *pl;
+    /** League goals, games and shots of the player. */
+    gint goals, games, shots;
+    /** The position in which the player was collected;
+	breaks ties like the stable sort of all players did. */
+    gint idx;
+} StatPlayer;
+
+/** Compare two players like player_compare_func() with
+    #PLAYER_COMPARE_ATTRIBUTE_LEAGUE_GOALS.
+    @param sign 1 for scorers, -1 for goalies. */
+static gint
+stat_compare_players(gconstpointer a, gconstpointer b, gpointer sign)
+{
+    const StatPlayer *stat_pl1 = (const StatPlayer*)a,
+	*stat_pl2 = (const StatPlayer*)b;
+    gint return_value;
+
+    if(stat_pl1->goals != stat_pl2->goals)
+	return_value = misc_int_compare(stat_pl1->goals, stat_pl2->goals);
+    else if(stat_pl1->games != stat_pl2->games)
+	return_value = misc_int_compare(stat_pl2->games, stat_pl1->games);
+    else
+	return_value = misc_int_compare(stat_pl2->shots, stat_pl1->shots);
+
+    return_value *= GPOINTER_TO_INT(sign);
+
+    if(return_value == 0)
+	return_value = misc_int_compare(stat_pl2->idx, stat_pl1->idx);
+
+    return return_value;
+}
+
+/** Offer a player to a heap holding the best maxlen players
+    seen so far, with the weakest of them at the root. */
+static void
+stat_players_heap_add(GArray *heap, const StatPlayer *stat_pl,
+		      gint maxlen, gint sign)
+{
+    gint i, child;
+    StatPlayer tmp;
+
+    if(heap->len < maxlen)
+    {
+	g_array_append_val(heap, *stat_pl);
+	for(i=heap->len - 1;i>0;i=(i - 1) / 2)
+	{
+	    if(stat_compare_players(&g_array_index(heap, StatPlayer, (i - 1) / 2),
+				    &g_array_index(heap, StatPlayer, i),
+				    GINT_TO_POINTER(sign)) > 0)
+		break;
+	    tmp = g_array_index(heap, StatPlayer, i);
+	    g_array_index(heap, StatPlayer, i) = g_array_index(heap, StatPlayer, (i - 1) / 2);
+	    g_array_index(heap, StatPlayer, (i - 1) / 2) = tmp;
+	}
+	return;
+    }
+
+    if(heap->len == 0 ||
+       stat_compare_players(stat_pl, &g_array_index(heap, StatPlayer, 0),
+			    GINT_TO_POINTER(sign)) > 0)
+	return;
+
+    g_array_index(heap, StatPlayer, 0) = *stat_pl;
+    for(i=0;2 * i + 1 < heap->len;i=child)
+    {
+	child = 2 * i + 1;
+	if(child + 1 < heap->len &&
+	   stat_compare_players(&g_array_index(heap, StatPlayer, child + 1),
+				&g_array_index(heap, StatPlayer, child),
+				GINT_TO_POINTER(sign)) > 0)
+	    child++;
+
+	if(stat_compare_players(&g_array_index(heap, StatPlayer, i),
+				&g_array_index(heap, StatPlayer, child),
+				GINT_TO_POINTER(sign)) > 0)
+	    break;
+
+	tmp = g_array_index(heap, StatPlayer, i);
+	g_array_index(heap, StatPlayer, i) = g_array_index(heap, StatPlayer, child);
+	g_array_index(heap, StatPlayer, child) = tmp;
+    }
+}
+
+/** Update the league player stats. The league values of each
+    player are looked up once and only the best players are kept
+    while going through the teams, instead of sorting them all. */
 void
 stat_update_league_players(League *league)
 {
@@ -87,53 +176,71 @@ stat_update_league_players(League *league)
     printf("stat_update_league_players\n");
 #endif
 
-    gint i, j;
-    GPtrArray *players_sorted[2] = {g_ptr_array_new(),
-				    g_ptr_array_new()};
+    gint i, j, k;
+    gint maxlen = const_int(int_stat_players_len);
+    gint signs[2] = {1, -1}, counts[2] = {0, 0};
+    gint played;
+    GArray *heaps[2] = {g_array_sized_new(FALSE, FALSE, sizeof(StatPlayer), maxlen),
+			g_array_sized_new(FALSE, FALSE, sizeof(StatPlayer), maxlen)};
     GArray *players[2] = {g_array_new(FALSE, FALSE, sizeof(Stat)),
 			  g_array_new(FALSE, FALSE, sizeof(Stat))};
-    Player *pl = NULL;
-    gint maxlen = const_int("int_stat_players_len");
+    const StatPlayer *stat_pl = NULL;
+    const PlayerCompetitionStats *stats;
+    const Competition *competition;
+    StatPlayer new_stat_pl;
     Stat new_stat;
 
     for(i=0;i<league->c.teams->len;i++) {
         Team *team = g_ptr_array_index(league->c.teams, i);
+	competition = &team->league->c;
+	played = -1;
 	for(j=0;j<team->players->len;j++)
 	{
-	    pl = &g_array_index(team->players, Player, j);
-	    if(pl->pos != PLAYER_POS_GOALIE)
-		g_ptr_array_add(players_sorted[0], pl);
-	    else if(player_games_goals_get(pl, pl->team->league->c.id, PLAYER_VALUE_GAMES) >=
-		    const_float("float_stat_goalie_percentage") * 
-		    (gfloat)team_get_table_value(pl->team, TABLE_PLAYED))
-		g_ptr_array_add(players_sorted[1], pl);
+	    new_stat_pl.pl = &g_array_index(team->players, Player, j);
+	    stats = player_competition_stats_get(new_stat_pl.pl, competition);
+	    new_stat_pl.games = (stats == NULL) ? 0 : stats->games;
+
+	    if(new_stat_pl.pl->pos == PLAYER_POS_GOALIE)
+	    {
+		if(played == -1)
+		    played = team_get_table_value(team, TABLE_PLAYED);
+		if(new_stat_pl.games < 
+		   const_float(float_stat_goalie_percentage) * (gfloat)played)
+		    continue;
+	    }
+
+	    new_stat_pl.goals = (stats == NULL) ? 0 : stats->goals;
+	    new_stat_pl.shots = (stats == NULL) ? 0 : stats->shots;
+
+	    k = (new_stat_pl.pl->pos == PLAYER_POS_GOALIE);
+	    new_stat_pl.idx = counts[k]++;
+	    stat_players_heap_add(heaps[k], &new_stat_pl, maxlen, signs[k]);
 	}
     }
 
-    g_ptr_array_sort_with_data(players_sorted[0], player_compare_func, 
-			       GINT_TO_POINTER(PLAYER_COMPARE_ATTRIBUTE_LEAGUE_GOALS));
-    g_ptr_array_sort_with_data(players_sorted[1], player_compare_func, 
-			       GINT_TO_POINTER(-PLAYER_COMPARE_ATTRIBUTE_LEAGUE_GOALS));
-
-    maxlen = MIN(maxlen, players_sorted[0]->len);
-    maxlen = MIN(maxlen, players_sorted[1]->len);
+    maxlen = MIN(maxlen, counts[0]);
+    maxlen = MIN(maxlen, counts[1]);
 
     for(i=0;i<2;i++)
+    {
+	g_array_sort_with_data(heaps[i], stat_compare_players,
+			       GINT_TO_POINTER(signs[i]));
+
 	for(j=0;j<maxlen;j++)
 	{
-	    pl = (Player*)g_ptr_array_index(players_sorted[i], j);
-	    new_stat.team_name = g_strdup(pl->team->name);
-	    new_stat.value_string = g_strdup(pl->name);
-	    new_stat.value1 = 
-		player_games_goals_get(pl, pl->team->league->c.id, PLAYER_VALUE_GOALS);
-	    new_stat.value2 = 
-		player_games_goals_get(pl, pl->team->league->c.id, PLAYER_VALUE_GAMES);
-	    new_stat.value3 = 
-		player_games_goals_get(pl, pl->team->league->c.id, PLAYER_VALUE_SHOTS);
+	    stat_pl = &g_array_index(heaps[i], StatPlayer, j);
+	    new_stat.team_name = stat_pl->pl->team->name;
+	    new_stat.value_string = stat_pl->pl->name;
+	    new_stat.value1 = stat_pl->goals;
+	    new_stat.value2 = stat_pl->games;
+	    new_stat.value3 = stat_pl->shots;
 
 	    g_array_append_val(players[i], new_stat);
 	}
 
+	g_array_free(heaps[i], TRUE);
+    }
+
     league->stats.player_scorers = players[0];
     league->stats.player_goalies = players[1];
 }
@@ -150,7 +257,7 @@ stat_update_league_teams(GPtrArray *teams, gint compare_type)
     GArray *stats = g_array_new(FALSE, FALSE, sizeof(Stat));
     GPtrArray *teams_temp;
     Stat new_stat;
-    gint maxlen = const_int("int_stat_teams_len");
+    gint maxlen = const_int(int_stat_teams_len);
     
     maxlen = MIN(maxlen, teams->len);
 
@@ -160,7 +267,7 @@ stat_update_league_teams(GPtrArray *teams, gint compare_type)
 
     for(i=0;i<maxlen;i++)
     {
-	new_stat.team_name = g_strdup(((Team*)g_ptr_array_index(teams_temp, i))->name);
+	new_stat.team_name = ((Team*)g_ptr_array_index(teams_temp, i))->name;
 	new_stat.value1 = 
 	    team_get_table_value((Team*)g_ptr_array_index(teams_temp, i), TABLE_GF);
 	new_stat.value2 = 
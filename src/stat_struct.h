@@ -27,7 +27,8 @@
 #define STAT_STRUCT_H
 
 /** A statistics element holding some
-    string and integer values. */
+    string and integer values. The strings are
+    team and player names in the name pool. */
 typedef struct
 {
     gchar *team_name;
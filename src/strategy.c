@@ -24,6 +24,7 @@
 */
 
 #include "fixture.h"
+#include "game.h"
 #include "league.h"
 #include "live_game.h"
 #include "main.h"
@@ -33,8 +34,6 @@
 #include "strategy.h"
 #include "team.h"
 
-GArray *token_strat;
-
 /** Return the sid of a random strategy from the 
     strategies array (also dependent on the priorities
     of the strategies). */
@@ -214,8 +213,8 @@ strategy_repair_player(Player *pl)
 	player_get_cskill(pl, pl->pos, FALSE);
 	
     pl->fitness = 
-	math_rnd(const_float("float_player_fitness_lower"),
-		 const_float("float_player_fitness_upper"));    
+	math_rnd(const_float(float_player_fitness_lower),
+		 const_float(float_player_fitness_upper));    
 }
 
 /** 'Repair' exactly as many players as are required to be able
@@ -308,20 +307,20 @@ strategy_update_team_pre_match(Team *tm)
     gint i;
     const GArray *prematches =
 	strategy_from_sid(tm->strategy_sid)->prematch;
+    StrategyTokens tokens;
 
-    strategy_set_tokens(tm, NULL);
+    strategy_tokens_init(&tokens, tm);
 
     for(i=prematches->len - 1; i >= 0; i--)
 	if(g_array_index(prematches, StrategyPrematch, i).condition == NULL ||
-	   misc_evaluate_condition(g_array_index(prematches, StrategyPrematch, i).parsed_condition,
-				token_strat))
+	   (g_array_index(prematches, StrategyPrematch, i).parsed_condition != NULL &&
+	    strategy_check_condition(
+		g_array_index(prematches, StrategyPrematch, i).parsed_condition, &tokens)))
 	{
 	   strategy_apply_prematch(tm, &g_array_index(prematches, StrategyPrematch, i));
 	   break;
 	}
 
-    strategy_free_tokens();
-
     if(i == -1)
 	main_exit_program(EXIT_STRATEGY_ERROR,
 			  "strategy_update_team_pre_match: none of the prematch conditions of strategy %s for team %s are fulfilled. remember that a strategy should contain an unconditional prematch.", 
@@ -348,112 +347,210 @@ strategy_from_sid(const gchar *sid)
     return NULL;
 }
 
-static
-void strategy_token_add(GArray *token_strat, enum ReplacementToken token, int value)
+/** Prepare the tokens of a team for the prematch conditions.
+    Nothing gets computed until a condition asks for it. */
+void
+strategy_tokens_init(StrategyTokens *tokens, const Team *tm)
 {
-    StratTokenValue *token_value = &g_array_index(token_strat, StratTokenValue, token);
-    token_value->initialized = TRUE;
-    token_value->value = value;
+#ifdef DEBUG
+    printf("strategy_tokens_init\n");
+#endif
+
+    tokens->tm = tm;
+    tokens->fix = NULL;
+    tokens->match = NULL;
+    tokens->team_idx = tokens->unit_idx = -1;
+    tokens->fix_known = FALSE;
+    tokens->skill = tokens->opp_skill = -1;
+    memset(tokens->state, STRAT_TOKEN_UNKNOWN, sizeof(tokens->state));
 }
 
-/** Add tokens that will be evaluated when checking
-    strategy conditions. */
+/** Prepare the tokens of a team for the match action
+    conditions checked after the last unit of the live game. */
 void
-strategy_set_tokens(const Team *tm, const Fixture *fixture)
+strategy_tokens_init_live_game(StrategyTokens *tokens,
+			       const LiveGame *match, gint team_idx)
 {
 #ifdef DEBUG
-    printf("strategy_set_tokens\n");
+    printf("strategy_tokens_init_live_game\n");
 #endif
 
-    const Fixture *fix = (fixture == NULL) ? 
-	team_get_fixture(tm, FALSE) : fixture;
-    const Team *opp = (fix == NULL) ? NULL :
-	fix->teams[fix->teams[0] == tm];
-    gint i;
-
-    token_strat = g_array_sized_new(FALSE, TRUE, sizeof(StratTokenValue), REP_TOKEN_LAST);
-    g_array_set_size(token_strat, REP_TOKEN_LAST);
+    strategy_tokens_init(tokens, match->fix->teams[team_idx]);
+    tokens->fix = match->fix;
+    tokens->fix_known = TRUE;
+    tokens->match = match;
+    tokens->team_idx = team_idx;
+    tokens->unit_idx = match->units->len - 1;
+}
 
-    if(opp == NULL)
-	return;
+/** Compute the value of a token.
+    @return Whether the token has a value. */
+static gboolean
+strategy_tokens_compute(StrategyTokens *tokens, enum ReplacementToken token,
+			gint *value)
+{
+    const Team *tm = tokens->tm, *opp;
+    const Fixture *fix;
+    const LiveGameUnit *unit = NULL;
 
-    strategy_token_add(token_strat, REP_TOKEN_HOMEADV,
-                       ((fix->teams[0] == tm) ? 1 : -1) * fix->home_advantage);
+    if(!tokens->fix_known)
+    {
+	tokens->fix = team_get_fixture(tm, FALSE);
+	tokens->fix_known = TRUE;
+    }
 
-    strategy_token_add(token_strat, REP_TOKEN_CUP,
-                       fix->competition->id >= ID_CUP_START);
+    fix = tokens->fix;
+    if(fix == NULL)
+	return FALSE;
 
-    strategy_token_add(token_strat, REP_TOKEN_AVSKILLDIFF, 
-		       rint(team_get_average_skill(tm, FALSE) -
-			    team_get_average_skill(opp, FALSE)));
+    opp = fix->teams[fix->teams[0] == tm];
+    if(tokens->match != NULL)
+	unit = &g_array_index(tokens->match->units, LiveGameUnit, tokens->unit_idx);
 
-    strategy_token_add(token_strat, REP_TOKEN_OPPONENT_SKILL,
-		       rint(team_get_average_skill(opp, FALSE)));
+    switch(token)
+    {
+	case REP_TOKEN_HOMEADV:
+	    *value = ((fix->teams[0] == tm) ? 1 : -1) * fix->home_advantage;
+	    return TRUE;
+	case REP_TOKEN_CUP:
+	    *value = fix->competition->id >= ID_CUP_START;
+	    return TRUE;
+	case REP_TOKEN_AVSKILLDIFF:
+	case REP_TOKEN_OPPONENT_SKILL:
+	    if(tokens->opp_skill < 0)
+		tokens->opp_skill = team_get_average_skill(opp, FALSE);
+	    if(token == REP_TOKEN_OPPONENT_SKILL)
+	    {
+		*value = rint(tokens->opp_skill);
+		return TRUE;
+	    }
+	    if(tokens->skill < 0)
+		tokens->skill = team_get_average_skill(tm, FALSE);
+	    *value = rint(tokens->skill - tokens->opp_skill);
+	    return TRUE;
+	case REP_TOKEN_TEAM_LAYERDIFF:
+	    if(tm->country != opp->country)
+		return FALSE;
+	    *value = tm->league->layer - opp->league->layer;
+	    return TRUE;
+	case REP_TOKEN_GOALS_TO_WIN:
+	    *value = fixture_get_goals_to_win(fix, tm);
+	    return TRUE;
+	default:
+	    break;
+    }
 
-    if(tm->country == opp->country)
-	strategy_token_add(token_strat, REP_TOKEN_TEAM_LAYERDIFF,
-		           tm->league->layer - opp->league->layer);
+    if(unit == NULL)
+	return FALSE;
 
-    strategy_token_add(token_strat, REP_TOKEN_GOALS_TO_WIN,
-		       fixture_get_goals_to_win(fix, tm));
+    switch(token)
+    {
+	default:
+	    return FALSE;
+	case REP_TOKEN_SUBS_LEFT:
+	    *value = tokens->match->subs_left[tokens->team_idx];
+	    return TRUE;
+	case REP_TOKEN_NUM_DEF:
+	    *value = math_get_place(tm->structure, 3);
+	    return TRUE;
+	case REP_TOKEN_NUM_MID:
+	    *value = math_get_place(tm->structure, 2);
+	    return TRUE;
+	case REP_TOKEN_NUM_ATT:
+	    *value = math_get_place(tm->structure, 1);
+	    return TRUE;
+	case REP_TOKEN_FORM:
+	    *value = tm->structure;
+	    return TRUE;
+	case REP_TOKEN_TIME:
+	    *value = unit->time;
+	    return TRUE;
+	case REP_TOKEN_MINUTE:
+	    *value = live_game_unit_get_minute(tokens->match, unit);
+	    return TRUE;
+	case REP_TOKEN_MINUTE_REMAINING:
+	    *value = live_game_get_minutes_remaining(tokens->match, unit);
+	    return (*value > 0);
+	case REP_TOKEN_MINUTE_TOTAL:
+	    *value = (query_fixture_is_draw(fix) ? 120 : 90) -
+		live_game_unit_get_minute(tokens->match, unit);
+	    return (*value > 0);
+    }
 }
 
-/** Free the token arrays. */
-void
-strategy_free_tokens(void)
+/** Look up the value of a token, computing it if
+    no condition has asked for it yet.
+    @return Whether the token has a value. */
+static gboolean
+strategy_tokens_get(StrategyTokens *tokens, enum ReplacementToken token,
+		    gint *value)
 {
-#ifdef DEBUG
-    printf("strategy_free_tokens\n");
-#endif
+    if(tokens->state[token] == STRAT_TOKEN_UNKNOWN)
+	tokens->state[token] =
+	    strategy_tokens_compute(tokens, token, &tokens->value[token]) ?
+	    STRAT_TOKEN_SET : STRAT_TOKEN_UNSET;
 
-    gint i;
+    *value = tokens->value[token];
 
-    g_array_free(token_strat, TRUE);
+    return (tokens->state[token] == STRAT_TOKEN_SET);
 }
 
-/** Fill the necessary tokens during a live game. */
-void
-strategy_live_game_set_tokens(const LiveGame *match, gint team_idx)
+/** Check whether a compiled strategy condition is fulfilled.
+    Conditions with a token that has no value never are.
+    @see misc_parse_condition_fast() */
+gboolean
+strategy_check_condition(const StratCondition *condition,
+			 StrategyTokens *tokens)
 {
-#ifdef DEBUG
-    printf("strategy_live_game_set_tokens\n");
-#endif
-
-    gint tmp_int, 
-	current_min = live_game_unit_get_minute(
-	    &g_array_index(match->units, LiveGameUnit, match->units->len - 1));
-    const Team *tm = match->fix->teams[team_idx];
-
-    strategy_set_tokens(tm, match->fix);
-
-    strategy_token_add(token_strat, REP_TOKEN_SUBS_LEFT,
-                       match->subs_left[team_idx]);
-    strategy_token_add(token_strat, REP_TOKEN_NUM_DEF,
-                       math_get_place(tm->structure, 3));
-    strategy_token_add(token_strat, REP_TOKEN_NUM_MID,
-		       math_get_place(tm->structure, 2));
-    strategy_token_add(token_strat, REP_TOKEN_NUM_ATT,
-		       math_get_place(tm->structure, 1));
-    strategy_token_add(token_strat, REP_TOKEN_FORM,
-		       tm->structure);
-    strategy_token_add(token_strat, REP_TOKEN_TIME,
-		   g_array_index(match->units, LiveGameUnit, match->units->len - 1).time);
-    strategy_token_add(token_strat, REP_TOKEN_MINUTE,
-		       current_min);
-
-    tmp_int = live_game_get_minutes_remaining(
-	&g_array_index(match->units, LiveGameUnit, match->units->len - 1));
-    
-    if(tmp_int > 0)
-	strategy_token_add(token_strat, REP_TOKEN_MINUTE_REMAINING, tmp_int);
+    gint i, sp = 0;
+    gint stack[STRAT_COND_STACK_SIZE];
+    const gint *code = condition->code;
 
-    if(query_fixture_is_draw(match->fix))
-	tmp_int = 120 - current_min;
-    else
-	tmp_int = 90 - current_min;
+    for(i=0;i<condition->len;i++)
+	switch(code[i])
+	{
+	    case STRAT_COND_INT:
+		stack[sp++] = code[++i];
+		break;
+	    case STRAT_COND_VAR:
+		if(!strategy_tokens_get(tokens, code[++i], &stack[sp++]))
+		    return FALSE;
+		break;
+	    case STRAT_COND_EQ:
+		sp--;
+		stack[sp - 1] = (stack[sp - 1] == stack[sp]);
+		break;
+	    case STRAT_COND_NE:
+		sp--;
+		stack[sp - 1] = (stack[sp - 1] != stack[sp]);
+		break;
+	    case STRAT_COND_GT:
+		sp--;
+		stack[sp - 1] = (stack[sp - 1] > stack[sp]);
+		break;
+	    case STRAT_COND_GE:
+		sp--;
+		stack[sp - 1] = (stack[sp - 1] >= stack[sp]);
+		break;
+	    case STRAT_COND_LT:
+		sp--;
+		stack[sp - 1] = (stack[sp - 1] < stack[sp]);
+		break;
+	    case STRAT_COND_LE:
+		sp--;
+		stack[sp - 1] = (stack[sp - 1] <= stack[sp]);
+		break;
+	    case STRAT_COND_AND:
+		sp--;
+		stack[sp - 1] = (stack[sp - 1] && stack[sp]);
+		break;
+	    case STRAT_COND_OR:
+		sp--;
+		stack[sp - 1] = (stack[sp - 1] || stack[sp]);
+		break;
+	}
 
-    if(tmp_int > 0)
-	strategy_token_add(token_strat, REP_TOKEN_MINUTE_TOTAL, tmp_int);
+    return (sp > 0 && stack[0] != 0);
 }
 
 /** Compare function for sorting the players when
@@ -594,13 +691,15 @@ strategy_get_sub(const Team *tm, gint position,
 
 /** Apply the strategy actions specified to the given team. */
 void
-strategy_live_game_apply_action(LiveGame *match, gint team_idx,
-				const StrategyMatchAction *action)
+strategy_live_game_apply_action(LiveGameContext *ctx, gint team_idx,
+				const StrategyMatchAction *action,
+				StrategyTokens *tokens)
 {
 #ifdef DEBUG
     printf("strategy_live_game_apply_action\n");
 #endif
 
+    LiveGame *match = ctx->live_game;
     gint sub_in_id = -1, sub_out_id = -1;
     Team *tm = match->fix->teams[team_idx];
     gint old_form = tm->structure;
@@ -610,23 +709,24 @@ strategy_live_game_apply_action(LiveGame *match, gint team_idx,
     if(action->style != -100 && tm->style != action->style)
     {
 	tm->style = action->style;
-	live_game_event_team_change(team_idx, 
+	live_game_event_team_change(ctx, team_idx, 
 				    LIVE_GAME_EVENT_STYLE_CHANGE_ALL_OUT_DEFEND +
 				    tm->style + 2);
     }
 
     if((action->boost != -100 && tm->boost != action->boost) &&
-       (action->boost != 1 || !sett_int("int_opt_disable_boost_on")))
+       (action->boost != 1 || !sett_int(int_opt_disable_boost_on)))
     {
 	tm->boost = action->boost;
-	live_game_event_team_change(team_idx,
+	live_game_event_team_change(ctx, team_idx,
 				    LIVE_GAME_EVENT_BOOST_CHANGE_ANTI +
 				    tm->boost + 1);
     }
 
     if(action->sub_in_pos != -1 && match->subs_left[team_idx] > 0 &&
        (action->sub_condition == NULL || 
-	misc_evaluate_condition(action->parsed_sub_condition, token_strat)))
+	(action->parsed_sub_condition != NULL &&
+	 strategy_check_condition(action->parsed_sub_condition, tokens))))
     {
 	sub_in_id = strategy_get_sub(tm, action->sub_in_pos, 
 				     action->sub_in_prop, TRUE);
@@ -641,29 +741,33 @@ strategy_live_game_apply_action(LiveGame *match, gint team_idx,
 	    team_change_structure(tm, team_find_appropriate_structure(tm));
 	    team_rearrange(tm);
 	    
-	    live_game_event_substitution(team_idx, sub_in_id, sub_out_id);
+	    live_game_event_substitution(ctx, team_idx, sub_in_id, sub_out_id);
 
 	    if(tm->structure != old_form)
-		live_game_event_team_change(team_idx,
+		live_game_event_team_change(ctx, team_idx,
 					    LIVE_GAME_EVENT_STRUCTURE_CHANGE);
 	}
     }
+
+    game_view_update(&match->views[team_idx], tm);
 }
 
 /** Take match actions specified in the team's strategy
     if necessary. */
 void
-strategy_live_game_check(LiveGame *match, gint team_idx)
+strategy_live_game_check(LiveGameContext *ctx, gint team_idx)
 {
 #ifdef DEBUG
     printf("strategy_live_game_check\n");
 #endif
 
     gint i;
+    LiveGame *match = ctx->live_game;
     Team *tm = match->fix->teams[team_idx];
     const Strategy *strat = strategy_from_sid(tm->strategy_sid);
+    StrategyTokens tokens;
 
-    strategy_live_game_set_tokens(match, team_idx);
+    strategy_tokens_init_live_game(&tokens, match, team_idx);
 
     for(i=strat->match_action->len - 1; i >= 0; i--)
     {
@@ -672,12 +776,11 @@ strategy_live_game_check(LiveGame *match, gint team_idx)
 	if((match->subs_left[team_idx] > 0 || action->sub_in_pos == -1) &&
 	   !query_misc_integer_is_in_g_array(action->id, match->action_ids[team_idx]) &&
 	   (action->condition == NULL ||
-	    misc_evaluate_condition(action->parsed_condition, token_strat)))
+	    (action->parsed_condition != NULL &&
+	     strategy_check_condition(action->parsed_condition, &tokens))))
 	{
-	    strategy_live_game_apply_action(match, team_idx, action); 
+	    strategy_live_game_apply_action(ctx, team_idx, action, &tokens);
 	    break;
 	}
     }
-
-    strategy_free_tokens();
 }
@@ -62,23 +62,26 @@ strategy_repair_players(GPtrArray *players,
 			const StrategyPrematch *prematch);
 
 void
-strategy_set_tokens(const Team *tm, const Fixture *fix);
+strategy_tokens_init(StrategyTokens *tokens, const Team *tm);
 
 void
-strategy_free_tokens(void);
+strategy_tokens_init_live_game(StrategyTokens *tokens,
+			       const LiveGame *match, gint team_idx);
 
-void
-strategy_apply_prematch(Team *tm, const StrategyPrematch *prematch);
+gboolean
+strategy_check_condition(const StratCondition *condition,
+			 StrategyTokens *tokens);
 
 void
-strategy_live_game_set_tokens(const LiveGame *match, gint team_idx);
+strategy_apply_prematch(Team *tm, const StrategyPrematch *prematch);
 
 void
-strategy_live_game_check(LiveGame *match, gint team_idx);
+strategy_live_game_check(LiveGameContext *ctx, gint team_idx);
 
 void
-strategy_live_game_apply_action(LiveGame *match, gint team_idx,
-				const StrategyMatchAction *action);
+strategy_live_game_apply_action(LiveGameContext *ctx, gint team_idx,
+				const StrategyMatchAction *action,
+				StrategyTokens *tokens);
 
 gint
 strategy_compare_players_sub(gconstpointer a,
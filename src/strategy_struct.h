@@ -26,6 +26,9 @@
 #ifndef STRATEGY_STRUCT_H
 #define STRATEGY_STRUCT_H
 
+#include "bygfoot.h"
+#include "live_game_struct.h"
+
 /** Lineup types for a CPU team (ie. which players
     are preferred when putting together the first 11). */
 enum StratLineupType
@@ -173,11 +176,39 @@ enum ReplacementToken {
     REP_TOKEN_LAST
 };
 
+/** States of the values in #StrategyTokens. */
+enum StratTokenState
+{
+    STRAT_TOKEN_UNKNOWN = 0,
+    STRAT_TOKEN_SET,
+    STRAT_TOKEN_UNSET
+};
+
+/** The strategy tokens of a team. The values get computed
+    when a condition first needs them and are kept for the
+    live game unit (or the prematch) they were asked for. */
 typedef struct
 {
-    gboolean initialized;
-    gint value;
-} StratTokenValue;
+    const Team *tm;
+    /** The fixture of the team; NULL if it has none. */
+    const Fixture *fix;
+    /** The live game and the index of the unit the tokens
+	are computed for; NULL before the match. */
+    const LiveGame *match;
+    gint team_idx, unit_idx;
+    /** Whether the fixture has been looked up. */
+    gboolean fix_known;
+    /** Average skills of the team and the opponent;
+	negative until computed. */
+    gfloat skill, opp_skill;
+    /** State and value of each token, see #StratTokenState. */
+    guint8 state[REP_TOKEN_LAST];
+    gint value[REP_TOKEN_LAST];
+} StrategyTokens;
+
+/** The number of operands a strategy condition may keep
+    on the evaluation stack. */
+#define STRAT_COND_STACK_SIZE 16
 
 typedef struct
 {
@@ -186,14 +217,24 @@ typedef struct
     gint len;
 } StratCondPart;
 
+/** A strategy condition compiled into postfix instructions.
+    An instruction is a #StratCondToken operator or
+    #STRAT_COND_INT or #STRAT_COND_VAR followed by the
+    number or the #ReplacementToken to push. */
+typedef struct
+{
+    gint *code;
+    gint len;
+} StratCondition;
+
 /** A struct describing the pre-match strategy settings 
     of a CPU team. */
 typedef struct
 {
     /** A condition describing when the strategy should be applied. */
     gchar *condition;
-    /** A lexed version of the conditions for faster processing. */
-    GArray *parsed_condition;
+    /** A compiled version of the condition for faster processing. */
+    StratCondition *parsed_condition;
     /** Array of possible formations, sorted by preference. */
     GArray *formations;
     /** Boost, style values and lineup type. */
@@ -207,8 +248,8 @@ typedef struct
 {
     /** A condition describing when the action should be taken. */
     gchar *condition, *sub_condition;
-    /** A lexed version of the conditions for faster processing. */
-    GArray *parsed_condition, *parsed_sub_condition;
+    /** Compiled versions of the conditions for faster processing. */
+    StratCondition *parsed_condition, *parsed_sub_condition;
     /** New boost and style values. */
     gint boost, style;
     /** Substitution specifiers (position and property).
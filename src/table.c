@@ -25,6 +25,7 @@
 
 #include "cup.h"
 #include "competition.h"
+#include "fixture.h"
 #include "league.h"
 #include "misc.h"
 #include "table.h"
@@ -65,6 +66,7 @@ table_element_new(Team *team, gint old_rank)
 
     new.team = team;
     new.old_rank = old_rank;
+    new.changed = TRUE;
 
     for(i=0;i<TABLE_END;i++)
 	new.values[i] = 0;
@@ -97,6 +99,7 @@ table_update(const Fixture *fix)
         {
             if(elements[i] != NULL)
             {
+                elements[i]->changed = TRUE;
                 elements[i]->values[TABLE_PLAYED]++;
                 elements[i]->values[TABLE_GF] += fix->result[i][0];
                 elements[i]->values[TABLE_GA] += fix->result[!i][0];
@@ -197,7 +200,6 @@ table_element_compare_func(gconstpointer a,
     printf("table_element_compare_func\n");
 #endif
 
-    gint i;
     gint cup_round, value;
     TableElement *element1 = (TableElement*)a,
 	*element2 = (TableElement*)b;
@@ -208,12 +210,6 @@ table_element_compare_func(gconstpointer a,
     if(element1->team == element2->team)
 	return 0;
 
-    fixtures = league_cup_get_fixtures(comp->id);
-    if(competition_is_league(comp))
-	cup_round = -1;
-    else
-	cup_round = cup_has_tables((Cup*)comp);
-    
     /*todo use misc_int_compare*/
     if(element1->values[TABLE_PTS] != element2->values[TABLE_PTS])
 	value = misc_int_compare(element1->values[TABLE_PTS],
@@ -227,20 +223,16 @@ table_element_compare_func(gconstpointer a,
 				 element2->values[TABLE_GA]);
     else
     {
-	for(i=0;i<fixtures->len;i++)
-	{
-	    if(g_array_index(fixtures, Fixture, i).round == cup_round &&
-	       g_array_index(fixtures, Fixture, i).week_number <= week &&
-	       g_array_index(fixtures, Fixture, i).week_round_number <= week_round)
-	    {
-		if(g_array_index(fixtures, Fixture, i).teams[0] == element1->team &&
-		   g_array_index(fixtures, Fixture, i).teams[1] == element2->team)
-		    fix[0] = &g_array_index(fixtures, Fixture, i);
-		else if(g_array_index(fixtures, Fixture, i).teams[1] == element1->team &&
-			g_array_index(fixtures, Fixture, i).teams[0] == element2->team)
-		    fix[1] = &g_array_index(fixtures, Fixture, i);
-	    }
-	}
+	fixtures = league_cup_get_fixtures(comp->id);
+	if(competition_is_league(comp))
+	    cup_round = -1;
+	else
+	    cup_round = cup_has_tables((Cup*)comp);
+
+	fix[0] = fixture_get_head_to_head(comp, fixtures, element1->team, element2->team,
+					  cup_round, week, week_round);
+	fix[1] = fixture_get_head_to_head(comp, fixtures, element2->team, element1->team,
+					  cup_round, week, week_round);
 	
 	if(fix[0] == NULL || fix[1] == NULL)
 	    value = 0;
@@ -262,6 +254,104 @@ table_element_compare_func(gconstpointer a,
     return value;
 }
 
+/** Sort a table after a week round, remembering the old ranks.
+    Only the elements whose values changed since the last sort
+    get sorted; they are then merged into the others, which
+    keep their order.
+    @param comp The league or cup of the table. */
+void
+table_sort(Table *table, Competition *comp)
+{
+#ifdef DEBUG
+    printf("table_sort\n");
+#endif
+
+    gint i, j, k, value;
+    GArray *elements = table->elements;
+    GArray *changed = NULL, *unchanged = NULL, *check = NULL;
+    const TableElement *elem, *changed_elem, *unchanged_elem;
+
+    for(i=0;i<elements->len;i++)
+	g_array_index(elements, TableElement, i).old_rank = i;
+
+    if(debug > 130)
+	check = g_array_copy(elements);
+
+    changed = g_array_new(FALSE, FALSE, sizeof(TableElement));
+    unchanged = g_array_sized_new(FALSE, FALSE, sizeof(TableElement), elements->len);
+
+    for(i=0;i<elements->len;i++)
+    {
+	elem = &g_array_index(elements, TableElement, i);
+	if(elem->changed)
+	    g_array_append_val(changed, *elem);
+	else
+	    g_array_append_val(unchanged, *elem);
+    }
+
+    if(changed->len > 0)
+    {
+	g_array_sort_with_data(changed,
+			       (GCompareDataFunc)table_element_compare_func,
+			       comp);
+
+	/* Ties go to the element that was ranked higher,
+	   like in a stable sort of the whole table. */
+	i = j = 0;
+	for(k=0;k<elements->len;k++)
+	{
+	    unchanged_elem = (i < unchanged->len) ?
+		&g_array_index(unchanged, TableElement, i) : NULL;
+	    changed_elem = (j < changed->len) ?
+		&g_array_index(changed, TableElement, j) : NULL;
+
+	    if(unchanged_elem == NULL)
+		value = 1;
+	    else if(changed_elem == NULL)
+		value = -1;
+	    else
+	    {
+		value = table_element_compare_func(unchanged_elem, changed_elem, comp);
+		if(value == 0)
+		    value = misc_int_compare(changed_elem->old_rank,
+					     unchanged_elem->old_rank);
+	    }
+
+	    if(value < 0)
+	    {
+		g_array_index(elements, TableElement, k) = *unchanged_elem;
+		i++;
+	    }
+	    else
+	    {
+		g_array_index(elements, TableElement, k) = *changed_elem;
+		j++;
+	    }
+
+	    g_array_index(elements, TableElement, k).changed = FALSE;
+	}
+    }
+
+    if(check != NULL)
+    {
+	g_array_sort_with_data(check,
+			       (GCompareDataFunc)table_element_compare_func,
+			       comp);
+	for(i=0;i<elements->len;i++)
+	    if(g_array_index(check, TableElement, i).team !=
+	       g_array_index(elements, TableElement, i).team)
+	    {
+		debug_print_message("table_sort: sorting the changed elements of table %s differs from sorting the whole table at rank %d\n",
+				    table->name, i + 1);
+		break;
+	    }
+	g_array_free(check, TRUE);
+    }
+
+    g_array_free(changed, TRUE);
+    g_array_free(unchanged, TRUE);
+}
+
 /** Find out if there are active leagues (which automatically
     have tables then) or cups with tables in the country. */
 gboolean
@@ -311,6 +401,7 @@ table_copy(const Table *table)
         elem = &g_array_index(table->elements, TableElement, i);
         new_table_element.team = elem->team;
         new_table_element.old_rank = elem->old_rank;
+        new_table_element.changed = elem->changed;
 
         for(j=0;j<TABLE_END;j++)
             new_table_element.values[j] = elem->values[j];
@@ -47,6 +47,9 @@ table_element_compare_func(gconstpointer a,
 			   gconstpointer b,
 			   gpointer clid_round);
 
+void
+table_sort(Table *table, Competition *comp);
+
 gboolean
 query_tables_in_country(void);
 
@@ -59,6 +59,9 @@ typedef struct
 	Used to display an arrow if the rank changed. */
     gint old_rank;
     gint values[TABLE_END];
+    /** Whether the values changed since the table was last sorted.
+	@see table_sort() */
+    gboolean changed;
 } TableElement;
 
 /**
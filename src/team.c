@@ -37,6 +37,7 @@
 #include "misc.h"
 #include "option.h"
 #include "player.h"
+#include "registry.h"
 #include "strategy.h"
 #include "team.h"
 #include "transfer.h"
@@ -69,6 +70,11 @@ team_new(gboolean new_id, Country *country)
     new.average_talent = 0;
     new.luck = 1;
 
+    new.stadium.capacity = -1;
+    new.stadium.average_attendance = new.stadium.possible_attendance =
+	new.stadium.games = 0;
+    new.stadium.safety = new.stadium.ticket_price = 0;
+
     new.players = g_array_new(FALSE, FALSE, sizeof(Player));
     new.first_team.team = NULL;
     new.reserve_level = 0;
@@ -87,8 +93,8 @@ team_generate_players_stadium(Team *tm)
 #endif
 
     gint i;    
-    gfloat skill_factor = math_rnd(1 - const_float("float_team_skill_variance"),
-				   1 + const_float("float_team_skill_variance"));
+    gfloat skill_factor = math_rnd(1 - const_float(float_team_skill_variance),
+				   1 + const_float(float_team_skill_variance));
     Player new;
     gfloat wages = 0, average_talent, league_av_talent;
     gchar *def_file = team_has_def_file(tm);    
@@ -98,21 +104,21 @@ team_generate_players_stadium(Team *tm)
     tm->stadium.average_attendance = tm->stadium.possible_attendance =
 	tm->stadium.games = 0;
     tm->stadium.safety = 
-	math_rnd(const_float("float_team_stadium_safety_lower"),
-		 const_float("float_team_stadium_safety_upper"));
-    tm->stadium.ticket_price = const_int("int_team_stadium_ticket_price");
+	math_rnd(const_float(float_team_stadium_safety_lower),
+		 const_float(float_team_stadium_safety_upper));
+    tm->stadium.ticket_price = const_int(int_team_stadium_ticket_price);
 
     league_av_talent = tm->league->average_talent;
     average_talent = (tm->average_talent == 0) ?
         skill_factor * league_av_talent :
         tm->average_talent;
 	
-    average_talent = CLAMP(average_talent, 0, const_float_fast(float_player_max_skill));
+    average_talent = CLAMP(average_talent, 0, const_float(float_player_max_skill));
     tm->average_talent = average_talent;
 
     if(def_file == NULL)
     {
-	for(i=0;i<const_int("int_team_cpu_players");i++)
+	for(i=0;i<const_int(int_team_cpu_players);i++)
 	{
 	    new = player_new(tm, average_talent, TRUE);
 	    g_array_append_val(tm->players, new);
@@ -124,12 +130,48 @@ team_generate_players_stadium(Team *tm)
 	g_free(def_file);
     }
 
-    for(i=0;i<const_int("int_team_cpu_players") - 2;i++)
+    for(i=0;i<const_int(int_team_cpu_players) - 2;i++)
 	wages += g_array_index(tm->players, Player, i).wage;
 
     tm->stadium.capacity = 
-	math_round_integer((gint)rint((wages / (gfloat)const_int("int_team_stadium_ticket_price")) *
-				      const_float("float_team_stadium_size_wage_factor")), 2);
+	math_round_integer((gint)rint((wages / (gfloat)const_int(int_team_stadium_ticket_price)) *
+				      const_float(float_team_stadium_size_wage_factor)), 2);
+}
+
+/** Check whether the team is a team of another country
+    whose players haven't been generated yet.
+    @see start_load_other_countries() */
+gboolean
+query_team_is_skeleton(const Team *tm)
+{
+    return (tm->players->len == 0 && tm->country != &country);
+}
+
+/** Generate the players and the stadium of a team of
+    another country the first time it's needed. The random numbers
+    come from a stream keyed by the random seed and the team id, so
+    the team looks the same no matter when it's generated.
+    @param tm The team that gets filled if it's a skeleton. */
+void
+team_fill_skeleton(Team *tm)
+{
+#ifdef DEBUG
+    printf("team_fill_skeleton\n");
+#endif
+
+    MathRand *current, *stream;
+
+    if(!query_team_is_skeleton(tm))
+	return;
+
+    current = math_rand_get_current();
+    stream = math_rand_new(math_rand_key(rand_seed, -1, -1, -1, -1, tm->id));
+    math_rand_set_current(stream);
+
+    team_generate_players_stadium(tm);
+
+    math_rand_set_current(current);
+    math_rand_free(stream);
 }
 
 /** Check whether the team is already part of an
@@ -225,15 +267,12 @@ team_get_pointers_from_array(const GArray *teams, GPtrArray *team_ptrs)
     return team_pointers;
 }
 
-/** Return the pointer to the team belonging to
-    the id. */
-Team*
-team_of_id(gint id)
+/** Find a team by scanning all leagues; used to
+    cross-check the registry in debug mode.
+    @see team_of_id() */
+static Team*
+team_of_id_scan(gint id)
 {
-#ifdef DEBUG
-    printf("team_of_id\n");
-#endif
-
     gint i, j, k;
 
     for(i=0;i<country.leagues->len;i++) {
@@ -257,12 +296,32 @@ team_of_id(gint id)
         }
     }
 
-    main_exit_program(EXIT_POINTER_NOT_FOUND, 
-		      "team_of_id: team with id %d not found.", id);
-
     return NULL;
 }
 
+/** Return the pointer to the team belonging to
+    the id. */
+Team*
+team_of_id(gint id)
+{
+#ifdef DEBUG
+    printf("team_of_id\n");
+#endif
+
+    Team *tm = registry_get_team(id);
+
+    if(debug > 130 && tm != team_of_id_scan(id))
+	debug_print_message("team_of_id: registry and scan disagree for team with id %d\n", id);
+
+    if(tm == NULL)
+	main_exit_program(EXIT_POINTER_NOT_FOUND, 
+			  "team_of_id: team with id %d not found.", id);
+
+    team_fill_skeleton(tm);
+
+    return tm;
+}
+
 /** Return the pointer to the team belonging to the sid. */
 Team *
 team_of_sid(const char *sid, const Country *country)
@@ -724,7 +783,7 @@ team_change_attribute_with_message(Team *tm, gint attribute, gint new_value)
 		    _("Boost changed to %s (costs %d per minute)."), 
 		    team_attribute_to_char(attribute, new_value),
 		    (gint)rint(finance_wage_unit(current_user.tm) *
-			       const_float("float_boost_cost_factor")));
+			       const_float(float_boost_cost_factor)));
 	    else
 		game_gui_print_message(_("Boost changed to %s."), 
 				       team_attribute_to_char(attribute, new_value));
@@ -741,8 +800,8 @@ team_update_cpu_new_players(Team *tm)
 #endif
 
     gint i;
-    gint number_of_new = math_rndi(const_int("int_team_new_players_lower"),
-				   const_int("int_team_new_players_upper"));
+    gint number_of_new = math_rndi(const_int(int_team_new_players_lower),
+				   const_int(int_team_new_players_upper));
     gint player_numbers[tm->players->len];
 
     math_generate_permutation(player_numbers, 0, tm->players->len - 1);
@@ -754,57 +813,157 @@ team_update_cpu_new_players(Team *tm)
     }
 }
 
-/** Increase player ages etc.
-    @param tm The user team we examine. */
+/** Regenerate player fitness etc. after a match. 
+    @param tm The user team we examine.
+    @param clid The fixture clid. */
 void
-team_update_team_weekly(Team *tm)
+team_update_post_match(Team *tm, const Fixture *fix)
 {
 #ifdef DEBUG
-    printf("team_update_team_weekly\n");
+    printf("team_update_post_match\n");
 #endif
 
     gint i;
 
-    for(i=tm->players->len - 1;i>=0;i--)
-	player_update_weekly(&g_array_index(tm->players, Player, i));
-
-    if(team_is_user(tm) == -1 &&
-       math_rnd(0, 1) < const_float("float_team_new_player_probability"))
-	team_update_cpu_new_players(tm);
+    for(i=0;i<tm->players->len;i++)
+	player_update_post_match(player_of_idx_team(tm, i), fix);
 }
 
-/** Regenerate player fitness etc. after a match. 
-    @param tm The user team we examine.
-    @param clid The fixture clid. */
-void
-team_update_post_match(Team *tm, const Fixture *fix)
+/** A team whose players get updated by a worker thread.
+    @see team_update_teams() */
+typedef struct
+{
+    Team *tm;
+    gint update;
+    gboolean user;
+    MathRand *rand;
+} TeamUpdateJob;
+
+/** Update the players of a team (age, skill, fitness etc.).
+    @param update The kind of update. @see #TeamUpdate */
+static void
+team_update_players(Team *tm, gint update)
 {
 #ifdef DEBUG
-    printf("team_update_post_match\n");
+    printf("team_update_players\n");
 #endif
 
     gint i;
 
-    for(i=0;i<tm->players->len;i++)
-	player_update_post_match(player_of_idx_team(tm, i), fix);
+    if(update == TEAM_UPDATE_WEEKLY)
+    {
+	for(i=tm->players->len - 1;i>=0;i--)
+	    player_update_weekly(&g_array_index(tm->players, Player, i));
+    }
+    else
+	for(i=0;i<tm->players->len;i++)
+	    player_update_week_roundly(tm, i);
 }
 
-/** Some updates each round.
-    @param tm The user team we examine. */
+/** Thread pool function updating the players of a CPU team. */
+static void
+team_update_job(gpointer data, gpointer user_data)
+{
+#ifdef DEBUG
+    printf("team_update_job\n");
+#endif
+
+    TeamUpdateJob *job = (TeamUpdateJob*)data;
+
+    math_rand_set_current(job->rand);
+    team_update_players(job->tm, job->update);
+    math_rand_set_current(NULL);
+}
+
+/** Do the part of the update of a CPU team that touches
+    other teams or global data: new players replacing old ones
+    and the pre-match strategy, which looks at the opponent.
+    @param update The kind of update. @see #TeamUpdate */
+static void
+team_update_cpu_team(Team *tm, gint update)
+{
+#ifdef DEBUG
+    printf("team_update_cpu_team\n");
+#endif
+
+    if(update == TEAM_UPDATE_WEEKLY)
+    {
+	if(math_rnd(0, 1) < const_float(float_team_new_player_probability))
+	    team_update_cpu_new_players(tm);
+    }
+    else
+	strategy_update_team_pre_match(tm);
+}
+
+/** Update teams at the beginning of a week or a week round.
+    The players of the CPU teams get updated first, by several
+    threads if wanted. Afterwards the user teams and the updates
+    with side effects on other teams (user events, expiring contracts,
+    new players, the transfer list, strategies) are done in the calling
+    thread, in the order of the array. Each team draws from its own
+    random number stream, so the results don't depend on the number of
+    threads.
+    @param teams The teams to update.
+    @param update The kind of update. @see #TeamUpdate
+    @param num_threads How many threads to use; with 1 or less
+    everything is done in the calling thread. */
 void
-team_update_team_week_roundly(Team *tm)
+team_update_teams(GPtrArray *teams, gint update, gint num_threads)
 {
 #ifdef DEBUG
-    printf("team_update_team_week_roundly\n");
+    printf("team_update_teams\n");
 #endif
 
     gint i;
+    TeamUpdateJob *jobs = g_new(TeamUpdateJob, teams->len);
+    GThreadPool *pool = NULL;
+    GError *error = NULL;
 
-    for(i=0;i<tm->players->len;i++)
-	player_update_week_roundly(tm, i);
+    for(i=0;i<teams->len;i++)
+    {
+	jobs[i].tm = (Team*)g_ptr_array_index(teams, i);
+	jobs[i].update = update;
+	jobs[i].user = (team_is_user(jobs[i].tm) != -1);
+	/* Negative competition ids keep the streams apart from
+	   the ones of the fixtures. */
+	jobs[i].rand = math_rand_new(
+	    math_rand_key(rand_seed, season, week, week_round,
+			  -1 - update, jobs[i].tm->id));
+    }
 
-    if(team_is_user(tm) == -1)
-	strategy_update_team_pre_match(tm);
+    if(num_threads > 1)
+    {
+	pool = g_thread_pool_new(team_update_job, NULL,
+				 num_threads, TRUE, &error);
+	misc_print_error(&error, TRUE);
+    }
+
+    for(i=0;i<teams->len;i++)
+	if(!jobs[i].user)
+	{
+	    if(pool != NULL)
+		g_thread_pool_push(pool, &jobs[i], NULL);
+	    else
+		team_update_job(&jobs[i], NULL);
+	}
+
+    /* Wait for the CPU teams to finish. */
+    if(pool != NULL)
+	g_thread_pool_free(pool, FALSE, TRUE);
+
+    for(i=0;i<teams->len;i++)
+    {
+	math_rand_set_current(jobs[i].rand);
+	if(jobs[i].user)
+	    team_update_players(jobs[i].tm, update);
+	else
+	    team_update_cpu_team(jobs[i].tm, update);
+	math_rand_set_current(NULL);
+
+	math_rand_free(jobs[i].rand);
+    }
+
+    g_free(jobs);
 }
 
 /** Return a value from the league table element going with the team.
@@ -955,10 +1114,10 @@ team_get_new(const Team *tm, gboolean fire)
 
     gint i;
     gint lower = 0, upper = 0;
-    gint bound1 = (fire) ? const_int("int_team_new_bound_upper") :
-	const_int("int_team_new_bound_lower"),
-	bound2 = (fire) ? const_int("int_team_new_bound_lower") :
-	const_int("int_team_new_bound_upper");
+    gint bound1 = (fire) ? const_int(int_team_new_bound_upper) :
+	const_int(int_team_new_bound_lower),
+	bound2 = (fire) ? const_int(int_team_new_bound_lower) :
+	const_int(int_team_new_bound_upper);
     gint idx = -1;
     GPtrArray *teams = 
 	team_get_sorted(team_compare_func, TEAM_COMPARE_LEAGUE_RANK, FALSE);
@@ -1130,8 +1289,8 @@ team_write_own_results(const Team *tm, gchar *buf, gboolean sort, gboolean cup_m
 		{
 		    /* a match away */
 		    sprintf(buf3, _("<span background='%s' foreground='%s'>%s (A) </span> "), 
-			    const_app("string_treeview_live_game_commentary_away_bg"),
-			    const_app("string_treeview_live_game_commentary_away_fg"),
+			    const_app(string_treeview_live_game_commentary_away_bg),
+			    const_app(string_treeview_live_game_commentary_away_fg),
 			    buf2);
 		    place = 1;
 		}
@@ -1175,7 +1334,7 @@ team_write_results(const Team *tm, gchar *result_buf, gchar *goals_buf)
     gint i;
     GPtrArray *latest_fixtures = fixture_get_latest(tm, TRUE);
     gint res[2], goals[2] = {0, 0};
-    gint end_idx = latest_fixtures->len - const_int("int_treeview_latest_results");
+    gint end_idx = latest_fixtures->len - const_int(int_treeview_latest_results);
 
     strcpy(result_buf, "");
     end_idx = MAX(0, end_idx);
@@ -1256,7 +1415,7 @@ team_has_def_file(const Team *tm)
     gchar *return_value = NULL;
     gchar buf[SMALL];
 
-    if(tm->def_file != NULL && opt_int("int_opt_load_defs") != 0)
+    if(tm->def_file != NULL && opt_int(int_opt_load_defs) != 0)
     {
 	sprintf(buf, "team_%s.xml", tm->def_file);
 	return_value = file_find_support_file(buf, FALSE);
@@ -1277,7 +1436,7 @@ team_complete_def(Team *tm)
     gint i, new_pos, pos_sum;
     gint positions[4] = {0, 0, 0, 0};
     Player new_player;
-    gint add = const_int("int_team_cpu_players") - tm->players->len;
+    gint add = const_int(int_team_cpu_players) - tm->players->len;
     gboolean is_user = (team_is_user(tm) != -1);
 
     for(i=0;i<tm->players->len;i++)
@@ -1300,10 +1459,10 @@ team_complete_def(Team *tm)
 	if(positions[0] < 2)
 	    new_pos = 0;
 	else if((gfloat)positions[1] / (gfloat)pos_sum <
-		const_float("float_player_pos_bound1"))
+		const_float(float_player_pos_bound1))
 	    new_pos = 1;
 	else if((gfloat)positions[2] / (gfloat)pos_sum <
-		const_float("float_player_pos_bound1"))
+		const_float(float_player_pos_bound1))
 	    new_pos = 2;
 	else
 	    new_pos = 3;
@@ -43,6 +43,15 @@ enum TeamCompare
     TEAM_COMPARE_END
 };
 
+/** The regular updates of all teams.
+    @see team_update_teams() */
+enum TeamUpdate
+{
+    TEAM_UPDATE_WEEKLY = 0,
+    TEAM_UPDATE_WEEK_ROUNDLY,
+    TEAM_UPDATE_END
+};
+
 Team
 team_new(gboolean new_id, Country *country);
 
@@ -52,6 +61,12 @@ query_is_my_team(const Team *tm);
 void
 team_generate_players_stadium(Team *tm);
 
+gboolean
+query_team_is_skeleton(const Team *tm);
+
+void
+team_fill_skeleton(Team *tm);
+
 gboolean
 query_team_is_in_cups(const Team *tm, gint group);
 
@@ -103,9 +118,6 @@ team_attribute_to_char(gint attribute, gint value);
 void
 team_change_attribute_with_message(Team * tm, gint attribute, gint new_value);
 
-void
-team_update_team_weekly(Team *tm);
-
 void
 team_update_post_match(Team *tm, const Fixture *fix);
 
@@ -113,7 +125,7 @@ void
 team_update_cpu_new_players(Team *tm);
 
 void
-team_update_team_week_roundly(Team *tm);
+team_update_teams(GPtrArray *teams, gint update, gint num_threads);
 
 Team*
 team_get_new(const Team *tm, gboolean fire);
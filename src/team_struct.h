@@ -75,7 +75,9 @@ typedef struct
     @see Player */
 typedef struct team
 {
-    gchar *name, *symbol;
+    /** The name, which is in the name pool. @see name_intern() */
+    gchar *name;
+    gchar *symbol;
     /** File the team takes the 
 	player names from. */
     gchar *names_file;
@@ -0,0 +1,1003 @@
+/*
+   token.c
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include "debug.h"
+#include "maths.h"
+#include "misc.h"
+#include "token.h"
+
+static void
+token_render(const GPtrArray *parts, const TokenValue *token_rep,
+	     gchar **results, gchar *dest, gsize *len);
+
+/** Set the replacement of a token. The replacement
+    gets freed when the token is removed. If the token is
+    set already, the first replacement stays like it always did.
+    @param token The token, e.g. REP_TOKEN_PLAYER0.
+    @param replacement The replacement or NULL. */
+void
+token_add(TokenValue *token_rep, gint token, gchar *replacement)
+{
+#ifdef DEBUG
+    printf("token_add\n");
+#endif
+
+    token = token_from_name(NULL, token);
+
+    if(replacement == NULL || token_rep[token].string != NULL)
+    {
+	g_free(replacement);
+	return;
+    }
+
+    token_rep[token].string = replacement;
+    token_rep[token].value = 0;
+    token_rep[token].number =
+	(*misc_skip_spaces(misc_parse_expression(
+			       replacement, &token_rep[token].value)) == '\0');
+}
+
+/** Set a token to 0 or 1. */
+void
+token_add_bool(TokenValue *token_rep, gint token, gboolean value)
+{
+#ifdef DEBUG
+    printf("token_add_bool\n");
+#endif
+
+    token_add(token_rep, token, misc_int_to_char(value));
+}
+
+/** Unset a token. */
+void
+token_remove(TokenValue *token_rep, gint token)
+{
+#ifdef DEBUG
+    printf("token_remove\n");
+#endif
+
+    token = token_from_name(NULL, token);
+
+    g_free(token_rep[token].string);
+    token_rep[token].string = NULL;
+}
+
+/** Unset all tokens of the array. */
+void
+token_remove_all(TokenValue *token_rep)
+{
+#ifdef DEBUG
+    printf("token_remove_all\n");
+#endif
+
+    gint i;
+
+    for(i=0;i<REP_TOKEN_LAST;i++)
+    {
+	g_free(token_rep[i].string);
+	token_rep[i].string = NULL;
+    }
+}
+
+/** Return the token with the given name, e.g. _P0_.
+    @param name The name or NULL if only the token should get
+    canonicalised; in this case len is the token.
+    @return The token or REP_TOKEN_LAST if there's none. */
+gint
+token_from_name(const gchar *name, gint len)
+{
+    gint token = (name == NULL) ?
+	len : misc_parse_replacement_token(name, len);
+
+    /* The news cup flag is _CUP_ like the cup name. */
+    return (token == REP_TOKEN_BOOL_CUP) ? REP_TOKEN_CUP : token;
+}
+
+/** Free a part of a compiled text. */
+static void
+token_part_free(gpointer data)
+{
+    TokenPart *part = (TokenPart*)data;
+
+    /* Parts moved into a bracket leave a NULL behind. */
+    if(part == NULL)
+	return;
+
+    g_free(part->text);
+    if(part->parts != NULL)
+	g_ptr_array_free(part->parts, TRUE);
+    if(part->choices != NULL)
+	g_ptr_array_free(part->choices, TRUE);
+    g_free(part);
+}
+
+static TokenPart*
+token_part_new(gint type, const gchar *text, gsize len)
+{
+    TokenPart *part = g_malloc0(sizeof(TokenPart));
+
+    part->type = type;
+    part->text = (text == NULL) ? NULL : g_strndup(text, len);
+    part->token = REP_TOKEN_LAST;
+    part->bracket = -1;
+
+    if(type == TOKEN_PART_NAME)
+	part->parts = g_ptr_array_new_with_free_func(token_part_free);
+
+    return part;
+}
+
+/** Add the text between start and end to the parts
+    unless it's empty. */
+static void
+token_parts_add_text(GPtrArray *parts, const gchar *start, const gchar *end)
+{
+    if(end > start)
+	g_ptr_array_add(parts, token_part_new(TOKEN_PART_TEXT, start, end - start));
+}
+
+static gboolean
+query_token_part_is_text(const TokenPart *part, const gchar *text)
+{
+    return (part->type == TOKEN_PART_TEXT && strcmp(part->text, text) == 0);
+}
+
+/** Split a text into plain text, tokens and single brackets.
+    We look for tokens from the right like the string replacement
+    always did, so that _POSS_POSS__ ends with the token _POSS_. */
+static GPtrArray*
+token_text_split(const gchar *text)
+{
+    GPtrArray *parts = g_ptr_array_new_with_free_func(token_part_free);
+    const gchar *end = text + strlen(text), *s = end, *start;
+    TokenPart *part;
+    gint i, token;
+
+    while(s > text)
+    {
+	s--;
+
+	if(*s == '[' || *s == ']')
+	{
+	    token_parts_add_text(parts, s + 1, end);
+	    token_parts_add_text(parts, s, s + 1);
+	    end = s;
+	    continue;
+	}
+
+	if(*s != '_')
+	    continue;
+
+	for(start=s - 1;start >= text && *start != '_';start--);
+
+	if(start >= text &&
+	   (token = token_from_name(start, s - start + 1)) != REP_TOKEN_LAST)
+	{
+	    token_parts_add_text(parts, s + 1, end);
+	    part = token_part_new(TOKEN_PART_TOKEN, start, s - start + 1);
+	    part->token = token;
+	    g_ptr_array_add(parts, part);
+	    end = s = start;
+	}
+    }
+
+    token_parts_add_text(parts, text, end);
+
+    for(i=0;i<parts->len / 2;i++)
+    {
+	part = g_ptr_array_index(parts, i);
+	g_ptr_array_index(parts, i) = g_ptr_array_index(parts, parts->len - 1 - i);
+	g_ptr_array_index(parts, parts->len - 1 - i) = part;
+    }
+
+    return parts;
+}
+
+/** Move the contents of the brackets to the bracket array in the
+    order the string replacement always evaluated them: the rightmost
+    opening bracket with the next closing one first. The brackets
+    are replaced by parts referring to them. */
+static void
+token_text_get_brackets(GPtrArray *parts, GPtrArray *brackets, const gchar *text)
+{
+    gint i, open, close;
+    TokenPart *bracket, *ref;
+
+    while(TRUE)
+    {
+	open = close = -1;
+
+	for(i=parts->len - 1;i>=0 && open == -1;i--)
+	    if(query_token_part_is_text(g_ptr_array_index(parts, i), "["))
+		open = i;
+
+	if(open == -1)
+	    return;
+
+	for(i=open + 1;i<parts->len && close == -1;i++)
+	    if(query_token_part_is_text(g_ptr_array_index(parts, i), "]"))
+		close = i;
+
+	if(close == -1)
+	{
+	    debug_print_message("token_text_get_brackets: no closing bracket in '%s'\n",
+				text);
+	    g_ptr_array_remove_range(parts, open, parts->len - open);
+	    continue;
+	}
+
+	bracket = token_part_new(TOKEN_PART_BRACKET, NULL, 0);
+	bracket->bracket = brackets->len;
+	bracket->parts = g_ptr_array_new_with_free_func(token_part_free);
+	for(i=open + 1;i<close;i++)
+	{
+	    g_ptr_array_add(bracket->parts, g_ptr_array_index(parts, i));
+	    g_ptr_array_index(parts, i) = NULL;
+	}
+
+	g_ptr_array_remove_range(parts, open + 1, close - open);
+	token_part_free(g_ptr_array_index(parts, open));
+	g_ptr_array_index(parts, open) = ref =
+	    token_part_new(TOKEN_PART_BRACKET, NULL, 0);
+	ref->bracket = bracket->bracket;
+	g_ptr_array_add(brackets, bracket);
+    }
+}
+
+/** Merge adjacent text parts and turn the token names built
+    from other parts, like _T_POSS__ or _T[_GOALS0_ G _GOALS1_]_,
+    into name parts: an underscore and capital letters, a token or
+    bracket, capital letters or digits and an underscore. */
+static void
+token_parts_get_names(GPtrArray *parts)
+{
+    gint i;
+    TokenPart *prev, *next, *name;
+    gchar *prefix, *suffix, *end, *text;
+
+    for(i=parts->len - 1;i>0;i--)
+    {
+	prev = g_ptr_array_index(parts, i - 1);
+	next = g_ptr_array_index(parts, i);
+
+	if(prev->type == TOKEN_PART_TEXT && next->type == TOKEN_PART_TEXT)
+	{
+	    text = g_strconcat(prev->text, next->text, NULL);
+	    g_free(prev->text);
+	    prev->text = text;
+	    g_ptr_array_remove_index(parts, i);
+	}
+    }
+
+    for(i=1;i + 1<parts->len;i++)
+    {
+	prev = g_ptr_array_index(parts, i - 1);
+	next = g_ptr_array_index(parts, i + 1);
+	name = g_ptr_array_index(parts, i);
+
+	if(prev->type != TOKEN_PART_TEXT || next->type != TOKEN_PART_TEXT ||
+	   (name->type != TOKEN_PART_TOKEN && name->type != TOKEN_PART_BRACKET))
+	    continue;
+
+	end = prefix = prev->text + strlen(prev->text);
+	while(prefix > prev->text && g_ascii_isupper(prefix[-1]))
+	    prefix--;
+	if(prefix == end || prefix == prev->text || prefix[-1] != '_')
+	    continue;
+	prefix--;
+
+	suffix = next->text;
+	while(g_ascii_isupper(*suffix) || g_ascii_isdigit(*suffix))
+	    suffix++;
+	if(*suffix != '_')
+	    continue;
+	suffix++;
+
+	name = token_part_new(TOKEN_PART_NAME, NULL, 0);
+	g_ptr_array_add(name->parts,
+			token_part_new(TOKEN_PART_TEXT, prefix, end - prefix));
+	g_ptr_array_add(name->parts, g_ptr_array_index(parts, i));
+	g_ptr_array_add(name->parts,
+			token_part_new(TOKEN_PART_TEXT, next->text,
+				       suffix - next->text));
+	g_ptr_array_index(parts, i) = name;
+
+	*prefix = '\0';
+	text = g_strdup(suffix);
+	g_free(next->text);
+	next->text = text;
+    }
+
+    for(i=parts->len - 1;i>=0;i--)
+	if(query_token_part_is_text(g_ptr_array_index(parts, i), ""))
+	    g_ptr_array_remove_index(parts, i);
+}
+
+/** Split the alternatives of a bracket that's nothing but
+    plain text with a '|', so that filling it in only has to
+    pick one. */
+static void
+token_bracket_get_choices(TokenPart *bracket)
+{
+    const TokenPart *part;
+    gchar **choices;
+    gint i;
+
+    if(bracket->parts->len != 1)
+	return;
+
+    part = g_ptr_array_index(bracket->parts, 0);
+    if(part->type != TOKEN_PART_TEXT || strchr(part->text, '|') == NULL)
+	return;
+
+    bracket->choices = g_ptr_array_new_with_free_func(g_free);
+    choices = g_strsplit(part->text, "|", -1);
+    for(i=0;choices[i]!=NULL;i++)
+	g_ptr_array_add(bracket->choices, choices[i]);
+    g_free(choices);
+}
+
+/** Split a commentary or news text into its parts so that
+    filling it in doesn't have to search for tokens and brackets.
+    @see token_text_fill() */
+TokenText*
+token_text_compile(const gchar *text)
+{
+#ifdef DEBUG
+    printf("token_text_compile\n");
+#endif
+
+    gint i;
+    TokenText *compiled = g_malloc(sizeof(TokenText));
+
+    compiled->parts = token_text_split(text);
+    compiled->brackets = g_ptr_array_new_with_free_func(token_part_free);
+
+    token_text_get_brackets(compiled->parts, compiled->brackets, text);
+
+    token_parts_get_names(compiled->parts);
+    for(i=0;i<compiled->brackets->len;i++)
+    {
+	token_parts_get_names(
+	    ((TokenPart*)g_ptr_array_index(compiled->brackets, i))->parts);
+	token_bracket_get_choices(g_ptr_array_index(compiled->brackets, i));
+    }
+
+    return compiled;
+}
+
+void
+token_text_free(TokenText *text)
+{
+#ifdef DEBUG
+    printf("token_text_free\n");
+#endif
+
+    if(text == NULL)
+	return;
+
+    g_ptr_array_free(text->parts, TRUE);
+    g_ptr_array_free(text->brackets, TRUE);
+    g_free(text);
+}
+
+/** Append a string to a buffer of size SMALL, cutting it off
+    if it doesn't fit. */
+static void
+token_append(gchar *dest, gsize *len, const gchar *string)
+{
+    gsize add = MIN(strlen(string), SMALL - 1 - *len);
+
+    memcpy(dest + *len, string, add);
+    *len += add;
+    dest[*len] = '\0';
+}
+
+/** Find the value of the token a name part stands for.
+    @param name The buffer of size SMALL the name gets written to.
+    @return The value or NULL if there's no such token or it's not set. */
+static const TokenValue*
+token_name_get_value(const TokenPart *part, const TokenValue *token_rep,
+		     gchar **results, gchar *name)
+{
+    gsize len = 0;
+    gint token;
+
+    name[0] = '\0';
+    token_render(part->parts, token_rep, results, name, &len);
+    token = token_from_name(name, len);
+
+    return (token == REP_TOKEN_LAST || token_rep[token].string == NULL) ?
+	NULL : &token_rep[token];
+}
+
+static void
+token_render_name(const TokenPart *part, const TokenValue *token_rep,
+		  gchar **results, gchar *dest, gsize *len)
+{
+    gchar name[SMALL];
+    const TokenValue *value =
+	token_name_get_value(part, token_rep, results, name);
+
+    token_append(dest, len, (value == NULL) ? name : value->string);
+}
+
+/** Write the parts into the buffer; tokens that aren't set
+    stay as they are.
+    @param results The values of the brackets. */
+static void
+token_render(const GPtrArray *parts, const TokenValue *token_rep,
+	     gchar **results, gchar *dest, gsize *len)
+{
+    gint i;
+    const TokenPart *part;
+
+    for(i=0;i<parts->len;i++)
+    {
+	part = g_ptr_array_index(parts, i);
+
+	switch(part->type)
+	{
+	    default:
+		token_append(dest, len, part->text);
+		break;
+	    case TOKEN_PART_TOKEN:
+		token_append(dest, len,
+			     (token_rep[part->token].string == NULL) ?
+			     part->text : token_rep[part->token].string);
+		break;
+	    case TOKEN_PART_NAME:
+		token_render_name(part, token_rep, results, dest, len);
+		break;
+	    case TOKEN_PART_BRACKET:
+		token_append(dest, len, results[part->bracket]);
+		break;
+	}
+    }
+}
+
+/** Evaluate the contents of a bracket: pick one of the
+    alternatives separated by '|' or compute the comparison
+    or arithmetic expression. */
+static void
+token_bracket_evaluate(const gchar *contents, gchar *result, gsize size)
+{
+    gint value = -1, count = 1, choice;
+    const gchar *s, *end;
+
+    if(strchr(contents, '|') != NULL)
+    {
+	for(s=contents;*s!='\0';s++)
+	    count += (*s == '|');
+
+	choice = math_rndi(0, count - 1);
+	for(s=contents;choice>0;choice--)
+	    s = strchr(s, '|') + 1;
+
+	end = strchr(s, '|');
+	if(end == NULL)
+	    end = s + strlen(s);
+
+	g_strlcpy(result, s, MIN(size, end - s + 1));
+	return;
+    }
+
+    if(strchr(contents, '<') != NULL || strchr(contents, '>') != NULL ||
+       strchr(contents, '=') != NULL || strstr(contents, " G ") != NULL ||
+       strstr(contents, " L ") != NULL || strstr(contents, " GE ") != NULL ||
+       strstr(contents, " LE ") != NULL)
+	misc_parse(contents, &value);
+    else
+	misc_parse_expression(contents, &value);
+
+    g_snprintf(result, size, "%d", value);
+}
+
+/** Evaluate the brackets of a text in order.
+    @param results The results, pointing into the buffer
+    of size SMALL. */
+static void
+token_text_evaluate_brackets(const TokenText *text, const TokenValue *token_rep,
+			     gchar **results, gchar *buf)
+{
+    gint i;
+    gsize len, offset = 0;
+    gchar contents[SMALL];
+    const TokenPart *bracket;
+
+    for(i=0;i<text->brackets->len;i++)
+    {
+	bracket = g_ptr_array_index(text->brackets, i);
+	offset = MIN(offset, SMALL - 1);
+	results[i] = buf + offset;
+
+	if(bracket->choices != NULL)
+	    g_strlcpy(results[i],
+		      g_ptr_array_index(bracket->choices,
+					math_rndi(0, bracket->choices->len - 1)),
+		      SMALL - offset);
+	else
+	{
+	    len = 0;
+	    contents[0] = '\0';
+	    token_render(bracket->parts, token_rep, results, contents, &len);
+	    token_bracket_evaluate(contents, results[i], SMALL - offset);
+	}
+
+	offset += strlen(results[i]) + 1;
+    }
+}
+
+/** Fill in the tokens and brackets of a compiled text.
+    @param dest The buffer of size SMALL for the result.
+    @return TRUE if all tokens could be replaced. */
+gboolean
+token_text_fill(const TokenText *text, const TokenValue *token_rep, gchar *dest)
+{
+#ifdef DEBUG
+    printf("token_text_fill\n");
+#endif
+
+    gchar buf[SMALL];
+    gchar *results[text->brackets->len + 1];
+    gsize len = 0;
+
+    token_text_evaluate_brackets(text, token_rep, results, buf);
+
+    dest[0] = '\0';
+    token_render(text->parts, token_rep, results, dest, &len);
+
+    return (strchr(dest, '_') == NULL);
+}
+
+static void
+token_cond_free(TokenCond *cond)
+{
+    if(cond == NULL)
+	return;
+
+    token_cond_free(cond->left);
+    token_cond_free(cond->right);
+    g_free(cond);
+}
+
+/** Split the plain text parts of a condition into numbers and
+    operators; tokens, names and brackets become operands.
+    @return The lexemes ending with TOKEN_COND_END. */
+static GArray*
+token_condition_lex(const TokenText *text)
+{
+    gint i;
+    const gchar *s;
+    const TokenPart *part;
+    TokenCond lexeme;
+    GArray *lexemes = g_array_new(FALSE, FALSE, sizeof(TokenCond));
+
+    for(i=0;i<text->parts->len;i++)
+    {
+	part = g_ptr_array_index(text->parts, i);
+	memset(&lexeme, 0, sizeof(TokenCond));
+
+	if(part->type != TOKEN_PART_TEXT)
+	{
+	    lexeme.type = TOKEN_COND_PART;
+	    lexeme.part = part;
+	    g_array_append_val(lexemes, lexeme);
+	    continue;
+	}
+
+	for(s=part->text;*s!='\0';)
+	{
+	    memset(&lexeme, 0, sizeof(TokenCond));
+
+	    if(g_ascii_isspace(*s))
+	    {
+		s++;
+		continue;
+	    }
+
+	    if(g_ascii_isdigit(*s))
+	    {
+		lexeme.type = TOKEN_COND_INT;
+		while(g_ascii_isdigit(*s))
+		    lexeme.value = lexeme.value * 10 + (*s++ - '0');
+		g_array_append_val(lexemes, lexeme);
+		continue;
+	    }
+
+	    lexeme.type = TOKEN_COND_OTHER;
+	    switch(*s)
+	    {
+		default:
+		    break;
+		case '_':
+		    /* An underscore that's not part of a token
+		       is an unknown token. */
+		    lexeme.type = TOKEN_COND_PART;
+		    lexeme.part = part;
+		    break;
+		case '+':
+		    lexeme.type = TOKEN_COND_PLUS;
+		    break;
+		case '-':
+		    lexeme.type = TOKEN_COND_MINUS;
+		    break;
+		case '=':
+		    lexeme.type = TOKEN_COND_EQ;
+		    break;
+		case '!':
+		    if(s[1] == '=')
+		    {
+			lexeme.type = TOKEN_COND_NE;
+			s++;
+		    }
+		    break;
+		case '<':
+		case 'L':
+		    lexeme.type = TOKEN_COND_LT;
+		    if((*s == '<' && s[1] == '=') || (*s == 'L' && s[1] == 'E'))
+		    {
+			lexeme.type = TOKEN_COND_LE;
+			s++;
+		    }
+		    break;
+		case '>':
+		case 'G':
+		    lexeme.type = TOKEN_COND_GT;
+		    if((*s == '>' && s[1] == '=') || (*s == 'G' && s[1] == 'E'))
+		    {
+			lexeme.type = TOKEN_COND_GE;
+			s++;
+		    }
+		    break;
+		case '(':
+		    lexeme.type = TOKEN_COND_OPEN_PAREN;
+		    break;
+		case ')':
+		    lexeme.type = TOKEN_COND_CLOSE_PAREN;
+		    break;
+		case 'a':
+		    if(strncmp(s, "and", 3) == 0)
+		    {
+			lexeme.type = TOKEN_COND_AND;
+			s += 2;
+		    }
+		    break;
+		case 'o':
+		    if(s[1] == 'r')
+		    {
+			lexeme.type = TOKEN_COND_OR;
+			s++;
+		    }
+		    break;
+	    }
+
+	    s++;
+	    g_array_append_val(lexemes, lexeme);
+	}
+    }
+
+    memset(&lexeme, 0, sizeof(TokenCond));
+    lexeme.type = TOKEN_COND_END;
+    g_array_append_val(lexemes, lexeme);
+
+    return lexemes;
+}
+
+static TokenCond*
+token_cond_new(const TokenCond *lexeme, TokenCond *left, TokenCond *right)
+{
+    TokenCond *cond = g_malloc(sizeof(TokenCond));
+
+    *cond = *lexeme;
+    cond->left = left;
+    cond->right = right;
+
+    return cond;
+}
+
+static TokenCond*
+token_cond_parse_or(const TokenCond **lexeme);
+
+/** Skip what's left of a condition or parenthesis after parsing
+    stopped, like the old parser did. The tokens in it still
+    have to be set for the condition to be fulfilled.
+    @param top Whether we're outside of parentheses. */
+static TokenCond*
+token_cond_parse_rest(const TokenCond **lexeme, TokenCond *cond, gboolean top)
+{
+    gint depth = 0;
+    TokenCond rest = {TOKEN_COND_REST, 0, NULL, NULL, NULL};
+
+    for(;(*lexeme)->type != TOKEN_COND_END;(*lexeme)++)
+    {
+	if((*lexeme)->type == TOKEN_COND_CLOSE_PAREN)
+	{
+	    if(depth > 0)
+		depth--;
+	    else if(!top)
+		break;
+	}
+	else if((*lexeme)->type == TOKEN_COND_OPEN_PAREN)
+	    depth++;
+	else if((*lexeme)->type == TOKEN_COND_PART && depth == 0)
+	    cond = token_cond_new(&rest, cond, token_cond_new(*lexeme, NULL, NULL));
+    }
+
+    return cond;
+}
+
+/** Parse a number, a token or a condition in parentheses.
+    A missing value is 0. */
+static TokenCond*
+token_cond_parse_value(const TokenCond **lexeme)
+{
+    const TokenCond *current = *lexeme;
+    TokenCond *cond,
+	paren = {TOKEN_COND_PAREN, 0, NULL, NULL, NULL},
+	zero = {TOKEN_COND_INT, 0, NULL, NULL, NULL};
+
+    if(current->type == TOKEN_COND_INT || current->type == TOKEN_COND_PART)
+    {
+	(*lexeme)++;
+	return token_cond_new(current, NULL, NULL);
+    }
+
+    if(current->type != TOKEN_COND_OPEN_PAREN)
+	return token_cond_new(&zero, NULL, NULL);
+
+    (*lexeme)++;
+    cond = token_cond_parse_rest(lexeme, token_cond_parse_or(lexeme), FALSE);
+    if((*lexeme)->type == TOKEN_COND_CLOSE_PAREN)
+	(*lexeme)++;
+
+    return token_cond_new(&paren, cond, NULL);
+}
+
+/** Parse a sum or difference of values. */
+static TokenCond*
+token_cond_parse_expression(const TokenCond **lexeme)
+{
+    const TokenCond *op;
+    TokenCond *left = token_cond_parse_value(lexeme);
+
+    while((*lexeme)->type == TOKEN_COND_PLUS || (*lexeme)->type == TOKEN_COND_MINUS)
+    {
+	op = (*lexeme)++;
+	left = token_cond_new(op, left, token_cond_parse_value(lexeme));
+    }
+
+    return left;
+}
+
+static TokenCond*
+token_cond_parse_comparison(const TokenCond **lexeme)
+{
+    const TokenCond *op;
+    TokenCond *left = token_cond_parse_expression(lexeme);
+
+    if((*lexeme)->type < TOKEN_COND_EQ || (*lexeme)->type > TOKEN_COND_GE)
+	return left;
+
+    op = (*lexeme)++;
+
+    return token_cond_new(op, left, token_cond_parse_expression(lexeme));
+}
+
+static TokenCond*
+token_cond_parse_and(const TokenCond **lexeme)
+{
+    const TokenCond *op;
+    TokenCond *left = token_cond_parse_comparison(lexeme);
+
+    while((*lexeme)->type == TOKEN_COND_AND)
+    {
+	op = (*lexeme)++;
+	left = token_cond_new(op, left, token_cond_parse_comparison(lexeme));
+    }
+
+    return left;
+}
+
+static TokenCond*
+token_cond_parse_or(const TokenCond **lexeme)
+{
+    const TokenCond *op;
+    TokenCond *left = token_cond_parse_and(lexeme);
+
+    while((*lexeme)->type == TOKEN_COND_OR)
+    {
+	op = (*lexeme)++;
+	left = token_cond_new(op, left, token_cond_parse_and(lexeme));
+    }
+
+    return left;
+}
+
+/** Compile a commentary or news condition into a syntax tree.
+    @see token_condition_check() */
+TokenCondition*
+token_condition_compile(const gchar *condition)
+{
+#ifdef DEBUG
+    printf("token_condition_compile\n");
+#endif
+
+    GArray *lexemes;
+    const TokenCond *lexeme;
+    TokenCondition *compiled = g_malloc(sizeof(TokenCondition));
+
+    compiled->text = token_text_compile(condition);
+
+    lexemes = token_condition_lex(compiled->text);
+    lexeme = (const TokenCond*)lexemes->data;
+    compiled->root =
+	token_cond_parse_rest(&lexeme, token_cond_parse_or(&lexeme), TRUE);
+    g_array_free(lexemes, TRUE);
+
+    return compiled;
+}
+
+void
+token_condition_free(TokenCondition *condition)
+{
+#ifdef DEBUG
+    printf("token_condition_free\n");
+#endif
+
+    if(condition == NULL)
+	return;
+
+    token_text_free(condition->text);
+    token_cond_free(condition->root);
+    g_free(condition);
+}
+
+/** Return the value of a token, name or bracket operand.
+    @param missing Gets set if the token isn't set or unknown.
+    @param stop Gets set if the operand isn't a number. */
+static gint
+token_cond_get_part_value(const TokenPart *part, const TokenValue *token_rep,
+			  gchar **results, gboolean *missing, gboolean *stop)
+{
+    gint value = 0;
+    gchar name[SMALL];
+    const TokenValue *token_value;
+
+    if(part->type == TOKEN_PART_TEXT)
+    {
+	*missing = TRUE;
+	return 0;
+    }
+
+    if(part->type == TOKEN_PART_BRACKET)
+    {
+	*stop = (*misc_skip_spaces(
+		     misc_parse_expression(results[part->bracket], &value)) != '\0');
+	return value;
+    }
+
+    token_value = (part->type == TOKEN_PART_TOKEN) ?
+	&token_rep[part->token] :
+	token_name_get_value(part, token_rep, results, name);
+
+    if(token_value == NULL || token_value->string == NULL)
+    {
+	*missing = TRUE;
+	return 0;
+    }
+
+    *stop = !token_value->number;
+
+    return token_value->value;
+}
+
+/** Evaluate a node of a condition.
+    @param missing Gets set if a token isn't set.
+    @param stop Gets set if the evaluation stopped at an operand that
+    isn't a number; the operators after it get ignored. */
+static gint
+token_cond_evaluate(const TokenCond *cond, const TokenValue *token_rep,
+		    gchar **results, gboolean *missing, gboolean *stop)
+{
+    gint left, right;
+    gboolean paren_missing = FALSE, paren_stop = FALSE, right_stop = FALSE;
+
+    *stop = FALSE;
+
+    switch(cond->type)
+    {
+	default:
+	    break;
+	case TOKEN_COND_INT:
+	    return cond->value;
+	case TOKEN_COND_PART:
+	    return token_cond_get_part_value(cond->part, token_rep, results,
+					     missing, stop);
+	case TOKEN_COND_PAREN:
+	    /* A missing token only makes the parenthesis false. */
+	    left = token_cond_evaluate(cond->left, token_rep, results,
+				       &paren_missing, &paren_stop);
+	    return (!paren_missing && left != 0);
+    }
+
+    /* Both sides get evaluated so that we notice all missing tokens. */
+    left = token_cond_evaluate(cond->left, token_rep, results, missing, stop);
+    right = token_cond_evaluate(cond->right, token_rep, results, missing,
+				&right_stop);
+
+    if(*stop)
+	return left;
+
+    *stop = right_stop;
+
+    switch(cond->type)
+    {
+	default:
+	    return left;
+	case TOKEN_COND_PLUS:
+	    return left + right;
+	case TOKEN_COND_MINUS:
+	    return left - right;
+	case TOKEN_COND_EQ:
+	    return (left == right);
+	case TOKEN_COND_NE:
+	    return (left != right);
+	case TOKEN_COND_LT:
+	    return (left < right);
+	case TOKEN_COND_LE:
+	    return (left <= right);
+	case TOKEN_COND_GT:
+	    return (left > right);
+	case TOKEN_COND_GE:
+	    return (left >= right);
+	case TOKEN_COND_AND:
+	    return (left && right);
+	case TOKEN_COND_OR:
+	    return (left || right);
+    }
+}
+
+/** Check whether a compiled condition is fulfilled. Like before,
+    it isn't if one of its tokens isn't set, except for tokens in
+    parentheses which only make the parenthesis false. */
+gboolean
+token_condition_check(const TokenCondition *condition, const TokenValue *token_rep)
+{
+#ifdef DEBUG
+    printf("token_condition_check\n");
+#endif
+
+    gchar buf[SMALL];
+    gchar *results[condition->text->brackets->len + 1];
+    gboolean missing = FALSE, stop = FALSE;
+    gint value;
+
+    token_text_evaluate_brackets(condition->text, token_rep, results, buf);
+    value = token_cond_evaluate(condition->root, token_rep, results,
+				&missing, &stop);
+
+    return (!missing && value != 0);
+}
@@ -0,0 +1,65 @@
+/*
+   token.h
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef TOKEN_H
+#define TOKEN_H
+
+#include "bygfoot.h"
+#include "token_struct.h"
+
+void
+token_add(TokenValue *token_rep, gint token, gchar *replacement);
+
+void
+token_add_bool(TokenValue *token_rep, gint token, gboolean value);
+
+void
+token_remove(TokenValue *token_rep, gint token);
+
+void
+token_remove_all(TokenValue *token_rep);
+
+gint
+token_from_name(const gchar *name, gint len);
+
+TokenText*
+token_text_compile(const gchar *text);
+
+void
+token_text_free(TokenText *text);
+
+gboolean
+token_text_fill(const TokenText *text, const TokenValue *token_rep, gchar *dest);
+
+TokenCondition*
+token_condition_compile(const gchar *condition);
+
+void
+token_condition_free(TokenCondition *condition);
+
+gboolean
+token_condition_check(const TokenCondition *condition, const TokenValue *token_rep);
+
+#endif
@@ -0,0 +1,130 @@
+/*
+   token_struct.h
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef TOKEN_STRUCT_H
+#define TOKEN_STRUCT_H
+
+#include "bygfoot.h"
+#include "strategy_struct.h"
+
+/** The value of a token in the live game commentary or the news.
+    The token arrays have REP_TOKEN_LAST elements. */
+typedef struct
+{
+    /** The replacement string, NULL if the token isn't set. */
+    gchar *string;
+    /** The replacement as a number (used in conditions). */
+    gint value;
+    /** Whether the replacement is nothing but a number. Conditions
+	stop at other replacements like team names. */
+    gboolean number;
+} TokenValue;
+
+/** The parts a commentary or news text gets split into. */
+enum TokenPartType
+{
+    TOKEN_PART_TEXT = 0, /**< Plain text. */
+    TOKEN_PART_TOKEN, /**< A token like _P0_. */
+    TOKEN_PART_NAME, /**< A token name depending on other parts, like _T_POSS__. */
+    TOKEN_PART_BRACKET, /**< An expression or random choice like [a|b]. */
+    TOKEN_PART_END
+};
+
+typedef struct
+{
+    enum TokenPartType type;
+    /** The text or the token name. */
+    gchar *text;
+    /** The token, REP_TOKEN_LAST for other parts. */
+    gint token;
+    /** The index of a bracket in the evaluation order.
+	The bracket parts in the text only refer to the brackets
+	of the text. */
+    gint bracket;
+    /** The parts a name or bracket consists of. */
+    GPtrArray *parts;
+    /** The alternatives of a random choice without tokens
+	like [beat|defeat], split when compiling; NULL for
+	other brackets, which get evaluated on their contents. */
+    GPtrArray *choices;
+} TokenPart;
+
+/** A text with tokens, compiled when the commentary or
+    news file gets loaded. @see token_text_compile() */
+typedef struct
+{
+    GPtrArray *parts;
+    /** The contents of the brackets in the order they get
+	evaluated: the rightmost innermost one first. */
+    GPtrArray *brackets;
+} TokenText;
+
+/** The nodes of a compiled condition. The parentheses and
+    other characters only occur while compiling. */
+enum TokenCondType
+{
+    TOKEN_COND_INT = 0,
+    TOKEN_COND_PART, /**< A token, name or bracket. */
+    TOKEN_COND_PLUS,
+    TOKEN_COND_MINUS,
+    TOKEN_COND_EQ,
+    TOKEN_COND_NE,
+    TOKEN_COND_LT,
+    TOKEN_COND_LE,
+    TOKEN_COND_GT,
+    TOKEN_COND_GE,
+    TOKEN_COND_AND,
+    TOKEN_COND_OR,
+    TOKEN_COND_PAREN, /**< A condition in parentheses. */
+    TOKEN_COND_REST, /**< Operands the parser skipped, like after '=='. */
+    TOKEN_COND_OPEN_PAREN,
+    TOKEN_COND_CLOSE_PAREN,
+    TOKEN_COND_OTHER,
+    TOKEN_COND_END
+};
+
+typedef struct TokenCond
+{
+    enum TokenCondType type;
+    /** The value of a number. */
+    gint value;
+    /** The part of the condition text an operand stands for. */
+    const TokenPart *part;
+    /** The operands; the condition of a parenthesis is
+	the left one. */
+    struct TokenCond *left, *right;
+} TokenCond;
+
+/** A condition compiled when the commentary or news file
+    gets loaded. @see token_condition_compile() */
+typedef struct
+{
+    /** The condition split into tokens, names and brackets. */
+    TokenText *text;
+    /** The syntax tree. */
+    TokenCond *root;
+} TokenCondition;
+
+#endif
@@ -299,9 +299,9 @@ calculateCostsTrainingCamp(gint number_camp)
     gint *money = &current_user.money;
     gfloat factor = finance_wage_unit(current_user.tm);
 	
-    gint costs[3] = {factor * const_float("float_training_camp_factor1"),
-		     factor * const_float("float_training_camp_factor2"),
-		     factor * const_float("float_training_camp_factor2")};
+    gint costs[3] = {factor * const_float(float_training_camp_factor1),
+		     factor * const_float(float_training_camp_factor2),
+		     factor * const_float(float_training_camp_factor2)};
 
     money_out[MON_OUT_TRAINING_CAMP] -= costs[number_camp - 1];
     *money -= costs[number_camp - 1];
@@ -110,8 +110,8 @@ on_b_ok_clicked                        (GtkButton       *button,
 
     if(save)
     {
-	opt_user_set_int("int_opt_user_training_camp_hotel", number_camp);
-	opt_user_set_int("int_opt_user_training_camp_recreation", value_recreation);
+	opt_user_set_int(int_opt_user_training_camp_hotel, number_camp);
+	opt_user_set_int(int_opt_user_training_camp_recreation, value_recreation);
     }
 	
     window_destroy(&window.training_camp);
@@ -134,7 +134,7 @@ on_rb_camp3_clicked                    (GtkButton       *button,
     gchar buf[SMALL];
 	
     misc_print_grouped_int(
-	math_round_integer(finance_wage_unit(current_user.tm) * const_float("float_training_camp_factor3"), -2), 
+	math_round_integer(finance_wage_unit(current_user.tm) * const_float(float_training_camp_factor3), -2), 
 	buf);
     tfCosts = GTK_ENTRY(lookup_widget(window.training_camp, "tf_costs"));
     gtk_entry_set_text (tfCosts, buf);
@@ -153,7 +153,7 @@ on_rb_camp2_clicked                    (GtkButton       *button,
     gchar buf[SMALL];
 	
     misc_print_grouped_int(
-	math_round_integer(finance_wage_unit(current_user.tm) * const_float("float_training_camp_factor2"), -2), 
+	math_round_integer(finance_wage_unit(current_user.tm) * const_float(float_training_camp_factor2), -2), 
 	buf);
     tfCosts = GTK_ENTRY(lookup_widget(window.training_camp, "tf_costs"));
     gtk_entry_set_text (tfCosts, buf);
@@ -172,7 +172,7 @@ on_rb_camp1_clicked                    (GtkButton       *button,
     gchar buf[SMALL];
 	
     misc_print_grouped_int(
-	math_round_integer(finance_wage_unit(current_user.tm) * const_float("float_training_camp_factor1"), -2), 
+	math_round_integer(finance_wage_unit(current_user.tm) * const_float(float_training_camp_factor1), -2), 
 	buf);
     tfCosts = GTK_ENTRY(lookup_widget(window.training_camp, "tf_costs"));
     gtk_entry_set_text (tfCosts, buf);
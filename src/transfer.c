@@ -51,7 +51,7 @@ transfer_update(Bygfoot *bygfoot)
     gint i, j;
 
     if((week > transfer_get_deadline() ||
-       sett_int("int_opt_disable_transfers")) &&
+       sett_int(int_opt_disable_transfers)) &&
        transfer_list->len == 0)
 	return;
 
@@ -104,21 +104,21 @@ transfer_add_cpu_offers(void)
 
     gint i;
     gfloat scout_factor_bounds[4][2] =
-	{{const_float("float_transfer_offer_fee_best_lower"),
-	  const_float("float_transfer_offer_fee_best_upper")},
-	 {const_float("float_transfer_offer_fee_good_lower"),
-	  const_float("float_transfer_offer_fee_good_upper")},
-	 {-const_float("float_transfer_offer_fee_good_upper"),
-	  -const_float("float_transfer_offer_fee_good_lower")},
-	 {-const_float("float_transfer_offer_fee_best_upper"),
-	  -const_float("float_transfer_offer_fee_best_lower")}};
+	{{const_float(float_transfer_offer_fee_best_lower),
+	  const_float(float_transfer_offer_fee_best_upper)},
+	 {const_float(float_transfer_offer_fee_good_lower),
+	  const_float(float_transfer_offer_fee_good_upper)},
+	 {-const_float(float_transfer_offer_fee_good_upper),
+	  -const_float(float_transfer_offer_fee_good_lower)},
+	 {-const_float(float_transfer_offer_fee_best_upper),
+	  -const_float(float_transfer_offer_fee_best_lower)}};
 
     for(i=0;i<transfer_list->len;i++)
 	if(team_is_user(trans(i).tm) != -1 &&
 	   trans(i).offers->len == 0 &&
-	   math_rnd(0, 1) < const_float("float_transfer_offer_prob_max") -
+	   math_rnd(0, 1) < const_float(float_transfer_offer_prob_max) -
 	   (user_from_team(trans(i).tm)->scout % 10 * 
-	    const_float("float_transfer_offer_prob_reduce")))
+	    const_float(float_transfer_offer_prob_reduce)))
 	    transfer_add_offer(
 		i, transfer_team_get_new(),
 		math_round_integer(
@@ -306,18 +306,18 @@ transfer_add_new_players(void)
 #endif
 
     gint i;
-    gint number_of_new = math_rndi(const_int("int_transfer_new_players_lower"),
-				   const_int("int_transfer_new_players_upper"));
+    gint number_of_new = math_rndi(const_int(int_transfer_new_players_lower),
+				   const_int(int_transfer_new_players_upper));
     number_of_new = MIN(number_of_new,
-			const_int("int_transfer_max_players") - transfer_list->len);
+			const_int(int_transfer_max_players) - transfer_list->len);
     
     for(i=0;i<number_of_new;i++)
 	transfer_add_player(
 	    transfer_player_get_new(
-		(math_rnd(0, 1) < const_float("float_transfer_cup_percentage") &&
+		(math_rnd(0, 1) < const_float(float_transfer_cup_percentage) &&
                  country.allcups->len)),
-	    math_rndi(const_int("int_transfer_time_lower"),
-		      const_int("int_transfer_time_upper")));
+	    math_rndi(const_int(int_transfer_time_lower),
+		      const_int(int_transfer_time_upper)));
 }
 
 /** Select a random player for the transfer list. */
@@ -338,9 +338,9 @@ transfer_player_get_new(gboolean cup)
 	tm = (Team*)g_ptr_array_index(teams, math_rndi(0, teams->len - 1));
 	pl = player_of_idx_team(tm, math_rndi(0, tm->players->len - 1));
 
-	if(pl->skill > const_float("float_player_max_skill") *
-	   const_float("float_transfer_good_player_skill_bound") &&
-	   math_rnd(0, 1) > const_float("float_transfer_good_player_prob"))
+	if(pl->skill > const_float(float_player_max_skill) *
+	   const_float(float_transfer_good_player_skill_bound) &&
+	   math_rnd(0, 1) > const_float(float_transfer_good_player_prob))
 	    pl = NULL;
     }
     
@@ -368,11 +368,11 @@ transfer_add_player(Player *pl, gint time)
     for(i=0;i<4;i++)
     {
 	deviance_value = 
-	    math_rnd(-(i + 1) * const_float("float_transfer_scout_deviance_value"),
-		     (i + 1) * const_float("float_transfer_scout_deviance_value"));
+	    math_rnd(-(i + 1) * const_float(float_transfer_scout_deviance_value),
+		     (i + 1) * const_float(float_transfer_scout_deviance_value));
 	deviance_wage = 
-	    math_rnd(-(i + 1) * const_float("float_transfer_scout_deviance_wage"),
-		     (i + 1) * const_float("float_transfer_scout_deviance_wage"));
+	    math_rnd(-(i + 1) * const_float(float_transfer_scout_deviance_wage),
+		     (i + 1) * const_float(float_transfer_scout_deviance_wage));
 	new.fee[i] = math_round_integer(
 	    (gint)rint((gfloat)pl->value * (1 + deviance_value)), 3);
 	new.wage[i] = math_round_integer(
@@ -408,7 +408,7 @@ transfer_get_deadline(void)
         }
 
     return (length > 0) ? 
-	(gint)rint((gfloat)length * const_float("float_transfer_deadline_percentage")) :
+	(gint)rint((gfloat)length * const_float(float_transfer_deadline_percentage)) :
 	35;
 }
 
@@ -565,13 +565,13 @@ transfer_add_remove_user_player(Player *pl)
 	{
 	    transfer_add_player(
 		pl,
-		(gint)rint(((gfloat)const_int("int_transfer_time_lower") +
-			    (gfloat)const_int("int_transfer_time_upper")) / 2));
+		(gint)rint(((gfloat)const_int(int_transfer_time_lower) +
+			    (gfloat)const_int(int_transfer_time_upper)) / 2));
 	    game_gui_print_message(
 		_("%s has been added to the transfer list for %d weeks."),
 		pl->name, 
-		(gint)rint(((gfloat)const_int("int_transfer_time_lower") +
-			    (gfloat)const_int("int_transfer_time_upper")) / 2));
+		(gint)rint(((gfloat)const_int(int_transfer_time_lower) +
+			    (gfloat)const_int(int_transfer_time_upper)) / 2));
 	}
 	else
 	{
@@ -643,11 +643,11 @@ transfer_new_star_balks(const Transfer *tr, const TransferOffer *troff)
 
     /* Weak players never balk. */
     if(player_of_id_team(tr->tm, tr->id)->skill < 
-       const_float("float_transfer_star_skill_limit"))
+       const_float(float_transfer_star_skill_limit))
 	return FALSE;
 
     /* There is some chance that the new star doesn't balk at all. */
-    if(math_rnd(0, 1) < const_float("float_transfer_star_no_balk"))
+    if(math_rnd(0, 1) < const_float(float_transfer_star_no_balk))
 	return FALSE;
 
     /* Find out if there are any stars at all on the team. */
@@ -655,12 +655,12 @@ transfer_new_star_balks(const Transfer *tr, const TransferOffer *troff)
     for(i = 0; i < troff->tm->players->len; i++)
     {
 	if(g_array_index(troff->tm->players, Player, i).skill > 
-	   const_float("float_transfer_star_skill_limit"))
+	   const_float(float_transfer_star_skill_limit))
 	    number_of_stars++;
     }
     
     if(number_of_stars == 0)
 	return FALSE;
 
-    return (math_rnd(0, 1) > 1 - number_of_stars * const_float("float_transfer_star_prob_decrease"));
+    return (math_rnd(0, 1) > 1 - number_of_stars * const_float(float_transfer_star_prob_decrease));
 }
@@ -261,7 +261,7 @@ treeview_create_player_list(GPtrArray *players, gint *attributes, gint max,
 	if(show_separator && i == 11)
 	{
 	    gtk_list_store_set(ls, &iter, 0, 
-			       const_int("int_treeview_helper_int_empty"), -1);
+			       const_int(int_treeview_helper_int_empty), -1);
 
 	    for(j=0;j<max + status;j++)
 		gtk_list_store_set(ls, &iter, j + 1, NULL, -1);
@@ -528,16 +528,16 @@ treeview_live_game_show_commentary(const LiveGameUnit *unit)
     GtkTreePath *path;
     gchar buf[SMALL], buf2[SMALL];
 
-    sprintf(buf, "%3d.", live_game_unit_get_minute(unit));
+    sprintf(buf, "%3d.", live_game_unit_get_minute((LiveGame*)statp, unit));
     if(unit->possession == 1)
 	sprintf(buf2, "<span background='%s' foreground='%s'>%s</span>",
-		const_app("string_treeview_live_game_commentary_away_bg"),
-		const_app("string_treeview_live_game_commentary_away_fg"),
+		const_app(string_treeview_live_game_commentary_away_bg),
+		const_app(string_treeview_live_game_commentary_away_fg),
 		unit->event.commentary);
     else
 	sprintf(buf2, "<span background='%s' foreground='%s'>%s</span>",
-		const_app("string_treeview_helper_color_default_background"),
-		const_app("string_treeview_helper_color_default_foreground"),
+		const_app(string_treeview_helper_color_default_background),
+		const_app(string_treeview_helper_color_default_foreground),
 		unit->event.commentary);
     
     gtk_list_store_prepend(ls, &iter);
@@ -888,13 +888,13 @@ treeview_create_game_stats(LiveGame *live_game)
 	    strcpy(buf[1], "   </span>");
 	    if(k == LIVE_GAME_STAT_ARRAY_INJURED)
 		sprintf(buf[0], "<span background='%s'>   ", 
-			const_app("string_treeview_helper_color_player_injury"));
+			const_app(string_treeview_helper_color_player_injury));
 	    else if(k == LIVE_GAME_STAT_ARRAY_REDS)
 		sprintf(buf[0], "<span background='%s'>   ", 
-			const_app("string_treeview_helper_color_player_banned"));
+			const_app(string_treeview_helper_color_player_banned));
 	    else if(k == LIVE_GAME_STAT_ARRAY_YELLOWS)
 		sprintf(buf[0], "<span background='%s'>   ", 
-			const_app("string_treeview_helper_color_player_yellow_danger"));
+			const_app(string_treeview_helper_color_player_yellow_danger));
 	}
 
 	for(i=0;i<MAX(stats->players[0][k]->len,
@@ -925,13 +925,13 @@ treeview_create_game_stats(LiveGame *live_game)
 	gtk_list_store_append(ls, &iter);
 	if(live_game->stadium_event == LIVE_GAME_EVENT_STADIUM_BREAKDOWN)
 	    sprintf(buf[0], _("<span background='%s'>There were technical problems\nin the stadium.</span>"),
-		    const_app("string_treeview_stadium_event_bg"));
+		    const_app(string_treeview_stadium_event_bg));
 	else if(live_game->stadium_event == LIVE_GAME_EVENT_STADIUM_RIOTS)
 	    sprintf(buf[0], _("<span background='%s'>There were riots\nin the stadium.</span>"),
-		    const_app("string_treeview_stadium_event_bg"));
+		    const_app(string_treeview_stadium_event_bg));
 	else
 	    sprintf(buf[0], _("<span background='%s'>There was a fire\nin the stadium.</span>"),
-		    const_app("string_treeview_stadium_event_bg"));
+		    const_app(string_treeview_stadium_event_bg));
 
 	gtk_list_store_set(ls, &iter, 0, buf[0], 1, "", 2, "", -1);
     }
@@ -1047,12 +1047,12 @@ treeview_create_fixtures_header(const Fixture *fix, GtkListStore *ls, gboolean b
     }
     
     sprintf(buf, "<span background='%s' foreground='%s'>%s%s</span>", 
-	    const_app("string_treeview_fixture_header_bg"),
-	    const_app("string_treeview_fixture_header_fg"),
+	    const_app(string_treeview_fixture_header_bg),
+	    const_app(string_treeview_fixture_header_fg),
 	    name, round_name);
     sprintf(buf2, "<span background='%s' foreground='%s'>%s</span>",
-	    const_app("string_treeview_fixture_header_bg"),
-	    const_app("string_treeview_fixture_header_fg"), buf3);
+	    const_app(string_treeview_fixture_header_bg),
+	    const_app(string_treeview_fixture_header_fg), buf3);
 
     gtk_list_store_append(ls, &iter);
     treeview_helper_insert_icon((GtkTreeModel*)ls, &iter, 0, symbol);
@@ -1089,8 +1089,8 @@ treeview_create_fixture(const Fixture *fix, GtkListStore *ls)
 					 &colour_bg, &colour_fg);
     else
     {
-	colour_fg = const_app("string_treeview_helper_color_default_foreground");
-	colour_bg = const_app("string_treeview_helper_color_default_background");
+	colour_fg = const_app(string_treeview_helper_color_default_foreground);
+	colour_bg = const_app(string_treeview_helper_color_default_background);
     }
 
     fixture_result_to_buf(fix, buf_result, FALSE);
@@ -1181,7 +1181,7 @@ treeview_set_up_fixtures(GtkTreeView *treeview)
     gtk_tree_view_append_column(treeview, col);
     renderer = gtk_cell_renderer_pixbuf_new();
     g_object_set(renderer, "cell-background", 
-		 const_app("string_treeview_symbol_bg"), NULL);
+		 const_app(string_treeview_symbol_bg), NULL);
     gtk_tree_view_column_pack_start(col, renderer, TRUE);
     gtk_tree_view_column_add_attribute(col, renderer,
 				       "pixbuf", 0);
@@ -1203,7 +1203,7 @@ treeview_set_up_fixtures(GtkTreeView *treeview)
     gtk_tree_view_append_column(treeview, col);
     renderer = gtk_cell_renderer_pixbuf_new();
     g_object_set(renderer, "cell-background", 
-		 const_app("string_treeview_symbol_bg"), NULL);
+		 const_app(string_treeview_symbol_bg), NULL);
     gtk_tree_view_column_pack_start(col, renderer, FALSE);
     gtk_tree_view_column_add_attribute(col, renderer,
 				       "pixbuf", 4);
@@ -1300,13 +1300,13 @@ treeview_create_single_table(GtkListStore *ls, const Table *table, gint table_in
 	
 	if(elem->old_rank > i)
 	    treeview_helper_insert_icon((GtkTreeModel*)ls, &iter, 2, 
-					const_app("string_treeview_table_up_icon"));
+					const_app(string_treeview_table_up_icon));
 	else if(elem->old_rank < i)
 	    treeview_helper_insert_icon((GtkTreeModel*)ls, &iter, 2, 
-					const_app("string_treeview_table_down_icon"));
+					const_app(string_treeview_table_down_icon));
 	else
 	    treeview_helper_insert_icon((GtkTreeModel*)ls, &iter, 2, 
-					const_app("string_treeview_table_stay_icon"));
+					const_app(string_treeview_table_stay_icon));
 
 	treeview_helper_get_table_element_colours(table, table_index, i, 
 						  &colour_fg, &colour_bg, FALSE);
@@ -1420,7 +1420,7 @@ treeview_set_up_table(GtkTreeView *treeview)
     gtk_tree_view_append_column(treeview, col);
     renderer = gtk_cell_renderer_pixbuf_new();
     g_object_set(renderer, "cell-background", 
-		 const_app("string_treeview_symbol_bg"), NULL);
+		 const_app(string_treeview_symbol_bg), NULL);
     gtk_tree_view_column_pack_start(col, renderer, TRUE);
     gtk_tree_view_column_add_attribute(col, renderer,
 				       "pixbuf", 0);
@@ -1520,7 +1520,7 @@ treeview_expense_to_string(gint expense, gchar *buf)
     gchar expense_buf[GROUPED_INT_SIZE];
     misc_print_grouped_int(expense, expense_buf);
     sprintf(buf, "<span foreground='%s'>-%s</span>",
-                 const_app("string_treeview_finances_expenses_fg"), expense_buf);
+                 const_app(string_treeview_finances_expenses_fg), expense_buf);
 }
 
 GtkTreeModel*
@@ -1590,7 +1590,7 @@ treeview_create_finances(const User *user)
 	{
 	    misc_print_grouped_int(out[i], buf3);
 	    sprintf(buf, "<span foreground='%s'>%s</span>",
-		    const_app("string_treeview_finances_expenses_fg"), buf3);
+		    const_app(string_treeview_finances_expenses_fg), buf3);
 	    gtk_list_store_append(ls, &iter);
 	    gtk_list_store_set(ls, &iter, 0, out_titles[i], 1, "", 2, buf, -1);
 	    balance += out[i];
@@ -1604,7 +1604,7 @@ treeview_create_finances(const User *user)
 	strcpy(buf2, buf);
     else
 	sprintf(buf2, "<span foreground='%s'>%s</span>",
-		const_app("string_treeview_finances_expenses_fg"), buf);
+		const_app(string_treeview_finances_expenses_fg), buf);
     gtk_list_store_set(ls, &iter, 1 + (balance < 0), buf2, -1);
 
     gtk_list_store_append(ls, &iter);
@@ -1615,7 +1615,7 @@ treeview_create_finances(const User *user)
 	misc_print_grouped_int(in[MON_IN_TRANSFERS], buf);
 	misc_print_grouped_int(out[MON_OUT_TRANSFERS], buf3);
 	sprintf(buf2, "<span foreground='%s'>%s</span>",
-		const_app("string_treeview_finances_expenses_fg"), buf3);
+		const_app(string_treeview_finances_expenses_fg), buf3);
 	gtk_list_store_append(ls, &iter);
 	gtk_list_store_set(ls, &iter, 0, _("Transfers"), 1, buf, 2, buf2, -1);
     }
@@ -1625,7 +1625,7 @@ treeview_create_finances(const User *user)
 	misc_print_grouped_int(out[MON_OUT_STADIUM_IMPROVEMENT] + out[MON_OUT_STADIUM_BILLS], 
 			       buf);
 	sprintf(buf2, "<span foreground='%s'>%s</span>",
-		const_app("string_treeview_finances_expenses_fg"), buf);
+		const_app(string_treeview_finances_expenses_fg), buf);
 	gtk_list_store_append(ls, &iter);
 	gtk_list_store_set(ls, &iter, 0, _("Stadium expenses"), 1, "", 2, buf2, -1);
     }
@@ -1633,7 +1633,7 @@ treeview_create_finances(const User *user)
     if(out[MON_OUT_TRAINING_CAMP] != 0)
     {
 		misc_print_grouped_int(out[MON_OUT_TRAINING_CAMP], buf);
-		sprintf(buf2, "<span foreground='%s'>%s</span>", const_app("string_treeview_finances_expenses_fg"), buf);
+		sprintf(buf2, "<span foreground='%s'>%s</span>", const_app(string_treeview_finances_expenses_fg), buf);
 		gtk_list_store_append(ls, &iter);
 		gtk_list_store_set(ls, &iter, 0, _("Training camp"), 1, "", 2, buf2, -1);
     }
@@ -1647,7 +1647,7 @@ treeview_create_finances(const User *user)
 	strcpy(buf2, buf);
     else
 	sprintf(buf2, "<span foreground='%s'>%s</span>",
-		const_app("string_treeview_finances_expenses_fg"), buf);
+		const_app(string_treeview_finances_expenses_fg), buf);
     gtk_list_store_set(ls, &iter, 0, _("Money"), 1, buf2, 2, "", -1);
 
     misc_print_grouped_int(finance_team_drawing_credit_loan(user->tm, FALSE), buf);
@@ -1662,7 +1662,7 @@ treeview_create_finances(const User *user)
     {
 	misc_print_grouped_int(user->debt, buf);
 	sprintf(buf2, "<span foreground='%s'>%s (%.2f%% %s)</span>",
-		const_app("string_treeview_finances_expenses_fg"), buf, 
+		const_app(string_treeview_finances_expenses_fg), buf, 
                 user->debt_interest * 100, _("interest rate"));
 	sprintf(buf, _("Debt (repay in %d weeks)"), user->counters[COUNT_USER_LOAN]);
 	gtk_list_store_append(ls, &iter);
@@ -1676,7 +1676,7 @@ treeview_create_finances(const User *user)
 
         misc_print_grouped_int(user->alr_weekly_installment, buf);
 	sprintf(buf2, "<span foreground='%s'>%s</span>",
-                const_app("string_treeview_finances_expenses_fg"), buf);
+                const_app(string_treeview_finances_expenses_fg), buf);
         sprintf(buf, _("(starting week %d)"), user->alr_start_week);
 	gtk_list_store_append(ls, &iter);
 	gtk_list_store_set(ls, &iter, 0, buf, 1, "", 2, buf2, -1);
@@ -1862,13 +1862,13 @@ treeview_create_next_opponent_values(GtkListStore *ls, const Fixture *fix)
     for(i=0;i<4;i++)
     {
 	strcpy(buf2, "");
-	for(j=0;j<(gint)rint((gfloat)const_int("int_treeview_max_pipes") *
+	for(j=0;j<(gint)rint((gfloat)const_int(int_treeview_max_pipes) *
 			     (team_values[fix->teams[0] == current_user.tm][i] / max_values[i]));j++)
 	    strcat(buf2, "|");
 
 	sprintf(buf, "%s\n<span foreground='%s'>", buf2,
-		const_app("string_treeview_opponent_value_colour_fg"));
-	for(j=0;j<(gint)rint((gfloat)const_int("int_treeview_max_pipes") *
+		const_app(string_treeview_opponent_value_colour_fg));
+	for(j=0;j<(gint)rint((gfloat)const_int(int_treeview_max_pipes) *
 			     (team_values[fix->teams[0] != current_user.tm][i] / max_values[i]));j++)
 	    strcat(buf, "|");
 	strcat(buf, "</span>");
@@ -1914,13 +1914,13 @@ treeview_create_next_opponent(void)
     if(fix->week_number == week && 
        fix->week_round_number == week_round)
 	sprintf(buf, _("<span foreground='%s' background='%s'>Week %d Round %d</span>"),
-		const_app("string_treeview_helper_color_default_foreground"),
-		const_app("string_treeview_helper_color_default_background"),
+		const_app(string_treeview_helper_color_default_foreground),
+		const_app(string_treeview_helper_color_default_background),
 		fix->week_number, fix->week_round_number);
     else
 	sprintf(buf, _("<span foreground='%s' background='%s'>Week %d Round %d</span>"),
-		const_app("string_treeview_opponent_match_later_fg"),
-		const_app("string_treeview_opponent_match_later_bg"),
+		const_app(string_treeview_opponent_match_later_fg),
+		const_app(string_treeview_opponent_match_later_bg),
 		fix->week_number, fix->week_round_number);	
 
     if(!fix->home_advantage)
@@ -1950,12 +1950,12 @@ treeview_create_next_opponent(void)
     if(team_get_average_skill(opp, TRUE) >
        team_get_average_skill(current_user.tm, TRUE))
 	sprintf(buf2, " (<span foreground='%s'>%+.1f</span>)",
-		const_app("string_treeview_opponent_skill_positive_fg"),
+		const_app(string_treeview_opponent_skill_positive_fg),
 		team_get_average_skill(opp, TRUE) -
 		team_get_average_skill(current_user.tm, TRUE));
     else
 	sprintf(buf2, " (<span foreground='%s'>%+.1f</span>)",
-		const_app("string_treeview_opponent_skill_negative_fg"),
+		const_app(string_treeview_opponent_skill_negative_fg),
 		team_get_average_skill(opp, TRUE) -
 		team_get_average_skill(current_user.tm, TRUE));
 
@@ -2064,7 +2064,7 @@ treeview_create_league_results(void)
 	{
 	    if(team_is_user(g_array_index(table_elements, TableElement, i).team) != -1)
 		sprintf(name, "<span background='%s'>%s</span>",
-			const_app("string_treeview_user_bg"),
+			const_app(string_treeview_user_bg),
 			g_array_index(table_elements, TableElement, i).team->name);
 	    else
 		strcpy(name, g_array_index(table_elements, TableElement, i).team->name);
@@ -2167,7 +2167,7 @@ treeview_create_preview(void)
     gint i;
     GtkListStore  *ls;
     GPtrArray *fixtures = fixture_get_coming(current_user.tm);
-    gint max = MIN(const_int("int_treeview_coming_matches"), fixtures->len);
+    gint max = MIN(const_int(int_treeview_coming_matches), fixtures->len);
     GtkTreeIter iter;
 
     if(fixtures->len == 0)
@@ -2333,7 +2333,7 @@ treeview_create_fixtures_week(gint week_number, gint week_round_number)
     {
 	if(((Fixture*)g_ptr_array_index(fixtures, i))->competition->id >= ID_CUP_START ||
 	   ((Fixture*)g_ptr_array_index(fixtures, i))->competition->id == current_user.tm->league->c.id ||	   
-	   opt_user_int("int_opt_user_show_all_leagues"))
+	   opt_user_int(int_opt_user_show_all_leagues))
 	{
 	    if(i == 0 ||
 	       ((Fixture*)g_ptr_array_index(fixtures, i))->competition->id != 
@@ -2487,32 +2487,32 @@ treeview_create_league_stats(GtkListStore *ls, const LeagueStat *league_stat)
     GArray *players[2] = {league_stat->player_scorers, league_stat->player_goalies};
     gchar *team_titles[2] = {_("Best offensive teams"),
 			    _("Best defensive teams")};
-    gchar *team_icons[2] = {const_app("string_treeview_league_stats_off_teams_icon"),
-			    const_app("string_treeview_league_stats_def_teams_icon")};
+    gchar *team_icons[2] = {const_app(string_treeview_league_stats_off_teams_icon),
+			    const_app(string_treeview_league_stats_def_teams_icon)};
     gchar *player_titles[2][2] = {{_("Best goal scorers"), _("Shot %")},
 				  {_("Best goalkeepers"),
 				   /* % of saves for goalies (#goals / #shots) */
 				   _("Save %")}};
-    gchar *player_icons[2] = {const_app("string_treeview_league_stats_scorers_icon"),
-			      const_app("string_treeview_league_stats_goalies_icon")};
+    gchar *player_icons[2] = {const_app(string_treeview_league_stats_scorers_icon),
+			      const_app(string_treeview_league_stats_goalies_icon)};
     gchar *colour_fg = NULL, *colour_bg = NULL;
 
     gtk_list_store_append(ls, &iter);
     treeview_helper_insert_icon((GtkTreeModel*)ls, &iter, 0, 
 				league_stat->league_symbol);
-    gtk_list_store_set(ls, &iter, 1, const_int("int_treeview_helper_int_empty"),
+    gtk_list_store_set(ls, &iter, 1, const_int(int_treeview_helper_int_empty),
 		       2, league_stat->league_name, 3, "", 4, "", 5, "", -1);
 
     for(i=0;i<2;i++)
     {
 	gtk_list_store_append(ls, &iter);
 	gtk_list_store_set(ls, &iter, 0, NULL,
-			   1, const_int("int_treeview_helper_int_empty"),
+			   1, const_int(int_treeview_helper_int_empty),
 			   2, "", 3, "", 4, "", 5, "", -1);
 	
 	gtk_list_store_append(ls, &iter);
 	treeview_helper_insert_icon((GtkTreeModel*)ls, &iter, 0, team_icons[i]);
-	gtk_list_store_set(ls, &iter, 1, const_int("int_treeview_helper_int_empty"),
+	gtk_list_store_set(ls, &iter, 1, const_int(int_treeview_helper_int_empty),
 			   2, team_titles[i], 4, _("Goals"), -1);
 	
 	for(j=0;j<teams[i]->len;j++)
@@ -2540,12 +2540,12 @@ treeview_create_league_stats(GtkListStore *ls, const LeagueStat *league_stat)
     {
 	gtk_list_store_append(ls, &iter);
 	gtk_list_store_set(ls, &iter, 0, NULL,
-			   1, const_int("int_treeview_helper_int_empty"),
+			   1, const_int(int_treeview_helper_int_empty),
 			   2, "", 3, "", 4, "", 5, "", -1);
 	
 	gtk_list_store_append(ls, &iter);
 	treeview_helper_insert_icon((GtkTreeModel*)ls, &iter, 0, player_icons[i]);
-	gtk_list_store_set(ls, &iter, 1, const_int("int_treeview_helper_int_empty"),
+	gtk_list_store_set(ls, &iter, 1, const_int(int_treeview_helper_int_empty),
 			   /* Goals. */
 			   2, player_titles[i][0], 3, _("Go"),
 			   /* Goals per game. */
@@ -2659,20 +2659,20 @@ treeview_create_season_history_champions(GtkListStore *ls, const GArray* league_
     const GArray *champs[2] = {league_champs, cup_champs};
     gchar *titles[2] = {_("League champions"),
 			_("Cup champions")};
-    gchar *icons[2] = {const_app("string_treeview_season_hist_league_champions_icon"),
-		       const_app("string_treeview_season_hist_cup_champions_icon")};
+    gchar *icons[2] = {const_app(string_treeview_season_hist_league_champions_icon),
+		       const_app(string_treeview_season_hist_cup_champions_icon)};
     
     for(i=0;i<2;i++)
     {
 	gtk_list_store_append(ls, &iter);
 	treeview_helper_insert_icon((GtkTreeModel*)ls, &iter, 0, icons[i]);
-	gtk_list_store_set(ls, &iter, 1, const_int("int_treeview_helper_int_empty"),
+	gtk_list_store_set(ls, &iter, 1, const_int(int_treeview_helper_int_empty),
 			   2, titles[i], 3, "", 4, "", 5, "", -1);
 
 	for(j=0;j<champs[i]->len;j++)
 	{
 	    gtk_list_store_append(ls, &iter);
-	    gtk_list_store_set(ls, &iter, 0, NULL, 1, const_int("int_treeview_helper_int_empty"),
+	    gtk_list_store_set(ls, &iter, 0, NULL, 1, const_int(int_treeview_helper_int_empty),
 			       2, g_array_index(champs[i], ChampStat, j).cl_name,
 			       3, g_array_index(champs[i], ChampStat, j).team_name,
 			       4, "", 5, "", -1);
@@ -2680,7 +2680,7 @@ treeview_create_season_history_champions(GtkListStore *ls, const GArray* league_
 
 	gtk_list_store_append(ls, &iter);
 	gtk_list_store_set(ls, &iter, 0, NULL, 
-			   1, const_int("int_treeview_helper_int_empty"),
+			   1, const_int(int_treeview_helper_int_empty),
 			   2, "", 3, "", 4, "", 5, "", -1);
     }
 }
@@ -2711,7 +2711,7 @@ treeview_show_season_history(gint page, gint idx)
     sprintf(buf, _("Season %d"), stat->season_number);
     gtk_list_store_append(model, &iter);
     gtk_list_store_set(model, &iter, 0, NULL,
-		       1, const_int("int_treeview_helper_int_empty"),
+		       1, const_int(int_treeview_helper_int_empty),
 		       2, buf, -1);
 
     if(page != -1)
@@ -2842,6 +2842,7 @@ treeview_show_contributors(GtkTreeView *treeview)
 
     help_list.list = NULL;
     help_list.datalist = NULL;
+    help_list.ids = NULL;
     file_load_opt_file(help_file, &help_list, FALSE);
 
     gtk_tree_selection_set_mode(gtk_tree_view_get_selection(treeview),
@@ -2864,7 +2865,7 @@ treeview_show_contributors(GtkTreeView *treeview)
 			    "string_contrib_title"))
 	{
 	    sprintf(buf, "\n<span %s>%s</span>", 
-		    const_app("string_help_window_title_attribute"),
+		    const_app(string_help_window_title_attribute),
 		    g_array_index(help_list.list, Option, i).string_value);
 	    gtk_list_store_set(ls, &iter, 0, buf, -1);
 	}
@@ -2945,9 +2946,9 @@ treeview_create_language_list(void)
     GtkListStore *ls = gtk_list_store_new(2, GDK_TYPE_PIXBUF, G_TYPE_STRING);
     GtkTreeIter iter;
     GPtrArray *names = 
-	misc_separate_strings(const_str("string_language_names"));
+	misc_separate_strings(const_str(string_language_names));
     GPtrArray *symbols = 
-	misc_separate_strings(const_str("string_language_symbols"));
+	misc_separate_strings(const_str(string_language_symbols));
 
     gtk_list_store_append(ls, &iter);
     /* Language is system-set (not user chosen). */
@@ -3042,7 +3043,7 @@ treeview_show_training_hotels_combo(void)
     g_object_unref(model);
 
     gtk_combo_box_set_active(GTK_COMBO_BOX(combo_hotel), 
-			     opt_user_int("int_opt_user_training_camp_hotel") - 1);
+			     opt_user_int(int_opt_user_training_camp_hotel) - 1);
 }
 
 GtkTreeModel*
@@ -72,7 +72,7 @@ treeview2_create_mmatches(GtkListStore *ls)
     }
 
     gtk_list_store_append(ls, &iter);
-    gtk_list_store_set(ls, &iter, 0, const_int("int_treeview_helper_int_empty"),
+    gtk_list_store_set(ls, &iter, 0, const_int(int_treeview_helper_int_empty),
 		       1, NULL, -1);
 }
 
@@ -308,9 +308,9 @@ treeview2_create_bets(GtkListStore *ls)
 	    fix = fixture_from_id(g_array_index(bets[k], BetMatch, i).fix_id, TRUE);
 	    if(fix->competition->id == current_user.tm->league->c.id ||
 	       (fix->competition->id >= ID_CUP_START &&
-		opt_user_int("int_opt_user_bet_show_cups")) ||
+		opt_user_int(int_opt_user_bet_show_cups)) ||
 	       (fix->competition->id < ID_CUP_START &&
-		opt_user_int("int_opt_user_bet_show_all_leagues")))
+		opt_user_int(int_opt_user_bet_show_all_leagues)))
 	    {
 		bet = &g_array_index(bets[k], BetMatch, i);
 		bet_user = bet_is_user(bet);
@@ -318,7 +318,7 @@ treeview2_create_bets(GtkListStore *ls)
 
 		if(k == 1 || (k == 0 && 
 		   (bet_user != NULL ||
-		    !opt_user_int("int_opt_user_bet_show_my_recent"))))
+		    !opt_user_int(int_opt_user_bet_show_my_recent))))
 		{
 		    if(i == 0 || fix->competition->id != 
 		       fixture_from_id(
@@ -345,7 +345,7 @@ treeview2_create_bets(GtkListStore *ls)
 			    strcpy(buf, buf2);
 			else
 			    sprintf(buf, "<span foreground='%s'>%s</span>",
-				    const_app("string_treeview_finances_expenses_fg"), buf2);
+				    const_app(string_treeview_finances_expenses_fg), buf2);
 		    }
 
 		    for(j=0;j<2;j++)
@@ -596,7 +596,7 @@ treeview2_create_news(GtkListStore *ls)
     {
 	gtk_list_store_append(ls, &iter);
 	sprintf(buf, "\n<span %s>%s</span>", 
-		const_app("string_news_window_title_attribute"),
+		const_app(string_news_window_title_attribute),
 		_("No news available."));
 	gtk_list_store_set(ls, &iter, 0, buf, 1, NULL, -1);
 	return;
@@ -609,7 +609,7 @@ treeview2_create_news(GtkListStore *ls)
                           g_array_index(newspaper.articles, NewsPaperArticle, i).competition->id !=
                           g_array_index(newspaper.articles, NewsPaperArticle, i + 1).competition->id));
 
-        if(!opt_int("int_opt_news_show_recent") ||
+        if(!opt_int(int_opt_news_show_recent) ||
            g_array_index(newspaper.articles, NewsPaperArticle, i).week_number == week - 1)
         {
             if(i == newspaper.articles->len - 1 ||
@@ -627,7 +627,7 @@ treeview2_create_news(GtkListStore *ls)
                         g_array_index(newspaper.articles, NewsPaperArticle, i).week_number,
                         g_array_index(newspaper.articles, NewsPaperArticle, i).week_round_number);
                 sprintf(buf, "<span %s>%s</span>\n\n",
-                        const_app("string_news_window_week_number_attribute"),
+                        const_app(string_news_window_week_number_attribute),
                         buf2);
 
                 second_column = TRUE;
@@ -32,6 +32,7 @@
 #include "job.h"
 #include "league.h"
 #include "misc.h"
+#include "name.h"
 #include "option.h"
 #include "player.h"
 #include "support.h"
@@ -204,8 +205,8 @@ treeview_helper_cell_renderer_text_new(void)
 {
     GtkCellRenderer *renderer = gtk_cell_renderer_text_new();
 
-    if(strlen(opt_str("string_opt_font_name")) > 0)
-	g_object_set(renderer, "font", opt_str("string_opt_font_name"), NULL);
+    if(strlen(opt_str(string_opt_font_name)) > 0)
+	g_object_set(renderer, "font", opt_str(string_opt_font_name), NULL);
     
     return renderer;
 }
@@ -230,66 +231,66 @@ treeview_helper_live_game_icon(gint event_type)
        event_type == LIVE_GAME_EVENT_HALF_TIME ||
        event_type == LIVE_GAME_EVENT_EXTRA_TIME ||
        event_type == LIVE_GAME_EVENT_PENALTIES)
-	return const_app("string_live_game_event_start_match_icon");
+	return const_app(string_live_game_event_start_match_icon);
     else if(event_type == LIVE_GAME_EVENT_LOST_POSSESSION)
-	return const_app("string_live_game_event_lost_possession_icon");
+	return const_app(string_live_game_event_lost_possession_icon);
     else if(event_type == LIVE_GAME_EVENT_PENALTY)
-	return const_app("string_live_game_event_penalty_icon");
+	return const_app(string_live_game_event_penalty_icon);
     else if(event_type == LIVE_GAME_EVENT_SCORING_CHANCE ||
 	    event_type == LIVE_GAME_EVENT_FREE_KICK)
-	return const_app("string_live_game_event_scoring_chance_icon");
+	return const_app(string_live_game_event_scoring_chance_icon);
     else if(event_type == LIVE_GAME_EVENT_HEADER)
-	return const_app("string_live_game_event_header_icon");
+	return const_app(string_live_game_event_header_icon);
     else if(event_type == LIVE_GAME_EVENT_GOAL)
-	return const_app("string_live_game_event_goal_icon");
+	return const_app(string_live_game_event_goal_icon);
     else if(event_type == LIVE_GAME_EVENT_OWN_GOAL)
-	return const_app("string_live_game_event_own_goal_icon");
+	return const_app(string_live_game_event_own_goal_icon);
     else if(event_type == LIVE_GAME_EVENT_POST)
-	return const_app("string_live_game_event_post_icon");
+	return const_app(string_live_game_event_post_icon);
     else if(event_type == LIVE_GAME_EVENT_CROSS_BAR)
-	return const_app("string_live_game_event_cross_bar_icon");
+	return const_app(string_live_game_event_cross_bar_icon);
     else if(event_type == LIVE_GAME_EVENT_SAVE)
-	return const_app("string_live_game_event_save_icon");
+	return const_app(string_live_game_event_save_icon);
     else if(event_type == LIVE_GAME_EVENT_MISS)
-	return const_app("string_live_game_event_miss_icon");
+	return const_app(string_live_game_event_miss_icon);
     else if(event_type == LIVE_GAME_EVENT_FOUL)
-	return const_app("string_live_game_event_foul_icon");
+	return const_app(string_live_game_event_foul_icon);
     else if(event_type == LIVE_GAME_EVENT_FOUL_YELLOW)
-	return const_app("string_live_game_event_foul_yellow_icon");
+	return const_app(string_live_game_event_foul_yellow_icon);
     else if(event_type == LIVE_GAME_EVENT_SEND_OFF ||
 	    event_type == LIVE_GAME_EVENT_FOUL_RED ||
 	    event_type == LIVE_GAME_EVENT_FOUL_RED_INJURY)
-	return const_app("string_live_game_event_send_off_icon");
+	return const_app(string_live_game_event_send_off_icon);
     else if(event_type == LIVE_GAME_EVENT_INJURY)
-	return const_app("string_live_game_event_injury_icon");
+	return const_app(string_live_game_event_injury_icon);
     else if(event_type == LIVE_GAME_EVENT_TEMP_INJURY)
-	return const_app("string_live_game_event_temp_injury_icon");
+	return const_app(string_live_game_event_temp_injury_icon);
     else if(event_type == LIVE_GAME_EVENT_STADIUM_BREAKDOWN)
-	return const_app("string_live_game_event_stadium_breakdown_icon");
+	return const_app(string_live_game_event_stadium_breakdown_icon);
     else if(event_type == LIVE_GAME_EVENT_STADIUM_FIRE)
-	return const_app("string_live_game_event_stadium_fire_icon");
+	return const_app(string_live_game_event_stadium_fire_icon);
     else if(event_type == LIVE_GAME_EVENT_STADIUM_RIOTS)
-	return const_app("string_live_game_event_stadium_riots_icon");
+	return const_app(string_live_game_event_stadium_riots_icon);
     else if(event_type == LIVE_GAME_EVENT_SUBSTITUTION)
-	return const_app("string_live_game_event_substitution_icon");
+	return const_app(string_live_game_event_substitution_icon);
     else if(event_type == LIVE_GAME_EVENT_STRUCTURE_CHANGE)
-	return const_app("string_live_game_event_structure_change_icon");
+	return const_app(string_live_game_event_structure_change_icon);
     else if(event_type == LIVE_GAME_EVENT_STYLE_CHANGE_ALL_OUT_DEFEND)
-	return const_app("string_game_gui_style_all_out_defend_icon");
+	return const_app(string_game_gui_style_all_out_defend_icon);
     else if(event_type == LIVE_GAME_EVENT_STYLE_CHANGE_DEFEND)
-	return const_app("string_game_gui_style_defend_icon");
+	return const_app(string_game_gui_style_defend_icon);
     else if(event_type == LIVE_GAME_EVENT_STYLE_CHANGE_BALANCED)
-	return const_app("string_game_gui_style_balanced_icon");
+	return const_app(string_game_gui_style_balanced_icon);
     else if(event_type == LIVE_GAME_EVENT_STYLE_CHANGE_ATTACK)
-	return const_app("string_game_gui_style_attack_icon");
+	return const_app(string_game_gui_style_attack_icon);
     else if(event_type == LIVE_GAME_EVENT_STYLE_CHANGE_ALL_OUT_ATTACK)
-	return const_app("string_game_gui_style_all_out_attack_icon");
+	return const_app(string_game_gui_style_all_out_attack_icon);
     else if(event_type == LIVE_GAME_EVENT_BOOST_CHANGE_ANTI)
-	return const_app("string_game_gui_boost_anti_icon");
+	return const_app(string_game_gui_boost_anti_icon);
     else if(event_type == LIVE_GAME_EVENT_BOOST_CHANGE_OFF)
-	return const_app("string_game_gui_boost_off_icon");
+	return const_app(string_game_gui_boost_off_icon);
     else if(event_type == LIVE_GAME_EVENT_BOOST_CHANGE_ON)
-	return const_app("string_game_gui_boost_on_icon");
+	return const_app(string_game_gui_boost_on_icon);
     else
 	return "";
 }
@@ -313,27 +314,27 @@ treeview_helper_get_user_history_icon(gint history_type)
         debug_print_message("treeview_helper_get_user_history_icon: unknown type %d.\n", history_type);
         return NULL;
     case USER_HISTORY_START_GAME:
-        return const_app("string_treeview_helper_user_history_symbol_start_game_icon");
+        return const_app(string_treeview_helper_user_history_symbol_start_game_icon);
     case USER_HISTORY_FIRE_FINANCE:
-        return const_app("string_treeview_helper_user_history_symbol_fire_finances_icon");
+        return const_app(string_treeview_helper_user_history_symbol_fire_finances_icon);
     case  USER_HISTORY_FIRE_FAILURE:
-        return const_app("string_treeview_helper_user_history_symbol_fire_failure_icon");
+        return const_app(string_treeview_helper_user_history_symbol_fire_failure_icon);
     case  USER_HISTORY_JOB_OFFER_ACCEPTED:
-        return const_app("string_treeview_helper_user_history_symbol_job_offer_accepted_icon");
+        return const_app(string_treeview_helper_user_history_symbol_job_offer_accepted_icon);
     case  USER_HISTORY_END_SEASON:
-        return const_app("string_treeview_helper_user_history_symbol_end_season_icon");
+        return const_app(string_treeview_helper_user_history_symbol_end_season_icon);
     case  USER_HISTORY_WIN_FINAL:
-        return const_app("string_treeview_helper_user_history_symbol_win_final_icon");
+        return const_app(string_treeview_helper_user_history_symbol_win_final_icon);
     case  USER_HISTORY_LOSE_FINAL:
-        return const_app("string_treeview_helper_user_history_symbol_lose_final_icon");
+        return const_app(string_treeview_helper_user_history_symbol_lose_final_icon);
     case  USER_HISTORY_PROMOTED:
-        return const_app("string_treeview_helper_user_history_symbol_promoted_icon");
+        return const_app(string_treeview_helper_user_history_symbol_promoted_icon);
     case  USER_HISTORY_RELEGATED:
-        return const_app("string_treeview_helper_user_history_symbol_relegated_icon");
+        return const_app(string_treeview_helper_user_history_symbol_relegated_icon);
     case USER_HISTORY_REACH_CUP_ROUND:
-        return const_app("string_treeview_helper_user_history_symbol_reach_cup_round_icon");
+        return const_app(string_treeview_helper_user_history_symbol_reach_cup_round_icon);
     case USER_HISTORY_CHAMPION:
-        return const_app("string_treeview_helper_user_history_symbol_champion_icon");
+        return const_app(string_treeview_helper_user_history_symbol_champion_icon);
     }
 
     return NULL;
@@ -648,25 +649,25 @@ treeview_helper_get_table_element_colours(const Table *table, gint table_index,
     const League *league = NULL;
     GPtrArray *cup_advance = NULL;
     
-    *colour_fg = const_app("string_treeview_helper_color_default_foreground");
-    *colour_bg = const_app("string_treeview_helper_color_default_background");
+    *colour_fg = const_app(string_treeview_helper_color_default_foreground);
+    *colour_bg = const_app(string_treeview_helper_color_default_background);
     
     if(user && elem->team == current_user.tm)
     {
-	*colour_fg = const_app("string_treeview_current_user_fg");
-	*colour_bg = const_app("string_treeview_current_user_bg");
+	*colour_fg = const_app(string_treeview_current_user_fg);
+	*colour_bg = const_app(string_treeview_current_user_bg);
     }
     else if(user && team_is_user(elem->team) != -1)
     {
-	*colour_fg = const_app("string_treeview_user_fg");
-	*colour_bg = const_app("string_treeview_user_bg");
+	*colour_fg = const_app(string_treeview_user_fg);
+	*colour_bg = const_app(string_treeview_user_bg);
     }
     else if(table->competition->id < ID_CUP_START)
     {
 	league = league_from_clid(table->competition->id);
 
 	if(idx + 1 == 1)
-	    *colour_bg = const_app("string_treeview_table_first");
+	    *colour_bg = const_app(string_treeview_table_first);
 	else
 	{	    
 	    if(!treeview_helper_get_table_element_colour_cups(league, table_index, idx, colour_bg))
@@ -677,9 +678,9 @@ treeview_helper_get_table_element_colours(const Table *table, gint table_index,
 		    if(pelem->ranks[0] <= idx + 1 && idx + 1 <= pelem->ranks[1] && pelem->from_table == table_index)
 		    {
 			if(pelem->type == PROM_REL_PROMOTION)
-			    *colour_bg = const_app("string_treeview_table_promotion");
+			    *colour_bg = const_app(string_treeview_table_promotion);
 			else if(pelem->type == PROM_REL_RELEGATION)
-			    *colour_bg = const_app("string_treeview_table_relegation");
+			    *colour_bg = const_app(string_treeview_table_relegation);
 		    }
 		}
 	    }
@@ -693,7 +694,7 @@ treeview_helper_get_table_element_colours(const Table *table, gint table_index,
 	for(i=0;i<cup_advance->len;i++)
 	    if((Team*)g_ptr_array_index(cup_advance, i) == elem->team)
 	    {
-		*colour_bg = const_app("string_treeview_table_promotion");	
+		*colour_bg = const_app(string_treeview_table_promotion);	
 		free_g_ptr_array(&cup_advance);
 		return;
 	    }
@@ -717,18 +718,18 @@ treeview_helper_set_user_colours(const gchar *team_name,
 
     if(strcmp(team_name, current_user.tm->name) == 0)
     {
-	*colour_fg = const_app("string_treeview_current_user_fg");
-	*colour_bg = const_app("string_treeview_current_user_bg");
+	*colour_fg = const_app(string_treeview_current_user_fg);
+	*colour_bg = const_app(string_treeview_current_user_bg);
     }
     else if(team_name_is_user(team_name) != -1)
     {
-	*colour_fg = const_app("string_treeview_user_fg");
-	*colour_bg = const_app("string_treeview_user_bg");
+	*colour_fg = const_app(string_treeview_user_fg);
+	*colour_bg = const_app(string_treeview_user_bg);
     }
     else
     {
-	*colour_fg = const_app("string_treeview_helper_color_default_foreground");
-	*colour_bg = const_app("string_treeview_helper_color_default_background");
+	*colour_fg = const_app(string_treeview_helper_color_default_foreground);
+	*colour_bg = const_app(string_treeview_helper_color_default_background);
     }
 }
 
@@ -814,7 +815,7 @@ treeview_helper_int_to_cell(GtkTreeViewColumn *col,
 
     gtk_tree_model_get(model, iter, column, &value, -1);
     
-    if(value == const_int("int_treeview_helper_int_empty"))
+    if(value == const_int(int_treeview_helper_int_empty))
 	strcpy(buf, "");
     else
 	sprintf(buf, "%d", value);
@@ -839,9 +840,9 @@ treeview_helper_player_ext_info_to_cell(GtkTreeViewColumn *col,
     const Player *pl;
 
     g_object_set(renderer, "text", "", "foreground",
-		 const_app("string_treeview_helper_color_default_foreground"),
+		 const_app(string_treeview_helper_color_default_foreground),
 		 "background",
-		 const_app("string_treeview_helper_color_default_background"), NULL);
+		 const_app(string_treeview_helper_color_default_background), NULL);
 
     gtk_tree_model_get(model, iter, column, &pl, -1);
 
@@ -1002,7 +1003,7 @@ treeview_helper_player_info_banned_to_cell(GtkCellRenderer *renderer, const GArr
 
     if(strlen(buf) > 0)
 	g_object_set(renderer, "background", 
-		     const_app("string_treeview_helper_color_player_banned"), NULL);
+		     const_app(string_treeview_helper_color_player_banned), NULL);
 }
 
 void
@@ -1095,7 +1096,7 @@ treeview_helper_player_info_health_to_cell(GtkCellRenderer *renderer, const Play
 	sprintf(buf, _("%s (expected recovery in %d weeks)"),
 		player_injury_to_char(pl->health), pl->recovery);
 	g_object_set(renderer, "background",
-		     const_app("string_treeview_helper_color_player_injury"), NULL);
+		     const_app(string_treeview_helper_color_player_injury), NULL);
     }
     else
 	/* Player health: ok. */
@@ -1122,9 +1123,9 @@ treeview_helper_player_to_cell(GtkTreeViewColumn *col,
     const Player *pl;
 
     g_object_set(renderer, "text", "", "foreground",
-		 const_app("string_treeview_helper_color_default_foreground"),
+		 const_app(string_treeview_helper_color_default_foreground),
 		 "background",
-		 const_app("string_treeview_helper_color_default_background"), NULL);
+		 const_app(string_treeview_helper_color_default_background), NULL);
     strcpy(buf, "");
 
     gtk_tree_model_get(model, iter, column, &pl, -1);
@@ -1152,7 +1153,7 @@ treeview_helper_player_to_cell(GtkTreeViewColumn *col,
         treeview_helper_player_cskill_to_cell(renderer, buf, pl);
         break;
     case PLAYER_LIST_ATTRIBUTE_SKILL:
-        sprintf(buf, "%.*f", opt_int("int_opt_player_precision"), pl->skill);
+        sprintf(buf, "%.*f", opt_int(int_opt_player_precision), pl->skill);
         break;
     case PLAYER_LIST_ATTRIBUTE_FITNESS:
         treeview_helper_player_fitness_to_cell(renderer, buf, pl->fitness);
@@ -1174,10 +1175,10 @@ treeview_helper_player_to_cell(GtkTreeViewColumn *col,
         treeview_helper_player_cards_to_cell(buf, pl);
         break;
     case PLAYER_LIST_ATTRIBUTE_AGE:
-        sprintf(buf, "%.*f", opt_int("int_opt_player_precision"), pl->age);
+        sprintf(buf, "%.*f", opt_int(int_opt_player_precision), pl->age);
         break;
     case PLAYER_LIST_ATTRIBUTE_ETAL:
-        sprintf(buf, "%.*f", opt_int("int_opt_player_precision"),
+        sprintf(buf, "%.*f", opt_int(int_opt_player_precision),
                 pl->etal[current_user.scout % 10]);
         break;
     case PLAYER_LIST_ATTRIBUTE_VALUE:
@@ -1214,12 +1215,12 @@ treeview_helper_player_name_to_cell(GtkCellRenderer *renderer, gchar *buf, const
 #endif
 
     const TransferOffer *off = transfer_player_has_offer(pl);
-    const gchar *colour_fg = const_app("string_treeview_helper_color_default_foreground"),
-	*colour_bg = const_app("string_treeview_helper_color_default_background");
+    const gchar *colour_fg = const_app(string_treeview_helper_color_default_foreground),
+	*colour_bg = const_app(string_treeview_helper_color_default_background);
 
     strcpy(buf, pl->name);
     if(pl->team == current_user.tm &&
-       opt_user_int("int_opt_user_penalty_shooter") == pl->id)
+       opt_user_int(int_opt_user_penalty_shooter) == pl->id)
 	/* Penalty shooter. */
 	strcat(buf, _(" (P)"));
     
@@ -1227,24 +1228,24 @@ treeview_helper_player_name_to_cell(GtkCellRenderer *renderer, gchar *buf, const
     {
 	if(pl->team == current_user.tm)
 	{
-	    colour_bg = const_app("string_treeview_helper_color_transfer_offer_user_bg");
-	    colour_fg = const_app("string_treeview_helper_color_transfer_offer_user_fg");
+	    colour_bg = const_app(string_treeview_helper_color_transfer_offer_user_bg);
+	    colour_fg = const_app(string_treeview_helper_color_transfer_offer_user_fg);
 	}
 	else if(off->tm == current_user.tm)
 	{
-	    colour_bg = const_app("string_treeview_helper_color_transfer_offer_accepted_current_bg");
-	    colour_fg = const_app("string_treeview_helper_color_transfer_offer_accepted_current_fg");
+	    colour_bg = const_app(string_treeview_helper_color_transfer_offer_accepted_current_bg);
+	    colour_fg = const_app(string_treeview_helper_color_transfer_offer_accepted_current_fg);
 	}
 	else
 	{
-	    colour_bg = const_app("string_treeview_helper_color_transfer_offer_accepted_other_bg");
-	    colour_fg = const_app("string_treeview_helper_color_transfer_offer_accepted_other_fg");
+	    colour_bg = const_app(string_treeview_helper_color_transfer_offer_accepted_other_bg);
+	    colour_fg = const_app(string_treeview_helper_color_transfer_offer_accepted_other_fg);
 	}
     }
     else if(query_transfer_current_team_offer(pl))
     {
-        colour_bg = const_app("string_treeview_helper_color_transfer_offer_bg");
-        colour_fg = const_app("string_treeview_helper_color_transfer_offer_fg");
+        colour_bg = const_app(string_treeview_helper_color_transfer_offer_bg);
+        colour_fg = const_app(string_treeview_helper_color_transfer_offer_fg);
     }
        
     g_object_set(renderer, "background", colour_bg, NULL);
@@ -1262,21 +1263,21 @@ treeview_helper_player_contract_to_cell(GtkCellRenderer *renderer, gchar *buf, g
     printf("treeview_helper_player_contract_to_cell\n");
 #endif
 
-    sprintf(buf, "%.*f", 1 + opt_int("int_opt_player_precision"),
+    sprintf(buf, "%.*f", 1 + opt_int(int_opt_player_precision),
 	    contract_time);
 
-    if(contract_time < const_float("float_treeview_helper_limit_player_contract_below3"))
+    if(contract_time < const_float(float_treeview_helper_limit_player_contract_below3))
 	g_object_set(renderer, "foreground", 
-		     const_app("string_treeview_helper_color_player_contract_below3"), NULL);
-    else if(contract_time < const_float("float_treeview_helper_limit_player_contract_below2"))
+		     const_app(string_treeview_helper_color_player_contract_below3), NULL);
+    else if(contract_time < const_float(float_treeview_helper_limit_player_contract_below2))
 	g_object_set(renderer, "foreground", 
-		     const_app("string_treeview_helper_color_player_contract_below2"), NULL);
-    else if(contract_time < const_float("float_treeview_helper_limit_player_contract_below1"))
+		     const_app(string_treeview_helper_color_player_contract_below2), NULL);
+    else if(contract_time < const_float(float_treeview_helper_limit_player_contract_below1))
 	g_object_set(renderer, "foreground", 
-		     const_app("string_treeview_helper_color_player_contract_below1"), NULL);
+		     const_app(string_treeview_helper_color_player_contract_below1), NULL);
     else
 	g_object_set(renderer, "foreground", 
-		     const_app("string_treeview_helper_color_player_contract_normal"), NULL);
+		     const_app(string_treeview_helper_color_player_contract_normal), NULL);
 }
 
 /** Render a cell of player yellow cards.
@@ -1299,7 +1300,7 @@ treeview_helper_player_cards_to_cell(gchar *buf, const Player *pl)
 	    strcpy(buf, "0");
 	else
 	{
-	    if(opt_user_int("int_opt_user_show_overall"))
+	    if(opt_user_int(int_opt_user_show_overall))
 		sprintf(buf, "%d(%d)", g_array_index(pl->stats, PlayerCompetitionStats, 0).yellow,
 			player_all_cards(pl));
 	    else
@@ -1309,11 +1310,11 @@ treeview_helper_player_cards_to_cell(gchar *buf, const Player *pl)
 	return;
     }
 
-    yellow = player_card_get(pl, fix->competition->id, PLAYER_VALUE_CARD_YELLOW);
+    yellow = player_card_get(pl, fix->competition, PLAYER_VALUE_CARD_YELLOW);
 
     if(yellow != -1)
     {
-	if(opt_user_int("int_opt_user_show_overall"))
+	if(opt_user_int(int_opt_user_show_overall))
 	    sprintf(buf, "%d(%d)", yellow,
 		    player_all_cards(pl));
 	else
@@ -1368,12 +1369,12 @@ treeview_helper_player_status_to_cell(GtkTreeViewColumn *col,
 	{
 	    sprintf(buf, _("INJ(%d)"), pl->recovery);
 	    g_object_set(renderer, "background",
-			 const_app("string_treeview_helper_color_player_injury"), NULL);
+			 const_app(string_treeview_helper_color_player_injury), NULL);
 	}
 	else
 	    symbol =
 		treeview_helper_pixbuf_from_filename(
-		    const_app("string_treeview_helper_player_status_injury"));
+		    const_app(string_treeview_helper_player_status_injury));
     }
     else if(ban > 0)
     {
@@ -1382,12 +1383,12 @@ treeview_helper_player_status_to_cell(GtkTreeViewColumn *col,
 	{
 	    sprintf(buf, _("BAN(%d)"), ban);
 	    g_object_set(renderer, "background",
-			 const_app("string_treeview_helper_color_player_banned"), NULL);
+			 const_app(string_treeview_helper_color_player_banned), NULL);
 	}
 	else
 	    symbol =
 		treeview_helper_pixbuf_from_filename(
-		    const_app("string_treeview_helper_player_status_ban"));
+		    const_app(string_treeview_helper_player_status_ban));
     }
     else
     {
@@ -1399,19 +1400,19 @@ treeview_helper_player_status_to_cell(GtkTreeViewColumn *col,
 	    if(ban == -1)
 		symbol =
 		    treeview_helper_pixbuf_from_filename(
-			const_app("string_treeview_helper_player_status_yellow_danger"));
+			const_app(string_treeview_helper_player_status_yellow_danger));
 	    else if(pl->streak == PLAYER_STREAK_HOT)
 		symbol =
 		    treeview_helper_pixbuf_from_filename(
-			const_app("string_treeview_helper_player_status_hot_streak"));
+			const_app(string_treeview_helper_player_status_hot_streak));
 	    else if(pl->streak == PLAYER_STREAK_COLD)
 		symbol =
 		    treeview_helper_pixbuf_from_filename(
-			const_app("string_treeview_helper_player_status_cold_streak"));
+			const_app(string_treeview_helper_player_status_cold_streak));
 	    else
 		symbol =
 		    treeview_helper_pixbuf_from_filename(
-			const_app("string_treeview_helper_player_status_ok"));
+			const_app(string_treeview_helper_player_status_ok));
 	}
     }    
 
@@ -1428,14 +1429,14 @@ static int
 treeview_helper_player_get_games_goals(const Player *pl, gint type)
 {
     const Fixture *fix = team_get_fixture(pl->team, FALSE);
-    gint clid = pl->team->league->c.id;
+    const Competition *competition = &pl->team->league->c;
 
     if(fix != NULL)
-	clid = fix->competition->id;
+	competition = fix->competition;
     else if (pl->stats->len == 1)
-        clid = g_array_index(pl->stats, PlayerCompetitionStats, 0).competition->id;
+        competition = g_array_index(pl->stats, PlayerCompetitionStats, 0).competition;
 
-    return player_games_goals_get(pl, clid, type);
+    return player_games_goals_get(pl, competition, type);
 }
 
 /** Render a cell of player games or goals.
@@ -1458,7 +1459,7 @@ treeview_helper_player_games_goals_to_cell(gchar *buf, const Player *pl, gint ty
 	return;
     }
 
-    if(opt_user_int("int_opt_user_show_overall"))
+    if(opt_user_int(int_opt_user_show_overall))
 	sprintf(buf, "%d(%d)", val, player_all_games_goals(pl, type));
     else
 	sprintf(buf, "%d", val);
@@ -1475,21 +1476,21 @@ treeview_helper_player_fitness_to_cell(GtkCellRenderer *renderer, gchar *buf, gf
     printf("treeview_helper_player_fitness_to_cell\n");
 #endif
 
-    sprintf(buf, "%.*f%%", opt_int("int_opt_player_precision"),
+    sprintf(buf, "%.*f%%", opt_int(int_opt_player_precision),
 	    fitness * 100);
 
-    if(fitness < const_float("float_treeview_helper_limit_player_fitness_below3"))
+    if(fitness < const_float(float_treeview_helper_limit_player_fitness_below3))
 	g_object_set(renderer, "foreground", 
-		     const_app("string_treeview_helper_color_player_fitness_below3"), NULL);
-    else if(fitness < const_float("float_treeview_helper_limit_player_fitness_below2"))
+		     const_app(string_treeview_helper_color_player_fitness_below3), NULL);
+    else if(fitness < const_float(float_treeview_helper_limit_player_fitness_below2))
 	g_object_set(renderer, "foreground", 
-		     const_app("string_treeview_helper_color_player_fitness_below2"), NULL);
-    else if(fitness < const_float("float_treeview_helper_limit_player_fitness_below2"))
+		     const_app(string_treeview_helper_color_player_fitness_below2), NULL);
+    else if(fitness < const_float(float_treeview_helper_limit_player_fitness_below2))
 	g_object_set(renderer, "foreground", 
-		     const_app("string_treeview_helper_color_player_fitness_below2"), NULL);
+		     const_app(string_treeview_helper_color_player_fitness_below2), NULL);
     else
 	g_object_set(renderer, "foreground", 
-		     const_app("string_treeview_helper_color_player_fitness_normal"), NULL);
+		     const_app(string_treeview_helper_color_player_fitness_normal), NULL);
 }
 
 /** Render a cell of player position or cposition.
@@ -1513,41 +1514,41 @@ treeview_helper_player_pos_to_cell(GtkCellRenderer *renderer, gchar *buf,
         /* Goalie */
         strcpy(buf, _("G"));
         g_object_set(renderer, "background", 
-                     const_app("string_treeview_helper_color_player_pos_goalie_bg"),
+                     const_app(string_treeview_helper_color_player_pos_goalie_bg),
                      "foreground", 
-                     const_app("string_treeview_helper_color_player_pos_goalie_fg"), NULL);
+                     const_app(string_treeview_helper_color_player_pos_goalie_fg), NULL);
         break;
     case PLAYER_POS_DEFENDER:
         /* Defender */
         strcpy(buf, _("D"));
         g_object_set(renderer, "background", 
-                     const_app("string_treeview_helper_color_player_pos_defender_bg"),
+                     const_app(string_treeview_helper_color_player_pos_defender_bg),
                      "foreground", 
-                     const_app("string_treeview_helper_color_player_pos_defender_fg"), NULL);
+                     const_app(string_treeview_helper_color_player_pos_defender_fg), NULL);
         break;
     case PLAYER_POS_MIDFIELDER:
         /* Midfielder */
         strcpy(buf, _("M"));
         g_object_set(renderer, "background", 
-                     const_app("string_treeview_helper_color_player_pos_midfielder_bg"),
+                     const_app(string_treeview_helper_color_player_pos_midfielder_bg),
                      "foreground", 
-                     const_app("string_treeview_helper_color_player_pos_midfielder_fg"), NULL);
+                     const_app(string_treeview_helper_color_player_pos_midfielder_fg), NULL);
         break;
     case PLAYER_POS_FORWARD:
         /* Forward */
         strcpy(buf, _("F"));
         g_object_set(renderer, "background", 
-                     const_app("string_treeview_helper_color_player_pos_forward_bg"),
+                     const_app(string_treeview_helper_color_player_pos_forward_bg),
                      "foreground", 
-                     const_app("string_treeview_helper_color_player_pos_forward_fg"), NULL);
+                     const_app(string_treeview_helper_color_player_pos_forward_fg), NULL);
         break;
     }
 
     if(pl->cskill == 0)
 	g_object_set(renderer, "background", 
-		     const_app("string_treeview_helper_color_player_pos_disabled_bg"),
+		     const_app(string_treeview_helper_color_player_pos_disabled_bg),
 		     "foreground", 
-		     const_app("string_treeview_helper_color_player_pos_disabled_fg"), NULL);
+		     const_app(string_treeview_helper_color_player_pos_disabled_fg), NULL);
 }
 
 /** Render a cell of player cskill.
@@ -1561,19 +1562,19 @@ treeview_helper_player_cskill_to_cell(GtkCellRenderer *renderer, gchar *buf, con
     printf("treeview_helper_player_cskill_to_cell\n");
 #endif
 
-    sprintf(buf, "%.*f", opt_int("int_opt_player_precision"),
+    sprintf(buf, "%.*f", opt_int(int_opt_player_precision),
 	    player_get_game_skill(pl, FALSE, FALSE));
 	    
     if(pl->cskill < pl->skill)
 	g_object_set(renderer, "background", 
-		     const_app("string_treeview_helper_color_player_bad_cskill_bg"),
+		     const_app(string_treeview_helper_color_player_bad_cskill_bg),
 		     "foreground", 
-		     const_app("string_treeview_helper_color_player_bad_cskill_fg"), NULL);
+		     const_app(string_treeview_helper_color_player_bad_cskill_fg), NULL);
     else
 	g_object_set(renderer, "background", 
-		     const_app("string_treeview_helper_color_default_background"),
+		     const_app(string_treeview_helper_color_default_background),
 		     "foreground", 
-		     const_app("string_treeview_helper_color_default_foreground"), NULL);
+		     const_app(string_treeview_helper_color_default_foreground), NULL);
 	
 }
 
@@ -1598,7 +1599,7 @@ treeview_helper_live_game_result(GtkTreeViewColumn *col,
 
     gtk_tree_model_get(model, iter, column, &data, -1);
     sprintf(buf, "<span %s>%s</span>", 
-	    const_app("string_treeview_helper_live_game_result_attributes"),
+	    const_app(string_treeview_helper_live_game_result_attributes),
 	    data);
 
     g_object_set(renderer, "markup", buf, NULL);
@@ -1639,9 +1640,9 @@ treeview_helper_mm_teams(GtkTreeViewColumn *col,
     const gchar *text = NULL;
 
     g_object_set(renderer, "background",
-		 const_app("string_treeview_helper_color_default_background"), NULL);
+		 const_app(string_treeview_helper_color_default_background), NULL);
     g_object_set(renderer, "foreground",
-		 const_app("string_treeview_helper_color_default_foreground"), NULL);
+		 const_app(string_treeview_helper_color_default_foreground), NULL);
     g_object_set(renderer, "text", "", NULL);
 
     if(column == 1 || column == 2)
@@ -1658,15 +1659,15 @@ treeview_helper_mm_teams(GtkTreeViewColumn *col,
 	       ((column == 1 && mm->user_team == 1) ||
 		(column == 2 && mm->user_team == 0)))
 		g_object_set(renderer, "background",
-			     const_app("string_treeview_live_game_commentary_away_bg"), NULL);
+			     const_app(string_treeview_live_game_commentary_away_bg), NULL);
 	}
 	else if(column == 1)
 	{
 	    g_object_set(renderer, "text", _("ADD LAST MATCH"), NULL);
 	    g_object_set(renderer, "background", 
-			 const_app("string_treeview_helper_mmatches_add_bg"), NULL);
+			 const_app(string_treeview_helper_mmatches_add_bg), NULL);
 	    g_object_set(renderer, "foreground", 
-			 const_app("string_treeview_helper_mmatches_add_fg"), NULL);
+			 const_app(string_treeview_helper_mmatches_add_fg), NULL);
 	}
     }
     else if(column >= TREEVIEW_MMATCH_COL_REPLAY)
@@ -1682,23 +1683,23 @@ treeview_helper_mm_teams(GtkTreeViewColumn *col,
 	if(column == TREEVIEW_MMATCH_COL_REPLAY)
 	{
 	    g_object_set(renderer, "background",
-			 const_app("string_treeview_helper_mmatches_replay_bg"), NULL);
+			 const_app(string_treeview_helper_mmatches_replay_bg), NULL);
 	    g_object_set(renderer, "foreground",
-			 const_app("string_treeview_helper_mmatches_replay_fg"), NULL);
+			 const_app(string_treeview_helper_mmatches_replay_fg), NULL);
 	}
 	else if(column == TREEVIEW_MMATCH_COL_REMOVE)
 	{
 	    g_object_set(renderer, "background",
-			 const_app("string_treeview_helper_mmatches_remove_bg"), NULL);
+			 const_app(string_treeview_helper_mmatches_remove_bg), NULL);
 	    g_object_set(renderer, "foreground",
-			 const_app("string_treeview_helper_mmatches_remove_fg"), NULL);
+			 const_app(string_treeview_helper_mmatches_remove_fg), NULL);
 	}
 	else if(column == TREEVIEW_MMATCH_COL_EXPORT)
 	{
 	    g_object_set(renderer, "background",
-			 const_app("string_treeview_helper_mmatches_export_bg"), NULL);
+			 const_app(string_treeview_helper_mmatches_export_bg), NULL);
 	    g_object_set(renderer, "foreground",
-			 const_app("string_treeview_helper_mmatches_export_fg"), NULL);
+			 const_app(string_treeview_helper_mmatches_export_fg), NULL);
 	}
     }
 }
@@ -1731,10 +1732,10 @@ treeview_helper_season_results(GtkTreeViewColumn *col,
 	strcpy(buf, fix->teams[!user_idx]->name);
 	if(user_idx == 1)
 	    g_object_set(renderer, "background",
-			 const_app("string_treeview_live_game_commentary_away_bg"), NULL);
+			 const_app(string_treeview_live_game_commentary_away_bg), NULL);
 	else
 	    g_object_set(renderer, "background",
-			 const_app("string_treeview_helper_color_default_background"), NULL);
+			 const_app(string_treeview_helper_color_default_background), NULL);
     }
     else if(column == 4)
     {
@@ -1742,7 +1743,7 @@ treeview_helper_season_results(GtkTreeViewColumn *col,
 	{
 	    strcpy(buf, "");
 	    g_object_set(renderer, "background",
-			 const_app("string_treeview_helper_color_default_background"), NULL);
+			 const_app(string_treeview_helper_color_default_background), NULL);
 	}
 	else if((fix->result[0][2] + fix->result[1][2] > 0 && 
 		 fix->result[user_idx][2] > fix->result[!user_idx][2]) ||
@@ -1753,7 +1754,7 @@ treeview_helper_season_results(GtkTreeViewColumn *col,
 	    /* Won. */
 	    strcpy(buf, _("W"));
 	    g_object_set(renderer, "background",
-			 const_app("string_treeview_helper_season_results_win_bg"), NULL);
+			 const_app(string_treeview_helper_season_results_win_bg), NULL);
 	}
 	else if((fix->result[0][2] + fix->result[1][2] > 0 && 
 		 fix->result[user_idx][2] < fix->result[!user_idx][2]) ||
@@ -1764,14 +1765,14 @@ treeview_helper_season_results(GtkTreeViewColumn *col,
 	    /* Lost. */
 	    strcpy(buf, _("L"));
 	    g_object_set(renderer, "background",
-			 const_app("string_treeview_helper_season_results_loss_bg"), NULL);
+			 const_app(string_treeview_helper_season_results_loss_bg), NULL);
 	}
 	else
 	{
 	    /* Draw. */
 	    strcpy(buf, _("Dw"));
 	    g_object_set(renderer, "background",
-			 const_app("string_treeview_helper_season_results_draw_bg"), NULL);
+			 const_app(string_treeview_helper_season_results_draw_bg), NULL);
 	}
     }
     else if(column == 5)
@@ -1800,9 +1801,9 @@ treeview_helper_bet_odds(GtkTreeViewColumn *col,
     gtk_tree_model_get(model, iter, column, &bet, -1);
 
     g_object_set(renderer, "background",
-		 const_app("string_treeview_helper_color_default_background"), 
+		 const_app(string_treeview_helper_color_default_background), 
 		 "foreground",
-		 const_app("string_treeview_helper_color_default_foreground"), 
+		 const_app(string_treeview_helper_color_default_foreground), 
 		 "text", "", NULL);
 
     if(bet == NULL)
@@ -1822,9 +1823,9 @@ treeview_helper_bet_odds(GtkTreeViewColumn *col,
        bet_user != NULL &&
        bet_user->outcome == column - 1)
 	g_object_set(renderer, "background",
-		     const_app("string_treeview_helper_color_user_bet_bg"), 
+		     const_app(string_treeview_helper_color_user_bet_bg), 
 		     "foreground",
-		     const_app("string_treeview_helper_color_user_bet_fg"), NULL);
+		     const_app(string_treeview_helper_color_user_bet_fg), NULL);
 
     g_object_set(renderer, "text", buf, NULL);
 }
@@ -1885,8 +1886,8 @@ treeview_helper_news_additional(GtkTreeViewColumn *col,
 
     gtk_tree_model_get(model, iter, 2, &article, -1);
 
-    colour_fg = const_app("string_treeview_helper_color_default_foreground");
-    colour_bg = const_app("string_treeview_helper_color_default_background");
+    colour_fg = const_app(string_treeview_helper_color_default_foreground);
+    colour_bg = const_app(string_treeview_helper_color_default_background);
 
     if(article == NULL)
     {
@@ -1904,7 +1905,7 @@ treeview_helper_news_additional(GtkTreeViewColumn *col,
         sprintf(buf2, "%s", article->competition->name);
 
     sprintf(buf, "<span %s>%s</span>", 
-            const_app("string_news_window_league_cup_attribute"),
+            const_app(string_news_window_league_cup_attribute),
             buf2);
 
     g_object_set(renderer, "markup", buf, 
@@ -1926,8 +1927,8 @@ treeview_helper_news(GtkTreeViewColumn *col,
 
     gtk_tree_model_get(model, iter, 1, &article, -1);
 
-    colour_fg = const_app("string_treeview_helper_color_default_foreground");
-    colour_bg = const_app("string_treeview_helper_color_default_background");
+    colour_fg = const_app(string_treeview_helper_color_default_foreground);
+    colour_bg = const_app(string_treeview_helper_color_default_background);
 
     if(article == NULL)
     {
@@ -1938,27 +1939,27 @@ treeview_helper_news(GtkTreeViewColumn *col,
      
     if(article->user_idx == cur_user)
     {
-	colour_fg = const_app("string_treeview_current_user_fg");
-	colour_bg = const_app("string_treeview_current_user_bg");
+	colour_fg = const_app(string_treeview_current_user_fg);
+	colour_bg = const_app(string_treeview_current_user_bg);
     }
     else if(article->user_idx != -1)
     {
-	colour_fg = const_app("string_treeview_user_fg");
-	colour_bg = const_app("string_treeview_user_bg");
+	colour_fg = const_app(string_treeview_user_fg);
+	colour_bg = const_app(string_treeview_user_bg);
     }
 
     sprintf(buf, "<span %s>%s</span>",
-            const_app("string_news_window_title_small_attribute"),
+            const_app(string_news_window_title_small_attribute),
             article->title_small);
  
     news_string = g_string_new(buf);
 
     g_string_append_printf(news_string, "\n<span %s>%s</span>",
-                           const_app("string_news_window_title_attribute"),
+                           const_app(string_news_window_title_attribute),
                            article->title);
  
     g_string_append_printf(news_string, "\n<span %s>%s</span>",
-                           const_app("string_news_window_subtitle_attribute"),
+                           const_app(string_news_window_subtitle_attribute),
                            article->subtitle);
 
     g_object_set(renderer, "markup", news_string->str, 
@@ -1988,9 +1989,9 @@ treeview_helper_job_exchange(GtkTreeViewColumn *col,
 	return;
 
     g_object_set(renderer, "background",
-		 const_app("string_treeview_helper_color_default_background"), 
+		 const_app(string_treeview_helper_color_default_background), 
 		 "foreground",
-		 const_app("string_treeview_helper_color_default_foreground"), 
+		 const_app(string_treeview_helper_color_default_foreground), 
 		 NULL);
 
     if(column == 3)
@@ -1998,9 +1999,9 @@ treeview_helper_job_exchange(GtkTreeViewColumn *col,
 	strcpy(buf, job->country_name);
 	if(job->type != JOB_TYPE_NATIONAL)
 	    g_object_set(renderer, "background",
-			 const_app("string_treeview_helper_color_job_international_bg"),
+			 const_app(string_treeview_helper_color_job_international_bg),
 			 "foreground",
-			 const_app("string_treeview_helper_color_job_international_fg"), 
+			 const_app(string_treeview_helper_color_job_international_fg), 
 			 NULL);
     }
     else if(column == 4)
@@ -2025,8 +2026,7 @@ treeview_helper_player_name_editing_done(GtkCellRendererText *renderer,
         return;
 
     idx = (idx > 11) ? idx - 1 : idx;
-    g_free(g_array_index(current_user.tm->players, Player, idx).name);
-    g_array_index(current_user.tm->players, Player, idx).name = g_strdup(new_text);
+    g_array_index(current_user.tm->players, Player, idx).name = name_intern(new_text);
 
     gtk_widget_set_sensitive(lookup_widget(window.main, "menubar1"), TRUE);
     gtk_widget_set_sensitive(lookup_widget(window.main, "hbox1"), TRUE);
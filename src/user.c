@@ -23,6 +23,8 @@
    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 */
 
+#include <glib/gstdio.h>
+
 #include "bet.h"
 #include "cup.h"
 #include "file.h"
@@ -66,6 +68,7 @@ user_new(void)
     new.history = g_array_new(FALSE, FALSE, sizeof(UserHistory)); 
     new.options.list = NULL;
     new.options.datalist = NULL;
+    new.options.ids = NULL;
 
     new.sponsor.name = g_string_new("");
     new.sponsor.contract = new.sponsor.benefit = -1;
@@ -96,7 +99,7 @@ user_set_up_team_new_game(User *user)
     printf("user_set_up_team_new_game\n");
 #endif
 
-    gchar buf[SMALL];
+    gchar *name = NULL;
     gint rndom;
 
     /* If the user chose to start in a different league than
@@ -118,10 +121,10 @@ user_set_up_team_new_game(User *user)
 	    rndom = math_rndi(0, league->c.teams->len - 1);
       
         team = g_ptr_array_index(league->c.teams, rndom);
-	sprintf(buf, "%s", team->name);
-	misc_string_assign(&team->name,
-			   user->tm->name);
-	misc_string_assign(&user->tm->name, buf);
+	/* Swap the names; they're in the name pool. */
+	name = team->name;
+	team->name = user->tm->name;
+	user->tm->name = name;
 
 	user->tm = team;
 
@@ -161,7 +164,7 @@ user_set_up_team(User *user, gboolean remove_players)
 
     user->scout = user->physio = QUALITY_AVERAGE;
 
-    if(sett_int("int_opt_disable_transfers"))
+    if(sett_int(int_opt_disable_transfers))
 	user->physio = QUALITY_GOOD;
     
     user->tm->style = 0;
@@ -169,11 +172,11 @@ user_set_up_team(User *user, gboolean remove_players)
     user_set_up_finances(user);
     user_set_up_counters(user);
 
-    if(!sett_int("int_opt_disable_ya"))
+    if(!sett_int(int_opt_disable_ya))
 	youth_academy_new(user);
 
     user->counters[COUNT_USER_NEW_SPONSOR] = 
-	(sett_int("int_opt_disable_finances")) ? -5 : 1;
+	(sett_int(int_opt_disable_finances)) ? -5 : 1;
 
     option_set_int("int_opt_user_penalty_shooter",
 		   &user->options, -1);
@@ -195,7 +198,7 @@ user_set_up_counters(User *user)
     user->counters[COUNT_USER_LOAN] =
 	user->counters[COUNT_USER_POSITIVE] = -1;
     user->counters[COUNT_USER_TRAININGS_LEFT_SEASON] = 
-	const_int("int_training_camps_per_season");
+	const_int(int_training_camps_per_season);
 }
 
 /** Set up the user's finances when he's got a new team.
@@ -220,8 +223,8 @@ user_set_up_finances(User *user)
         user->alr_weekly_installment = 0;
     user->money = 
 	math_round_integer(user->tm->stadium.capacity * 
-			   math_rndi(const_int("int_initial_money_lower"),
-				     const_int("int_initial_money_upper")), 2);
+			   math_rndi(const_int(int_initial_money_lower),
+				     const_int(int_initial_money_upper)), 2);
 }
 
 /** Remove a user from the game.
@@ -378,13 +381,13 @@ user_job_offer(User *user)
 
     Team *new_team = NULL;
 
-    if(math_rnd(0, 1) > const_float("float_user_success_counter_check") ||
+    if(math_rnd(0, 1) > const_float(float_user_success_counter_check) ||
        ABS(user->counters[COUNT_USER_SUCCESS]) < 
-       (gfloat)const_int("int_user_success_offer_limit") * 0.9)
+       (gfloat)const_int(int_user_success_offer_limit) * 0.9)
 	return;
 
     if(user->counters[COUNT_USER_SUCCESS] < 
-       -(gfloat)const_int("int_user_success_offer_limit") * 0.9 &&
+       -(gfloat)const_int(int_user_success_offer_limit) * 0.9 &&
        !user->counters[COUNT_USER_WARNING])
     {
 	user_event_add(user, EVENT_TYPE_WARNING, -1, -1, NULL,
@@ -393,9 +396,9 @@ user_job_offer(User *user)
 	return;
     }
 
-    if(math_rnd(0, 1) < const_float("float_user_success_base_prob") * 
+    if(math_rnd(0, 1) < const_float(float_user_success_base_prob) * 
        log((gfloat)ABS(user->counters[COUNT_USER_SUCCESS]) * 
-	   const_float("float_user_success_prob_factor")))
+	   const_float(float_user_success_prob_factor)))
     {
 	if(user->counters[COUNT_USER_SUCCESS] < 0)
 	{
@@ -421,9 +424,9 @@ user_weekly_update_counters(User *user)
     gint rank = team_get_league_rank(user->tm, NULL);
     gint teamslen = user->tm->league->c.teams->len;
     gint rank_bounds[2] = 
-	{(gint)rint(const_float("float_user_success_table_bound_upper") *
+	{(gint)rint(const_float(float_user_success_table_bound_upper) *
 		    (gfloat)teamslen),
-	 (gint)rint(const_float("float_user_success_table_bound_lower") *
+	 (gint)rint(const_float(float_user_success_table_bound_lower) *
 		    (gfloat)teamslen)};
     gint *cnts = user->counters;
     gint increase_capacity;
@@ -433,10 +436,10 @@ user_weekly_update_counters(User *user)
 
     if(cnts[COUNT_USER_STADIUM_CAPACITY] > 0)
     {
-	increase_capacity = math_rndi(const_int("int_stadium_improvement_base_seats") - 
-				      const_int("int_stadium_improvement_seats_variance"),
-				      const_int("int_stadium_improvement_base_seats") + 
-				      const_int("int_stadium_improvement_seats_variance"));
+	increase_capacity = math_rndi(const_int(int_stadium_improvement_base_seats) - 
+				      const_int(int_stadium_improvement_seats_variance),
+				      const_int(int_stadium_improvement_base_seats) + 
+				      const_int(int_stadium_improvement_seats_variance));
 	user->tm->stadium.capacity += MIN(cnts[COUNT_USER_STADIUM_CAPACITY],
 					  increase_capacity);
 	cnts[COUNT_USER_STADIUM_CAPACITY] = 
@@ -445,10 +448,10 @@ user_weekly_update_counters(User *user)
 
     if(cnts[COUNT_USER_STADIUM_SAFETY] > 0)
     {
-	increase_safety = math_rnd(const_float("float_stadium_improvement_base_safety") - 
-				   const_float("float_stadium_improvement_safety_variance"),
-				   const_float("float_stadium_improvement_base_safety") + 
-				   const_float("float_stadium_improvement_safety_variance"));
+	increase_safety = math_rnd(const_float(float_stadium_improvement_base_safety) - 
+				   const_float(float_stadium_improvement_safety_variance),
+				   const_float(float_stadium_improvement_base_safety) + 
+				   const_float(float_stadium_improvement_safety_variance));
 	user->tm->stadium.safety += MIN((gfloat)cnts[COUNT_USER_STADIUM_SAFETY] / 100,
 					increase_safety);
 	user->tm->stadium.safety = MIN(user->tm->stadium.safety, 1);
@@ -466,9 +469,9 @@ user_weekly_update_counters(User *user)
 	else
 	{
 	    if(user->counters[COUNT_USER_SUCCESS] > 0)
-		user->counters[COUNT_USER_SUCCESS] -= const_int("int_user_success_mediocre_rank_change");
+		user->counters[COUNT_USER_SUCCESS] -= const_int(int_user_success_mediocre_rank_change);
 	    else
-		user->counters[COUNT_USER_SUCCESS] += const_int("int_user_success_mediocre_rank_change");
+		user->counters[COUNT_USER_SUCCESS] += const_int(int_user_success_mediocre_rank_change);
 	}
     }
 }
@@ -584,9 +587,9 @@ user_event_show_next(void)
 	    break;
 	case EVENT_TYPE_OVERDRAW:
 	    if(event->value1 == 1)
-		game_gui_show_warning(_("You have overdrawn your bank account. The team owners give you %d weeks to get above your drawing credit limit."), const_int("int_finance_overdraw_positive"));
+		game_gui_show_warning(_("You have overdrawn your bank account. The team owners give you %d weeks to get above your drawing credit limit."), const_int(int_finance_overdraw_positive));
 	    else
-		game_gui_show_warning(_("You have overdrawn your bank account once again. Bear in mind that after the fourth time you get fired.\nThe team owners give you %d weeks to get above your drawing credit limit."), const_int("int_finance_overdraw_positive"));
+		game_gui_show_warning(_("You have overdrawn your bank account once again. Bear in mind that after the fourth time you get fired.\nThe team owners give you %d weeks to get above your drawing credit limit."), const_int(int_finance_overdraw_positive));
 	    break;
 	case EVENT_TYPE_TRANSFER_OFFER_USER:
 	    game_gui_show_warning(_("Have a look at the transfer list, there's an offer for %s."),
@@ -667,7 +670,7 @@ user_change_team(User *user, Team *tm)
     gint success = user->counters[COUNT_USER_SUCCESS];
 
     /* Reset the ticketprice of the old team to the default value */
-    user->tm->stadium.ticket_price = const_int("int_team_stadium_ticket_price");
+    user->tm->stadium.ticket_price = const_int(int_team_stadium_ticket_price);
 
     user->tm = tm;
 
@@ -783,10 +786,10 @@ user_history_add(User *user, gint type, const gchar *team_name,
 
     if(type == USER_HISTORY_PROMOTED)
 	user->counters[COUNT_USER_SUCCESS] += 
-	    const_int("int_user_success_promotion");
+	    const_int(int_user_success_promotion);
     else if(type == USER_HISTORY_RELEGATED)
 	user->counters[COUNT_USER_SUCCESS] -= 
-	    const_int("int_user_success_relegation");
+	    const_int(int_user_success_relegation);
 
     his->season = season;
     his->week = week;
@@ -919,20 +922,20 @@ user_add_cup_success(User *user, const Cup *cup, gint round, gint type)
     {
 	if(international)
 	    user->counters[COUNT_USER_SUCCESS] +=
-		const_int("int_user_success_international_winner");
+		const_int(int_user_success_international_winner);
 	else if(national)
 	    user->counters[COUNT_USER_SUCCESS] +=
-		const_int("int_user_success_national_winner");
+		const_int(int_user_success_national_winner);
     }
     else if(type == USER_HISTORY_LOSE_FINAL)
     {
 	if(international)
 	    user->counters[COUNT_USER_SUCCESS] +=
-		const_int("int_user_success_international_final");
+		const_int(int_user_success_international_final);
 	else if(international)
 	    user->counters[COUNT_USER_SUCCESS] +=
-		const_int("int_user_success_national_winner");
-		const_int("int_user_success_national_final");
+		const_int(int_user_success_national_winner);
+		const_int(int_user_success_national_final);
     }
     else if(type == USER_HISTORY_REACH_CUP_ROUND)
     {
@@ -940,19 +943,19 @@ user_add_cup_success(User *user, const Cup *cup, gint round, gint type)
 	{
 	    if(international)
 		user->counters[COUNT_USER_SUCCESS] +=
-		    const_int("int_user_success_international_semis");
+		    const_int(int_user_success_international_semis);
 	    else if(national)
 		user->counters[COUNT_USER_SUCCESS] +=
-		    const_int("int_user_success_national_semis");
+		    const_int(int_user_success_national_semis);
 	}
 	else if(round == cup->rounds->len - 3)
 	{
 	    if(international)
 		user->counters[COUNT_USER_SUCCESS] +=
-		    const_int("int_user_success_international_quarter");
+		    const_int(int_user_success_international_quarter);
 	    else if(national)
 		user->counters[COUNT_USER_SUCCESS] +=
-		    const_int("int_user_success_national_quarter");
+		    const_int(int_user_success_national_quarter);
 	}
     }
 }
@@ -1053,14 +1056,14 @@ user_get_sponsor(const User *user)
 	g_string_append(new.name, short_names[math_rndi(0, 6)]);
 
     new.contract = 4 * math_rndi(9, 36);
-    new.benefit = (gint)rint((((const_float("float_sponsor_wage_percentage_upper") -
-			       const_float("float_sponsor_wage_percentage_lower")) /
-			      (2 * (gfloat)const_int("int_user_success_offer_limit"))) *
+    new.benefit = (gint)rint((((const_float(float_sponsor_wage_percentage_upper) -
+			       const_float(float_sponsor_wage_percentage_lower)) /
+			      (2 * (gfloat)const_int(int_user_success_offer_limit))) *
 			     (gfloat)current_user.counters[COUNT_USER_SUCCESS]
-			     + ((const_float("float_sponsor_wage_percentage_upper") -
-				 const_float("float_sponsor_wage_percentage_lower")) / 2)) *
+			     + ((const_float(float_sponsor_wage_percentage_upper) -
+				 const_float(float_sponsor_wage_percentage_lower)) / 2)) *
 			     (1 + suc_factor * ((gfloat)new.contract / 52 - 1) * 
-			      const_float("float_sponsor_contract_length_factor")) *
+			      const_float(float_sponsor_contract_length_factor)) *
 			     (finance_wage_unit(current_user.tm) * current_user.tm->players->len));
     new.benefit = math_round_integer(new.benefit, 2);
 
@@ -1080,17 +1083,17 @@ user_show_sponsors(Bygfoot *bygfoot)
     UserSponsor sponsor;
 
     if(ABS(current_user.counters[COUNT_USER_SUCCESS]) >= 
-       const_int("int_user_success_offer_limit"))
+       const_int(int_user_success_offer_limit))
 	num_offers = (current_user.counters[COUNT_USER_SUCCESS] < 0) ?
-	    const_int("int_sponsor_offers_lower") :
-	    const_int("int_sponsor_offers_upper");
+	    const_int(int_sponsor_offers_lower) :
+	    const_int(int_sponsor_offers_upper);
     else
-	num_offers = (gint)rint(((gfloat)(const_int("int_sponsor_offers_upper") -
-					  const_int("int_sponsor_offers_lower")) /
-				 (2 * (gfloat)const_int("int_user_success_offer_limit"))) *
+	num_offers = (gint)rint(((gfloat)(const_int(int_sponsor_offers_upper) -
+					  const_int(int_sponsor_offers_lower)) /
+				 (2 * (gfloat)const_int(int_user_success_offer_limit))) *
 				(gfloat)current_user.counters[COUNT_USER_SUCCESS]
-				+ ((gfloat)(const_int("int_sponsor_offers_upper") -
-					    const_int("int_sponsor_offers_lower")) / 2) + 1);
+				+ ((gfloat)(const_int(int_sponsor_offers_upper) -
+					    const_int(int_sponsor_offers_lower)) / 2) + 1);
 
     num_offers += math_rndi(-1, 1);
     if(num_offers <= 0)
@@ -1162,7 +1165,11 @@ user_mm_load_file(const gchar *filename, GArray *mmatches)
 
     sprintf(matches_file, "%s___mmatches", prefix->str);
 
-    file_decompress(filename_local);
+    if(!file_archive_begin_read(filename_local))
+    {
+	g_string_free(prefix, TRUE);
+	return;
+    }
     
     if(mmatches == NULL)
     {
@@ -1172,19 +1179,7 @@ user_mm_load_file(const gchar *filename, GArray *mmatches)
 
     xml_mmatches_read(matches_file, mm_array);
 
-    gchar* dirname = g_get_current_dir();
-    GPtrArray *files = file_dir_get_contents(dirname, prefix->str, "");
-    // Remove the zipfile from the list
-    gint i;  
-    for(i=0;i<files->len;i++)
-    {
-      if (g_strcmp0((gchar*)g_ptr_array_index(files, i),filename_local)==0){
-         g_ptr_array_remove_index_fast(files, i);
-      }
-    }
-    file_remove_files(files);
-    g_free(dirname);
-    free_gchar_array(&files);
+    file_archive_end_read();
 
     if(mmatches == NULL)
 	misc_string_assign(&current_user.mmatches_file, filename_local);
@@ -1256,9 +1251,16 @@ user_mm_save_file(const gchar *filename, const GArray *mmatches)
 
     strcat(prefix, "___");
 
+    if(g_file_test(filename, G_FILE_TEST_EXISTS))
+	g_remove(filename);
+
+    if(!file_archive_begin_write(filename))
+	return;
+
     xml_mmatches_write(prefix, mmatches);
 
-    file_compress_files(filename, prefix);
+    if(!file_archive_end_write())
+	debug_print_message("user_mm_save_file: could not write %s\n", filename);
 }
 
 /** Set an appropriate filename for the memorable
@@ -1390,10 +1392,10 @@ gint
 user_get_scout_cost(const User *user)
 {
     gfloat scout_factor[4] =
-        {const_float("float_finance_scout_factor1"),
-         const_float("float_finance_scout_factor2"),
-         const_float("float_finance_scout_factor3"),
-         const_float("float_finance_scout_factor4")};
+        {const_float(float_finance_scout_factor1),
+         const_float(float_finance_scout_factor2),
+         const_float(float_finance_scout_factor3),
+         const_float(float_finance_scout_factor4)};
     return (gint)(finance_wage_unit(user->tm) * scout_factor[user->scout % 10]);
 }
 
@@ -1401,10 +1403,10 @@ gint
 user_get_youth_coach_cost(const User *user)
 {
     gfloat yc_factor[4] =
-        {const_float("float_finance_yc_factor1"),
-         const_float("float_finance_yc_factor2"),
-         const_float("float_finance_yc_factor3"),
-         const_float("float_finance_yc_factor4")};
+        {const_float(float_finance_yc_factor1),
+         const_float(float_finance_yc_factor2),
+         const_float(float_finance_yc_factor3),
+         const_float(float_finance_yc_factor4)};
     if (user->youth_academy.players->len == 0)
         return 0;
 
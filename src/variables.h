@@ -85,6 +85,10 @@ GArray *strategies;
 /** Array of current and recent bets. */
 GArray *bets[2];
 
+/** The betting odds table, sorted by skill difference.
+    @see BetOddsStep */
+GArray *bet_odds_table;
+
 /** Loan interest for the current week. */
 gfloat current_interest;
 
@@ -106,6 +110,14 @@ gint selected_row;
 /** An array of name lists. */
 GArray *name_lists;
 
+/** The indices of the name lists in the array (plus 1) by sid. */
+GHashTable *name_lists_index;
+
+/** The first and last names of the name lists and the names of
+    players and teams; each name is stored only once.
+    @see name_intern() */
+GStringChunk *name_pool;
+
 /** The struct containing the window pointers. */
 Windows window;
 
@@ -119,6 +131,10 @@ gint timeout_id;
 
 GRand *rand_generator;
 
+/** The seed of the random number streams of the matches.
+    @see live_game_fixture_rand_new() */
+guint32 rand_seed;
+
 /** Debug information. */
 gint debug_level, debug_output;
 
@@ -130,6 +146,11 @@ gint debug_level, debug_output;
 */
 GList *support_directories;
 
+/** The full paths of the files in the support directories by
+    file name, built when file_find_support_file() is first called.
+    @see file_index_support_files() */
+GHashTable *support_files;
+
 /**
  * The list of root defintions directories found (ending in definitions)
  */ 
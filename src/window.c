@@ -127,13 +127,13 @@ window_show_progress(gint pictype)
     gchar *buf2 = NULL;
     GtkImage *image = NULL;
 
-    if(sett_int("int_opt_goto_mode"))
+    if(sett_int(int_opt_goto_mode))
         return;
 
     window_create(WINDOW_PROGRESS, NULL);
 
     if(pictype == PIC_TYPE_NONE ||
-       !opt_int("int_opt_progressbar_pics"))
+       !opt_int(int_opt_progressbar_pics))
 	return;
 
     image = GTK_IMAGE(lookup_widget(window.progress,
@@ -187,13 +187,13 @@ window_show_bets(Bygfoot *bygfoot)
 
     gtk_toggle_button_set_active(
 	GTK_TOGGLE_BUTTON(lookup_widget(window.bets, "checkbutton_bet_all_leagues")),
-	opt_user_int("int_opt_user_bet_show_all_leagues"));
+	opt_user_int(int_opt_user_bet_show_all_leagues));
     gtk_toggle_button_set_active(
 	GTK_TOGGLE_BUTTON(lookup_widget(window.bets, "checkbutton_bet_cups")),
-	opt_user_int("int_opt_user_bet_show_cups"));
+	opt_user_int(int_opt_user_bet_show_cups));
     gtk_toggle_button_set_active(
 	GTK_TOGGLE_BUTTON(lookup_widget(window.bets, "checkbutton_bet_user_recent")),
-	opt_user_int("int_opt_user_bet_show_my_recent"));
+	opt_user_int(int_opt_user_bet_show_my_recent));
 
     treeview2_show_bets();
 }
@@ -211,7 +211,7 @@ window_show_help(gint page)
 
     window_create(WINDOW_HELP, NULL);
 
-    sprintf(buf, "<span %s>Bygfoot Football Manager %s</span>\n(c) %s Győző Both (gyboth@bygfoot.com)\nhttp://bygfoot.sourceforge.net", const_app("string_help_window_program_name_attribute"), VERS, YEAR);
+    sprintf(buf, "<span %s>Bygfoot Football Manager %s</span>\n(c) %s Győző Both (gyboth@bygfoot.com)\nhttp://bygfoot.sourceforge.net", const_app(string_help_window_program_name_attribute), VERS, YEAR);
     gtk_label_set_markup(GTK_LABEL(lookup_widget(window.help, "label_about")), buf);
 
     treeview_show_contributors(
@@ -507,7 +507,7 @@ window_show_digits(const gchar *text_main, const gchar* text1, gint value1,
 	gtk_spin_button_set_range(spinbutton1, (gdouble)1, (gdouble)value1);
     else if(stat1 == STATUS_SET_YA_PERCENTAGE)
 	gtk_spin_button_set_range(spinbutton2, (gdouble)0,
-				  (gdouble)const_int("int_youth_academy_max_percentage"));
+				  (gdouble)const_int(int_youth_academy_max_percentage));
 
     gtk_spin_button_set_value(spinbutton1, (gdouble)value1);
     gtk_spin_button_set_value(spinbutton2, (gdouble)value2);
@@ -557,7 +557,7 @@ window_show_stadium(Bygfoot *bygfoot)
     gtk_spin_button_set_value(spin_ticket_price, tm->stadium.ticket_price);
     /* Set the lower bound to constant_ticket_price-(1/constant_ticket_attendance)
        +1 So that we can't divide by 0 or negative numbers*/
-    gfloat lower_bound = const_int("int_team_stadium_ticket_price")-(1/const_float("float_team_stadium_price_attendance_factor"))+1;
+    gfloat lower_bound = const_int(int_team_stadium_ticket_price)-(1/const_float(float_team_stadium_price_attendance_factor))+1;
 
     gtk_spin_button_set_range(spin_ticket_price, lower_bound, 100);
 
@@ -690,8 +690,8 @@ window_live_set_up(void)
 					    &usr(stat2).options);
     
     gtk_spin_button_set_range(
-	sb_speed, 0, -rint((gfloat)(const_int("int_game_gui_live_game_speed_max") - 10) /
-			   (gfloat)(const_int("int_game_gui_live_game_speed_grad"))));
+	sb_speed, 0, -rint((gfloat)(const_int(int_game_gui_live_game_speed_max) - 10) /
+			   (gfloat)(const_int(int_game_gui_live_game_speed_grad))));
     
     gtk_spin_button_set_value(sb_speed, user_option);
     
@@ -761,6 +761,7 @@ window_main_load_geometry(void)
     {
 	optionlist.list = NULL;
 	optionlist.datalist = NULL;
+	optionlist.ids = NULL;
 	file_load_opt_file(filename, &optionlist, FALSE);
 
 	gtk_window_resize(GTK_WINDOW(window.main),
@@ -811,7 +812,7 @@ window_create(gint window_type, Bygfoot *bygfoot)
 	    }
 	    else
 		wind = window.main;
-	    if(opt_int("int_opt_maximize_main_window"))
+	    if(opt_int(int_opt_maximize_main_window))
 		gtk_window_maximize(GTK_WINDOW(wind));
 	    break;
 	case WINDOW_STARTUP:
@@ -1076,7 +1077,7 @@ window_show_training_camp(Bygfoot *bygfoot)
         
     // Initialize entry costs
     misc_print_grouped_int(
-	math_round_integer(finance_wage_unit(current_user.tm) * const_float("float_training_camp_factor1"), -2),
+	math_round_integer(finance_wage_unit(current_user.tm) * const_float(float_training_camp_factor1), -2),
 	buf);
     tfCosts = GTK_ENTRY(lookup_widget(window.training_camp, "tf_costs"));
     gtk_entry_set_text (tfCosts, buf);
@@ -1086,9 +1087,9 @@ window_show_training_camp(Bygfoot *bygfoot)
     rb_camp2 = GTK_WIDGET(lookup_widget(window.training_camp, "rb_camp2"));
     rb_camp3 = GTK_WIDGET(lookup_widget(window.training_camp, "rb_camp3"));
 
-    if(opt_user_int("int_opt_user_training_camp_hotel") == TRAINING_CAMP_HOTEL_GOOD)
+    if(opt_user_int(int_opt_user_training_camp_hotel) == TRAINING_CAMP_HOTEL_GOOD)
 	gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(rb_camp1), TRUE);
-    else if(opt_user_int("int_opt_user_training_camp_hotel") == TRAINING_CAMP_HOTEL_FIRST)
+    else if(opt_user_int(int_opt_user_training_camp_hotel) == TRAINING_CAMP_HOTEL_FIRST)
 	gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(rb_camp2), TRUE);
     else
 	gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(rb_camp3), TRUE);
@@ -1110,9 +1111,9 @@ window_show_training_camp(Bygfoot *bygfoot)
     gtk_range_set_range (GTK_RANGE(hs_recreation), CAMP_SCALE_MIN, CAMP_SCALE_MAX);
     gtk_range_set_range (GTK_RANGE(hs_training), CAMP_SCALE_MIN, CAMP_SCALE_MAX);
     gtk_range_set_range (GTK_RANGE(hs_camp_points), CAMP_SCALE_MIN, CAMP_SCALE_MAX);
-    gtk_range_set_value (GTK_RANGE(hs_recreation), opt_user_int("int_opt_user_training_camp_recreation"));
+    gtk_range_set_value (GTK_RANGE(hs_recreation), opt_user_int(int_opt_user_training_camp_recreation));
     gtk_range_set_value (GTK_RANGE(hs_training), 
-			 CAMP_SCALE_MAX - opt_user_int("int_opt_user_training_camp_recreation"));
+			 CAMP_SCALE_MAX - opt_user_int(int_opt_user_training_camp_recreation));
     gtk_range_set_value (GTK_RANGE(hs_camp_points), CAMP_SCALE_MIN);
     gtk_scale_set_digits (GTK_SCALE(hs_recreation), 0);
     gtk_scale_set_digits (GTK_SCALE(hs_training), 0);
@@ -1159,7 +1160,7 @@ window_show_alr(Bygfoot *bygfoot)
     gtk_spin_button_set_range(GTK_SPIN_BUTTON(lookup_widget(window.alr, "spinbutton_start_week")),
                               week + 1, MIN(week + current_user.counters[COUNT_USER_LOAN], fixture_get_last_scheduled_week()));
     gtk_spin_button_set_range(GTK_SPIN_BUTTON(lookup_widget(window.alr, "spinbutton_weekly_installment")),
-                              0, -current_user.debt * powf(1 + current_user.debt_interest, const_int("int_finance_payback_weeks")) + 1);
+                              0, -current_user.debt * powf(1 + current_user.debt_interest, const_int(int_finance_payback_weeks)) + 1);
 }
 
 /** Show the window where the user can edit constants determining
@@ -30,6 +30,7 @@
 #include "league.h"
 #include "misc.h"
 #include "option.h"
+#include "registry.h"
 #include "support.h"
 #include "table.h"
 #include "transfer_struct.h"
@@ -105,6 +106,7 @@ xml_load_league(Country *country, GPtrArray *league_list, const gchar *dirname,
     sprintf(buf, "%s%s%s_stat.xml", dirname, G_DIR_SEPARATOR_S, prefix);
     xml_loadsave_league_stat_read(buf, &league->stats);
 
+    registry_invalidate();
     g_free(prefix);
 }
 
@@ -132,6 +134,7 @@ xml_load_cup(Bygfoot *bygfoot, Cup *cup, const gchar *dirname, const gchar *base
     sprintf(buf, "%s%s%s_fixtures.xml", dirname, G_DIR_SEPARATOR_S, prefix);
     xml_loadsave_fixtures_read(buf, &cup->c, cup->fixtures);
 
+    registry_invalidate();
     g_free(prefix);
 }
 
@@ -153,7 +156,7 @@ xml_load_transfers(const gchar *dirname, const gchar *basename)
 }
 
 void
-xml_write_string(FILE *fil, const gchar *string, gint tag, const gchar* indent)
+xml_write_string(GString *fil, const gchar *string, gint tag, const gchar* indent)
 {
 #ifdef DEBUG
     printf("xml_write_string\n");
@@ -162,17 +165,17 @@ xml_write_string(FILE *fil, const gchar *string, gint tag, const gchar* indent)
     if(string == NULL)
 	return;
 
-    fprintf(fil, "%s<_%d>%s</_%d>\n", indent, tag, string, tag);
+    g_string_append_printf(fil, "%s<_%d>%s</_%d>\n", indent, tag, string, tag);
 }
 
 void
-xml_write_float(FILE *fil, float value, gint tag, const gchar* indent)
+xml_write_float(GString *fil, float value, gint tag, const gchar* indent)
 {
     gint ivalue = 0;
 
     memcpy(&ivalue, &value, sizeof(gint));
     /* TODO: Drop 0x prefix once old save format is no longer supported. */
-    fprintf(fil, "%s<_%d>0x%x</_%d>\n", indent, tag, ivalue, tag);
+    g_string_append_printf(fil, "%s<_%d>0x%x</_%d>\n", indent, tag, ivalue, tag);
 }
 
 gfloat
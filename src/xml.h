@@ -91,17 +91,17 @@ enum XmlTags
 
 #define xml_write_g_string(fil, gstring, tag, indent) xml_write_string(fil, (gstring)->str, tag, indent)
 
-#define xml_write_int(fil, value, tag, indent) fprintf(fil, "%s<_%d>%d</_%d>\n", indent, tag, value, tag)
+#define xml_write_int(fil, value, tag, indent) g_string_append_printf(fil, "%s<_%d>%d</_%d>\n", indent, tag, value, tag)
 
 #define xml_read_int(str) ((gint)g_ascii_strtoll(str, NULL, 10))
 
 #define xml_get_tag_from_name(name) (gint)g_ascii_strtod(name + 1, NULL)
 
 void
-xml_write_string(FILE *fil, const gchar *string, gint tag, const gchar* indent);
+xml_write_string(GString *fil, const gchar *string, gint tag, const gchar* indent);
 
 void
-xml_write_float(FILE *fil, float value, gint tag, const gchar* indent);
+xml_write_float(GString *fil, float value, gint tag, const gchar* indent);
 
 gfloat
 xml_read_float(const char *str);
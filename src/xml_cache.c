@@ -0,0 +1,606 @@
+/*
+   xml_cache.c
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <string.h>
+#include <glib/gstdio.h>
+
+#include "debug.h"
+#include "file.h"
+#include "misc.h"
+#include "xml_cache.h"
+
+/* The definitions cache keeps the parser events of the definition
+   files (countries, leagues, cups, teams, names) so that they can be
+   replayed into the parser callbacks instead of parsing the XML again.
+   Replaying the events has exactly the effects parsing the file has.
+
+   The cache file is mapped into memory and consists of
+
+   - a header with the magic string, the version, a byte order mark
+     and the number of entries;
+   - the entries: the absolute file name, size and modification time
+     of the file and the length of the events, followed by the events.
+
+   An event is its type followed by the element name and the attributes
+   (start), the element name (end) or the text. Integers are 32 bits,
+   strings are their length followed by the characters, a terminating
+   zero and padding to 4 bytes, so the strings can be passed to the
+   callbacks right from the mapped file.
+
+   Entries whose file changed get recorded again; the cache file is
+   rewritten when something was recorded. */
+
+#define XML_CACHE_MAGIC "BYGFOOTD"
+#define XML_CACHE_BYTE_ORDER 0x01020304
+
+enum XmlCacheEvent
+{
+    XML_CACHE_EVENT_START = 0,
+    XML_CACHE_EVENT_END,
+    XML_CACHE_EVENT_TEXT,
+    XML_CACHE_EVENT_END_TYPES
+};
+
+/** The parser and user data the recording callbacks forward to. */
+typedef struct
+{
+    const GMarkupParser *parser;
+    gpointer user_data;
+    GByteArray *events;
+} XmlCacheRecorder;
+
+/** The entries by file name. */
+static GHashTable *xml_cache_entries = NULL;
+static GMappedFile *xml_cache_map = NULL;
+/** Whether something was recorded since the cache file was written. */
+static gboolean xml_cache_dirty = FALSE;
+
+static void
+xml_cache_put_int(GByteArray *data, guint32 value)
+{
+    g_byte_array_append(data, (const guint8*)&value, sizeof(guint32));
+}
+
+static void
+xml_cache_put_string(GByteArray *data, const gchar *string, gsize length)
+{
+    static const guint8 padding[4] = {0, 0, 0, 0};
+
+    xml_cache_put_int(data, length);
+    g_byte_array_append(data, (const guint8*)string, length);
+    /* At least one byte, the terminating zero. */
+    g_byte_array_append(data, padding, 4 - length % 4);
+}
+
+/** Read an integer if there's one left before the end. */
+static gboolean
+xml_cache_get_int(const gchar **pos, const gchar *end, guint32 *value)
+{
+    if(end - *pos < sizeof(guint32))
+	return FALSE;
+
+    memcpy(value, *pos, sizeof(guint32));
+    *pos += sizeof(guint32);
+
+    return TRUE;
+}
+
+/** Read a string if it fits before the end. */
+static gboolean
+xml_cache_get_string(const gchar **pos, const gchar *end,
+		     const gchar **string, gsize *length)
+{
+    guint32 len;
+
+    if(!xml_cache_get_int(pos, end, &len) ||
+       end - *pos < (gsize)len + 4 - len % 4 ||
+       (*pos)[len] != '\0')
+	return FALSE;
+
+    *string = *pos;
+    if(length != NULL)
+	*length = len;
+    *pos += len + 4 - len % 4;
+
+    return TRUE;
+}
+
+static void
+xml_cache_entry_free(gpointer data)
+{
+    XmlCacheEntry *entry = (XmlCacheEntry*)data;
+
+    g_free(entry->file_name);
+    if(entry->recorded != NULL)
+	g_byte_array_free(entry->recorded, TRUE);
+    g_free(entry);
+}
+
+/** Return the full name of the cache file or NULL. */
+static gchar*
+xml_cache_get_file_name(void)
+{
+    gchar dir[SMALL];
+
+    if(!file_get_bygfoot_dir(dir, SMALL) ||
+       !g_file_test(dir, G_FILE_TEST_IS_DIR))
+	return NULL;
+
+    return g_build_filename(dir, XML_CACHE_FILE, NULL);
+}
+
+/** Map the cache file and fill the entries table. A missing,
+    outdated or corrupt cache file leaves the table empty. */
+static void
+xml_cache_load(void)
+{
+#ifdef DEBUG
+    printf("xml_cache_load\n");
+#endif
+
+    gchar *file_name = xml_cache_get_file_name();
+    const gchar *pos, *end, *string;
+    guint32 version, byte_order, count, length, i;
+    XmlCacheEntry *entry;
+
+    xml_cache_entries = g_hash_table_new_full(g_str_hash, g_str_equal,
+					      NULL, xml_cache_entry_free);
+
+    if(file_name == NULL)
+	return;
+
+    xml_cache_map = g_mapped_file_new(file_name, FALSE, NULL);
+    g_free(file_name);
+
+    if(xml_cache_map == NULL)
+	return;
+
+    pos = g_mapped_file_get_contents(xml_cache_map);
+    end = pos + g_mapped_file_get_length(xml_cache_map);
+
+    if(end - pos < strlen(XML_CACHE_MAGIC) ||
+       strncmp(pos, XML_CACHE_MAGIC, strlen(XML_CACHE_MAGIC)) != 0)
+	count = 0;
+    else
+    {
+	pos += strlen(XML_CACHE_MAGIC);
+	if(!xml_cache_get_int(&pos, end, &version) ||
+	   !xml_cache_get_int(&pos, end, &byte_order) ||
+	   !xml_cache_get_int(&pos, end, &count) ||
+	   version != XML_CACHE_VERSION ||
+	   byte_order != XML_CACHE_BYTE_ORDER)
+	    count = 0;
+    }
+
+    for(i=0;i<count;i++)
+    {
+	entry = g_new0(XmlCacheEntry, 1);
+
+	if(!xml_cache_get_string(&pos, end, &string, NULL) ||
+	   end - pos < 2 * sizeof(gint64))
+	{
+	    g_free(entry);
+	    break;
+	}
+
+	memcpy(&entry->size, pos, sizeof(gint64));
+	memcpy(&entry->mtime, pos + sizeof(gint64), sizeof(gint64));
+	pos += 2 * sizeof(gint64);
+
+	if(!xml_cache_get_int(&pos, end, &length) ||
+	   end - pos < length)
+	{
+	    g_free(entry);
+	    break;
+	}
+
+	entry->file_name = g_strdup(string);
+	entry->events = pos;
+	entry->length = length;
+	pos += length;
+
+	g_hash_table_replace(xml_cache_entries, entry->file_name, entry);
+    }
+
+    if(i < count)
+    {
+	debug_print_message("xml_cache_load: the definitions cache is corrupt, ignoring it.\n");
+	g_hash_table_remove_all(xml_cache_entries);
+    }
+}
+
+/** Check that the events of the entry are complete
+    so that replaying them doesn't run off the end. */
+static gboolean
+xml_cache_check_events(const XmlCacheEntry *entry)
+{
+    const gchar *pos = entry->events,
+	*end = entry->events + entry->length,
+	*string;
+    guint32 type, attributes, i;
+
+    while(pos < end)
+    {
+	if(!xml_cache_get_int(&pos, end, &type))
+	    return FALSE;
+
+	if(type == XML_CACHE_EVENT_START)
+	{
+	    if(!xml_cache_get_int(&pos, end, &attributes) ||
+	       attributes > (end - pos) / 8)
+		return FALSE;
+	    for(i=0;i<2 * attributes + 1;i++)
+		if(!xml_cache_get_string(&pos, end, &string, NULL))
+		    return FALSE;
+	}
+	else if(type >= XML_CACHE_EVENT_END_TYPES ||
+		!xml_cache_get_string(&pos, end, &string, NULL))
+	    return FALSE;
+    }
+
+    return TRUE;
+}
+
+/** Find the file in the cache or read it.
+    @param file_name The definition file.
+    @param contents The struct to fill; it gets freed by xml_cache_parse().
+    @param error The error when the file can't be read.
+    @return TRUE on success, FALSE if the file can't be read. */
+gboolean
+xml_cache_get_contents(const gchar *file_name, XmlCacheContents *contents,
+		       GError **error)
+{
+#ifdef DEBUG
+    printf("xml_cache_get_contents\n");
+#endif
+
+    XmlCacheEntry *entry;
+    GStatBuf buf;
+    gchar *dir;
+
+    memset(contents, 0, sizeof(XmlCacheContents));
+    contents->size = contents->mtime = -1;
+
+    /* Like g_file_get_contents(), fail without an error
+       if the file wasn't found in the support directories. */
+    if(file_name == NULL)
+	return FALSE;
+
+    if(xml_cache_entries == NULL)
+	xml_cache_load();
+
+    if(g_path_is_absolute(file_name))
+	contents->file_name = g_strdup(file_name);
+    else
+    {
+	dir = g_get_current_dir();
+	contents->file_name = g_build_filename(dir, file_name, NULL);
+	g_free(dir);
+    }
+
+    if(g_stat(file_name, &buf) == 0)
+    {
+	contents->size = buf.st_size;
+	contents->mtime = buf.st_mtime;
+
+	entry = (XmlCacheEntry*)g_hash_table_lookup(xml_cache_entries,
+						    contents->file_name);
+	if(entry != NULL &&
+	   entry->size == contents->size && entry->mtime == contents->mtime)
+	{
+	    if(xml_cache_check_events(entry))
+	    {
+		contents->entry = entry;
+		return TRUE;
+	    }
+
+	    g_hash_table_remove(xml_cache_entries, contents->file_name);
+	}
+    }
+
+    if(!g_file_get_contents(file_name, &contents->contents,
+			    &contents->length, error))
+    {
+	g_free(contents->file_name);
+	contents->file_name = NULL;
+	return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void
+xml_cache_record_start_element(GMarkupParseContext *context,
+			       const gchar *element_name,
+			       const gchar **attribute_names,
+			       const gchar **attribute_values,
+			       gpointer user_data,
+			       GError **error)
+{
+    XmlCacheRecorder *recorder = (XmlCacheRecorder*)user_data;
+    gint i, attributes = 0;
+
+    while(attribute_names[attributes] != NULL)
+	attributes++;
+
+    xml_cache_put_int(recorder->events, XML_CACHE_EVENT_START);
+    xml_cache_put_int(recorder->events, attributes);
+    xml_cache_put_string(recorder->events, element_name, strlen(element_name));
+    for(i=0;i<attributes;i++)
+    {
+	xml_cache_put_string(recorder->events, attribute_names[i],
+			     strlen(attribute_names[i]));
+	xml_cache_put_string(recorder->events, attribute_values[i],
+			     strlen(attribute_values[i]));
+    }
+
+    if(recorder->parser->start_element != NULL)
+	recorder->parser->start_element(context, element_name, attribute_names,
+					attribute_values, recorder->user_data, error);
+}
+
+static void
+xml_cache_record_end_element(GMarkupParseContext *context,
+			     const gchar *element_name,
+			     gpointer user_data,
+			     GError **error)
+{
+    XmlCacheRecorder *recorder = (XmlCacheRecorder*)user_data;
+
+    xml_cache_put_int(recorder->events, XML_CACHE_EVENT_END);
+    xml_cache_put_string(recorder->events, element_name, strlen(element_name));
+
+    if(recorder->parser->end_element != NULL)
+	recorder->parser->end_element(context, element_name,
+				      recorder->user_data, error);
+}
+
+static void
+xml_cache_record_text(GMarkupParseContext *context,
+		      const gchar *text,
+		      gsize text_len,
+		      gpointer user_data,
+		      GError **error)
+{
+    XmlCacheRecorder *recorder = (XmlCacheRecorder*)user_data;
+
+    xml_cache_put_int(recorder->events, XML_CACHE_EVENT_TEXT);
+    xml_cache_put_string(recorder->events, text, text_len);
+
+    if(recorder->parser->text != NULL)
+	recorder->parser->text(context, text, text_len,
+			       recorder->user_data, error);
+}
+
+/** Parse the file contents, recording the events
+    and adding them to the cache if everything went well. */
+static gboolean
+xml_cache_record(XmlCacheContents *contents, const GMarkupParser *parser,
+		 gpointer user_data, GError **error)
+{
+    GMarkupParser recording = {xml_cache_record_start_element,
+			       xml_cache_record_end_element,
+			       xml_cache_record_text, NULL, NULL};
+    XmlCacheRecorder recorder = {parser, user_data, g_byte_array_new()};
+    GMarkupParseContext *context =
+	g_markup_parse_context_new(&recording, 0, &recorder, NULL);
+    XmlCacheEntry *entry;
+    gboolean success =
+	g_markup_parse_context_parse(context, contents->contents,
+				     contents->length, error);
+
+    if(success && g_markup_parse_context_end_parse(context, NULL) &&
+       contents->size >= 0)
+    {
+	entry = g_new0(XmlCacheEntry, 1);
+	entry->file_name = g_strdup(contents->file_name);
+	entry->size = contents->size;
+	entry->mtime = contents->mtime;
+	entry->recorded = recorder.events;
+	entry->events = (const gchar*)recorder.events->data;
+	entry->length = recorder.events->len;
+
+	g_hash_table_replace(xml_cache_entries, entry->file_name, entry);
+	xml_cache_dirty = TRUE;
+    }
+    else
+	g_byte_array_free(recorder.events, TRUE);
+
+    g_markup_parse_context_free(context);
+
+    return success;
+}
+
+/** Pass the recorded events of the entry to the parser callbacks. */
+static gboolean
+xml_cache_replay(const XmlCacheEntry *entry, const GMarkupParser *parser,
+		 gpointer user_data, GError **error)
+{
+    const gchar *pos = entry->events,
+	*end = entry->events + entry->length,
+	*name;
+    guint32 type, attributes, i;
+    gsize length;
+    GError *callback_error = NULL;
+
+    while(pos < end && callback_error == NULL)
+    {
+	xml_cache_get_int(&pos, end, &type);
+
+	if(type == XML_CACHE_EVENT_START)
+	{
+	    xml_cache_get_int(&pos, end, &attributes);
+	    xml_cache_get_string(&pos, end, &name, NULL);
+	    {
+		const gchar *attribute_names[attributes + 1],
+		    *attribute_values[attributes + 1];
+
+		for(i=0;i<attributes;i++)
+		{
+		    xml_cache_get_string(&pos, end, &attribute_names[i], NULL);
+		    xml_cache_get_string(&pos, end, &attribute_values[i], NULL);
+		}
+		attribute_names[attributes] = attribute_values[attributes] = NULL;
+
+		if(parser->start_element != NULL)
+		    parser->start_element(NULL, name, attribute_names,
+					  attribute_values, user_data,
+					  &callback_error);
+	    }
+	}
+	else if(type == XML_CACHE_EVENT_END)
+	{
+	    xml_cache_get_string(&pos, end, &name, NULL);
+	    if(parser->end_element != NULL)
+		parser->end_element(NULL, name, user_data, &callback_error);
+	}
+	else
+	{
+	    xml_cache_get_string(&pos, end, &name, &length);
+	    if(parser->text != NULL)
+		parser->text(NULL, name, length, user_data, &callback_error);
+	}
+    }
+
+    if(callback_error != NULL)
+    {
+	g_propagate_error(error, callback_error);
+	return FALSE;
+    }
+
+    return TRUE;
+}
+
+/** Pass the definition file to the parser callbacks, either
+    by replaying the cached events or by parsing the file.
+    The parser callbacks don't get a parse context when the
+    events are replayed.
+    @param contents The contents from xml_cache_get_contents(); they
+    get freed.
+    @return TRUE on success, FALSE if there was a parse error. */
+gboolean
+xml_cache_parse(XmlCacheContents *contents, const GMarkupParser *parser,
+		gpointer user_data, GError **error)
+{
+#ifdef DEBUG
+    printf("xml_cache_parse\n");
+#endif
+
+    gboolean success = (contents->entry != NULL) ?
+	xml_cache_replay(contents->entry, parser, user_data, error) :
+	xml_cache_record(contents, parser, user_data, error);
+
+    g_free(contents->file_name);
+    g_free(contents->contents);
+    memset(contents, 0, sizeof(XmlCacheContents));
+
+    return success;
+}
+
+/** Write the cache file if something new was recorded.
+    Entries of files that don't exist anymore get dropped. */
+void
+xml_cache_save(void)
+{
+#ifdef DEBUG
+    printf("xml_cache_save\n");
+#endif
+
+    gchar *file_name;
+    GByteArray *data;
+    GHashTableIter iter;
+    XmlCacheEntry *entry;
+    guint32 count = 0;
+    gsize count_pos;
+    GError *error = NULL;
+
+    if(!xml_cache_dirty)
+	return;
+
+    xml_cache_dirty = FALSE;
+    file_name = xml_cache_get_file_name();
+    if(file_name == NULL)
+	return;
+
+    data = g_byte_array_new();
+    g_byte_array_append(data, (const guint8*)XML_CACHE_MAGIC,
+			strlen(XML_CACHE_MAGIC));
+    xml_cache_put_int(data, XML_CACHE_VERSION);
+    xml_cache_put_int(data, XML_CACHE_BYTE_ORDER);
+    count_pos = data->len;
+    xml_cache_put_int(data, 0);
+
+    g_hash_table_iter_init(&iter, xml_cache_entries);
+    while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&entry))
+    {
+	if(!g_file_test(entry->file_name, G_FILE_TEST_EXISTS))
+	    continue;
+
+	xml_cache_put_string(data, entry->file_name, strlen(entry->file_name));
+	g_byte_array_append(data, (const guint8*)&entry->size, sizeof(gint64));
+	g_byte_array_append(data, (const guint8*)&entry->mtime, sizeof(gint64));
+	xml_cache_put_int(data, entry->length);
+	g_byte_array_append(data, (const guint8*)entry->events, entry->length);
+	count++;
+    }
+
+    memcpy(data->data + count_pos, &count, sizeof(guint32));
+
+    /* The file gets replaced, so the mapping of the
+       old one stays valid. */
+    if(!g_file_set_contents(file_name, (const gchar*)data->data,
+			    data->len, &error))
+    {
+	debug_print_message("xml_cache_save: can't write the definitions cache %s\n",
+			    file_name);
+	misc_print_error(&error, FALSE);
+    }
+
+    g_byte_array_free(data, TRUE);
+    g_free(file_name);
+}
+
+/** Save the cache if necessary and free it. */
+void
+xml_cache_free(void)
+{
+#ifdef DEBUG
+    printf("xml_cache_free\n");
+#endif
+
+    if(xml_cache_entries == NULL)
+	return;
+
+    xml_cache_save();
+
+    g_hash_table_destroy(xml_cache_entries);
+    xml_cache_entries = NULL;
+
+    if(xml_cache_map != NULL)
+    {
+	g_mapped_file_unref(xml_cache_map);
+	xml_cache_map = NULL;
+    }
+}
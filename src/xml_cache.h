@@ -0,0 +1,77 @@
+/*
+   xml_cache.h
+
+   Bygfoot Football Manager -- a small and simple GTK2-based
+   football management game.
+
+   http://bygfoot.sourceforge.net
+
+   Copyright (C) 2005  Gyözö Both (gyboth@bygfoot.com)
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef XML_CACHE_H
+#define XML_CACHE_H
+
+#include "bygfoot.h"
+
+/** The cache file in the Bygfoot directory.
+    @see file_get_bygfoot_dir() */
+#define XML_CACHE_FILE "definitions.cache"
+
+/** Cache files with a different version get ignored. */
+#define XML_CACHE_VERSION 1
+
+/** The parser events recorded for a definition file. */
+typedef struct
+{
+    gchar *file_name;
+    /** Size and modification time of the file
+	when it was recorded. */
+    gint64 size, mtime;
+    /** The events, either in the mapped cache file
+	or in the recorded array. */
+    const gchar *events;
+    gsize length;
+    GByteArray *recorded;
+} XmlCacheEntry;
+
+/** A definition file about to be parsed: either
+    the cache entry or the contents of the file. */
+typedef struct
+{
+    gchar *file_name;
+    const XmlCacheEntry *entry;
+    gchar *contents;
+    gsize length;
+    gint64 size, mtime;
+} XmlCacheContents;
+
+gboolean
+xml_cache_get_contents(const gchar *file_name, XmlCacheContents *contents,
+		       GError **error);
+
+gboolean
+xml_cache_parse(XmlCacheContents *contents, const GMarkupParser *parser,
+		gpointer user_data, GError **error);
+
+void
+xml_cache_save(void);
+
+void
+xml_cache_free(void);
+
+#endif
@@ -28,6 +28,7 @@
 #include "misc.h"
 #include "option.h"
 #include "variables.h"
+#include "xml_cache.h"
 #include "xml_cup.h"
 #include "xml_country.h"
 #include "xml_league.h"
@@ -193,13 +194,13 @@ xml_country_read_text         (GMarkupParseContext *context,
 	misc_string_assign(&cntry->sid, buf);
     else if(state == STATE_SUPERNATIONAL && cntry == &country)
     {
-	sett_set_int("int_opt_disable_finances", 1);
-	sett_set_int("int_opt_disable_transfers", 1);
-	sett_set_int("int_opt_disable_stadium", 1);
-	sett_set_int("int_opt_disable_contracts", 1);
-	sett_set_int("int_opt_disable_boost_on", 1);
-	sett_set_int("int_opt_disable_ya", 1);
-	sett_set_int("int_opt_disable_training_camp", 1);//***ML***
+	sett_set_int(int_opt_disable_finances, 1);
+	sett_set_int(int_opt_disable_transfers, 1);
+	sett_set_int(int_opt_disable_stadium, 1);
+	sett_set_int(int_opt_disable_contracts, 1);
+	sett_set_int(int_opt_disable_boost_on, 1);
+	sett_set_int(int_opt_disable_ya, 1);
+	sett_set_int(int_opt_disable_training_camp, 1);//***ML***
     }
     else if(state == STATE_LEAGUE)
 	xml_league_read(buf, cntry);
@@ -238,23 +239,18 @@ xml_country_read(const gchar *country_name, Country *cntry_arg,
     GMarkupParser parser = {xml_country_read_start_element,
 			    xml_country_read_end_element,
 			    xml_country_read_text, NULL, NULL};
-    GMarkupParseContext *context;
-    gchar *file_contents;
-    gsize length;
+    XmlCacheContents contents;
     GError *error = NULL;
     gchar buf[SMALL];
     gint i;
 
-    context = 
-	g_markup_parse_context_new(&parser, 0, NULL, NULL);
-
     if(file_name == NULL)
     {
 	sprintf(buf, "country_%s.xml", country_name);
 	file_name = file_find_support_file(buf, TRUE);
     }
 	
-    if(!g_file_get_contents(file_name, &file_contents, &length, &error))
+    if(!xml_cache_get_contents(file_name, &contents, &error))
     {
 	debug_print_message("xml_country_read: error reading file %s\n", file_name);
 	misc_print_error(&error, TRUE);
@@ -271,23 +267,17 @@ xml_country_read(const gchar *country_name, Country *cntry_arg,
 
     if(cntry_arg == NULL)
     {
-	sett_set_int("int_opt_disable_finances", 0);
-	sett_set_int("int_opt_disable_transfers", 0);
-	sett_set_int("int_opt_disable_stadium", 0);
-	sett_set_int("int_opt_disable_contracts", 0);
-	sett_set_int("int_opt_disable_boost_on", 0);
-	sett_set_int("int_opt_disable_ya", 0);
-	sett_set_int("int_opt_disable_training_camp", 0); //***ML***
+	sett_set_int(int_opt_disable_finances, 0);
+	sett_set_int(int_opt_disable_transfers, 0);
+	sett_set_int(int_opt_disable_stadium, 0);
+	sett_set_int(int_opt_disable_contracts, 0);
+	sett_set_int(int_opt_disable_boost_on, 0);
+	sett_set_int(int_opt_disable_ya, 0);
+	sett_set_int(int_opt_disable_training_camp, 0); //***ML***
     }
 
     cntry->bygfoot = bygfoot;
-    if(g_markup_parse_context_parse(context, file_contents, length, &error))
-    {
-	g_markup_parse_context_end_parse(context, NULL);	
-	g_markup_parse_context_free(context);
-	g_free(file_contents);
-    }
-    else
+    if(!xml_cache_parse(&contents, &parser, NULL, &error))
     {
 	g_critical("xml_country_read: error parsing file %s\n", buf);
 	misc_print_error(&error, TRUE);
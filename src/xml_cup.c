@@ -29,7 +29,9 @@
 #include "main.h"
 #include "misc.h"
 #include "option.h"
+#include "registry.h"
 #include "variables.h"
+#include "xml_cache.h"
 #include "xml_cup.h"
 #include "xml.h"
 
@@ -516,23 +518,18 @@ xml_cup_read(const gchar *cup_name, GPtrArray *cups, Bygfoot *bygfoot)
     GMarkupParser parser = {xml_cup_read_start_element,
 			    xml_cup_read_end_element,
 			    xml_cup_read_text, NULL, NULL};
-    GMarkupParseContext *context;
-    gchar *file_contents;
-    gsize length;
+    XmlCacheContents contents;
     GError *error = NULL;
     gchar buf[SMALL];
     gint i;
 
-    context = 
-	g_markup_parse_context_new(&parser, 0, bygfoot, NULL);
-
     if(file_name == NULL)
     {
 	sprintf(buf, "cup_%s.xml", cup_name);
 	file_name = file_find_support_file(buf, TRUE);
     }
 
-    if(!g_file_get_contents(file_name, &file_contents, &length, &error))
+    if(!xml_cache_get_contents(file_name, &contents, &error))
     {
 	debug_print_message("xml_cup_read: error reading file %s\n", file_name);
 	misc_print_error(&error, FALSE);
@@ -543,13 +540,7 @@ xml_cup_read(const gchar *cup_name, GPtrArray *cups, Bygfoot *bygfoot)
     strcpy(buf, file_name);
     g_free(file_name);
 
-    if(g_markup_parse_context_parse(context, file_contents, length, &error))
-    {
-	g_markup_parse_context_end_parse(context, NULL);	
-	g_markup_parse_context_free(context);
-	g_free(file_contents);
-    }
-    else
+    if(!xml_cache_parse(&contents, &parser, bygfoot, &error))
     {
 	g_critical("xml_cup_read: error parsing file %s\n", buf);
 	misc_print_error(&error, TRUE);
@@ -565,4 +556,5 @@ xml_cup_read(const gchar *cup_name, GPtrArray *cups, Bygfoot *bygfoot)
         }
 
     g_ptr_array_add(cups, new_cup);
+    registry_invalidate();
 }
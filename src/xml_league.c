@@ -28,10 +28,13 @@
 #include "free.h"
 #include "league.h"
 #include "misc.h"
+#include "name.h"
 #include "option.h"
+#include "registry.h"
 #include "team.h"
 #include "table.h"
 #include "variables.h"
+#include "xml_cache.h"
 #include "xml_league.h"
 #include "xml_cup.h"
 #include "xml.h"
@@ -429,7 +432,7 @@ xml_league_read_text         (GMarkupParseContext *context,
 	new_league.c.yellow_red = int_value;
     else if(state == STATE_AVERAGE_TALENT)
 	new_league.average_talent = 
-	    (float_value / 10000) * const_float_fast(float_player_max_skill);
+	    (float_value / 10000) * const_float(float_player_max_skill);
     else if(state == STATE_NAMES_FILE)
 	misc_string_assign(&new_league.names_file, buf);
     else if(state == STATE_BREAK)
@@ -497,14 +500,14 @@ xml_league_read_text         (GMarkupParseContext *context,
 			  new_league.prom_rel.elements->len - 1).type = PROM_REL_RELEGATION;
     }	
     else if(state == STATE_TEAM_NAME)
-	misc_string_assign(&league_user_data->new_team->name, buf);
+	league_user_data->new_team->name = name_intern(buf);
     else if(state == STATE_TEAM_SYMBOL)
 	misc_string_assign(&league_user_data->new_team->symbol, buf);
     else if(state == STATE_TEAM_NAMES_FILE)
 	misc_string_assign(&league_user_data->new_team->names_file, buf);
     else if(state == STATE_TEAM_AVERAGE_TALENT)
 	league_user_data->new_team->average_talent = 
-	    (float_value / 10000) * const_float_fast(float_player_max_skill);
+	    (float_value / 10000) * const_float(float_player_max_skill);
     else if(state == STATE_TEAM_DEF_FILE)
 	misc_string_assign(&league_user_data->new_team->def_file, buf);
     else if(state == STATE_TEAM_FIRST_TEAM)
@@ -534,9 +537,7 @@ xml_league_read(const gchar *league_name, Country *country)
     GMarkupParser parser = {xml_league_read_start_element,
 			    xml_league_read_end_element,
 			    xml_league_read_text, NULL, NULL};
-    GMarkupParseContext *context;
-    gchar *file_contents;
-    gsize length;
+    XmlCacheContents contents;
     GError *error = NULL;
     gchar buf[SMALL];
     LeagueUserData user_data;
@@ -544,16 +545,13 @@ xml_league_read(const gchar *league_name, Country *country)
     memset(&user_data, 0, sizeof(user_data));
     user_data.country = country;
 
-    context = 
-	g_markup_parse_context_new(&parser, 0, &user_data, NULL);
-
     if(file_name == NULL)
     {
 	sprintf(buf, "league_%s.xml", league_name);
 	file_name = file_find_support_file(buf, TRUE);
     }
 
-    if(!g_file_get_contents(file_name, &file_contents, &length, &error))
+    if(!xml_cache_get_contents(file_name, &contents, &error))
     {
 	debug_print_message("xml_league_read: error reading file %s\n", file_name);
 	misc_print_error(&error, FALSE);
@@ -564,13 +562,10 @@ xml_league_read(const gchar *league_name, Country *country)
     strcpy(buf, file_name);
     g_free(file_name);
 
-    if(g_markup_parse_context_parse(context, file_contents, length, &error))
+    if(xml_cache_parse(&contents, &parser, &user_data, &error))
     {
         gint i;
         League *new_league_ptr;
-	g_markup_parse_context_end_parse(context, NULL);	
-	g_markup_parse_context_free(context);
-	g_free(file_contents);
 
         league_cup_adjust_rr_breaks(new_league.rr_breaks, new_league.round_robins, new_league.week_gap);
         league_cup_adjust_week_breaks(new_league.week_breaks, new_league.week_gap);
@@ -578,6 +573,7 @@ xml_league_read(const gchar *league_name, Country *country)
         *new_league_ptr = new_league;
 
 	g_ptr_array_add(country->leagues, new_league_ptr);
+	registry_invalidate();
 
         for (i = 0; i < new_league.prom_rel.elements->len; i++) {
             PromRelElement *elem = &g_array_index(new_league.prom_rel.elements,
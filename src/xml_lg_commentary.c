@@ -27,6 +27,7 @@
 #include "lg_commentary.h"
 #include "live_game.h"
 #include "misc.h"
+#include "token.h"
 #include "variables.h"
 #include "xml_lg_commentary.h"
 
@@ -275,6 +276,9 @@ xml_lg_commentary_read_text         (GMarkupParseContext *context,
     {
 	misc_string_assign(&commentary.text, buf);
 	commentary.condition = condition;
+	commentary.parsed_text = token_text_compile(buf);
+	commentary.parsed_condition = (condition == NULL) ?
+	    NULL : token_condition_compile(condition);
 	commentary.priority = MAX(1, priority);
 	commentary.id = lg_commentary_id_new;
 	g_array_append_val(lg_commentary[commentary_idx], commentary);
@@ -392,7 +392,7 @@ xml_loadsave_cup_read(const gchar *filename, Cup *cup)
     context = 
 	g_markup_parse_context_new(&parser, 0, NULL, NULL);
 
-    if(!g_file_get_contents(filename, &file_contents, &length, &error))
+    if(!file_get_contents(filename, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_cup_read: error reading file %s\n", filename);
 	misc_print_error(&error, TRUE);
@@ -425,15 +425,14 @@ xml_loadsave_cup_write(const gchar *prefix, const Cup *cup)
 
     gint i;
     gchar buf[SMALL];
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
 
     sprintf(buf, "%s___cup_%d_fixtures.xml", prefix, cup->c.id);
     xml_loadsave_fixtures_write(buf, cup->fixtures);
 
     sprintf(buf, "%s___cup_%d.xml", prefix, cup->c.id);
-    file_my_fopen(buf, "w", &fil, TRUE);
 
-    fprintf(fil, "<_%d>\n", TAG_CUP);
+    g_string_append_printf(fil, "<_%d>\n", TAG_CUP);
 
     xml_write_string(fil, cup->c.name, TAG_NAME, I0);
     xml_write_string(fil, cup->short_name, TAG_SHORT_NAME, I0);
@@ -475,26 +474,26 @@ xml_loadsave_cup_write(const gchar *prefix, const Cup *cup)
 	    xml_write_int(fil, ((Team*)g_ptr_array_index(cup->bye, i))->id,
 			  TAG_CUP_TEAM_ID_BYE, I1);
 
-    fprintf(fil, "<_%d>\n", TAG_CUP_HISTORY);
+    g_string_append_printf(fil, "<_%d>\n", TAG_CUP_HISTORY);
     for (i = 0; i < cup->history->len; i++) {
         int j;
         GPtrArray *season = g_ptr_array_index(cup->history, i);
-        fprintf(fil, "<_%d>\n", TAG_CUP_HISTORY_SEASON);
+        g_string_append_printf(fil, "<_%d>\n", TAG_CUP_HISTORY_SEASON);
         for (j = 0; j < season->len; j++) {
             const Team *team = g_ptr_array_index(season, j);
             xml_write_int(fil, team->id, TAG_CUP_HISTORY_TEAM_PTR_ID, I1);
         }
-        fprintf(fil, "</_%d>\n", TAG_CUP_HISTORY_SEASON);
+        g_string_append_printf(fil, "</_%d>\n", TAG_CUP_HISTORY_SEASON);
     }
-    fprintf(fil, "</_%d>\n", TAG_CUP_HISTORY);
+    g_string_append_printf(fil, "</_%d>\n", TAG_CUP_HISTORY);
 
-    fprintf(fil, "</_%d>\n", TAG_CUP);
+    g_string_append_printf(fil, "</_%d>\n", TAG_CUP);
 
-    fclose(fil);
+    file_write_contents(buf, fil);
 }
 
 void
-xml_loadsave_cup_write_round(FILE *fil, const gchar *prefix, const Cup *cup, gint round)
+xml_loadsave_cup_write_round(GString *fil, const gchar *prefix, const Cup *cup, gint round)
 {
 #ifdef DEBUG
     printf("xml_loadsave_cup_write_round\n");
@@ -505,7 +504,7 @@ xml_loadsave_cup_write_round(FILE *fil, const gchar *prefix, const Cup *cup, gin
     const CupRound *cup_round = &g_array_index(cup->rounds, CupRound, round);
     gchar *basename = g_path_get_basename(prefix);
 
-    fprintf(fil, "<_%d>\n", TAG_CUP_ROUND);
+    g_string_append_printf(fil, "<_%d>\n", TAG_CUP_ROUND);
 
     xml_write_string(fil, cup_round->name,
                      TAG_CUP_ROUND_NAME, I1);
@@ -572,20 +571,20 @@ xml_loadsave_cup_write_round(FILE *fil, const gchar *prefix, const Cup *cup, gin
 	xml_write_int(fil, ((Team*)g_ptr_array_index(cup_round->team_ptrs, i))->id,
 		      TAG_CUP_ROUND_TEAM_PTR_ID, I1);
     
-    fprintf(fil, "</_%d>\n", TAG_CUP_ROUND);
+    g_string_append_printf(fil, "</_%d>\n", TAG_CUP_ROUND);
 
     g_free(basename);
 }
 
 
 void
-xml_loadsave_cup_write_choose_team(FILE *fil, const CupChooseTeam *choose_team, gboolean is_alternative)
+xml_loadsave_cup_write_choose_team(GString *fil, const CupChooseTeam *choose_team, gboolean is_alternative)
 {
 #ifdef DEBUG
     printf("xml_loadsave_cup_write_choose_team\n");
 #endif
 
-    fprintf(fil, "%s<_%d>\n", I1, TAG_CUP_CHOOSE_TEAM);
+    g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_CUP_CHOOSE_TEAM);
     
     xml_write_string(fil, choose_team->sid, TAG_CUP_CHOOSE_TEAM_SID, I2);
     xml_write_int(fil, choose_team->number_of_teams, 
@@ -610,12 +609,12 @@ xml_loadsave_cup_write_choose_team(FILE *fil, const CupChooseTeam *choose_team,
 
     if (choose_team->next) {
         if (!is_alternative)
-            fprintf(fil, "%s<_%d>\n", I1, TAG_CUP_CHOOSE_TEAM_ALTERNATIVES);
+            g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_CUP_CHOOSE_TEAM_ALTERNATIVES);
 
         xml_loadsave_cup_write_choose_team(fil, choose_team->next, TRUE);
 
         if (!is_alternative)
-            fprintf(fil, "%s</_%d>\n", I1, TAG_CUP_CHOOSE_TEAM_ALTERNATIVES);
+            g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_CUP_CHOOSE_TEAM_ALTERNATIVES);
     }
-    fprintf(fil, "%s</_%d>\n", I1, TAG_CUP_CHOOSE_TEAM);
+    g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_CUP_CHOOSE_TEAM);
 }
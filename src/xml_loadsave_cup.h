@@ -36,10 +36,10 @@ void
 xml_loadsave_cup_write(const gchar *prefix, const Cup *cup);
 
 void
-xml_loadsave_cup_write_round(FILE *fil, const gchar *prefix, const Cup *cup, gint round);
+xml_loadsave_cup_write_round(GString *fil, const gchar *prefix, const Cup *cup, gint round);
 
 void
-xml_loadsave_cup_write_choose_team(FILE *fil, const CupChooseTeam *choose_team,
+xml_loadsave_cup_write_choose_team(GString *fil, const CupChooseTeam *choose_team,
                                    gboolean is_alternative);
 
 #endif
@@ -112,6 +112,7 @@ xml_loadsave_fixtures_end_element    (GMarkupParseContext *context,
     {
 	state = TAG_FIXTURES;
 	g_array_append_val(fixtures_array, new_fixture);
+	fixture_schedule_invalidate();
     }
     else if(tag == TAG_FIXTURE_REPLAY_NUMBER ||
 	    tag == TAG_FIXTURE_ID ||
@@ -205,7 +206,7 @@ xml_loadsave_fixtures_read(const gchar *filename, Competition *competition,
     context = 
 	g_markup_parse_context_new(&parser, 0, &user_data, NULL);
 
-    if(!g_file_get_contents(filename, &file_contents, &length, &error))
+    if(!file_get_contents(filename, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_fixtures_read: error reading file %s\n", filename);
 	misc_print_error(&error, TRUE);
@@ -234,15 +235,13 @@ xml_loadsave_fixtures_write(const gchar *filename, const GArray *fixtures)
 #endif
 
     gint i, j;
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
 
-    file_my_fopen(filename, "w", &fil, TRUE);
-
-    fprintf(fil, "<_%d>\n", TAG_FIXTURES);
+    g_string_append_printf(fil, "<_%d>\n", TAG_FIXTURES);
 
     for(i=0;i<fixtures->len;i++)
     {
-	fprintf(fil, "<_%d>\n", TAG_FIXTURE);
+	g_string_append_printf(fil, "<_%d>\n", TAG_FIXTURE);
     /* Keep this for backwards compatibility. */
 	xml_write_int(fil, g_array_index(fixtures, Fixture, i).competition->id, TAG_ID, I1);
 	xml_write_int(fil, g_array_index(fixtures, Fixture, i).round, TAG_ROUND, I1);
@@ -275,9 +274,9 @@ xml_loadsave_fixtures_write(const gchar *filename, const GArray *fixtures)
                           TAG_TEAM_ID, I1);
 	}
 
-	fprintf(fil, "</_%d>\n", TAG_FIXTURE);
+	g_string_append_printf(fil, "</_%d>\n", TAG_FIXTURE);
     }
-    fprintf(fil, "</_%d>\n", TAG_FIXTURES);
+    g_string_append_printf(fil, "</_%d>\n", TAG_FIXTURES);
 
-    fclose(fil);
+    file_write_contents(filename, fil);
 }
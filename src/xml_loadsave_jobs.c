@@ -174,7 +174,7 @@ xml_loadsave_jobs_read(const gchar *dirname, const gchar *basename)
     context = 
 	g_markup_parse_context_new(&parser, 0, NULL, NULL);
 
-    if(!g_file_get_contents(file, &file_contents, &length, &error))
+    if(!file_get_contents(file, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_jobs_read: error reading file %s\n", file);
 	misc_print_error(&error, TRUE);
@@ -202,16 +202,15 @@ xml_loadsave_jobs_write(const gchar *prefix)
 
     gint i;
     gchar buf[SMALL];
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
 
     sprintf(buf, "%s___jobs.xml", prefix);
-    file_my_fopen(buf, "w", &fil, TRUE);
 
-    fprintf(fil, "<_%d>\n", TAG_JOBS);
+    g_string_append_printf(fil, "<_%d>\n", TAG_JOBS);
 
     for(i=0;i<jobs->len;i++)
     {
-	fprintf(fil, "<_%d>\n", TAG_JOB);
+	g_string_append_printf(fil, "<_%d>\n", TAG_JOB);
 
 	xml_write_int(fil, g_array_index(jobs, Job, i).type, 
 		      TAG_JOB_TYPE, I1);
@@ -240,10 +239,10 @@ xml_loadsave_jobs_write(const gchar *prefix)
 	xml_write_int(fil, g_array_index(jobs, Job, i).team_id, 
 		      TAG_JOB_TEAM_ID, I1);
 
-	fprintf(fil, "</_%d>\n", TAG_JOB);
+	g_string_append_printf(fil, "</_%d>\n", TAG_JOB);
     }
 
-    fprintf(fil, "</_%d>\n", TAG_JOBS);
+    g_string_append_printf(fil, "</_%d>\n", TAG_JOBS);
 
-    fclose(fil);
+    file_write_contents(buf, fil);
 }
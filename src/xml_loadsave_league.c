@@ -335,7 +335,7 @@ xml_loadsave_league_read(const gchar *filename, const gchar *team_file, League *
     context = 
 	g_markup_parse_context_new(&parser, 0, NULL, NULL);
 
-    if(!g_file_get_contents(filename, &file_contents, &length, &error))
+    if(!file_get_contents(filename, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_league_read: error reading file %s\n", filename);
 	misc_print_error(&error, TRUE);
@@ -375,7 +375,7 @@ xml_loadsave_league_write(const gchar *prefix, const League *league)
 
     gint i;
     gchar buf[SMALL];
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
     gchar *basename = g_path_get_basename(prefix);
 
     sprintf(buf, "%s___league_%d_teams.xml", prefix, league->c.id);
@@ -387,10 +387,7 @@ xml_loadsave_league_write(const gchar *prefix, const League *league)
     sprintf(buf, "%s___league_%d_stat.xml", prefix, league->c.id);
     xml_loadsave_league_stat_write(buf, &league->stats);
 
-    sprintf(buf, "%s___league_%d.xml", prefix, league->c.id);
-    file_my_fopen(buf, "w", &fil, TRUE);
-
-    fprintf(fil, "%s<_%d>\n", I0, TAG_LEAGUE);
+    g_string_append_printf(fil, "%s<_%d>\n", I0, TAG_LEAGUE);
 
     xml_write_string(fil, league->c.name, TAG_NAME, I0);
     xml_write_string(fil, league->short_name, TAG_SHORT_NAME, I0);
@@ -455,22 +452,23 @@ xml_loadsave_league_write(const gchar *prefix, const League *league)
 
     xml_loadsave_league_prom_rel_write(fil, league);
 
-    fprintf(fil, "%s</_%d>\n", I0, TAG_LEAGUE);
+    g_string_append_printf(fil, "%s</_%d>\n", I0, TAG_LEAGUE);
 
-    fclose(fil);
+    sprintf(buf, "%s___league_%d.xml", prefix, league->c.id);
+    file_write_contents(buf, fil);
 }
 
 /** Write the prom_rel data into the file. */
 void
-xml_loadsave_league_prom_rel_write(FILE *fil, const League *league)
+xml_loadsave_league_prom_rel_write(GString *fil, const League *league)
 {
     gint i;
 
-    fprintf(fil, "%s<_%d>\n", I0, TAG_LEAGUE_PROM_REL);
+    g_string_append_printf(fil, "%s<_%d>\n", I0, TAG_LEAGUE_PROM_REL);
 
     for(i = 0; i < league->prom_rel.prom_games->len; i++)
     {
-        fprintf(fil, "%s<_%d>\n", I1, TAG_LEAGUE_PROM_GAMES);
+        g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_LEAGUE_PROM_GAMES);
 
         xml_write_string(fil, g_array_index(league->prom_rel.prom_games, PromGames, i).dest_sid,
                          TAG_LEAGUE_PROM_REL_PROM_GAMES_DEST_SID, I2);
@@ -485,13 +483,13 @@ xml_loadsave_league_prom_rel_write(FILE *fil, const League *league)
 	xml_write_int(fil, g_array_index(league->prom_rel.prom_games, PromGames, i).ranks[1],
 		      TAG_LEAGUE_PROM_REL_PROM_GAMES_RANK, I2);
         
-        fprintf(fil, "%s</_%d>\n", I1, TAG_LEAGUE_PROM_GAMES);
+        g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_LEAGUE_PROM_GAMES);
     }
 
-    fprintf(fil, "%s<_%d>\n", I1, TAG_LEAGUE_PROM_REL_ELEMENTS);
+    g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_LEAGUE_PROM_REL_ELEMENTS);
     for(i=0;i<league->prom_rel.elements->len;i++)
     {
-	fprintf(fil, "%s<_%d>\n", I1, TAG_LEAGUE_PROM_REL_ELEMENT);
+	g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_LEAGUE_PROM_REL_ELEMENT);
 	xml_write_int(fil, g_array_index(league->prom_rel.elements, PromRelElement, i).ranks[0],
 		      TAG_LEAGUE_PROM_REL_ELEMENT_RANK, I2);
 	xml_write_int(fil, g_array_index(league->prom_rel.elements, PromRelElement, i).ranks[1],
@@ -504,10 +502,10 @@ xml_loadsave_league_prom_rel_write(FILE *fil, const League *league)
 		      TAG_LEAGUE_PROM_REL_ELEMENT_FROM_TABLE, I2);
 	xml_write_string(fil, g_array_index(league->prom_rel.elements, PromRelElement, i).dest_sid,
 			   TAG_LEAGUE_PROM_REL_ELEMENT_DEST_SID, I2);
-	fprintf(fil, "%s</_%d>\n", I1, TAG_LEAGUE_PROM_REL_ELEMENT);
+	g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_LEAGUE_PROM_REL_ELEMENT);
     }
-    fprintf(fil, "%s</_%d>\n", I1, TAG_LEAGUE_PROM_REL_ELEMENTS);
+    g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_LEAGUE_PROM_REL_ELEMENTS);
 
-    fprintf(fil, "%s</_%d>\n", I0, TAG_LEAGUE_PROM_REL);
+    g_string_append_printf(fil, "%s</_%d>\n", I0, TAG_LEAGUE_PROM_REL);
 
 }
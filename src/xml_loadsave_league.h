@@ -57,6 +57,6 @@ void
 xml_loadsave_league_read(const gchar *filename, const gchar *team_file, League *league);
 
 void
-xml_loadsave_league_prom_rel_write(FILE *fil, const League *league);
+xml_loadsave_league_prom_rel_write(GString *fil, const League *league);
 
 #endif
@@ -25,6 +25,7 @@
 
 #include "file.h"
 #include "misc.h"
+#include "name.h"
 #include "stat.h"
 #include "team.h"
 #include "xml.h"
@@ -167,7 +168,7 @@ xml_loadsave_league_stat_text         (GMarkupParseContext *context,
     else if(state == TAG_STAT_LEAGUE_SYMBOL)
 	lig_stat->league_symbol = g_strdup(buf);
     else if(state == TAG_STAT_TEAM_NAME)
-	new_stat.team_name = g_strdup(buf);
+	new_stat.team_name = name_intern(buf);
     else if(state == TAG_STAT_VALUE)
     {
 	if(valueidx == 0)
@@ -178,7 +179,7 @@ xml_loadsave_league_stat_text         (GMarkupParseContext *context,
 	    new_stat.value3 = xml_read_int(buf);
     }
     else if(state == TAG_STAT_VALUE_STRING)
-	new_stat.value_string = g_strdup(buf);
+	new_stat.value_string = name_intern(buf);
 }
 
 void
@@ -199,7 +200,7 @@ xml_loadsave_league_stat_read(const gchar *filename, LeagueStat *league_stat)
     context = 
 	g_markup_parse_context_new(&parser, 0, NULL, NULL);
 
-    if(!g_file_get_contents(filename, &file_contents, &length, &error))
+    if(!file_get_contents(filename, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_league_stat_read: error reading file %s\n", filename);
 	misc_print_error(&error, TRUE);
@@ -228,52 +229,50 @@ xml_loadsave_league_stat_write(const gchar *filename, const LeagueStat *league_s
 #endif
 
     gint i;
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
 
-    file_my_fopen(filename, "w", &fil, TRUE);
-
-    fprintf(fil, "<_%d>\n", TAG_LEAGUE_STAT);
+    g_string_append_printf(fil, "<_%d>\n", TAG_LEAGUE_STAT);
     
     xml_write_string(fil, league_stat->league_name, TAG_STAT_LEAGUE_NAME, I0);
     xml_write_string(fil, league_stat->league_symbol, TAG_STAT_LEAGUE_SYMBOL, I0);
 
-    fprintf(fil, "<_%d>\n", TAG_STAT_TEAMS_OFF);
+    g_string_append_printf(fil, "<_%d>\n", TAG_STAT_TEAMS_OFF);
     for(i=0;i<league_stat->teams_off->len;i++)
 	xml_loadsave_league_stat_write_stat(
 	    fil, &g_array_index(league_stat->teams_off, Stat, i));
-    fprintf(fil, "</_%d>\n", TAG_STAT_TEAMS_OFF);
+    g_string_append_printf(fil, "</_%d>\n", TAG_STAT_TEAMS_OFF);
 
-    fprintf(fil, "<_%d>\n", TAG_STAT_TEAMS_DEF);
+    g_string_append_printf(fil, "<_%d>\n", TAG_STAT_TEAMS_DEF);
     for(i=0;i<league_stat->teams_def->len;i++)
 	xml_loadsave_league_stat_write_stat(
 	    fil, &g_array_index(league_stat->teams_def, Stat, i));
-    fprintf(fil, "</_%d>\n", TAG_STAT_TEAMS_DEF);
+    g_string_append_printf(fil, "</_%d>\n", TAG_STAT_TEAMS_DEF);
 
-    fprintf(fil, "<_%d>\n", TAG_STAT_PLAYER_SCORERS);
+    g_string_append_printf(fil, "<_%d>\n", TAG_STAT_PLAYER_SCORERS);
     for(i=0;i<league_stat->player_scorers->len;i++)
 	xml_loadsave_league_stat_write_stat(
 	    fil, &g_array_index(league_stat->player_scorers, Stat, i));
-    fprintf(fil, "</_%d>\n", TAG_STAT_PLAYER_SCORERS);
+    g_string_append_printf(fil, "</_%d>\n", TAG_STAT_PLAYER_SCORERS);
 
-    fprintf(fil, "<_%d>\n", TAG_STAT_PLAYER_GOALIES);
+    g_string_append_printf(fil, "<_%d>\n", TAG_STAT_PLAYER_GOALIES);
     for(i=0;i<league_stat->player_goalies->len;i++)
 	xml_loadsave_league_stat_write_stat(
 	    fil, &g_array_index(league_stat->player_goalies, Stat, i));
-    fprintf(fil, "</_%d>\n", TAG_STAT_PLAYER_GOALIES);
+    g_string_append_printf(fil, "</_%d>\n", TAG_STAT_PLAYER_GOALIES);
 
-    fprintf(fil, "</_%d>\n", TAG_LEAGUE_STAT);
+    g_string_append_printf(fil, "</_%d>\n", TAG_LEAGUE_STAT);
 
-    fclose(fil);
+    file_write_contents(filename, fil);
 }
 
 void
-xml_loadsave_league_stat_write_stat(FILE *fil, const Stat *stat)
+xml_loadsave_league_stat_write_stat(GString *fil, const Stat *stat)
 {
 #ifdef DEBUG
     printf("xml_loadsave_league_stat_write_stat\n");
 #endif
 
-    fprintf(fil, "%s<_%d>\n", I1, TAG_STAT);
+    g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_STAT);
 
     xml_write_string(fil, stat->team_name, TAG_STAT_TEAM_NAME, I1);
     xml_write_int(fil, stat->value1, TAG_STAT_VALUE, I1);
@@ -281,5 +280,5 @@ xml_loadsave_league_stat_write_stat(FILE *fil, const Stat *stat)
     xml_write_int(fil, stat->value3, TAG_STAT_VALUE, I1);
     xml_write_string(fil, stat->value_string, TAG_STAT_VALUE_STRING, I1);
 
-    fprintf(fil, "%s</_%d>\n", I1, TAG_STAT);
+    g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_STAT);
 }
@@ -33,7 +33,7 @@ void
 xml_loadsave_league_stat_write(const gchar *filename, const LeagueStat *league_stat);
 
 void
-xml_loadsave_league_stat_write_stat(FILE *fil, const Stat *stat);
+xml_loadsave_league_stat_write_stat(GString *fil, const Stat *stat);
 
 void
 xml_loadsave_league_stat_start_element (GMarkupParseContext *context,
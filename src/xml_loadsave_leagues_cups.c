@@ -146,7 +146,7 @@ xml_loadsave_leagues_cups_read(Country *country, const gchar *dirname, const gch
     context = 
 	g_markup_parse_context_new(&parser, 0, country, NULL);
 
-    if(!g_file_get_contents(file, &file_contents, &length, &error))
+    if(!file_get_contents(file, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_misc_read: error reading file %s\n", file);
 	misc_print_error(&error, TRUE);
@@ -181,12 +181,9 @@ xml_loadsave_leagues_cups_write(const gchar *prefix)
     gint i;
     gchar buf[SMALL],
 	*basename = g_path_get_basename(prefix);
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
 
-    sprintf(buf, "%s___leagues_cups.xml", prefix);
-    file_my_fopen(buf, "w", &fil, TRUE);
-
-    fprintf(fil, "%s<_%d>\n", I0, TAG_LEAGUES_CUPS);
+    g_string_append_printf(fil, "%s<_%d>\n", I0, TAG_LEAGUES_CUPS);
 
     for(i=0;i<country.leagues->len;i++)
     {
@@ -204,9 +201,10 @@ xml_loadsave_leagues_cups_write(const gchar *prefix)
 	xml_write_string(fil, buf, TAG_CUP_FILE, I1);
     }
 
-    fprintf(fil, "%s</_%d>\n", I0, TAG_LEAGUES_CUPS);
+    g_string_append_printf(fil, "%s</_%d>\n", I0, TAG_LEAGUES_CUPS);
     
-    fclose(fil);
+    sprintf(buf, "%s___leagues_cups.xml", prefix);
+    file_write_contents(buf, fil);
 
     g_free(basename);
 }
@@ -29,6 +29,7 @@
 #include "league.h"
 #include "live_game.h"
 #include "misc.h"
+#include "name.h"
 #include "option.h"
 #include "variables.h"
 #include "xml.h"
@@ -200,7 +201,7 @@ xml_loadsave_live_game_text         (GMarkupParseContext *context,
 	lgame->fix = fixture_from_id(xml_read_int(buf), FALSE);
     }
     else if(state == TAG_LIVE_GAME_TEAM_NAME)
-	misc_string_assign(&lgame->team_names[team_name_idx], buf);
+	lgame->team_names[team_name_idx] = name_intern(buf);
     else if(state == TAG_LIVE_GAME_ATTENDANCE)
 	lgame->attendance = xml_read_int(buf);
     else if(state == TAG_LIVE_GAME_UNIT_POSSESSION)
@@ -252,7 +253,7 @@ xml_loadsave_live_game_read(const gchar *filename, LiveGame *live_game)
     context = 
 	g_markup_parse_context_new(&parser, 0, NULL, NULL);
 
-    if(!g_file_get_contents(filename, &file_contents, &length, &error))
+    if(!file_get_contents(filename, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_live_game_read: error reading file %s\n", filename);
 	misc_print_error(&error, TRUE);
@@ -283,11 +284,9 @@ xml_loadsave_live_game_write(const gchar *filename, const LiveGame *live_game)
 #endif
 
     gint i;
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
 
-    file_my_fopen(filename, "w", &fil, TRUE);
-
-    fprintf(fil, "<_%d>\n", TAG_LIVE_GAME);
+    g_string_append_printf(fil, "<_%d>\n", TAG_LIVE_GAME);
 
     if(live_game->fix != NULL)
     {
@@ -312,19 +311,19 @@ xml_loadsave_live_game_write(const gchar *filename, const LiveGame *live_game)
 
     xml_loadsave_live_game_write_stats(fil, &live_game->stats);
 
-    fprintf(fil, "</_%d>\n", TAG_LIVE_GAME);
+    g_string_append_printf(fil, "</_%d>\n", TAG_LIVE_GAME);
 
-    fclose(fil);
+    file_write_contents(filename, fil);
 }
 
 void
-xml_loadsave_live_game_write_unit(FILE *fil, const LiveGameUnit *unit)
+xml_loadsave_live_game_write_unit(GString *fil, const LiveGameUnit *unit)
 {
 #ifdef DEBUG
     printf("xml_loadsave_live_game_write_unit\n");
 #endif
 
-    fprintf(fil, "<_%d>\n", TAG_LIVE_GAME_UNIT);
+    g_string_append_printf(fil, "<_%d>\n", TAG_LIVE_GAME_UNIT);
 
     xml_write_int(fil, unit->possession,
 		  TAG_LIVE_GAME_UNIT_POSSESSION, I1);
@@ -339,7 +338,7 @@ xml_loadsave_live_game_write_unit(FILE *fil, const LiveGameUnit *unit)
     xml_write_int(fil, unit->result[1],
 		  TAG_LIVE_GAME_UNIT_RESULT, I1);
 
-    fprintf(fil, "%s<_%d>\n", I1, TAG_LIVE_GAME_UNIT_EVENT);
+    g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_LIVE_GAME_UNIT_EVENT);
 	
     xml_write_int(fil, unit->event.type,
 		  TAG_LIVE_GAME_UNIT_EVENT_TYPE, I2);
@@ -356,13 +355,13 @@ xml_loadsave_live_game_write_unit(FILE *fil, const LiveGameUnit *unit)
     xml_write_int(fil, unit->event.player2,
 		  TAG_LIVE_GAME_UNIT_EVENT_PLAYER2, I2);
     
-    fprintf(fil, "%s</_%d>\n", I1, TAG_LIVE_GAME_UNIT_EVENT);
+    g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_LIVE_GAME_UNIT_EVENT);
 
-    fprintf(fil, "</_%d>\n", TAG_LIVE_GAME_UNIT);
+    g_string_append_printf(fil, "</_%d>\n", TAG_LIVE_GAME_UNIT);
 }
 
 void
-xml_loadsave_live_game_write_stats(FILE *fil, const LiveGameStats *stats)
+xml_loadsave_live_game_write_stats(GString *fil, const LiveGameStats *stats)
 {
 #ifdef DEBUG
     printf("xml_loadsave_live_game_write_stats\n");
@@ -370,34 +369,34 @@ xml_loadsave_live_game_write_stats(FILE *fil, const LiveGameStats *stats)
 
     gint i, j, k;
     
-    fprintf(fil, "<_%d>\n", TAG_LIVE_GAME_STAT);
+    g_string_append_printf(fil, "<_%d>\n", TAG_LIVE_GAME_STAT);
     
     xml_write_float(fil, stats->possession, 
 		    TAG_LIVE_GAME_STAT_POSSESSION, I1);
 
     for(i=0;i<2;i++)
     {
-	fprintf(fil, "%s<_%d>\n", I1, TAG_LIVE_GAME_STAT_VALUES);	
+	g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_LIVE_GAME_STAT_VALUES);	
 	for(j=0;j<LIVE_GAME_STAT_VALUE_END;j++)
 	    xml_write_int(fil, stats->values[i][j], 
 			  TAG_LIVE_GAME_STAT_VALUE, I2);
-	fprintf(fil, "%s</_%d>\n", I1, TAG_LIVE_GAME_STAT_VALUES);
+	g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_LIVE_GAME_STAT_VALUES);
     }
     
     for(i=0;i<2;i++)
     {
-	fprintf(fil, "%s<_%d>\n", I1, TAG_LIVE_GAME_STAT_PLAYERS);
+	g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_LIVE_GAME_STAT_PLAYERS);
 	for(j=0;j<LIVE_GAME_STAT_ARRAY_END;j++)
 	{
-	    fprintf(fil, "%s<_%d>\n", I1, TAG_LIVE_GAME_STAT_PLAYER);
+	    g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_LIVE_GAME_STAT_PLAYER);
 	    for(k=0;k<stats->players[i][j]->len;k++)
 		xml_write_string(fil, 
 				 (gchar*)g_ptr_array_index(stats->players[i][j], k),
 				 TAG_LIVE_GAME_STAT_PLAYER_ELEMENT, I2);
-	    fprintf(fil, "%s</_%d>\n", I1, TAG_LIVE_GAME_STAT_PLAYER);
+	    g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_LIVE_GAME_STAT_PLAYER);
 	}
-	fprintf(fil, "%s</_%d>\n", I1, TAG_LIVE_GAME_STAT_PLAYERS);
+	g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_LIVE_GAME_STAT_PLAYERS);
     }
 
-    fprintf(fil, "</_%d>\n", TAG_LIVE_GAME_STAT);
+    g_string_append_printf(fil, "</_%d>\n", TAG_LIVE_GAME_STAT);
 }
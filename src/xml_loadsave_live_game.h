@@ -30,10 +30,10 @@
 #include "live_game_struct.h"
 
 void
-xml_loadsave_live_game_write_stats(FILE *fil, const LiveGameStats *stats);
+xml_loadsave_live_game_write_stats(GString *fil, const LiveGameStats *stats);
 
 void
-xml_loadsave_live_game_write_unit(FILE *fil, const LiveGameUnit *unit);
+xml_loadsave_live_game_write_unit(GString *fil, const LiveGameUnit *unit);
 
 void
 xml_loadsave_live_game_write(const gchar *filename, const LiveGame *live_game);
@@ -29,6 +29,7 @@
 #include "fixture.h"
 #include "free.h"
 #include "misc.h"
+#include "registry.h"
 #include "xml.h"
 #include "variables.h"
 #include "xml_loadsave_misc.h"
@@ -180,6 +181,7 @@ xml_loadsave_misc_end_element    (GMarkupParseContext *context,
 	    oddidx++;
     } else if (tag == TAG_COUNTRY) {
         g_ptr_array_add(country_list, misc_user_data->country);
+        registry_invalidate();
         misc_user_data->country = &country;
     } else if(tag != TAG_MISC)
 	debug_print_message("xml_loadsave_misc_end_element: unknown tag: %s; I'm in state %d\n",
@@ -266,7 +268,7 @@ xml_loadsave_misc_read(Bygfoot *bygfoot, const gchar *dirname, const gchar *base
     context =
 	g_markup_parse_context_new(&parser, 0, &user_data, NULL);
 
-    if(!g_file_get_contents(file, &file_contents, &length, &error))
+    if(!file_get_contents(file, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_misc_read: error reading file %s\n", file);
 	misc_print_error(&error, TRUE);
@@ -282,6 +284,7 @@ xml_loadsave_misc_read(Bygfoot *bygfoot, const gchar *dirname, const gchar *base
 	g_ptr_array_free(bygfoot->international_cups, TRUE);
         bygfoot->international_cups = g_ptr_array_new();
     }
+    registry_invalidate();
     free_bets(TRUE);
 
     if(g_markup_parse_context_parse(context, file_contents, length, &error))
@@ -307,13 +310,11 @@ xml_loadsave_misc_write(Bygfoot *bygfoot, const gchar *prefix)
 
     gint i;
     gchar buf[SMALL];
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
 
     sprintf(buf, "%s___misc.xml", prefix);
 
-    file_my_fopen(buf, "w", &fil, TRUE);
-
-    fprintf(fil, "<_%d>\n", TAG_MISC);
+    g_string_append_printf(fil, "<_%d>\n", TAG_MISC);
 
     xml_write_string(fil, VERS, TAG_MISC_VERSION, I0);
     xml_write_float(fil, current_interest, TAG_MISC_CURRENT_INTEREST, I0);
@@ -340,13 +341,13 @@ xml_loadsave_misc_write(Bygfoot *bygfoot, const gchar *prefix)
 
     xml_loadsave_misc_write_international_cups(fil, bygfoot, prefix);
 
-    fprintf(fil, "</_%d>\n", TAG_MISC);
-    fclose(fil);
+    g_string_append_printf(fil, "</_%d>\n", TAG_MISC);
+    file_write_contents(buf, fil);
 }
 
 /** Write the bets arrays into the file. */
 void
-xml_loadsave_misc_write_bets(FILE *fil)
+xml_loadsave_misc_write_bets(GString *fil)
 {
 #ifdef DEBUG
     printf("xml_loadsave_misc_write_bets\n");
@@ -357,32 +358,32 @@ xml_loadsave_misc_write_bets(FILE *fil)
     for(i=0;i<2;i++)
 	for(j=0;j<bets[i]->len;j++)
 	{
-	    fprintf(fil, "%s<_%d>\n", I0, (i == 0) ? TAG_MISC_BET0 : TAG_MISC_BET1);
+	    g_string_append_printf(fil, "%s<_%d>\n", I0, (i == 0) ? TAG_MISC_BET0 : TAG_MISC_BET1);
 	    xml_write_int(fil, g_array_index(bets[i], BetMatch, j).fix_id,
 			  TAG_MISC_BET_FIX_ID, I1);
 	    for(k=0;k<3;k++)
 		xml_write_float(fil, g_array_index(bets[i], BetMatch, j).odds[k],
 				TAG_MISC_BET_ODD, I1);
-	    fprintf(fil, "%s</_%d>\n", I0, (i == 0) ? TAG_MISC_BET0 : TAG_MISC_BET1);
+	    g_string_append_printf(fil, "%s</_%d>\n", I0, (i == 0) ? TAG_MISC_BET0 : TAG_MISC_BET1);
 	}
 }
 
 static void
-xml_loadsave_misc_write_country(const Country *country, FILE *fil,
+xml_loadsave_misc_write_country(const Country *country, GString *fil,
                                 const gchar *prefix)
 {
     gchar buf[SMALL];
     gchar *basename = g_path_get_basename(prefix);
     gint i;
 
-    fprintf(fil, "%s<_%d>\n", I1, TAG_COUNTRY);
+    g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_COUNTRY);
     xml_write_string(fil, country->name, TAG_NAME, I0);
     xml_write_string(fil, country->symbol, TAG_SYMBOL, I0);
     xml_write_string(fil, country->sid, TAG_SID, I0);
     xml_write_int(fil, country->reserve_promotion_rules, TAG_MISC_RESERVE_PROMOTION_RULES, I0);
     xml_write_int(fil, country->rating, TAG_MISC_RATING, I0);
 
-    fprintf(fil, "%s<_%d>\n", I2, TAG_LEAGUES_CUPS);
+    g_string_append_printf(fil, "%s<_%d>\n", I2, TAG_LEAGUES_CUPS);
     for (i = 0; i < country->leagues->len; i++) {
         const League *league = g_ptr_array_index(country->leagues, i);
 	xml_loadsave_league_write(prefix, league);
@@ -397,41 +398,41 @@ xml_loadsave_misc_write_country(const Country *country, FILE *fil,
 	xml_write_string(fil, buf, TAG_CUP_FILE, I3);
     }
 
-    fprintf(fil, "%s</_%d>\n", I2, TAG_LEAGUES_CUPS);
-    fprintf(fil, "%s</_%d>\n", I1, TAG_COUNTRY);
+    g_string_append_printf(fil, "%s</_%d>\n", I2, TAG_LEAGUES_CUPS);
+    g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_COUNTRY);
 }
 
 /** Write non-user countries to the file. */
 void
-xml_loadsave_misc_write_countries(FILE *fil, const gchar *prefix)
+xml_loadsave_misc_write_countries(GString *fil, const gchar *prefix)
 {
     gint i;
 
-    fprintf(fil, "%s<!-- COUNTRIES--><_%d>\n", I0, TAG_COUNTRIES);
+    g_string_append_printf(fil, "%s<!-- COUNTRIES--><_%d>\n", I0, TAG_COUNTRIES);
 
     for (i = 0; i < country_list->len; i++) {
         const Country *country = g_ptr_array_index(country_list, i);
 	xml_loadsave_misc_write_country(country, fil, prefix);
     }
 
-    fprintf(fil, "%s</_%d>\n", I0, TAG_COUNTRIES);
+    g_string_append_printf(fil, "%s</_%d>\n", I0, TAG_COUNTRIES);
 
 }
 
 void
-xml_loadsave_misc_write_international_cups(FILE *fil, Bygfoot *bygfoot,
+xml_loadsave_misc_write_international_cups(GString *fil, Bygfoot *bygfoot,
                                            const gchar *prefix)
 {
     gint i;
     gchar buf[SMALL];
     gchar *basename = g_path_get_basename(prefix);
 
-    fprintf(fil, "%s<_%d>\n", I2, TAG_INTERNATIONAL_CUPS);
+    g_string_append_printf(fil, "%s<_%d>\n", I2, TAG_INTERNATIONAL_CUPS);
     for (i = 0; i < bygfoot->international_cups->len; i++) {
         const Cup *cup = g_ptr_array_index(bygfoot->international_cups, i);
 	xml_loadsave_cup_write(prefix, cup);
 	sprintf(buf, "%s___cup_%d.xml", basename, cup->c.id);
 	xml_write_string(fil, buf, TAG_CUP_FILE, I3);
     }
-    fprintf(fil, "%s</_%d>\n", I2, TAG_INTERNATIONAL_CUPS);
+    g_string_append_printf(fil, "%s</_%d>\n", I2, TAG_INTERNATIONAL_CUPS);
 }
@@ -35,12 +35,12 @@ void
 xml_loadsave_misc_write(Bygfoot *bygfoot, const gchar *prefix);
 
 void
-xml_loadsave_misc_write_bets(FILE *fil);
+xml_loadsave_misc_write_bets(GString *fil);
 
 void
-xml_loadsave_misc_write_countries(FILE *fil, const gchar *prefix);
+xml_loadsave_misc_write_countries(GString *fil, const gchar *prefix);
 
 void
-xml_loadsave_misc_write_international_cups(FILE *fil, Bygfoot *bygfoot,
+xml_loadsave_misc_write_international_cups(GString *fil, Bygfoot *bygfoot,
                                            const gchar *prefix);
 #endif
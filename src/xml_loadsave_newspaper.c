@@ -184,7 +184,7 @@ xml_loadsave_newspaper_read(Bygfoot *bygfoot, const gchar *dirname, const gchar
     context = 
 	g_markup_parse_context_new(&parser, 0, bygfoot, NULL);
 
-    if(!g_file_get_contents(filename, &file_contents, &length, &error))
+    if(!file_get_contents(filename, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_news_read: error reading file %s\n", filename);
 	misc_print_error(&error, TRUE);
@@ -211,18 +211,16 @@ xml_loadsave_newspaper_write(const gchar *prefix)
 #endif
 
     gint i;
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
     gchar buf[SMALL];
 
     sprintf(buf, "%s___newspaper.xml", prefix);
 
-    file_my_fopen(buf, "w", &fil, TRUE);
-
-    fprintf(fil, "<_%d>\n", TAG_NEWS_PAPER);
+    g_string_append_printf(fil, "<_%d>\n", TAG_NEWS_PAPER);
     
     for(i=0;i<newspaper.articles->len;i++)
     {
-	fprintf(fil, "%s<_%d>\n", I0, TAG_NEWS_PAPER_ARTICLE);
+	g_string_append_printf(fil, "%s<_%d>\n", I0, TAG_NEWS_PAPER_ARTICLE);
 	
 	xml_write_int(fil, g_array_index(newspaper.articles, NewsPaperArticle, i).id, 
 		      TAG_NEWS_PAPER_ARTICLE_ID, I1);
@@ -247,10 +245,10 @@ xml_loadsave_newspaper_write(const gchar *prefix)
 	xml_write_int(fil, g_array_index(newspaper.articles, NewsPaperArticle, i).cup_round, 
 		      TAG_NEWS_PAPER_ARTICLE_CUP_ROUND, I1);
 
-	fprintf(fil, "%s</_%d>\n", I0, TAG_NEWS_PAPER_ARTICLE);
+	g_string_append_printf(fil, "%s</_%d>\n", I0, TAG_NEWS_PAPER_ARTICLE);
     }
 
-    fprintf(fil, "</_%d>\n", TAG_NEWS_PAPER);
+    g_string_append_printf(fil, "</_%d>\n", TAG_NEWS_PAPER);
 
-    fclose(fil);
+    file_write_contents(buf, fil);
 }
@@ -24,6 +24,7 @@
 */
 
 #include "misc.h"
+#include "name.h"
 #include "player.h"
 #include "team.h"
 #include "xml.h"
@@ -217,7 +218,7 @@ xml_loadsave_players_text(gchar *text)
     printf("xml_loadsave_players_text\n");
 #endif
     if(state == TAG_PLAYER_NAME)
-	misc_string_assign(&new_player->name, text);
+	new_player->name = name_intern(text);
     else if(state == TAG_PLAYER_POS)
 	new_player->pos = xml_read_int(text);
     else if(state == TAG_PLAYER_CPOS)
@@ -296,7 +297,7 @@ xml_loadsave_players_text(gchar *text)
 }
 
 void
-xml_loadsave_players_write(FILE *fil, const GArray *players)
+xml_loadsave_players_write(GString *fil, const GArray *players)
 {
 #ifdef DEBUG
     printf("xml_loadsave_players_write\n");
@@ -304,16 +305,16 @@ xml_loadsave_players_write(FILE *fil, const GArray *players)
 
     gint i;
 
-    fprintf(fil, "%s<_%d>\n", I1, TAG_PLAYERS);
+    g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_PLAYERS);
    
     for(i=0;i<players->len;i++)
 	xml_loadsave_players_write_player(fil, &g_array_index(players, Player, i));
 
-    fprintf(fil, "%s</_%d>\n", I1, TAG_PLAYERS);
+    g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_PLAYERS);
 }
 
 void
-xml_loadsave_players_write_player(FILE *fil, const Player *pl)
+xml_loadsave_players_write_player(GString *fil, const Player *pl)
 {
 #ifdef DEBUG
     printf("xml_loadsave_players_write_player\n");
@@ -321,7 +322,7 @@ xml_loadsave_players_write_player(FILE *fil, const Player *pl)
 
     gint i;
 
-    fprintf(fil, "%s<_%d>\n", I1, TAG_PLAYER);
+    g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_PLAYER);
 
     xml_write_string(fil, pl->name, TAG_PLAYER_NAME, I2);
     xml_write_int(fil, pl->pos, TAG_PLAYER_POS, I2);
@@ -356,7 +357,7 @@ xml_loadsave_players_write_player(FILE *fil, const Player *pl)
 
     for(i=0;i<pl->stats->len;i++)
     {
-	fprintf(fil, "%s<_%d>\n", I2, TAG_PLAYER_STATS);
+	g_string_append_printf(fil, "%s<_%d>\n", I2, TAG_PLAYER_STATS);
 
 	xml_write_int(fil, g_array_index(pl->stats, PlayerCompetitionStats, i).competition->id,
 		      TAG_PLAYER_STATS_CLID, I3);
@@ -371,8 +372,8 @@ xml_loadsave_players_write_player(FILE *fil, const Player *pl)
 	xml_write_int(fil, g_array_index(pl->stats, PlayerCompetitionStats, i).red,
 		      TAG_PLAYER_STATS_RED, I3);
 
-	fprintf(fil, "%s</_%d>\n", I2, TAG_PLAYER_STATS);
+	g_string_append_printf(fil, "%s</_%d>\n", I2, TAG_PLAYER_STATS);
     }
 
-    fprintf(fil, "%s</_%d>\n", I1, TAG_PLAYER);
+    g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_PLAYER);
 }
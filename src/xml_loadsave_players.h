@@ -39,10 +39,10 @@ void
 xml_loadsave_players_start_element(gint tag, Team *tm, GArray *players);
 
 void
-xml_loadsave_players_write_player(FILE *fil, const Player *pl);
+xml_loadsave_players_write_player(GString *fil, const Player *pl);
 
 void
-xml_loadsave_players_write(FILE *fil, const GArray *players);
+xml_loadsave_players_write(GString *fil, const GArray *players);
 
 #endif
 
@@ -186,7 +186,7 @@ xml_loadsave_season_stats_read(const gchar *dirname, const gchar *prefix)
 
     sprintf(filename, "%s%s%s___season_stats.xml", dirname, G_DIR_SEPARATOR_S, prefix);
 
-    if(!g_file_get_contents(filename, &file_contents, &length, &error))
+    if(!file_get_contents(filename, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_season_stats_read: error reading file %s\n", filename);
 	misc_print_error(&error, TRUE);
@@ -217,26 +217,22 @@ xml_loadsave_season_stats_write(const gchar *prefix)
 
     gint i, j;
     gchar buf[SMALL];
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
     gchar *basename = NULL;
 
-    sprintf(buf, "%s___season_stats.xml", prefix);
-
-    file_my_fopen(buf, "w", &fil, TRUE);
-
-    fprintf(fil, "<_%d>\n", TAG_SEASON_STATS);
+    g_string_append_printf(fil, "<_%d>\n", TAG_SEASON_STATS);
     
     for(i=0;i<season_stats->len;i++)
     {
-	fprintf(fil, "<_%d>\n", TAG_SEASON_STAT);
+	g_string_append_printf(fil, "<_%d>\n", TAG_SEASON_STAT);
 
 	xml_write_int(fil, g_array_index(season_stats, SeasonStat, i).season_number,
 		      TAG_SEASON_NUMBER, I1);
 
-	fprintf(fil, "%s<_%d>\n", I1, TAG_LEAGUE_CHAMPS);
+	g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_LEAGUE_CHAMPS);
 	for(j=0;j<g_array_index(season_stats, SeasonStat, i).league_champs->len;j++)
 	{
-	    fprintf(fil, "%s<_%d>\n", I2, TAG_CHAMP_STAT);
+	    g_string_append_printf(fil, "%s<_%d>\n", I2, TAG_CHAMP_STAT);
 	    xml_write_string(fil,
 			     g_array_index(
 				 g_array_index(
@@ -248,14 +244,14 @@ xml_loadsave_season_stats_write(const gchar *prefix)
 				     season_stats, SeasonStat, i).league_champs, ChampStat, j).cl_name,
 			     TAG_CHAMP_STAT_CL_NAME, I2);
 	    
-	    fprintf(fil, "%s</_%d>\n", I2, TAG_CHAMP_STAT);
+	    g_string_append_printf(fil, "%s</_%d>\n", I2, TAG_CHAMP_STAT);
 	}
-	fprintf(fil, "%s</_%d>\n", I1, TAG_LEAGUE_CHAMPS);
+	g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_LEAGUE_CHAMPS);
 
-	fprintf(fil, "%s<_%d>\n", I1, TAG_CUP_CHAMPS);
+	g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_CUP_CHAMPS);
 	for(j=0;j<g_array_index(season_stats, SeasonStat, i).cup_champs->len;j++)
 	{
-	    fprintf(fil, "%s<_%d>\n", I2, TAG_CHAMP_STAT);
+	    g_string_append_printf(fil, "%s<_%d>\n", I2, TAG_CHAMP_STAT);
 	    xml_write_string(fil, g_array_index(
 				 g_array_index(
 				     season_stats, SeasonStat, i).cup_champs, ChampStat, j).team_name,
@@ -265,9 +261,9 @@ xml_loadsave_season_stats_write(const gchar *prefix)
 				     season_stats, SeasonStat, i).cup_champs, ChampStat, j).cl_name,
 			     TAG_CHAMP_STAT_CL_NAME, I2);
 			       
-	    fprintf(fil, "%s</_%d>\n", I2, TAG_CHAMP_STAT);
+	    g_string_append_printf(fil, "%s</_%d>\n", I2, TAG_CHAMP_STAT);
 	}
-	fprintf(fil, "%s</_%d>\n", I1, TAG_CUP_CHAMPS);
+	g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_CUP_CHAMPS);
 
 	for(j=0;j<g_array_index(season_stats, SeasonStat, i).league_stats->len;j++)
 	{
@@ -279,10 +275,11 @@ xml_loadsave_season_stats_write(const gchar *prefix)
 	    g_free(basename);
 	}
 
-	fprintf(fil, "</_%d>\n", TAG_SEASON_STAT);
+	g_string_append_printf(fil, "</_%d>\n", TAG_SEASON_STAT);
     }
 
-    fprintf(fil, "</_%d>\n", TAG_SEASON_STATS);
+    g_string_append_printf(fil, "</_%d>\n", TAG_SEASON_STATS);
 
-    fclose(fil);
+    sprintf(buf, "%s___season_stats.xml", prefix);
+    file_write_contents(buf, fil);
 }
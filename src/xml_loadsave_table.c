@@ -73,7 +73,10 @@ xml_loadsave_table_start_element (GMarkupParseContext *context,
 	}
 	
     if(tag == TAG_TABLE_ELEMENT)
+    {
 	valueidx = 0;
+	new_element.changed = TRUE;
+    }
 
     if(!valid_tag)
 	debug_print_message("xml_loadsave_table_start_element: unknown tag: %s; I'm in state %d\n",
@@ -161,7 +164,7 @@ xml_loadsave_table_read(const gchar *filename, Table *table)
     context = 
 	g_markup_parse_context_new(&parser, 0, NULL, NULL);
 
-    if(!g_file_get_contents(filename, &file_contents, &length, &error))
+    if(!file_get_contents(filename, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_table_read: error reading file %s\n", filename);
 	misc_print_error(&error, TRUE);
@@ -190,11 +193,9 @@ xml_loadsave_table_write(const gchar *filename, const Table *table)
 #endif
 
     gint i, j;
-    FILE *fil = NULL;
-
-    file_my_fopen(filename, "w", &fil, TRUE);
+    GString *fil = g_string_new("");
 
-    fprintf(fil, "<_%d>\n", TAG_TABLE);
+    g_string_append_printf(fil, "<_%d>\n", TAG_TABLE);
     
     xml_write_string(fil, table->name, TAG_NAME, I0);
     xml_write_int(fil, table->competition->id, TAG_ID, I0);
@@ -202,7 +203,7 @@ xml_loadsave_table_write(const gchar *filename, const Table *table)
 
     for(i=0;i<table->elements->len;i++)
     {
-	fprintf(fil, "<_%d>\n", TAG_TABLE_ELEMENT);
+	g_string_append_printf(fil, "<_%d>\n", TAG_TABLE_ELEMENT);
 	
 	xml_write_int(fil, g_array_index(table->elements, TableElement, i).team->id, 
 		      TAG_TEAM_ID, I1);
@@ -214,10 +215,10 @@ xml_loadsave_table_write(const gchar *filename, const Table *table)
 	    xml_write_int(fil, g_array_index(table->elements, TableElement, i).values[j], 
 			  TAG_TABLE_ELEMENT_VALUE, I1);
 
-	fprintf(fil, "</_%d>\n", TAG_TABLE_ELEMENT);
+	g_string_append_printf(fil, "</_%d>\n", TAG_TABLE_ELEMENT);
     }
 
-    fprintf(fil, "</_%d>\n", TAG_TABLE);
+    g_string_append_printf(fil, "</_%d>\n", TAG_TABLE);
 
-    fclose(fil);
+    file_write_contents(filename, fil);
 }
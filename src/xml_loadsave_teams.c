@@ -25,6 +25,7 @@
 
 #include "file.h"
 #include "misc.h"
+#include "name.h"
 #include "player.h"
 #include "team.h"
 #include "xml.h"
@@ -175,7 +176,7 @@ xml_loadsave_teams_text         (GMarkupParseContext *context,
     buf[text_len] = '\0';
 
     if(state == TAG_NAME)
-	misc_string_assign(&new_team->name, buf);
+	new_team->name = name_intern(buf);
     else if(state == TAG_SYMBOL)
 	misc_string_assign(&new_team->symbol, buf);
     else if(state == TAG_TEAM_NAMES_FILE)
@@ -235,7 +236,7 @@ xml_loadsave_teams_read(const gchar *filename, Country *country, GPtrArray *team
     context = 
 	g_markup_parse_context_new(&parser, 0, country, NULL);
 
-    if(!g_file_get_contents(filename, &file_contents, &length, &error))
+    if(!file_get_contents(filename, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_teams_read: error reading file %s\n", filename);
 	misc_print_error(&error, TRUE);
@@ -270,27 +271,25 @@ xml_loadsave_teams_write(const gchar *filename, const GPtrArray *teams)
 #endif
 
     gint i;
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
 
-    file_my_fopen(filename, "w", &fil, TRUE);
-
-    fprintf(fil, "<_%d>\n", TAG_TEAMS);
+    g_string_append_printf(fil, "<_%d>\n", TAG_TEAMS);
     for(i=0;i<teams->len;i++)
 	xml_loadsave_teams_write_team(fil, g_ptr_array_index(teams, i));
 
-    fprintf(fil, "</_%d>\n", TAG_TEAMS);
+    g_string_append_printf(fil, "</_%d>\n", TAG_TEAMS);
 
-    fclose(fil);
+    file_write_contents(filename, fil);
 }
 
 void
-xml_loadsave_teams_write_team(FILE *fil, const Team* team)
+xml_loadsave_teams_write_team(GString *fil, const Team* team)
 {
 #ifdef DEBUG
     printf("xml_loadsave_teams_write_team\n");
 #endif
 
-    fprintf(fil, "<_%d>\n", TAG_TEAM);
+    g_string_append_printf(fil, "<_%d>\n", TAG_TEAM);
 
     xml_write_string(fil, team->name, TAG_NAME, I1);
     xml_write_string(fil, team->symbol, TAG_SYMBOL, I1);
@@ -304,7 +303,7 @@ xml_loadsave_teams_write_team(FILE *fil, const Team* team)
     xml_write_int(fil, team->first_team.team->id, TAG_TEAM_FIRST_TEAM_ID, I1);
     xml_write_int(fil, team->reserve_level, TAG_TEAM_RESERVE_LEVEL, I1);
 
-    fprintf(fil, "%s<_%d>\n", I1, TAG_TEAM_STADIUM);
+    g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_TEAM_STADIUM);
 
     if(team->stadium.name != NULL)
 	xml_write_string(fil, team->stadium.name, TAG_TEAM_STADIUM_NAME, I2);
@@ -316,11 +315,11 @@ xml_loadsave_teams_write_team(FILE *fil, const Team* team)
     xml_write_float(fil, team->stadium.safety, TAG_TEAM_STADIUM_SAFETY, I2);
     xml_write_float(fil, team->stadium.ticket_price, TAG_TEAM_STADIUM_TICKET_PRICE, I2);
 
-    fprintf(fil, "%s</_%d>\n", I1, TAG_TEAM_STADIUM);
+    g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_TEAM_STADIUM);
 
     xml_loadsave_players_write(fil, team->players);
 
     xml_write_float(fil, team->luck, TAG_TEAM_LUCK, I1);
 
-    fprintf(fil, "</_%d>\n", TAG_TEAM);
+    g_string_append_printf(fil, "</_%d>\n", TAG_TEAM);
 }
@@ -58,6 +58,6 @@ void
 xml_loadsave_teams_write(const gchar *filename, const GPtrArray *teams);
 
 void
-xml_loadsave_teams_write_team(FILE *fil, const Team* team);
+xml_loadsave_teams_write_team(GString *fil, const Team* team);
 
 #endif
@@ -190,7 +190,7 @@ xml_loadsave_transfers_read(const gchar *filename)
     context = 
 	g_markup_parse_context_new(&parser, 0, NULL, NULL);
 
-    if(!g_file_get_contents(filename, &file_contents, &length, &error))
+    if(!file_get_contents(filename, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_transfers_read: error reading file %s\n", filename);
 	misc_print_error(&error, TRUE);
@@ -218,17 +218,15 @@ xml_loadsave_transfers_write(const gchar *prefix)
 
     gint i, j;
     gchar buf[SMALL];
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
 
     sprintf(buf, "%s___transfer_list.xml", prefix);
 
-    file_my_fopen(buf, "w", &fil, TRUE);
-
-    fprintf(fil, "<_%d>\n", TAG_TRANSFERS);
+    g_string_append_printf(fil, "<_%d>\n", TAG_TRANSFERS);
 
     for(i=0;i<transfer_list->len;i++)
     {
-	fprintf(fil, "<_%d>\n", TAG_TRANSFER);
+	g_string_append_printf(fil, "<_%d>\n", TAG_TRANSFER);
 
 	xml_write_int(fil, trans(i).tm->id, TAG_TEAM_ID, I1);
 	xml_write_int(fil, trans(i).id, TAG_TRANSFER_PLAYER_ID, I1);
@@ -242,7 +240,7 @@ xml_loadsave_transfers_write(const gchar *prefix)
 
 	for(j=0;j<trans(i).offers->len;j++)
 	{
-	    fprintf(fil, "%s<_%d>\n", I1, TAG_TRANSFER_OFFER);
+	    g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_TRANSFER_OFFER);
 	    
 	    xml_write_int(fil, transoff(i, j).tm->id, 
 			  TAG_TRANSFER_OFFER_TEAM_ID, I2);
@@ -253,13 +251,13 @@ xml_loadsave_transfers_write(const gchar *prefix)
 	    xml_write_int(fil, transoff(i, j).fee, 
 			  TAG_TRANSFER_OFFER_FEE, I2);
 
-	    fprintf(fil, "</_%d>\n", TAG_TRANSFER_OFFER);
+	    g_string_append_printf(fil, "</_%d>\n", TAG_TRANSFER_OFFER);
 	}
 
-	fprintf(fil, "%s</_%d>\n", I1, TAG_TRANSFER);
+	g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_TRANSFER);
     }
 
-    fprintf(fil, "</_%d>\n", TAG_TRANSFERS);
+    g_string_append_printf(fil, "</_%d>\n", TAG_TRANSFERS);
 
-    fclose(fil);
+    file_write_contents(buf, fil);
 }
@@ -384,7 +384,7 @@ xml_loadsave_users_read(const gchar *dirname, const gchar *basename)
     context = 
 	g_markup_parse_context_new(&parser, 0, NULL, NULL);
 
-    if(!g_file_get_contents(file, &file_contents, &length, &error))
+    if(!file_get_contents(file, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_users_read: error reading file %s\n", file);
 	misc_print_error(&error, TRUE);
@@ -412,7 +412,7 @@ xml_loadsave_users_write(const gchar *prefix)
 
     gint i, j, k;
     gchar buf[SMALL];
-    FILE *fil = NULL;
+    GString *fil = g_string_new("");
 
     for(i=0;i<users->len;i++)
     {
@@ -423,14 +423,11 @@ xml_loadsave_users_write(const gchar *prefix)
 	xml_loadsave_live_game_write(buf, &usr(i).live_game);
     }
 
-    sprintf(buf, "%s___users.xml", prefix);
-    file_my_fopen(buf, "w", &fil, TRUE);
-
-    fprintf(fil, "<_%d>\n", TAG_USERS);
+    g_string_append_printf(fil, "<_%d>\n", TAG_USERS);
 
     for(i=0;i<users->len;i++)
     {
-	fprintf(fil, "<_%d>\n", TAG_USER);
+	g_string_append_printf(fil, "<_%d>\n", TAG_USER);
 
 	xml_write_string(fil, usr(i).name, TAG_NAME, I1);
 	xml_write_int(fil, usr(i).tm->id, TAG_TEAM_ID, I1);
@@ -457,18 +454,18 @@ xml_loadsave_users_write(const gchar *prefix)
 
 	for(j=0;j<2;j++)
 	{
-	    fprintf(fil, "%s<_%d>\n", I1, TAG_USER_MONEY_INS);
+	    g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_USER_MONEY_INS);
 	    for(k=0;k<MON_IN_END;k++)
 		xml_write_int(fil, usr(i).money_in[j][k], TAG_USER_MONEY_IN, I2);	    
-	    fprintf(fil, "%s</_%d>\n", I1, TAG_USER_MONEY_INS);
+	    g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_USER_MONEY_INS);
 	}
 
 	for(j=0;j<2;j++)
 	{
-	    fprintf(fil, "%s<_%d>\n", I1, TAG_USER_MONEY_OUTS);
+	    g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_USER_MONEY_OUTS);
 	    for(k=0;k<MON_OUT_END;k++)
 		xml_write_int(fil, usr(i).money_out[j][k], TAG_USER_MONEY_OUT, I2);
-	    fprintf(fil, "%s</_%d>\n", I1, TAG_USER_MONEY_OUTS);
+	    g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_USER_MONEY_OUTS);
 	}
 
 	xml_write_int(fil, usr(i).youth_academy.coach, TAG_USER_YA_COACH, I1);
@@ -487,17 +484,18 @@ xml_loadsave_users_write(const gchar *prefix)
 	xml_loadsave_players_write(fil, usr(i).youth_academy.players);
 
 
-	fprintf(fil, "</_%d>\n", TAG_USER);
+	g_string_append_printf(fil, "</_%d>\n", TAG_USER);
     }
 
-    fprintf(fil, "</_%d>\n", TAG_USERS);
+    g_string_append_printf(fil, "</_%d>\n", TAG_USERS);
 
-    fclose(fil);
+    sprintf(buf, "%s___users.xml", prefix);
+    file_write_contents(buf, fil);
 }
 
 /** Write the history of a user into the file. */
 void
-xml_user_write_history(FILE *fil, const GArray *history)
+xml_user_write_history(GString *fil, const GArray *history)
 {
 #ifdef DEBUG
     printf("xml_user_write_history\n");
@@ -507,7 +505,7 @@ xml_user_write_history(FILE *fil, const GArray *history)
 
     for(i=0;i<history->len;i++)
     {
-	fprintf(fil, "%s<_%d>\n", I1, TAG_USER_HISTORY);
+	g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_USER_HISTORY);
 
 	xml_write_int(fil, g_array_index(history, UserHistory, i).season,
 		      TAG_USER_HISTORY_SEASON, I2);
@@ -524,13 +522,13 @@ xml_user_write_history(FILE *fil, const GArray *history)
 	    else
 		xml_write_string(fil, "", TAG_USER_HISTORY_STRING, I2);
 
-	fprintf(fil, "%s</_%d>\n", I1, TAG_USER_HISTORY);
+	g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_USER_HISTORY);
     }
 }
 
 /** Write the events of a user into the file. */
 void
-xml_user_write_events(FILE *fil, const GArray *events)
+xml_user_write_events(GString *fil, const GArray *events)
 {
 #ifdef DEBUG
     printf("xml_user_write_events\n");
@@ -540,7 +538,7 @@ xml_user_write_events(FILE *fil, const GArray *events)
 
     for(i=0;i<events->len;i++)
     {
-	fprintf(fil, "%s<_%d>\n", I1, TAG_USER_EVENT);
+	g_string_append_printf(fil, "%s<_%d>\n", I1, TAG_USER_EVENT);
 
 	xml_write_int(fil, g_array_index(events, Event, i).type,
 		      TAG_USER_EVENT_TYPE, I2);
@@ -551,13 +549,13 @@ xml_user_write_events(FILE *fil, const GArray *events)
 	xml_write_string(fil, g_array_index(events, Event, i).value_string,
 			 TAG_USER_EVENT_VALUE_STRING, I2);
 	
-	fprintf(fil, "%s</_%d>\n", I1, TAG_USER_EVENT);
+	g_string_append_printf(fil, "%s</_%d>\n", I1, TAG_USER_EVENT);
     }
 }
 
 /** Write the bets of a user into the file. */
 void
-xml_user_write_bets(FILE *fil, GArray **bets)
+xml_user_write_bets(GString *fil, GArray **bets)
 {
 #ifdef DEBUG
     printf("xml_user_write_bets\n");
@@ -568,7 +566,7 @@ xml_user_write_bets(FILE *fil, GArray **bets)
     for(i=0;i<2;i++)
 	for(j=0;j<bets[i]->len;j++)
 	{
-	    fprintf(fil, "%s<_%d>\n", I1, 
+	    g_string_append_printf(fil, "%s<_%d>\n", I1, 
 		    (i == 0) ? TAG_USER_BET0 : TAG_USER_BET1);
 	    xml_write_int(fil, g_array_index(bets[i], BetUser, j).wager,
 			  TAG_USER_BET_WAGER, I2);
@@ -576,7 +574,7 @@ xml_user_write_bets(FILE *fil, GArray **bets)
 			  TAG_USER_BET_OUTCOME, I2);
 	    xml_write_int(fil, g_array_index(bets[i], BetUser, j).fix_id,
 			  TAG_USER_BET_FIX_ID, I2);
-	    fprintf(fil, "%s</_%d>\n", I1, 
+	    g_string_append_printf(fil, "%s</_%d>\n", I1, 
 		    (i == 0) ? TAG_USER_BET0 : TAG_USER_BET1);
 	}
 }
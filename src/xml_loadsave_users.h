@@ -56,13 +56,13 @@ void
 xml_loadsave_users_write(const gchar *prefix);
 
 void
-xml_user_write_history(FILE *fil, const GArray *history);
+xml_user_write_history(GString *fil, const GArray *history);
 
 void
-xml_user_write_events(FILE *fil, const GArray *events);
+xml_user_write_events(GString *fil, const GArray *events);
 
 void
-xml_user_write_bets(FILE *fil, GArray **bets);
+xml_user_write_bets(GString *fil, GArray **bets);
 
 #endif
 
@@ -166,7 +166,7 @@ xml_mmatches_read(const gchar *filename, GArray *mmatches)
     context = 
 	g_markup_parse_context_new(&parser, 0, NULL, NULL);
 
-    if(!g_file_get_contents(filename, &file_contents, &length, &error))
+    if(!file_get_contents(filename, &file_contents, &length, &error))
     {
 	debug_print_message("xml_loadsave_mmatches_read: error reading file %s\n", filename);
 	misc_print_error(&error, TRUE);
@@ -198,20 +198,16 @@ xml_mmatches_write(const gchar *prefix, const GArray *mmatches)
     printf("xml_mmatches_write\n");
 #endif
 
-    FILE *fil;
+    GString *fil = g_string_new("");
     gint i;
     gchar buf[SMALL];
     gchar *basename = g_path_get_basename(prefix);
 
-    sprintf(buf, "%smmatches", prefix);
-
-    file_my_fopen(buf, "w", &fil, TRUE);
-
-    fprintf(fil, "<_%d>\n", TAG_MMATCHES);
+    g_string_append_printf(fil, "<_%d>\n", TAG_MMATCHES);
 
     for(i=0;i<mmatches->len;i++)
     {
-	fprintf(fil, "<_%d>\n", TAG_MMATCH);
+	g_string_append_printf(fil, "<_%d>\n", TAG_MMATCH);
 
 	xml_write_g_string(fil, 
 			   g_array_index(mmatches, MemMatch, i).competition_name,
@@ -232,12 +228,13 @@ xml_mmatches_write(const gchar *prefix, const GArray *mmatches)
 	xml_loadsave_live_game_write(buf, 
 				     &g_array_index(mmatches, MemMatch, i).lg);
 
-	fprintf(fil, "</_%d>\n", TAG_MMATCH);
+	g_string_append_printf(fil, "</_%d>\n", TAG_MMATCH);
     }
 
-    fprintf(fil, "</_%d>\n", TAG_MMATCHES);
+    g_string_append_printf(fil, "</_%d>\n", TAG_MMATCHES);
 
-    fclose(fil);
+    sprintf(buf, "%smmatches", prefix);
+    file_write_contents(buf, fil);
 
     g_free(basename);
 }
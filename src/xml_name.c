@@ -28,6 +28,7 @@
 #include "misc.h"
 #include "name.h"
 #include "variables.h"
+#include "xml_cache.h"
 #include "xml_name.h"
 
 #define TAG_NAMES "names"
@@ -108,9 +109,11 @@ xml_name_read_text         (GMarkupParseContext *context,
     buf[text_len] = '\0';
 
     if(state == STATE_FIRST_NAME)
-	g_ptr_array_add(nlist->first_names, g_strdup(buf));
+	g_ptr_array_add(nlist->first_names,
+			g_string_chunk_insert_const(name_pool, buf));
     else if(state == STATE_LAST_NAME)
-	g_ptr_array_add(nlist->last_names, g_strdup(buf));
+	g_ptr_array_add(nlist->last_names,
+			g_string_chunk_insert_const(name_pool, buf));
 }
 
 /** Fill the name list with names from the
@@ -128,19 +131,14 @@ xml_name_read(const gchar *sid, NameList *namelist)
     GMarkupParser parser = {xml_name_read_start_element,
 			    xml_name_read_end_element,
 			    xml_name_read_text, NULL, NULL};
-    GMarkupParseContext *context;
-    gchar *file_contents;
-    gsize length;
+    XmlCacheContents contents;
     GError *error = NULL;
     gchar buf[SMALL];
 
     sprintf(buf, "player_names_%s.xml", sid);
     file_name = file_find_support_file(buf, TRUE);
 
-    context = 
-	g_markup_parse_context_new(&parser, 0, NULL, NULL);
-
-    if(!g_file_get_contents(file_name, &file_contents, &length, &error))
+    if(!xml_cache_get_contents(file_name, &contents, &error))
     {
 	debug_print_message("xml_name_read: error reading file %s\n", file_name);
 	misc_print_error(&error, TRUE);
@@ -152,13 +150,7 @@ xml_name_read(const gchar *sid, NameList *namelist)
 
     nlist = namelist;
 
-    if(g_markup_parse_context_parse(context, file_contents, length, &error))
-    {
-	g_markup_parse_context_end_parse(context, NULL);	
-	g_markup_parse_context_free(context);
-	g_free(file_contents);
-    }
-    else
+    if(!xml_cache_parse(&contents, &parser, NULL, &error))
     {
 	g_critical("xml_name_read: error parsing file %s\n", buf);
 	misc_print_error(&error, TRUE);
@@ -26,6 +26,7 @@
 #include "free.h"
 #include "news.h"
 #include "misc.h"
+#include "token.h"
 #include "variables.h"
 #include "xml_news.h"
 
@@ -186,6 +187,8 @@ xml_news_read_end_element    (GMarkupParseContext *context,
     if(strcmp(element_name, TAG_ARTICLE) == 0)
     {
      	state = STATE_NEWS;
+        new_article.parsed_condition =
+            token_condition_compile(new_article.condition);
         g_array_append_val(news[article_idx], new_article);
     }
     else if(strcmp(element_name, TAG_ARTICLE_TYPE) == 0 ||
@@ -233,11 +236,17 @@ xml_news_read_text         (GMarkupParseContext *context,
     else if(state == STATE_ARTICLE_TITLE)
     {
         new_title.text = g_strdup(buf);
+        new_title.parsed_text = token_text_compile(buf);
+        new_title.parsed_condition =
+            token_condition_compile(new_title.condition);
         g_array_append_val(new_article.titles, new_title);
     }
     else if(state == STATE_ARTICLE_SUBTITLE)
     {
         new_subtitle.text = g_strdup(buf);
+        new_subtitle.parsed_text = token_text_compile(buf);
+        new_subtitle.parsed_condition =
+            token_condition_compile(new_subtitle.condition);
         g_array_append_val(new_article.subtitles, new_subtitle);
     }
 }
@@ -27,10 +27,12 @@
 #include "free.h"
 #include "main.h"
 #include "misc.h"
+#include "name.h"
 #include "option.h"
 #include "player.h"
 #include "team.h"
 #include "variables.h"
+#include "xml_cache.h"
 #include "xml_team.h"
 
 /**
@@ -116,7 +118,7 @@ xml_team_read_start_element (GMarkupParseContext *context,
     {
 	team_user_data->state = STATE_PLAYER;
 	team_user_data->new_player = player_new(team_user_data->team, ((gfloat)team_user_data->team->average_talent / 10000) * 
-				const_float_fast(float_player_max_skill), TRUE);
+				const_float(float_player_max_skill), TRUE);
     }
     else if(strcmp(element_name, TAG_PLAYER_NAME) == 0)
 	team_user_data->state = STATE_PLAYER_NAME;
@@ -164,12 +166,12 @@ xml_team_read_end_element    (GMarkupParseContext *context,
 	team_user_data->state = STATE_TEAM;
 	if(strcmp(element_name, TAG_PLAYER) == 0)
 	{
-	    if(team_user_data->team->players->len == const_int("int_team_cpu_players"))
+	    if(team_user_data->team->players->len == const_int(int_team_cpu_players))
 	    {
 		free_player(&team_user_data->new_player);
 		main_exit_program(EXIT_LOAD_TEAM_DEF, 
 				  "xml_team_read_end_element: too many players in team definition '%s' (only %d allowed).",
-				  team_user_data->d_file, const_int("int_team_cpu_players"));
+				  team_user_data->d_file, const_int(int_team_cpu_players));
 	    }
 	    else
 		g_array_append_val(team_user_data->team->players, team_user_data->new_player);
@@ -216,7 +218,7 @@ xml_team_read_text         (GMarkupParseContext *context,
     float_value = (gfloat)g_ascii_strtod(buf, NULL);
 
     if(team_user_data->state == STATE_TEAM_NAME)
-	misc_string_assign(&team_user_data->team->name, buf);
+	team_user_data->team->name = name_intern(buf);
     else if(team_user_data->state == STATE_STADIUM_NAME)
     {
 	g_free(team_user_data->team->stadium.name);
@@ -224,9 +226,9 @@ xml_team_read_text         (GMarkupParseContext *context,
     }
     else if(team_user_data->state == STATE_SYMBOL)
 	misc_string_assign(&team_user_data->team->symbol, buf);
-    else if(team_user_data->state == STATE_AVERAGE_TALENT && opt_int("int_opt_load_defs") == 1)
+    else if(team_user_data->state == STATE_AVERAGE_TALENT && opt_int(int_opt_load_defs) == 1)
 	team_user_data->team->average_talent = 
-	    (float_value / 10000) * const_float_fast(float_player_max_skill);
+	    (float_value / 10000) * const_float(float_player_max_skill);
     else if(team_user_data->state == STATE_FORMATION)
 	team_user_data->team->structure = int_value;
     else if(team_user_data->state == STATE_NAMES_FILE)
@@ -236,17 +238,17 @@ xml_team_read_text         (GMarkupParseContext *context,
     else if(team_user_data->state == STATE_RESERVE_LEVEL)
 	team_user_data->team->reserve_level = int_value;
     else if(team_user_data->state == STATE_PLAYER_NAME)
-	misc_string_assign(&team_user_data->new_player.name, buf);
-    else if(team_user_data->state == STATE_PLAYER_BIRTH_YEAR && opt_int("int_opt_load_defs") == 1)
+	team_user_data->new_player.name = name_intern(buf);
+    else if(team_user_data->state == STATE_PLAYER_BIRTH_YEAR && opt_int(int_opt_load_defs) == 1)
 	team_user_data->birth_year = int_value;
-    else if(team_user_data->state == STATE_PLAYER_BIRTH_MONTH && opt_int("int_opt_load_defs") == 1)
+    else if(team_user_data->state == STATE_PLAYER_BIRTH_MONTH && opt_int(int_opt_load_defs) == 1)
 	team_user_data->new_player.age = misc_get_age_from_birth(team_user_data->birth_year, int_value);
-    else if(team_user_data->state == STATE_PLAYER_SKILL && opt_int("int_opt_load_defs") == 1)
+    else if(team_user_data->state == STATE_PLAYER_SKILL && opt_int(int_opt_load_defs) == 1)
 	team_user_data->new_player.skill = ((gfloat)int_value / 10000) * 
-	    const_float_fast(float_player_max_skill);
-    else if(team_user_data->state == STATE_PLAYER_TALENT && opt_int("int_opt_load_defs") == 1)
+	    const_float(float_player_max_skill);
+    else if(team_user_data->state == STATE_PLAYER_TALENT && opt_int(int_opt_load_defs) == 1)
 	team_user_data->new_player.talent = ((gfloat)int_value / 10000) * 
-	    const_float_fast(float_player_max_skill);
+	    const_float(float_player_max_skill);
     else if(team_user_data->state == STATE_PLAYER_POSITION)
 	team_user_data->new_player.pos = int_value;
 }
@@ -262,9 +264,7 @@ xml_team_read(Team *tm, const gchar *def_file)
     GMarkupParser parser = {xml_team_read_start_element,
 			    xml_team_read_end_element,
 			    xml_team_read_text, NULL, NULL};
-    GMarkupParseContext *context;
-    gchar *file_contents;
-    gsize length;
+    XmlCacheContents contents;
     GError *error = NULL;
     TeamUserData user_data;
 
@@ -273,23 +273,14 @@ xml_team_read(Team *tm, const gchar *def_file)
     user_data.team = tm;
     user_data.d_file = def_file;
 
-    context = 
-	g_markup_parse_context_new(&parser, 0, &user_data, NULL);
-
-    if(!g_file_get_contents(def_file, &file_contents, &length, &error))
+    if(!xml_cache_get_contents(def_file, &contents, &error))
     {
 	debug_print_message("xml_team_read: error reading file %s\n", def_file);
 	misc_print_error(&error, FALSE);
 	return;
     }
 
-    if(g_markup_parse_context_parse(context, file_contents, length, &error))
-    {
-	g_markup_parse_context_end_parse(context, NULL);	
-	g_markup_parse_context_free(context);
-	g_free(file_contents);
-    }
-    else
+    if(!xml_cache_parse(&contents, &parser, &user_data, &error))
     {
 	g_critical("xml_team_read: error parsing file %s\n", def_file);
 	misc_print_error(&error, TRUE);
@@ -42,8 +42,8 @@ youth_academy_new(User *user)
 #endif
 
     gint i;
-    gint num_of_youths = math_rndi(const_int("int_youth_academy_youths_lower"),
-				   const_int("int_youth_academy_youths_upper"));
+    gint num_of_youths = math_rndi(const_int(int_youth_academy_youths_lower),
+				   const_int(int_youth_academy_youths_upper));
 
     user->youth_academy.tm = user->tm;
     user->youth_academy.coach =
@@ -51,11 +51,11 @@ youth_academy_new(User *user)
     user->youth_academy.pos_pref = PLAYER_POS_ANY;
     user->youth_academy.percentage =
 	user->youth_academy.av_percentage =
-	const_int("int_youth_academy_default_percentage");
+	const_int(int_youth_academy_default_percentage);
 
     user->youth_academy.counter_youth =
-	math_rnd(const_float("float_youth_academy_youth_counter_lower"),
-		 const_float("float_youth_academy_youth_counter_upper"));
+	math_rnd(const_float(float_youth_academy_youth_counter_lower),
+		 const_float(float_youth_academy_youth_counter_upper));
 
     free_player_array(&user->youth_academy.players);
     user->youth_academy.players = g_array_new(FALSE, FALSE, sizeof(Player));
@@ -77,10 +77,10 @@ youth_academy_add_new_player(YouthAcademy *youth_academy)
 
     gint i;
     gfloat pos_probs[4] =
-	{const_float("float_youth_academy_pos_goalie"),
-	 const_float("float_youth_academy_pos_defender"),
-	 const_float("float_youth_academy_pos_midfielder"),
-	 const_float("float_youth_academy_pos_forward")};
+	{const_float(float_youth_academy_pos_goalie),
+	 const_float(float_youth_academy_pos_defender),
+	 const_float(float_youth_academy_pos_midfielder),
+	 const_float(float_youth_academy_pos_forward)};
     gfloat rndom;
     gfloat av_talent = team_get_average_talent(youth_academy->tm);
     gfloat percentage_coach_talent_factor;
@@ -93,7 +93,7 @@ youth_academy_add_new_player(YouthAcademy *youth_academy)
     for(i=0;i<4;i++)
     {
 	if(i == youth_academy->pos_pref)
-	    pos_probs[i] += (const_float("float_youth_academy_coach_search_addition") *
+	    pos_probs[i] += (const_float(float_youth_academy_coach_search_addition) *
 			     (gfloat)(QUALITY_END - youth_academy->coach));
 	if(i > 0)
 	    pos_probs[i] += pos_probs[i - 1];
@@ -108,58 +108,59 @@ youth_academy_add_new_player(YouthAcademy *youth_academy)
 	}
 
     new.cpos = new.pos;
-    new.age = math_rnd(const_float("float_youth_academy_age_lower"),
-		       const_float("float_youth_academy_age_upper"));
+    new.age = math_rnd(const_float(float_youth_academy_age_lower),
+		       const_float(float_youth_academy_age_upper));
     new.peak_age =
-	math_rnd(const_float("float_player_peak_age_lower") +
+	math_rnd(const_float(float_player_peak_age_lower) +
 		 (new.pos == PLAYER_POS_GOALIE) *
-		 const_float("float_player_peak_age_goalie_addition"),
-		 const_float("float_player_peak_age_upper") +
+		 const_float(float_player_peak_age_goalie_addition),
+		 const_float(float_player_peak_age_upper) +
 		 (new.pos == PLAYER_POS_GOALIE) *
-		 const_float("float_player_peak_age_goalie_addition"));
+		 const_float(float_player_peak_age_goalie_addition));
 
     /* Argument for the talent factor function, depending on average coach and
 	percentage values (weighted). */
     percentage_coach_talent_factor = (4 - youth_academy->av_coach) *
-	(gfloat)const_int("int_youth_academy_max_percentage") *
-	const_float("float_youth_academy_coach_weight") * 0.25 +
+	(gfloat)const_int(int_youth_academy_max_percentage) *
+	const_float(float_youth_academy_coach_weight) * 0.25 +
 	youth_academy->av_percentage;
 
     /* Applying the talent factor funtion leading to a factor between
        float_youth_academy_talent_factor_lower and _upper */
     percentage_coach_talent_factor =
-	((const_float("float_youth_academy_talent_factor_upper") -
-	  const_float("float_youth_academy_talent_factor_lower")) /
-	 ((gfloat)const_int("int_youth_academy_max_percentage") *
-	  (1 + const_float("float_youth_academy_coach_weight")))) *
+	((const_float(float_youth_academy_talent_factor_upper) -
+	  const_float(float_youth_academy_talent_factor_lower)) /
+	 ((gfloat)const_int(int_youth_academy_max_percentage) *
+	  (1 + const_float(float_youth_academy_coach_weight)))) *
 	percentage_coach_talent_factor +
-	const_float("float_youth_academy_talent_factor_lower");
+	const_float(float_youth_academy_talent_factor_lower);
 
     new.talent = math_gauss_dist(
 	percentage_coach_talent_factor * av_talent *
-	(1 - const_float("float_youth_academy_talent_variance")),
+	(1 - const_float(float_youth_academy_talent_variance)),
 	percentage_coach_talent_factor * av_talent *
-	(1 + const_float("float_youth_academy_talent_variance")));
+	(1 + const_float(float_youth_academy_talent_variance)));
 
     new.peak_region =
-	math_gauss_dist(const_float("float_player_peak_region_lower"),
-			const_float("float_player_peak_region_upper"));//2;
+	math_gauss_dist(const_float(float_player_peak_region_lower),
+			const_float(float_player_peak_region_upper));//2;
 
-    new.talent = CLAMP(new.talent, 0, const_float_fast(float_player_max_skill));
+    new.talent = CLAMP(new.talent, 0, const_float(float_player_max_skill));
     new.skill = player_skill_from_talent(&new);
     new.cskill = new.skill;
     player_estimate_talent(&new);
 
-    new.fitness = math_rnd(const_float("float_player_fitness_lower"),
-			   const_float("float_player_fitness_upper"));
+    new.fitness = math_rnd(const_float(float_player_fitness_lower),
+			   const_float(float_player_fitness_upper));
     new.health = new.recovery = 0;
     new.value = player_assign_value(&new);
     new.wage = player_assign_wage(&new);
-    new.contract = math_rnd(const_float("float_player_contract_lower"),
-			    const_float("float_player_contract_upper"));
-    new.lsu = math_rnd(const_float("float_player_lsu_lower"),
-		       const_float("float_player_lsu_upper"));
+    new.contract = math_rnd(const_float(float_player_contract_lower),
+			    const_float(float_player_contract_upper));
+    new.lsu = math_rnd(const_float(float_player_lsu_lower),
+		       const_float(float_player_lsu_upper));
     new.stats = g_array_new(FALSE, FALSE, sizeof(PlayerCompetitionStats));
+    new.stats_slots = NULL;
 
     for(i=0;i<PLAYER_VALUE_END;i++)
 	new.career[i] = 0;
@@ -185,7 +186,7 @@ youth_academy_update_weekly(Bygfoot *bygfoot)
     gint i, j;
     YouthAcademy *ya = NULL;
 
-    if(sett_int("int_opt_disable_ya"))
+    if(sett_int(int_opt_disable_ya))
 	return;
 
     for(i=0;i<users->len;i++)
@@ -206,15 +207,15 @@ youth_academy_update_weekly(Bygfoot *bygfoot)
 	    }
 
 	    if(g_array_index(ya->players, Player, j).age + 0.1 >
-	       const_float("float_player_age_lower") &&
+	       const_float(float_player_age_lower) &&
 	       g_array_index(ya->players, Player, j).age + 0.08 <=
-	       const_float("float_player_age_lower") &&
-               !sett_int("int_opt_goto_mode"))
+	       const_float(float_player_age_lower) &&
+               !sett_int(int_opt_goto_mode))
 		user_event_add(&usr(i), EVENT_TYPE_WARNING, -1, -1, NULL,
 			       _("Youth %s will be too old for the youth academy soon. Move him to your team or kick him out of the academy. Otherwise he'll probably look for another team to play in."), g_array_index(ya->players, Player, j).name);
-	    else if(g_array_index(ya->players, Player, j).age > const_float("float_player_age_lower"))
+	    else if(g_array_index(ya->players, Player, j).age > const_float(float_player_age_lower))
 	    {
-                if(!sett_int("int_opt_goto_mode"))
+                if(!sett_int(int_opt_goto_mode))
                     user_event_add(&usr(i), EVENT_TYPE_WARNING, -1, -1, NULL,
                                    _("Youth %s thought he's old enough for a real contract and left your youth academy."),
                                    g_array_index(ya->players, Player, j).name);
@@ -224,34 +225,34 @@ youth_academy_update_weekly(Bygfoot *bygfoot)
 	}
 
 	ya->av_coach =
-	    (ya->av_coach * const_float("float_youth_academy_average_weight") +
+	    (ya->av_coach * const_float(float_youth_academy_average_weight) +
 	     (gfloat)ya->coach) /
-	    (const_float("float_youth_academy_average_weight") + 1);
+	    (const_float(float_youth_academy_average_weight) + 1);
 
 	ya->av_percentage =
-	    (ya->av_percentage * const_float("float_youth_academy_average_weight") +
+	    (ya->av_percentage * const_float(float_youth_academy_average_weight) +
 	     (gfloat)ya->percentage) /
-	    (const_float("float_youth_academy_average_weight") + 1);
+	    (const_float(float_youth_academy_average_weight) + 1);
 
 	if(ya->percentage > 0)
 	{
 	    ya->counter_youth -=
-		((1 / (gfloat)const_int("int_youth_academy_max_percentage")) *
-		 ya->av_percentage + const_float("float_youth_academy_counter_decrease_min"));
+		((1 / (gfloat)const_int(int_youth_academy_max_percentage)) *
+		 ya->av_percentage + const_float(float_youth_academy_counter_decrease_min));
 
 	    if(ya->counter_youth <= 0)
 	    {
-		ya->counter_youth = math_rnd(const_float("float_youth_academy_youth_counter_lower"),
-					     const_float("float_youth_academy_youth_counter_upper"));
-		if(ya->players->len < const_int("int_youth_academy_max_youths"))
+		ya->counter_youth = math_rnd(const_float(float_youth_academy_youth_counter_lower),
+					     const_float(float_youth_academy_youth_counter_upper));
+		if(ya->players->len < const_int(int_youth_academy_max_youths))
 		{
 		    youth_academy_add_new_player(ya);
 
-                    if(!sett_int("int_opt_goto_mode"))
+                    if(!sett_int(int_opt_goto_mode))
                         user_event_add(&usr(i), EVENT_TYPE_WARNING, -1, -1, NULL,
                                        _("A new youth registered at your youth academy."));
 		}
-		else if(!sett_int("int_opt_goto_mode"))
+		else if(!sett_int(int_opt_goto_mode))
 		    user_event_add(&usr(i), EVENT_TYPE_WARNING, -1, -1, NULL,
 				   _("A new youth wanted to registered at your youth academy but there was no room for him."));
 	    }
@@ -774,6 +774,55 @@ extern int ZEXPORT unzLocateFile (unzFile file, const char *szFileName, int iCas
 }
 
 
+/*
+///////////////////////////////////////////
+// Contributed by Ryan Haksi (mailto://cryogen@infoserve.net)
+// I need random access
+//
+// Further optimization could be realized by adding an ability
+// to cache the directory in memory. The goal being a single
+// comprehensive file read to put the file I need in a memory.
+*/
+
+extern int ZEXPORT unzGetFilePos (unzFile file, unz_file_pos* file_pos)
+{
+	unz_s* s;
+
+	if (file==NULL || file_pos==NULL)
+		return UNZ_PARAMERROR;
+	s=(unz_s*)file;
+	if (!s->current_file_ok)
+		return UNZ_END_OF_LIST_OF_FILE;
+
+	file_pos->pos_in_zip_directory  = s->pos_in_central_dir;
+	file_pos->num_of_file           = s->num_file;
+
+	return UNZ_OK;
+}
+
+extern int ZEXPORT unzGoToFilePos (unzFile file, unz_file_pos* file_pos)
+{
+	unz_s* s;
+	int err;
+
+	if (file==NULL || file_pos==NULL)
+		return UNZ_PARAMERROR;
+	s=(unz_s*)file;
+
+	/* jump to the right spot */
+	s->pos_in_central_dir = file_pos->pos_in_zip_directory;
+	s->num_file           = file_pos->num_of_file;
+
+	/* set the current file */
+	err = unzlocal_GetCurrentFileInfoInternal(file,&s->cur_file_info,
+											   &s->cur_file_info_internal,
+											   NULL,0,NULL,0,NULL,0);
+	/* return results */
+	s->current_file_ok = (err == UNZ_OK);
+	return err;
+}
+
+
 /*
   Read the local header of the current zipfile
   Check the coherency of the local header and info in the end of central
@@ -189,6 +189,28 @@ extern int ZEXPORT unzLocateFile (unzFile file,
 */
 
 
+/* ****************************************** */
+/* Ryan supplied functions */
+typedef struct unz_file_pos_s
+{
+    uLong pos_in_zip_directory;   /* offset in zip file directory */
+    uLong num_of_file;            /* # of file */
+} unz_file_pos;
+
+extern int ZEXPORT unzGetFilePos (unzFile file,
+				     unz_file_pos* file_pos);
+/*
+  Store the position of the current file in file_pos.
+*/
+
+extern int ZEXPORT unzGoToFilePos (unzFile file,
+				      unz_file_pos* file_pos);
+/*
+  Make the file stored at file_pos (see unzGetFilePos) the current
+  file, without scanning the central directory like unzLocateFile.
+*/
+
+
 extern int ZEXPORT unzGetCurrentFileInfo (unzFile file,
 					     unz_file_info *pfile_info,
 					     char *szFileName,
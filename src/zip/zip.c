@@ -113,6 +113,7 @@ typedef struct
     Byte buffered_data[Z_BUFSIZE];/* buffer contain compressed data to be writ*/
     uLong dosDate;
     uLong crc32;
+    int raw;                    /* 1 if the data gets written already compressed */
 } curfile_info;
 
 typedef struct
@@ -315,7 +316,7 @@ extern zipFile ZEXPORT zipOpen (const char *pathname, int append)
     return (zipFile)zi;
 }
 
-extern int ZEXPORT zipOpenNewFileInZip (zipFile file,
+extern int ZEXPORT zipOpenNewFileInZip2 (zipFile file,
 					   const char* filename,
 					   const zip_fileinfo* zipfi,
 					   const void* extrafield_local,
@@ -324,7 +325,8 @@ extern int ZEXPORT zipOpenNewFileInZip (zipFile file,
 					   uInt size_extrafield_global,
 					   const char* comment,
 					   int method,
-					   int level)
+					   int level,
+					   int raw)
 {
     zip_internal* zi;
     uInt size_filename;
@@ -376,6 +378,7 @@ extern int ZEXPORT zipOpenNewFileInZip (zipFile file,
 
     zi->ci.crc32 = 0;
     zi->ci.method = method;
+    zi->ci.raw = raw;
     zi->ci.stream_initialised = 0;
     zi->ci.pos_in_buffered_data = 0;
     zi->ci.pos_local_header = ftell(zi->filezip);
@@ -465,7 +468,7 @@ extern int ZEXPORT zipOpenNewFileInZip (zipFile file,
     zi->ci.stream.total_in = 0;
     zi->ci.stream.total_out = 0;
 
-    if ((err==ZIP_OK) && (zi->ci.method == Z_DEFLATED))
+    if ((err==ZIP_OK) && (zi->ci.method == Z_DEFLATED) && (!zi->ci.raw))
     {
         zi->ci.stream.zalloc = (alloc_func)0;
         zi->ci.stream.zfree = (free_func)0;
@@ -484,6 +487,23 @@ extern int ZEXPORT zipOpenNewFileInZip (zipFile file,
     return err;
 }
 
+extern int ZEXPORT zipOpenNewFileInZip (zipFile file,
+					   const char* filename,
+					   const zip_fileinfo* zipfi,
+					   const void* extrafield_local,
+					   uInt size_extrafield_local,
+					   const void* extrafield_global,
+					   uInt size_extrafield_global,
+					   const char* comment,
+					   int method,
+					   int level)
+{
+    return zipOpenNewFileInZip2 (file, filename, zipfi,
+                                 extrafield_local, size_extrafield_local,
+                                 extrafield_global, size_extrafield_global,
+                                 comment, method, level, 0);
+}
+
 extern int ZEXPORT zipWriteInFileInZip (zipFile file, const voidp buf, unsigned len)
 {
     zip_internal* zi;
@@ -512,7 +532,7 @@ extern int ZEXPORT zipWriteInFileInZip (zipFile file, const voidp buf, unsigned
             zi->ci.stream.next_out = zi->ci.buffered_data;
         }
 
-        if (zi->ci.method == Z_DEFLATED)
+        if ((zi->ci.method == Z_DEFLATED) && (!zi->ci.raw))
         {
             uLong uTotalOutBefore = zi->ci.stream.total_out;
             err=deflate(&zi->ci.stream,  Z_NO_FLUSH);
@@ -544,7 +564,9 @@ extern int ZEXPORT zipWriteInFileInZip (zipFile file, const voidp buf, unsigned
     return 0;
 }
 
-extern int ZEXPORT zipCloseFileInZip (zipFile file)
+extern int ZEXPORT zipCloseFileInZipRaw (zipFile file,
+					    uLong uncompressed_size,
+					    uLong crc32)
 {
     zip_internal* zi;
     int err=ZIP_OK;
@@ -557,7 +579,7 @@ extern int ZEXPORT zipCloseFileInZip (zipFile file)
         return ZIP_PARAMERROR;
     zi->ci.stream.avail_in = 0;
     
-    if (zi->ci.method == Z_DEFLATED)
+    if ((zi->ci.method == Z_DEFLATED) && (!zi->ci.raw))
         while (err==ZIP_OK)
     {
         uLong uTotalOutBefore;
@@ -583,17 +605,23 @@ extern int ZEXPORT zipCloseFileInZip (zipFile file)
                                                                        !=1)
             err = ZIP_ERRNO;
 
-    if ((zi->ci.method == Z_DEFLATED) && (err==ZIP_OK))
+    if ((zi->ci.method == Z_DEFLATED) && (!zi->ci.raw) && (err==ZIP_OK))
     {
         err=deflateEnd(&zi->ci.stream);
         zi->ci.stream_initialised = 0;
     }
 
-    ziplocal_putValue_inmemory(zi->ci.central_header+16,(uLong)zi->ci.crc32,4); /*crc*/
+    if (!zi->ci.raw)
+    {
+        crc32 = (uLong)zi->ci.crc32;
+        uncompressed_size = (uLong)zi->ci.stream.total_in;
+    }
+
+    ziplocal_putValue_inmemory(zi->ci.central_header+16,crc32,4); /*crc*/
     ziplocal_putValue_inmemory(zi->ci.central_header+20,
                                 (uLong)zi->ci.stream.total_out,4); /*compr size*/
     ziplocal_putValue_inmemory(zi->ci.central_header+24,
-                                (uLong)zi->ci.stream.total_in,4); /*uncompr size*/
+                                uncompressed_size,4); /*uncompr size*/
 
     if (err==ZIP_OK)
         err = add_data_in_datablock(&zi->central_dir,zi->ci.central_header,
@@ -608,13 +636,13 @@ extern int ZEXPORT zipCloseFileInZip (zipFile file)
 		    err = ZIP_ERRNO;
 
         if (err==ZIP_OK)
-            err = ziplocal_putValue(zi->filezip,(uLong)zi->ci.crc32,4); /* crc 32, unknown */
+            err = ziplocal_putValue(zi->filezip,crc32,4); /* crc 32, unknown */
 
         if (err==ZIP_OK) /* compressed size, unknown */
             err = ziplocal_putValue(zi->filezip,(uLong)zi->ci.stream.total_out,4); 
 
         if (err==ZIP_OK) /* uncompressed size, unknown */
-            err = ziplocal_putValue(zi->filezip,(uLong)zi->ci.stream.total_in,4);
+            err = ziplocal_putValue(zi->filezip,uncompressed_size,4);
 
 	    if (fseek(zi->filezip,
                   cur_pos_inzip,SEEK_SET)!=0)
@@ -627,6 +655,11 @@ extern int ZEXPORT zipCloseFileInZip (zipFile file)
     return err;
 }
 
+extern int ZEXPORT zipCloseFileInZip (zipFile file)
+{
+    return zipCloseFileInZipRaw (file,0,0);
+}
+
 extern int ZEXPORT zipClose (zipFile file, const char* global_comment)
 {
     zip_internal* zi;
@@ -130,6 +130,23 @@ extern int ZEXPORT zipOpenNewFileInZip (zipFile file,
   level contain the level of compression (can be Z_DEFAULT_COMPRESSION)
 */
 
+extern int ZEXPORT zipOpenNewFileInZip2 (zipFile file,
+					    const char* filename,
+					    const zip_fileinfo* zipfi,
+					    const void* extrafield_local,
+					    uInt size_extrafield_local,
+					    const void* extrafield_global,
+					    uInt size_extrafield_global,
+					    const char* comment,
+					    int method,
+					    int level,
+					    int raw);
+/*
+  Same as zipOpenNewFileInZip, except if raw=1, we write raw file:
+  the data passed to zipWriteInFileInZip is already compressed
+  with the given method; close the file with zipCloseFileInZipRaw.
+*/
+
 extern int ZEXPORT zipWriteInFileInZip (zipFile file,
 					   const voidp buf,
 					   unsigned len);
@@ -142,6 +159,15 @@ extern int ZEXPORT zipCloseFileInZip (zipFile file);
   Close the current file in the zipfile
 */
 
+extern int ZEXPORT zipCloseFileInZipRaw (zipFile file,
+					    uLong uncompressed_size,
+					    uLong crc32);
+/*
+  Close the current file in the zipfile, for file opened with
+    parameter raw=1 in zipOpenNewFileInZip2
+  uncompressed_size and crc32 are value for the uncompressed size
+*/
+
 extern int ZEXPORT zipClose (zipFile file,
 				const char* global_comment);
 /*
@@ -12,6 +12,7 @@ cat <<EOF > $json_file
   { 'start_bygfoot' : {}},
   { 'simulate_games' : {'weeks' : 5}},
   { 'save_bygfoot' : {'filename' : '$save_dir/save0.zip'}},
+  { 'save_bygfoot' : {'filename' : '$save_dir/save0.bgb'}},
   { 'load_bygfoot' : {'filename' : '$save_dir/save0.zip'}},
   { 'save_bygfoot' : {'filename' : '$save_dir/save1.zip'}},
   { 'simulate_games' : {'years' : 1}},
@@ -26,8 +27,26 @@ tmphome=`mktemp -d`
 pushd $bygfoot_bindir
 HOME=$tmphome ./bygfoot --random-seed=1 --json=$json_file
 
+# Check the binary savegames: loading one and saving the game as .zip
+# must give the same files as saving the .zip directly, and loading a
+# broken one must leave the running game untouched.
+head -c 100000 $save_dir/save0.bgb > $save_dir/truncated.bgb
+echo "not a savegame" > $save_dir/invalid.bgb
+
+cat <<EOF > $json_file
+{ 'commands' : [
+  { 'load_bygfoot' : {'filename' : '$save_dir/save0.bgb'}},
+  { 'save_bygfoot' : {'filename' : '$save_dir/save4.zip'}},
+  { 'load_bygfoot' : {'filename' : '$save_dir/truncated.bgb'}},
+  { 'load_bygfoot' : {'filename' : '$save_dir/invalid.bgb'}},
+  { 'save_bygfoot' : {'filename' : '$save_dir/save5.zip'}},
+]}
+EOF
+
+HOME=$tmphome ./bygfoot --random-seed=1 --json=$json_file
+
 # Verify that the save file are identical.
-for f in save0 save1 save2 save3; do
+for f in save0 save1 save2 save3 save4 save5; do
 
     mkdir -p $save_dir/$f
     unzip -q $save_dir/$f.zip -d $save_dir/$f
@@ -39,6 +58,8 @@ for f in save0 save1 save2 save3; do
 done
 diff -r $save_dir/save0 $save_dir/save1
 diff -r $save_dir/save2 $save_dir/save3
+diff -r $save_dir/save0 $save_dir/save4
+diff -r $save_dir/save0 $save_dir/save5
 
 # Test that we can load the saves on start up.
 cat << EOF > $json_file
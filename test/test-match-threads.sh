@@ -0,0 +1,21 @@
+set -e
+
+bygfoot_bin=$1
+bygfoot_bindir=`dirname $bygfoot_bin`
+input_dir=`pwd`/`dirname "$0"`
+
+out_dir=`mktemp -d`
+
+echo $out_dir
+tmphome=`mktemp -d`
+pushd $bygfoot_bindir
+
+# The matches of a round get played on several threads, each fixture
+# with its own random stream. Check that the results don't depend on
+# the number of threads.
+for threads in 1 4; do
+    HOME=$tmphome ./bygfoot --random-seed=1 --match-threads=$threads \
+        --json=$input_dir/verify-fast.json > $out_dir/threads$threads.json
+done
+
+cmp $out_dir/threads1.json $out_dir/threads4.json
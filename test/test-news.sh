@@ -0,0 +1,57 @@
+set -e
+
+bygfoot_bin=$1
+bygfoot_bindir=`dirname $bygfoot_bin`
+
+json_file=`mktemp`
+save_dir=`mktemp -d`
+support_dir=`mktemp -d`
+
+# The layers of teams from different countries can't be compared, so
+# the layer difference is 0 in international cups, even if both teams
+# come from the same country. Use a news file that only writes
+# articles about international cup matches and shows the layers.
+cat <<EOF > $support_dir/news_en.xml
+<?xml version="1.0" encoding="UTF-8"?>
+<news>
+EOF
+# Articles don't get repeated within the last 10 ones.
+for i in `seq 12`; do
+    cat <<EOF >> $support_dir/news_en.xml
+  <news_article>
+    <type>match</type>
+    <condition>_CUPINTERNATIONAL_ = 1</condition>
+    <title>layerdiff _TLAYERDIFF_ layers _TLAYER0_ _TLAYER1_</title>
+    <subtitle>_T0_ - _T1_</subtitle>
+  </news_article>
+EOF
+done
+echo "</news>" >> $support_dir/news_en.xml
+
+# With this seed two English teams from different layers meet in
+# an international cup in week 19.
+cat <<EOF > $json_file
+{ 'commands' : [
+  { 'add_country' : { 'name' : 'england' }},
+  { 'start_bygfoot' : {}},
+  { 'simulate_games' : {'weeks' : 20}},
+  { 'save_bygfoot' : {'filename' : '$save_dir/save0.zip'}},
+]}
+EOF
+
+echo $save_dir
+tmphome=`mktemp -d`
+pushd $bygfoot_bindir
+HOME=$tmphome ./bygfoot --random-seed=1 --lang=en --support-dir=$support_dir \
+    --json=$json_file
+
+unzip -p $save_dir/save0.zip '*___newspaper.xml' | \
+    grep -o "layerdiff [0-9]* layers [0-9]* [0-9]*" > $save_dir/titles.txt
+cat $save_dir/titles.txt
+
+if ! grep -q -v "layers \([0-9]*\) \1$" $save_dir/titles.txt; then
+    echo "No international cup match between teams from different layers."
+    exit 1
+fi
+
+! grep -v "layerdiff 0 " $save_dir/titles.txt
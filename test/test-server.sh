@@ -0,0 +1,86 @@
+set -e
+
+bygfoot_bin=$1
+bygfoot_bindir=`dirname $bygfoot_bin`
+
+out_file=`mktemp`
+client_file=`mktemp`
+save_dir=`mktemp -d`
+
+echo $save_dir
+tmphome=`mktemp -d`
+pushd $bygfoot_bindir
+
+# Requests on stdin, one per line. A malformed request and an unknown
+# command get a { "done" : false } answer, and the server goes on.
+HOME=$tmphome ./bygfoot --random-seed=1 --server > $out_file <<EOF
+{ 'add_country' : { 'name' : 'faroe_islands' }}
+{ 'start_bygfoot' : {}}
+{ 'simulate_games' : { 'weeks' :
+{ 'no_such_command' : {}}
+{ 'simulate_games' : { 'weeks' : 1 }}
+{ 'commands' : [ { 'save_bygfoot' : {'filename' : '$save_dir/save0.zip'}} ]}
+{ 'quit' : {}}
+EOF
+
+done_replies=`grep -o '"done" : [a-z]*' $out_file | cut -d' ' -f3 | tr '\n' ' '`
+echo $done_replies
+test "$done_replies" = "true true false false true true true "
+test -f $save_dir/save0.zip
+
+# Requests over the socket. One client goes away in the middle of
+# a request, another one before reading the answer; the server has
+# to keep answering the following clients.
+cat <<'EOF' > $client_file
+import re
+import socket
+import sys
+
+path, save_file = sys.argv[1:]
+
+def connect():
+    sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    # The server takes one client after the other, so this
+    # blocks until it's done with the previous ones.
+    sock.connect(path)
+    sock.settimeout(600)
+    return sock
+
+def request(line):
+    sock = connect()
+    sock.sendall((line + "\n").encode())
+    reply = ""
+    while not re.search(r'\{ "done" : (true|false) \}\n', reply):
+        data = sock.recv(4096)
+        if not data:
+            sys.exit("connection closed before the answer to " + line)
+        reply += data.decode()
+    sock.close()
+    if '{ "done" : true }' not in reply:
+        sys.exit("request failed: " + line)
+
+request("{ 'commands' : [ { 'add_country' : { 'name' : 'faroe_islands' }}, "
+        "{ 'start_bygfoot' : {}} ]}")
+
+sock = connect()
+sock.sendall(b"{ 'simulate_games' : { 'weeks'")
+sock.close()
+
+sock = connect()
+sock.sendall(b"{ 'simulate_games' : { 'weeks' : 2 }}\n")
+sock.close()
+
+request("{ 'save_bygfoot' : { 'filename' : '%s' }}" % save_file)
+request("{ 'quit' : {}}")
+EOF
+
+HOME=$tmphome ./bygfoot --random-seed=1 --socket=$save_dir/socket &
+server_pid=$!
+for i in `seq 100`; do
+    test -S $save_dir/socket && break
+    sleep 0.1
+done
+
+python3 $client_file $save_dir/socket $save_dir/save1.zip
+wait $server_pid
+test -f $save_dir/save1.zip
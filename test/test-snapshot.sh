@@ -0,0 +1,61 @@
+set -e
+
+bygfoot_bin=$1
+bygfoot_bindir=`dirname $bygfoot_bin`
+
+json_file=`mktemp`
+save_dir=`mktemp -d`
+
+# The straight run.
+cat <<EOF > $json_file
+{ 'commands' : [
+  { 'add_country' : { 'name' : 'faroe_islands' }},
+  { 'start_bygfoot' : {}},
+  { 'simulate_games' : {'weeks' : 5}},
+  { 'save_bygfoot' : {'filename' : '$save_dir/straight0.zip'}},
+  { 'simulate_games' : {'years' : 1}},
+  { 'save_bygfoot' : {'filename' : '$save_dir/straight1.zip'}},
+]}
+EOF
+
+echo $save_dir
+tmphome=`mktemp -d`
+pushd $bygfoot_bindir
+HOME=$tmphome ./bygfoot --random-seed=1 --json=$json_file
+
+# The same with a snapshot taken after 5 weeks, a branch that gets
+# thrown away and two restores. The snapshot holds the state of the
+# random number generator, too, so each restore has to give the same
+# game as the straight run.
+cat <<EOF > $json_file
+{ 'commands' : [
+  { 'add_country' : { 'name' : 'faroe_islands' }},
+  { 'start_bygfoot' : {}},
+  { 'simulate_games' : {'weeks' : 5}},
+  { 'snapshot' : {'name' : 'week5'}},
+  { 'simulate_games' : {'weeks' : 10}},
+  { 'restore' : {'name' : 'week5'}},
+  { 'save_bygfoot' : {'filename' : '$save_dir/restored0.zip'}},
+  { 'simulate_games' : {'years' : 1}},
+  { 'save_bygfoot' : {'filename' : '$save_dir/restored1.zip'}},
+  { 'restore' : {'name' : 'week5'}},
+  { 'simulate_games' : {'years' : 1}},
+  { 'save_bygfoot' : {'filename' : '$save_dir/restored2.zip'}},
+]}
+EOF
+
+HOME=$tmphome ./bygfoot --random-seed=1 --json=$json_file
+
+for f in straight0 straight1 restored0 restored1 restored2; do
+
+    mkdir -p $save_dir/$f
+    unzip -q $save_dir/$f.zip -d $save_dir/$f
+    sed -i "s/${f}___//g" $save_dir/$f/*
+    for file in `ls $save_dir/$f`; do
+        new_name=`echo $file | sed "s/${f}___//g"`
+        mv $save_dir/$f/$file $save_dir/$f/$new_name
+    done
+done
+diff -r $save_dir/straight0 $save_dir/restored0
+diff -r $save_dir/straight1 $save_dir/restored1
+diff -r $save_dir/straight1 $save_dir/restored2